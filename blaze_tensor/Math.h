@@ -44,11 +44,14 @@
 #include <blaze/Math.h>
 
 #include <blaze_tensor/math/Aliases.h>
+#include <blaze_tensor/math/CircularTensor.h>
 #include <blaze_tensor/math/Constraints.h>
 #include <blaze_tensor/math/CustomArray.h>
 #include <blaze_tensor/math/CustomTensor.h>
 #include <blaze_tensor/math/DynamicArray.h>
 #include <blaze_tensor/math/DynamicTensor.h>
+#include <blaze_tensor/math/QuantizedTensor.h>
+#include <blaze_tensor/math/Serialization.h>
 #include <blaze_tensor/math/UniformTensor.h>
 #include <blaze_tensor/math/StaticTensor.h>
 #include <blaze_tensor/math/TypeTraits.h>
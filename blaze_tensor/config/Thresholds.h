@@ -109,6 +109,34 @@
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief SMP dense array assignment threshold.
+// \ingroup config
+//
+// This threshold specifies when an assignment with a simple dense array can be executed in
+// parallel. In case the number of elements of the target array is larger or equal to this
+// threshold, the operation is executed in parallel. If the number of elements is below this
+// threshold the operation is executed single-threaded. In contrast to dense tensors, the
+// elements of dense arrays are accessed element by element via their multi-dimensional index,
+// which is why this threshold can be tuned independently of BLAZE_SMP_DTENSASSIGN_THRESHOLD.
+//
+// The default setting for this threshold is 48400. In case the threshold is set to 0, the
+// operation is unconditionally executed in parallel.
+//
+// \note It is possible to specify this threshold via command line or by defining this symbol
+// manually before including any Blaze header file:
+
+   \code
+   #define BLAZE_SMP_DARRASSIGN_THRESHOLD 48400UL
+   #include <blaze/Blaze.h>
+   \endcode
+*/
+#ifndef BLAZE_SMP_DARRASSIGN_THRESHOLD
+#define BLAZE_SMP_DARRASSIGN_THRESHOLD 48400UL
+#endif
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief SMP row-major dense matrix/dense vector multiplication threshold.
 // \ingroup config
@@ -176,3 +204,76 @@
 #define BLAZE_SMP_DTENSDMATSCHUR_THRESHOLD 36100UL
 #endif
 //*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  BATCHED LINEAR ALGEBRA THRESHOLDS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Batched dense tensor decomposition threshold.
+// \ingroup config
+//
+// This setting specifies the threshold between the application of the interleaved Blaze kernels
+// and the per-page LAPACK kernels for the batched decomposition, inversion and solution functions
+// of dense tensors (\c lu(), \c llh(), \c inv(), \c invert() and \c solve()). In case the order of
+// the (square) pages of the tensor is smaller than this value, several pages are processed at
+// once by the interleaved Blaze kernels (one page per SIMD lane). In case the order of the pages
+// is equal or higher, every page is processed by an individual LAPACK call.
+//
+// The default setting for this threshold is 16 (which corresponds to pages of size
+// \f$ 16 \times 16 \f$). Note that in case the Blaze debug mode is active, this threshold will
+// be replaced by the blaze::BATCHED_DECOMPOSITION_DEBUG_THRESHOLD value.
+//
+// \note It is possible to specify this threshold via command line or by defining this symbol
+// manually before including any Blaze header file:
+
+   \code
+   #define BLAZE_BATCHED_DECOMPOSITION_THRESHOLD 16UL
+   #include <blaze/Blaze.h>
+   \endcode
+*/
+#ifndef BLAZE_BATCHED_DECOMPOSITION_THRESHOLD
+#define BLAZE_BATCHED_DECOMPOSITION_THRESHOLD 16UL
+#endif
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  RUNTIME THRESHOLDS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Compilation switch for runtime tensor thresholds.
+// \ingroup config
+//
+// This compilation switch enables/disables runtime tensor thresholds. In case the switch is set
+// to 1, the tensor thresholds BLAZE_DTENSDVECMULT_THRESHOLD, BLAZE_SMP_DTENSASSIGN_THRESHOLD,
+// BLAZE_SMP_DTENSDVECMULT_THRESHOLD and BLAZE_SMP_DTENSDMATSCHUR_THRESHOLD are consulted at
+// runtime (e.g. by the \c canSMPAssign() functions of all tensors). They start with the compile
+// time values, which are replaced on first use by the values of the thresholds file named by
+// the \c BLAZE_TENSOR_THRESHOLDS environment variable (e.g. a header generated by the
+// \c blazemark_thresholds tuning tool). Additionally, the thresholds can be changed via
+// blaze::loadTensorThresholds() and blaze::setTensorThresholds(). In case the switch is set to
+// 0 (the default), all thresholds are compile time constants.
+//
+// \note It is possible to (de-)activate the runtime thresholds via command line or by defining
+// this symbol manually before including any Blaze header file:
+
+   \code
+   #define BLAZE_USE_RUNTIME_THRESHOLDS 1
+   #include <blaze/Blaze.h>
+   \endcode
+*/
+#ifndef BLAZE_USE_RUNTIME_THRESHOLDS
+#define BLAZE_USE_RUNTIME_THRESHOLDS 0
+#endif
+//*************************************************************************************************
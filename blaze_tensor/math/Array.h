@@ -65,6 +65,9 @@ namespace blaze {
 //@{
 template< typename MT >
 bool isUniform( const Array<MT>& m );
+
+template< typename MT >
+bool isZero( const Array<MT>& m );
 //@}
 //*************************************************************************************************
 
@@ -110,6 +113,30 @@ inline bool isUniform( const Array<MT>& t )
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Checks if the given array is a zero array.
+// \ingroup tensor
+//
+// \param t The array to be checked.
+// \return \a true if the array is a zero array, \a false if not.
+//
+// This function checks if the given array is a zero array, i.e. if all its elements are
+// zero. By default the elements are compared with relaxed semantics (blaze::relaxed). It is also
+// possible to request strict semantics (blaze::strict):
+
+   \code
+   if( isZero( A ) ) { ... }
+   if( isZero<strict>( A ) ) { ... }
+   \endcode
+*/
+template< typename MT > // Type of the array
+inline bool isZero( const Array<MT>& t )
+{
+   return isZero<relaxed>( *t );
+}
+//*************************************************************************************************
+
+
 //=================================================================================================
 //
 //  GLOBAL OPERATORS
@@ -117,7 +117,13 @@
 #include <blaze/math/views/Subvector.h>
 
 #include <blaze_tensor/math/Array.h>
+#include <blaze_tensor/math/dense/AccurateSum.h>
 #include <blaze_tensor/math/dense/DenseArray.h>
+#include <blaze_tensor/math/dense/FusedAssign.h>
+#include <blaze_tensor/math/dense/HalfPrecision.h>
+#include <blaze_tensor/math/dense/Normalization.h>
+#include <blaze_tensor/math/dense/ParallelRandom.h>
+#include <blaze_tensor/math/dense/Scan.h>
 // #include <blaze_tensor/math/expressions/DTensDTensAddExpr.h>
 #include <blaze_tensor/math/expressions/DArrDArrEqualExpr.h>
 #include <blaze_tensor/math/expressions/DArrDArrMapExpr.h>
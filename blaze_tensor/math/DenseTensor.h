@@ -122,7 +122,13 @@
 #include <blaze/math/views/Subvector.h>
 
 #include <blaze_tensor/math/Tensor.h>
+#include <blaze_tensor/math/dense/AccurateSum.h>
 #include <blaze_tensor/math/dense/DenseTensor.h>
+#include <blaze_tensor/math/dense/FusedAssign.h>
+#include <blaze_tensor/math/dense/HalfPrecision.h>
+#include <blaze_tensor/math/dense/Normalization.h>
+#include <blaze_tensor/math/dense/ParallelRandom.h>
+#include <blaze_tensor/math/dense/Scan.h>
 #include <blaze_tensor/math/expressions/DMatExpandExpr.h>
 #include <blaze_tensor/math/expressions/DMatRavelExpr.h>
 #include <blaze_tensor/math/expressions/DTensDMatSchurExpr.h>
@@ -139,6 +145,7 @@
 #include <blaze_tensor/math/expressions/DTensSerialExpr.h>
 #include <blaze_tensor/math/expressions/DTensTransExpr.h>
 #include <blaze_tensor/math/expressions/DenseTensor.h>
+#include <blaze_tensor/math/smp/AsyncAssign.h>
 #include <blaze_tensor/math/smp/DenseTensor.h>
 
 #endif
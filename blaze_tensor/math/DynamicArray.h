@@ -56,6 +56,7 @@
 
 #include <blaze_tensor/math/DenseArray.h>
 #include <blaze_tensor/math/dense/DynamicArray.h>
+#include <blaze_tensor/math/dense/Selection.h>
 #include <blaze_tensor/util/ArrayForEach.h>
 
 namespace blaze {
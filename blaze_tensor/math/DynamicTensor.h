@@ -44,7 +44,9 @@
 #include <blaze/math/DynamicMatrix.h>
 
 #include <blaze_tensor/math/DenseTensor.h>
+#include <blaze_tensor/math/dense/BatchedLinearAlgebra.h>
 #include <blaze_tensor/math/dense/DynamicTensor.h>
+#include <blaze_tensor/math/dense/Selection.h>
 
 namespace blaze {
 
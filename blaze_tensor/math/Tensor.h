@@ -63,6 +63,9 @@ namespace blaze {
 //@{
 template< typename MT >
 bool isUniform( const Tensor<MT>& m );
+
+template< typename MT >
+bool isZero( const Tensor<MT>& m );
 //@}
 //*************************************************************************************************
 
@@ -108,6 +111,30 @@ inline bool isUniform( const Tensor<MT>& t )
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Checks if the given tensor is a zero tensor.
+// \ingroup tensor
+//
+// \param t The tensor to be checked.
+// \return \a true if the tensor is a zero tensor, \a false if not.
+//
+// This function checks if the given tensor is a zero tensor, i.e. if all its elements are
+// zero. By default the elements are compared with relaxed semantics (blaze::relaxed). It is also
+// possible to request strict semantics (blaze::strict):
+
+   \code
+   if( isZero( A ) ) { ... }
+   if( isZero<strict>( A ) ) { ... }
+   \endcode
+*/
+template< typename MT > // Type of the tensor
+inline bool isZero( const Tensor<MT>& t )
+{
+   return isZero<relaxed>( *t );
+}
+//*************************************************************************************************
+
+
 //=================================================================================================
 //
 //  GLOBAL OPERATORS
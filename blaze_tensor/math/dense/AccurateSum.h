@@ -0,0 +1,1226 @@
+//=================================================================================================
+/*!
+//  \file blaze_tensor/math/dense/AccurateSum.h
+//  \brief Header file for the compensated and pairwise summation of dense tensors and arrays
+//
+//  Copyright (C) 2012-2018 Klaus Iglberger - All Rights Reserved
+//  Copyright (C) 2018 Hartmut Kaiser - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+
+#ifndef _BLAZE_TENSOR_MATH_DENSE_ACCURATESUM_H_
+#define _BLAZE_TENSOR_MATH_DENSE_ACCURATESUM_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <array>
+#include <utility>
+#include <vector>
+
+#include <blaze/math/Aliases.h>
+#include <blaze/math/SIMD.h>
+#include <blaze/math/functors/Abs.h>
+#include <blaze/math/functors/Add.h>
+#include <blaze/math/functors/Bind2nd.h>
+#include <blaze/math/functors/Noop.h>
+#include <blaze/math/functors/Pow.h>
+#include <blaze/math/functors/SqrAbs.h>
+#include <blaze/math/functors/Sqrt.h>
+#include <blaze/math/shims/Evaluate.h>
+#include <blaze/math/shims/Invert.h>
+#include <blaze/math/shims/IsZero.h>
+#include <blaze/math/smp/Functions.h>
+#include <blaze/math/smp/SerialSection.h>
+#include <blaze/math/traits/MultTrait.h>
+#include <blaze/math/typetraits/HasSIMDSub.h>
+#include <blaze/math/typetraits/IsPadded.h>
+#include <blaze/math/typetraits/UnderlyingBuiltin.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/FunctionTrace.h>
+#include <blaze/util/IntegralConstant.h>
+#include <blaze/util/StaticAssert.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/algorithms/Min.h>
+#include <blaze/util/typetraits/IsBaseOf.h>
+
+#include <blaze_tensor/math/expressions/DenseArray.h>
+#include <blaze_tensor/math/expressions/DenseTensor.h>
+#include <blaze_tensor/math/expressions/DTensNormExpr.h>
+#include <blaze_tensor/math/smp/ParallelFor.h>
+#include <blaze_tensor/system/Thresholds.h>
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  ACCUMULATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Kahan-compensated accumulator.
+// \ingroup dense_tensor
+//
+// The KahanSum class accumulates every single value with a running compensation of the rounding
+// error of the previous additions. The error of the final result is independent of the number
+// of accumulated values (as long as the compiler does not reassociate floating point operations,
+// i.e. \c -ffast-math must not be used).
+*/
+template< typename ET >  // Type of the accumulated values
+class KahanSum
+{
+ public:
+   //**Type definitions****************************************************************************
+   static constexpr bool elementwise = true;  //!< Values are accumulated one by one.
+   //**********************************************************************************************
+
+   //**Add function********************************************************************************
+   /*!\brief Adds the given value to the accumulator.
+   //
+   // \param value The value to be added.
+   // \return void
+   */
+   template< typename T >  // Type of the value
+   inline void add( const T& value ) {
+      const ET y( value - comp_ );
+      const ET t( sum_ + y );
+      comp_ = ( t - sum_ ) - y;
+      sum_ = t;
+   }
+   //**********************************************************************************************
+
+   //**Add function********************************************************************************
+   /*!\brief Folds the given SIMD sum and compensation vectors into the accumulator.
+   //
+   // \param sum The vector of partial sums.
+   // \param comp The vector of the compensations of the partial sums.
+   // \return void
+   */
+   template< typename ST >  // Type of the SIMD vectors
+   inline void add( const ST& sum, const ST& comp ) {
+      for( size_t i=0UL; i<ST::size; ++i ) {
+         add( sum[i] );
+         add( -comp[i] );
+      }
+   }
+   //**********************************************************************************************
+
+   //**Merge function******************************************************************************
+   /*!\brief Merges the partial result of another accumulator into this accumulator.
+   //
+   // \param other The other accumulator.
+   // \return void
+   */
+   inline void merge( const KahanSum& other ) {
+      add( other.sum_ );
+      add( -other.comp_ );
+   }
+   //**********************************************************************************************
+
+   //**Result function*****************************************************************************
+   /*!\brief Returns the compensated sum of all accumulated values.
+   //
+   // \return The compensated sum.
+   */
+   inline ET result() const {
+      return sum_ - comp_;
+   }
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   ET sum_ {};  //!< The running sum.
+   ET comp_{};  //!< The compensation of the rounding errors of the running sum.
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Pairwise accumulator.
+// \ingroup dense_tensor
+//
+// The PairwiseSum class accumulates the sums of consecutive blocks of values in a binary tree,
+// i.e. two partial sums are only added once they cover the same number of blocks. The tree is
+// stored as a binary counter, the \a i-th slot holding the sum of \f$ 2^i \f$ blocks. The error
+// of the final result grows with the logarithm of the number of accumulated blocks.
+*/
+template< typename ET >  // Type of the accumulated values
+class PairwiseSum
+{
+ public:
+   //**Type definitions****************************************************************************
+   static constexpr bool elementwise = false;  //!< Values are accumulated as block sums.
+   //**********************************************************************************************
+
+   //**Add function********************************************************************************
+   /*!\brief Adds the sum of the next block to the accumulator.
+   //
+   // \param value The sum of the block to be added.
+   // \return void
+   */
+   template< typename T >  // Type of the value
+   inline void add( const T& value ) {
+      ET sum( value );
+      size_t level( 0UL );
+      for( size_t count=count_; count & 1UL; count >>= 1UL, ++level ) {
+         sum = sums_[level] + sum;
+      }
+      sums_[level] = sum;
+      ++count_;
+   }
+   //**********************************************************************************************
+
+   //**Merge function******************************************************************************
+   /*!\brief Merges the partial result of another accumulator into this accumulator.
+   //
+   // \param other The other accumulator.
+   // \return void
+   */
+   inline void merge( const PairwiseSum& other ) {
+      add( other.result() );
+   }
+   //**********************************************************************************************
+
+   //**Result function*****************************************************************************
+   /*!\brief Returns the sum of all accumulated blocks.
+   //
+   // \return The pairwise sum.
+   */
+   inline ET result() const {
+      ET sum{};
+      for( size_t level=0UL; ( count_ >> level ) != 0UL; ++level ) {
+         if( ( count_ >> level ) & 1UL )
+            sum = sums_[level] + sum;
+      }
+      return sum;
+   }
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   std::array<ET,64UL> sums_{};  //!< The partial sums of the levels of the tree.
+   size_t count_{ 0UL };         //!< The number of accumulated blocks.
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Widening accumulator.
+// \ingroup dense_tensor
+//
+// The WidenedSum class accumulates the sums of consecutive blocks of values in the wider data
+// type \a AT. The blocks themselves are summed (and vectorized) in the element type, such that
+// the rounding error is bounded by the block size instead of growing with the number of values,
+// e.g. single precision tensors can be summed without converting the entire tensor to double.
+*/
+template< typename AT >  // Type of the accumulation
+class WidenedSum
+{
+ public:
+   //**Type definitions****************************************************************************
+   static constexpr bool elementwise = false;  //!< Values are accumulated as block sums.
+   //**********************************************************************************************
+
+   //**Add function********************************************************************************
+   /*!\brief Adds the sum of the next block to the accumulator.
+   //
+   // \param value The sum of the block to be added.
+   // \return void
+   */
+   template< typename T >  // Type of the value
+   inline void add( const T& value ) {
+      sum_ += AT( value );
+   }
+   //**********************************************************************************************
+
+   //**Merge function******************************************************************************
+   /*!\brief Merges the partial result of another accumulator into this accumulator.
+   //
+   // \param other The other accumulator.
+   // \return void
+   */
+   inline void merge( const WidenedSum& other ) {
+      sum_ += other.sum_;
+   }
+   //**********************************************************************************************
+
+   //**Result function*****************************************************************************
+   /*!\brief Returns the sum of all accumulated blocks.
+   //
+   // \return The widened sum.
+   */
+   inline AT result() const {
+      return sum_;
+   }
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   AT sum_{};  //!< The running sum.
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SUMMATION MODES
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Base class of all summation modes.
+// \ingroup dense_tensor
+*/
+struct SummationMode
+{};
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Summation mode for the Kahan-compensated summation (see blaze::kahan).
+// \ingroup dense_tensor
+*/
+struct KahanSummation
+   : public SummationMode
+{
+   template< typename ET >
+   using Accumulator = KahanSum<ET>;
+};
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Summation mode for the pairwise summation (see blaze::pairwise).
+// \ingroup dense_tensor
+*/
+struct PairwiseSummation
+   : public SummationMode
+{
+   template< typename ET >
+   using Accumulator = PairwiseSum<ET>;
+};
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Summation mode for the summation in a wider data type (see blaze::widened).
+// \ingroup dense_tensor
+*/
+template< typename AT >  // Type of the accumulation
+struct WidenedSummation
+   : public SummationMode
+{
+   template< typename ET >
+   using Accumulator = WidenedSum<AT>;
+};
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Selects the Kahan-compensated summation.
+// \ingroup dense_tensor
+//
+// All values are accumulated with a running compensation of the rounding errors (in several
+// SIMD lanes and, for large operands, in several threads at once). This is the most accurate,
+// but also the slowest of the accurate summation modes.
+*/
+constexpr KahanSummation kahan{};
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Selects the pairwise summation.
+// \ingroup dense_tensor
+//
+// Blocks of consecutive values are summed by the regular vectorized kernels and the block sums
+// are combined pairwise. The rounding error only grows logarithmically with the number of values.
+*/
+constexpr PairwiseSummation pairwise{};
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Selects the summation in the wider data type \a AT.
+// \ingroup dense_tensor
+//
+// Blocks of consecutive values are summed by the regular vectorized kernels in the element type
+// and the block sums are accumulated in the data type \a AT:
+
+   \code
+   blaze::DynamicTensor<float> A;
+   // ... Resizing and initialization
+   const double s = sum( A, blaze::widened<double> );
+   \endcode
+*/
+template< typename AT >  // Type of the accumulation
+constexpr WidenedSummation<AT> widened{};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ACCURATE SUMMATION KERNELS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Number of consecutive elements summed into a single block by the block accumulators.
+// \ingroup dense_tensor
+*/
+constexpr size_t accurateSumBlockSize = 256UL;
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Auxiliary helper struct for the accurate summation of dense tensors.
+// \ingroup dense_tensor
+*/
+template< typename MT       // Type of the dense tensor
+        , typename Abs      // Type of the abs operation
+        , typename Power >  // Type of the power operation
+struct DTensAccurateSumHelper
+{
+   //**********************************************************************************************
+   static constexpr bool value =
+      ( DTensNormHelper<MT,Abs,Power>::value &&
+        HasSIMDSub_v< ElementType_t<MT>, ElementType_t<MT> > );
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default kernel for the accurate summation of a range of rows of a dense tensor.
+// \ingroup dense_tensor
+//
+// \param tmp The given (evaluated) dense tensor.
+// \param f The transformation applied to each element before the summation.
+// \param acc The accumulator.
+// \param begin The first row of the range, counted over all pages.
+// \param end The row after the last row of the range, counted over all pages.
+// \return void
+*/
+template< typename TT     // Type of the dense tensor
+        , typename F      // Type of the element transformation
+        , typename Acc >  // Type of the accumulator
+void accurateSumRows( const DenseTensor<TT>& tmp, F f, Acc& acc, size_t begin, size_t end,
+                      FalseType )
+{
+   using ET = ElementType_t<TT>;
+
+   const size_t M( (*tmp).rows()    );
+   const size_t N( (*tmp).columns() );
+
+   for( size_t r=begin; r<end; ++r )
+   {
+      const size_t k( r / M );
+      const size_t i( r % M );
+
+      for( size_t jbegin=0UL; jbegin<N; jbegin+=accurateSumBlockSize )
+      {
+         const size_t jend( min( jbegin + accurateSumBlockSize, N ) );
+
+         if( Acc::elementwise ) {
+            for( size_t j=jbegin; j<jend; ++j )
+               acc.add( f( (*tmp)(k,i,j) ) );
+         }
+         else {
+            ET block{};
+            for( size_t j=jbegin; j<jend; ++j )
+               block += f( (*tmp)(k,i,j) );
+            acc.add( block );
+         }
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief SIMD optimized Kahan-compensated summation of a range of rows of a dense tensor.
+// \ingroup dense_tensor
+//
+// \param tmp The given (evaluated) dense tensor.
+// \param f The transformation applied to each element before the summation.
+// \param acc The accumulator.
+// \param begin The first row of the range, counted over all pages.
+// \param end The row after the last row of the range, counted over all pages.
+// \return void
+//
+// This kernel runs two independent compensated summations per SIMD lane. The sums and the
+// compensations of all lanes are folded into the (scalar) accumulator at the end of the range.
+*/
+template< typename TT     // Type of the dense tensor
+        , typename F      // Type of the element transformation
+        , typename Acc >  // Type of the accumulator
+void accurateSumRowsSIMD( const DenseTensor<TT>& tmp, F f, Acc& acc, size_t begin, size_t end,
+                          TrueType )
+{
+   using ET  = ElementType_t<TT>;
+   using SET = SIMDTrait_t<ET>;
+
+   static constexpr size_t SIMDSIZE = SIMDTrait<ET>::size;
+
+   const size_t M( (*tmp).rows()    );
+   const size_t N( (*tmp).columns() );
+
+   constexpr bool remainder( !IsPadded_v<TT> );
+
+   const size_t jpos( ( remainder )?( N & size_t(-SIMDSIZE) ):( N ) );
+   BLAZE_INTERNAL_ASSERT( !remainder || ( N - ( N % SIMDSIZE ) ) == jpos, "Invalid end calculation" );
+
+   SET sum1, comp1, sum2, comp2;
+
+   auto step = []( SET& sum, SET& comp, const SET& value ) {
+      const SET y( value - comp );
+      const SET t( sum + y );
+      comp = ( t - sum ) - y;
+      sum = t;
+   };
+
+   for( size_t r=begin; r<end; ++r )
+   {
+      const size_t k( r / M );
+      const size_t i( r % M );
+
+      size_t j( 0UL );
+
+      for( ; ( j + SIMDSIZE ) < jpos; j += SIMDSIZE*2UL ) {
+         step( sum1, comp1, f( (*tmp).load( k, i, j ) ) );
+         step( sum2, comp2, f( (*tmp).load( k, i, j + SIMDSIZE ) ) );
+      }
+      for( ; j < jpos; j += SIMDSIZE ) {
+         step( sum1, comp1, f( (*tmp).load( k, i, j ) ) );
+      }
+      for( ; remainder && j < N; ++j ) {
+         acc.add( f( (*tmp)( k, i, j ) ) );
+      }
+   }
+
+   acc.add( sum1, comp1 );
+   acc.add( sum2, comp2 );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief SIMD optimized block summation of a range of rows of a dense tensor.
+// \ingroup dense_tensor
+//
+// \param tmp The given (evaluated) dense tensor.
+// \param f The transformation applied to each element before the summation.
+// \param acc The accumulator.
+// \param begin The first row of the range, counted over all pages.
+// \param end The row after the last row of the range, counted over all pages.
+// \return void
+//
+// This kernel splits each row into blocks of blaze::accurateSumBlockSize elements, sums each
+// block by means of the regular vectorized summation and passes the block sums in order to the
+// accumulator.
+*/
+template< typename TT     // Type of the dense tensor
+        , typename F      // Type of the element transformation
+        , typename Acc >  // Type of the accumulator
+void accurateSumRowsSIMD( const DenseTensor<TT>& tmp, F f, Acc& acc, size_t begin, size_t end,
+                          FalseType )
+{
+   using ET  = ElementType_t<TT>;
+   using SET = SIMDTrait_t<ET>;
+
+   static constexpr size_t SIMDSIZE = SIMDTrait<ET>::size;
+
+   BLAZE_STATIC_ASSERT( accurateSumBlockSize % SIMDSIZE == 0UL );
+
+   const size_t M( (*tmp).rows()    );
+   const size_t N( (*tmp).columns() );
+
+   constexpr bool remainder( !IsPadded_v<TT> );
+
+   const size_t jpos( ( remainder )?( N & size_t(-SIMDSIZE) ):( N ) );
+   BLAZE_INTERNAL_ASSERT( !remainder || ( N - ( N % SIMDSIZE ) ) == jpos, "Invalid end calculation" );
+
+   for( size_t r=begin; r<end; ++r )
+   {
+      const size_t k( r / M );
+      const size_t i( r % M );
+
+      for( size_t jbegin=0UL; jbegin<N; jbegin+=accurateSumBlockSize )
+      {
+         const size_t jend( min( jbegin + accurateSumBlockSize, N ) );
+         const size_t jsimd( min( jbegin + accurateSumBlockSize, jpos ) );
+
+         SET xmm1, xmm2;
+         ET block{};
+
+         size_t j( jbegin );
+
+         for( ; ( j + SIMDSIZE ) < jsimd; j += SIMDSIZE*2UL ) {
+            xmm1 += f( (*tmp).load( k, i, j ) );
+            xmm2 += f( (*tmp).load( k, i, j + SIMDSIZE ) );
+         }
+         for( ; j < jsimd; j += SIMDSIZE ) {
+            xmm1 += f( (*tmp).load( k, i, j ) );
+         }
+         for( ; remainder && j < jend; ++j ) {
+            block += f( (*tmp)( k, i, j ) );
+         }
+
+         acc.add( block + sum( xmm1 + xmm2 ) );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief SIMD optimized kernel for the accurate summation of a range of rows of a dense tensor.
+// \ingroup dense_tensor
+//
+// \param tmp The given (evaluated) dense tensor.
+// \param f The transformation applied to each element before the summation.
+// \param acc The accumulator.
+// \param begin The first row of the range, counted over all pages.
+// \param end The row after the last row of the range, counted over all pages.
+// \return void
+*/
+template< typename TT     // Type of the dense tensor
+        , typename F      // Type of the element transformation
+        , typename Acc >  // Type of the accumulator
+inline void accurateSumRows( const DenseTensor<TT>& tmp, F f, Acc& acc, size_t begin, size_t end,
+                             TrueType )
+{
+   accurateSumRowsSIMD( *tmp, f, acc, begin, end, BoolConstant<Acc::elementwise>() );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Kernel for the accurate summation of a range of rows of a dense array.
+// \ingroup dense_array
+//
+// \param tmp The given (evaluated) dense array.
+// \param f The transformation applied to each element before the summation.
+// \param acc The accumulator.
+// \param begin The first row of the range.
+// \param end The row after the last row of the range.
+// \return void
+//
+// A row is a contiguous run of elements along the innermost dimension; the rows are numbered
+// in storage order over all remaining dimensions.
+*/
+template< typename AT     // Type of the dense array
+        , typename F      // Type of the element transformation
+        , typename Acc >  // Type of the accumulator
+void accurateSumRows( const DenseArray<AT>& tmp, F f, Acc& acc, size_t begin, size_t end,
+                      FalseType )
+{
+   using ET = ElementType_t<AT>;
+
+   constexpr size_t N( AT::num_dimensions );
+
+   const std::array<size_t,N>& dims( (*tmp).dimensions() );
+
+   std::array<size_t,N> index{};
+
+   for( size_t r=begin; r<end; ++r )
+   {
+      size_t row( r );
+      for( size_t d=1UL; d<N; ++d ) {
+         index[d] = row % dims[d];
+         row /= dims[d];
+      }
+
+      for( size_t jbegin=0UL; jbegin<dims[0]; jbegin+=accurateSumBlockSize )
+      {
+         const size_t jend( min( jbegin + accurateSumBlockSize, dims[0] ) );
+
+         if( Acc::elementwise ) {
+            for( index[0]=jbegin; index[0]<jend; ++index[0] )
+               acc.add( f( (*tmp)( index ) ) );
+         }
+         else {
+            ET block{};
+            for( index[0]=jbegin; index[0]<jend; ++index[0] )
+               block += f( (*tmp)( index ) );
+            acc.add( block );
+         }
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the number of rows of the given dense tensor for the accurate summation.
+// \ingroup dense_tensor
+*/
+template< typename TT >  // Type of the dense tensor
+inline size_t accurateSumRowCount( const DenseTensor<TT>& tmp ) noexcept
+{
+   return (*tmp).pages() * (*tmp).rows();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the number of rows of the given dense array for the accurate summation.
+// \ingroup dense_array
+*/
+template< typename AT >  // Type of the dense array
+inline size_t accurateSumRowCount( const DenseArray<AT>& tmp ) noexcept
+{
+   size_t rows( 1UL );
+   for( size_t d=1UL; d<AT::num_dimensions; ++d ) {
+      rows *= (*tmp).dimensions()[d];
+   }
+   return rows;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend implementation of the accurate summation of a dense tensor or array.
+// \ingroup dense_tensor
+//
+// \param tmp The given (evaluated) dense tensor or array.
+// \param f The transformation applied to each element before the summation.
+// \param size The total number of elements.
+// \return The accurate sum of all transformed elements.
+//
+// In case the operand is large enough and no serial section is active, its rows are split into
+// several contiguous chunks (see blaze::smpFor()). Each chunk is summed into an accumulator of
+// its own and the accumulators are merged in chunk order afterwards, such that the result does
+// only depend on the number of chunks, but not on the scheduling of the chunks.
+*/
+template< typename Mode  // Type of the summation mode
+        , typename ET    // Element type of the operand
+        , typename CT    // Type of the (evaluated) operand
+        , typename F     // Type of the element transformation
+        , bool SIMD >    // Vectorization flag
+decltype(auto) accurateSum_backend( const CT& tmp, F f, size_t size, BoolConstant<SIMD> )
+{
+   using Acc = typename Mode::template Accumulator<ET>;
+
+   const size_t rows( accurateSumRowCount( tmp ) );
+   const bool parallel( !isSerialSectionActive() && rows > 1UL &&
+                        size >= smpDTensAssignThreshold() );
+
+   if( !parallel ) {
+      Acc acc;
+      accurateSumRows( tmp, f, acc, 0UL, rows, BoolConstant<SIMD>() );
+      return acc.result();
+   }
+
+   const size_t chunks( min( rows, getNumThreads()*4UL ) );
+   std::vector<Acc> partials( chunks );
+
+   smpFor( 0UL, chunks, [&]( size_t chunk ) {
+      accurateSumRows( tmp, f, partials[chunk], ( rows*chunk ) / chunks,
+                       ( rows*(chunk+1UL) ) / chunks, BoolConstant<SIMD>() );
+   } );
+
+   Acc acc;
+   for( size_t chunk=0UL; chunk<chunks; ++chunk ) {
+      acc.merge( partials[chunk] );
+   }
+
+   return acc.result();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Accurate summation of the transformed elements of a dense tensor.
+// \ingroup dense_tensor
+*/
+template< typename Mode    // Type of the summation mode
+        , typename MT      // Type of the dense tensor
+        , typename Abs     // Type of the abs operation
+        , typename Power > // Type of the power operation
+decltype(auto) accurateSum( const DenseTensor<MT>& dm, Abs abs, Power power )
+{
+   using CT = CompositeType_t<MT>;
+   using ET = ElementType_t<MT>;
+
+   CT tmp( *dm );
+
+   auto f = [abs,power]( const auto& a ) { return power( abs( a ) ); };
+
+   return accurateSum_backend<Mode,ET>( tmp, f, tmp.pages()*tmp.rows()*tmp.columns(),
+      BoolConstant< DTensAccurateSumHelper<MT,Abs,Power>::value >() );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Accurate summation of the transformed elements of a dense array.
+// \ingroup dense_array
+*/
+template< typename Mode    // Type of the summation mode
+        , typename MT      // Type of the dense array
+        , typename Abs     // Type of the abs operation
+        , typename Power > // Type of the power operation
+decltype(auto) accurateSum( const DenseArray<MT>& dm, Abs abs, Power power )
+{
+   using CT = CompositeType_t<MT>;
+   using ET = ElementType_t<MT>;
+
+   CT tmp( *dm );
+
+   size_t size( 1UL );
+   for( size_t d=0UL; d<MT::num_dimensions; ++d ) {
+      size *= tmp.dimensions()[d];
+   }
+
+   auto f = [abs,power]( const auto& a ) { return power( abs( a ) ); };
+
+   return accurateSum_backend<Mode,ET>( tmp, f, size, FalseType() );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Computes a custom norm for the given dense tensor or array by means of an accurate
+//        summation.
+// \ingroup dense_tensor
+//
+// \param dm The given dense tensor or array for the norm computation.
+// \param abs The functor for the abs operation.
+// \param power The functor for the power operation.
+// \param root The functor for the root operation.
+// \return The norm of the given dense tensor or array.
+*/
+template< typename Mode    // Type of the summation mode
+        , typename MT      // Type of the dense tensor or array
+        , typename Abs     // Type of the abs operation
+        , typename Power   // Type of the power operation
+        , typename Root >  // Type of the root operation
+inline decltype(auto) accurateNorm_backend( const MT& dm, Abs abs, Power power, Root root )
+{
+   return evaluate( root( accurateSum<Mode>( dm, abs, power ) ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reduces the given dense tensor by means of an accurate summation.
+// \ingroup dense_tensor
+//
+// \param dm The given dense tensor for the reduction operation.
+// \param mode The summation mode (blaze::kahan, blaze::pairwise or blaze::widened).
+// \return The sum of all elements.
+//
+// In contrast to the plain sum(), whose rounding error grows linearly with the number of
+// elements, this function reduces the given dense tensor with the selected accurate summation
+// mode. All modes are vectorized and parallelized like the plain summation:
+
+   \code
+   blaze::DynamicTensor<float> A;
+   // ... Resizing and initialization
+
+   const float  s1 = sum( A, blaze::kahan );            // Kahan-compensated summation
+   const float  s2 = sum( A, blaze::pairwise );         // Pairwise summation
+   const double s3 = sum( A, blaze::widened<double> );  // Block sums accumulated in double
+   \endcode
+
+// Please note that the result may depend on the number of threads, but not on the scheduling
+// of the threads.
+*/
+template< typename MT     // Type of the dense tensor
+        , typename Mode   // Type of the summation mode
+        , typename = EnableIf_t< IsBaseOf_v<SummationMode,Mode> > >
+inline decltype(auto) sum( const DenseTensor<MT>& dm, Mode /*mode*/ )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return accurateSum<Mode>( *dm, Noop(), Noop() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reduces the given dense tensor by means of an accurate summation.
+// \ingroup dense_tensor
+//
+// \param dm The given dense tensor for the reduction operation.
+// \param op The reduction operation (blaze::Add).
+// \param mode The summation mode (blaze::kahan, blaze::pairwise or blaze::widened).
+// \return The sum of all elements.
+//
+// This function is equivalent to \c sum( dm, mode ).
+*/
+template< typename MT     // Type of the dense tensor
+        , typename Mode   // Type of the summation mode
+        , typename = EnableIf_t< IsBaseOf_v<SummationMode,Mode> > >
+inline decltype(auto) reduce( const DenseTensor<MT>& dm, Add /*op*/, Mode /*mode*/ )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return accurateSum<Mode>( *dm, Noop(), Noop() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the L2 norm for the given dense tensor by means of an accurate summation.
+// \ingroup dense_tensor
+//
+// \param dm The given dense tensor for the norm computation.
+// \param mode The summation mode (blaze::kahan, blaze::pairwise or blaze::widened).
+// \return The L2 norm of the given dense tensor.
+
+   \code
+   blaze::DynamicTensor<float> A;
+   // ... Resizing and initialization
+   const double l2 = norm( A, blaze::widened<double> );
+   \endcode
+*/
+template< typename MT     // Type of the dense tensor
+        , typename Mode   // Type of the summation mode
+        , typename = EnableIf_t< IsBaseOf_v<SummationMode,Mode> > >
+inline decltype(auto) norm( const DenseTensor<MT>& dm, Mode /*mode*/ )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return accurateNorm_backend<Mode>( *dm, SqrAbs(), Noop(), Sqrt() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the squared L2 norm for the given dense tensor by means of an accurate
+//        summation.
+// \ingroup dense_tensor
+//
+// \param dm The given dense tensor for the norm computation.
+// \param mode The summation mode (blaze::kahan, blaze::pairwise or blaze::widened).
+// \return The squared L2 norm of the given dense tensor.
+*/
+template< typename MT     // Type of the dense tensor
+        , typename Mode   // Type of the summation mode
+        , typename = EnableIf_t< IsBaseOf_v<SummationMode,Mode> > >
+inline decltype(auto) sqrNorm( const DenseTensor<MT>& dm, Mode /*mode*/ )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return accurateNorm_backend<Mode>( *dm, SqrAbs(), Noop(), Noop() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the L1 norm for the given dense tensor by means of an accurate summation.
+// \ingroup dense_tensor
+//
+// \param dm The given dense tensor for the norm computation.
+// \param mode The summation mode (blaze::kahan, blaze::pairwise or blaze::widened).
+// \return The L1 norm of the given dense tensor.
+*/
+template< typename MT     // Type of the dense tensor
+        , typename Mode   // Type of the summation mode
+        , typename = EnableIf_t< IsBaseOf_v<SummationMode,Mode> > >
+inline decltype(auto) l1Norm( const DenseTensor<MT>& dm, Mode /*mode*/ )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return accurateNorm_backend<Mode>( *dm, Abs(), Noop(), Noop() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the L2 norm for the given dense tensor by means of an accurate summation.
+// \ingroup dense_tensor
+//
+// \param dm The given dense tensor for the norm computation.
+// \param mode The summation mode (blaze::kahan, blaze::pairwise or blaze::widened).
+// \return The L2 norm of the given dense tensor.
+*/
+template< typename MT     // Type of the dense tensor
+        , typename Mode   // Type of the summation mode
+        , typename = EnableIf_t< IsBaseOf_v<SummationMode,Mode> > >
+inline decltype(auto) l2Norm( const DenseTensor<MT>& dm, Mode /*mode*/ )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return accurateNorm_backend<Mode>( *dm, SqrAbs(), Noop(), Sqrt() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the Lp norm for the given dense tensor by means of an accurate summation.
+// \ingroup dense_tensor
+//
+// \param dm The given dense tensor for the norm computation.
+// \param p The norm parameter (p > 0).
+// \param mode The summation mode (blaze::kahan, blaze::pairwise or blaze::widened).
+// \return The Lp norm of the given dense tensor.
+//
+// \note The norm parameter \a p is expected to be larger than 0. This precondition is only checked
+// by a user assertion.
+*/
+template< typename MT     // Type of the dense tensor
+        , typename ST     // Type of the norm parameter
+        , typename Mode   // Type of the summation mode
+        , typename = EnableIf_t< IsBaseOf_v<SummationMode,Mode> > >
+inline decltype(auto) lpNorm( const DenseTensor<MT>& dm, ST p, Mode /*mode*/ )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_USER_ASSERT( !isZero( p ), "Invalid p for Lp norm detected" );
+
+   using ScalarType = MultTrait_t< UnderlyingBuiltin_t<MT>, decltype( inv( p ) ) >;
+   using UnaryPow = Bind2nd<Pow,ScalarType>;
+   return accurateNorm_backend<Mode>( *dm, Abs(), UnaryPow( Pow(), p ),
+                                      UnaryPow( Pow(), inv( p ) ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reduces the given dense array by means of an accurate summation.
+// \ingroup dense_array
+//
+// \param dm The given dense array for the reduction operation.
+// \param mode The summation mode (blaze::kahan, blaze::pairwise or blaze::widened).
+// \return The sum of all elements.
+//
+// This function reduces the given dense array with the selected accurate summation mode. The
+// elements are summed by scalar kernels, but large arrays are summed in parallel:
+
+   \code
+   blaze::DynamicArray<3UL,float> A;
+   // ... Resizing and initialization
+
+   const float  s1 = sum( A, blaze::kahan );            // Kahan-compensated summation
+   const float  s2 = sum( A, blaze::pairwise );         // Pairwise summation
+   const double s3 = sum( A, blaze::widened<double> );  // Block sums accumulated in double
+   \endcode
+
+// Please note that the result may depend on the number of threads, but not on the scheduling
+// of the threads.
+*/
+template< typename MT     // Type of the dense array
+        , typename Mode   // Type of the summation mode
+        , typename = EnableIf_t< IsBaseOf_v<SummationMode,Mode> > >
+inline decltype(auto) sum( const DenseArray<MT>& dm, Mode /*mode*/ )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return accurateSum<Mode>( *dm, Noop(), Noop() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reduces the given dense array by means of an accurate summation.
+// \ingroup dense_array
+//
+// \param dm The given dense array for the reduction operation.
+// \param op The reduction operation (blaze::Add).
+// \param mode The summation mode (blaze::kahan, blaze::pairwise or blaze::widened).
+// \return The sum of all elements.
+//
+// This function is equivalent to \c sum( dm, mode ).
+*/
+template< typename MT     // Type of the dense array
+        , typename Mode   // Type of the summation mode
+        , typename = EnableIf_t< IsBaseOf_v<SummationMode,Mode> > >
+inline decltype(auto) reduce( const DenseArray<MT>& dm, Add /*op*/, Mode /*mode*/ )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return accurateSum<Mode>( *dm, Noop(), Noop() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the L2 norm for the given dense array by means of an accurate summation.
+// \ingroup dense_array
+//
+// \param dm The given dense array for the norm computation.
+// \param mode The summation mode (blaze::kahan, blaze::pairwise or blaze::widened).
+// \return The L2 norm of the given dense array.
+
+   \code
+   blaze::DynamicArray<3UL,float> A;
+   // ... Resizing and initialization
+   const double l2 = norm( A, blaze::widened<double> );
+   \endcode
+*/
+template< typename MT     // Type of the dense array
+        , typename Mode   // Type of the summation mode
+        , typename = EnableIf_t< IsBaseOf_v<SummationMode,Mode> > >
+inline decltype(auto) norm( const DenseArray<MT>& dm, Mode /*mode*/ )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return accurateNorm_backend<Mode>( *dm, SqrAbs(), Noop(), Sqrt() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the squared L2 norm for the given dense array by means of an accurate
+//        summation.
+// \ingroup dense_array
+//
+// \param dm The given dense array for the norm computation.
+// \param mode The summation mode (blaze::kahan, blaze::pairwise or blaze::widened).
+// \return The squared L2 norm of the given dense array.
+*/
+template< typename MT     // Type of the dense array
+        , typename Mode   // Type of the summation mode
+        , typename = EnableIf_t< IsBaseOf_v<SummationMode,Mode> > >
+inline decltype(auto) sqrNorm( const DenseArray<MT>& dm, Mode /*mode*/ )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return accurateNorm_backend<Mode>( *dm, SqrAbs(), Noop(), Noop() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the L1 norm for the given dense array by means of an accurate summation.
+// \ingroup dense_array
+//
+// \param dm The given dense array for the norm computation.
+// \param mode The summation mode (blaze::kahan, blaze::pairwise or blaze::widened).
+// \return The L1 norm of the given dense array.
+*/
+template< typename MT     // Type of the dense array
+        , typename Mode   // Type of the summation mode
+        , typename = EnableIf_t< IsBaseOf_v<SummationMode,Mode> > >
+inline decltype(auto) l1Norm( const DenseArray<MT>& dm, Mode /*mode*/ )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return accurateNorm_backend<Mode>( *dm, Abs(), Noop(), Noop() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the L2 norm for the given dense array by means of an accurate summation.
+// \ingroup dense_array
+//
+// \param dm The given dense array for the norm computation.
+// \param mode The summation mode (blaze::kahan, blaze::pairwise or blaze::widened).
+// \return The L2 norm of the given dense array.
+*/
+template< typename MT     // Type of the dense array
+        , typename Mode   // Type of the summation mode
+        , typename = EnableIf_t< IsBaseOf_v<SummationMode,Mode> > >
+inline decltype(auto) l2Norm( const DenseArray<MT>& dm, Mode /*mode*/ )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return accurateNorm_backend<Mode>( *dm, SqrAbs(), Noop(), Sqrt() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the Lp norm for the given dense array by means of an accurate summation.
+// \ingroup dense_array
+//
+// \param dm The given dense array for the norm computation.
+// \param p The norm parameter (p > 0).
+// \param mode The summation mode (blaze::kahan, blaze::pairwise or blaze::widened).
+// \return The Lp norm of the given dense array.
+//
+// \note The norm parameter \a p is expected to be larger than 0. This precondition is only checked
+// by a user assertion.
+*/
+template< typename MT     // Type of the dense array
+        , typename ST     // Type of the norm parameter
+        , typename Mode   // Type of the summation mode
+        , typename = EnableIf_t< IsBaseOf_v<SummationMode,Mode> > >
+inline decltype(auto) lpNorm( const DenseArray<MT>& dm, ST p, Mode /*mode*/ )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_USER_ASSERT( !isZero( p ), "Invalid p for Lp norm detected" );
+
+   using ScalarType = MultTrait_t< UnderlyingBuiltin_t<MT>, decltype( inv( p ) ) >;
+   using UnaryPow = Bind2nd<Pow,ScalarType>;
+   return accurateNorm_backend<Mode>( *dm, Abs(), UnaryPow( Pow(), p ),
+                                      UnaryPow( Pow(), inv( p ) ) );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
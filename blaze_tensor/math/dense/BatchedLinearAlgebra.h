@@ -0,0 +1,1405 @@
+//=================================================================================================
+/*!
+//  \file blaze_tensor/math/dense/BatchedLinearAlgebra.h
+//  \brief Header file for the batched decomposition and inversion functions of dense tensors
+//
+//  Copyright (C) 2012-2018 Klaus Iglberger - All Rights Reserved
+//  Copyright (C) 2018 Hartmut Kaiser - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+
+#ifndef _BLAZE_TENSOR_MATH_DENSE_BATCHEDLINEARALGEBRA_H_
+#define _BLAZE_TENSOR_MATH_DENSE_BATCHEDLINEARALGEBRA_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include <blaze/math/Aliases.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/SIMD.h>
+#include <blaze/math/constraints/BLASCompatible.h>
+#include <blaze/math/dense/DynamicMatrix.h>
+#include <blaze/math/dense/Inversion.h>
+#include <blaze/math/dense/LLH.h>
+#include <blaze/math/dense/LU.h>
+#include <blaze/math/typetraits/HasSIMDAdd.h>
+#include <blaze/math/typetraits/HasSIMDMult.h>
+#include <blaze/math/typetraits/HasSIMDSub.h>
+#include <blaze/math/typetraits/IsVectorizable.h>
+#include <blaze/math/views/Row.h>
+#include <blaze/util/AlignedAllocator.h>
+#include <blaze/util/AlignedArray.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/FunctionTrace.h>
+#include <blaze/util/IntegralConstant.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/algorithms/Min.h>
+#include <blaze/util/constraints/SameType.h>
+#include <blaze/util/typetraits/IsFloatingPoint.h>
+
+#include <blaze_tensor/math/dense/DynamicTensor.h>
+#include <blaze_tensor/math/expressions/DenseTensor.h>
+#include <blaze_tensor/math/smp/ParallelFor.h>
+#include <blaze_tensor/math/views/PageSlice.h>
+#include <blaze_tensor/system/Thresholds.h>
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  INTERLEAVED KERNELS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Auxiliary helper struct for the interleaved batched linear algebra kernels.
+// \ingroup dense_tensor
+//
+// The interleaved kernels process \a size pages at once. The elements of these pages are stored
+// interleaved, i.e. element \f$ (i,j) \f$ of all pages is stored contiguously, such that every
+// page is processed by a single SIMD lane.
+*/
+template< typename ET >  // Element type of the tensor
+struct BatchedKernelHelper
+{
+   //**********************************************************************************************
+   static constexpr bool simdEnabled =
+      ( IsVectorizable_v<ET> && HasSIMDAdd_v<ET,ET> && HasSIMDSub_v<ET,ET> && HasSIMDMult_v<ET,ET> );
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   static constexpr size_t size = ( simdEnabled ? SIMDTrait<ET>::size : 1UL );
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Lane-wise scaling of one interleaved element (\f$ y_l = y_l \cdot s_l \f$).
+// \ingroup dense_tensor
+//
+// \param y Pointer to the interleaved element to be scaled.
+// \param s Pointer to the interleaved scaling factors.
+// \return void
+*/
+template< typename ET >  // Element type of the tensor
+BLAZE_ALWAYS_INLINE auto batchedScale( ET* y, const ET* s ) noexcept
+   -> DisableIf_t< BatchedKernelHelper<ET>::simdEnabled >
+{
+   for( size_t l=0UL; l<BatchedKernelHelper<ET>::size; ++l ) {
+      y[l] *= s[l];
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief SIMD optimized lane-wise scaling of one interleaved element (\f$ y_l = y_l \cdot s_l \f$).
+// \ingroup dense_tensor
+//
+// \param y Pointer to the interleaved element to be scaled.
+// \param s Pointer to the interleaved scaling factors.
+// \return void
+*/
+template< typename ET >  // Element type of the tensor
+BLAZE_ALWAYS_INLINE auto batchedScale( ET* y, const ET* s ) noexcept
+   -> EnableIf_t< BatchedKernelHelper<ET>::simdEnabled >
+{
+   SIMDTrait_t<ET> xmm( loada( y ) );
+   xmm *= loada( s );
+   storea( y, xmm );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Lane-wise update of one interleaved element (\f$ y_l = y_l - m_l \cdot x_l \f$).
+// \ingroup dense_tensor
+//
+// \param y Pointer to the interleaved element to be updated.
+// \param m Pointer to the interleaved multipliers.
+// \param x Pointer to the interleaved element to be subtracted.
+// \return void
+*/
+template< typename ET >  // Element type of the tensor
+BLAZE_ALWAYS_INLINE auto batchedUpdate( ET* y, const ET* m, const ET* x ) noexcept
+   -> DisableIf_t< BatchedKernelHelper<ET>::simdEnabled >
+{
+   for( size_t l=0UL; l<BatchedKernelHelper<ET>::size; ++l ) {
+      y[l] -= m[l] * x[l];
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief SIMD optimized lane-wise update of one interleaved element
+//        (\f$ y_l = y_l - m_l \cdot x_l \f$).
+// \ingroup dense_tensor
+//
+// \param y Pointer to the interleaved element to be updated.
+// \param m Pointer to the interleaved multipliers.
+// \param x Pointer to the interleaved element to be subtracted.
+// \return void
+*/
+template< typename ET >  // Element type of the tensor
+BLAZE_ALWAYS_INLINE auto batchedUpdate( ET* y, const ET* m, const ET* x ) noexcept
+   -> EnableIf_t< BatchedKernelHelper<ET>::simdEnabled >
+{
+   SIMDTrait_t<ET> xmm( loada( y ) );
+   xmm -= loada( m ) * loada( x );
+   storea( y, xmm );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Lane-wise partial pivoting on column \a c of an interleaved block of pages.
+// \ingroup dense_tensor
+//
+// \param a Pointer to the interleaved \f$ n \times n \f$ pages.
+// \param n The order of the pages.
+// \param c The current column.
+// \param first The first column of the row interchange.
+// \param piv Pointer to the interleaved pivot indices of column \a c.
+// \param s Pointer to the resulting interleaved reciprocals of the pivot elements.
+// \return \a true in case all pivot elements are nonzero, \a false if not.
+//
+// This function selects the element with the largest absolute value in the rows \f$ [c..n) \f$
+// of column \a c separately for every lane, interchanges the columns \f$ [first..n) \f$ of the
+// pivot row and row \a c and stores the reciprocals of the pivot elements in \a s. Zero pivot
+// elements result in zero reciprocals, which leaves the remaining rows unmodified.
+*/
+template< typename ET >  // Element type of the tensor
+bool batchedPivot( ET* a, size_t n, size_t c, size_t first, size_t* piv, ET* s )
+{
+   using std::abs;
+
+   constexpr size_t W( BatchedKernelHelper<ET>::size );
+
+   bool nonsingular( true );
+
+   for( size_t l=0UL; l<W; ++l )
+   {
+      size_t p( c );
+
+      for( size_t r=c+1UL; r<n; ++r ) {
+         if( abs( a[(r*n+c)*W+l] ) > abs( a[(p*n+c)*W+l] ) )
+            p = r;
+      }
+
+      piv[l] = p;
+
+      if( p != c ) {
+         for( size_t j=first; j<n; ++j ) {
+            std::swap( a[(c*n+j)*W+l], a[(p*n+j)*W+l] );
+         }
+      }
+
+      const ET pivot( a[(c*n+c)*W+l] );
+
+      if( pivot == ET(0) ) {
+         nonsingular = false;
+         s[l] = ET(0);
+      }
+      else {
+         s[l] = ET(1) / pivot;
+      }
+   }
+
+   return nonsingular;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Interleaved LU decomposition with partial pivoting (\f$ P A = L U \f$).
+// \ingroup dense_tensor
+//
+// \param a Pointer to the interleaved \f$ n \times n \f$ pages.
+// \param n The order of the pages.
+// \param piv Pointer to the interleaved row interchanges (\f$ n \cdot size \f$ elements).
+// \return void
+//
+// On exit the strictly lower part of every page contains the multipliers of the unit lower
+// triangular factor and the upper part contains the upper triangular factor.
+*/
+template< typename ET >  // Element type of the tensor
+void batchedLUKernel( ET* a, size_t n, size_t* piv )
+{
+   constexpr size_t W( BatchedKernelHelper<ET>::size );
+
+   AlignedArray<ET,W> s;
+
+   for( size_t c=0UL; c<n; ++c )
+   {
+      batchedPivot( a, n, c, 0UL, piv+c*W, s.data() );
+
+      for( size_t r=c+1UL; r<n; ++r )
+      {
+         ET* const mr( a+(r*n+c)*W );
+         batchedScale( mr, s.data() );
+
+         for( size_t j=c+1UL; j<n; ++j ) {
+            batchedUpdate( a+(r*n+j)*W, mr, a+(c*n+j)*W );
+         }
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Interleaved Cholesky decomposition (\f$ A = L L^T \f$).
+// \ingroup dense_tensor
+//
+// \param a Pointer to the interleaved \f$ n \times n \f$ pages.
+// \param n The order of the pages.
+// \return \a true in case all pages are positive definite, \a false if not.
+//
+// Only the lower part of the pages is referenced. On exit it contains the lower triangular
+// Cholesky factors.
+*/
+template< typename ET >  // Element type of the tensor
+bool batchedLLHKernel( ET* a, size_t n )
+{
+   using std::sqrt;
+
+   constexpr size_t W( BatchedKernelHelper<ET>::size );
+
+   AlignedArray<ET,W> s;
+   bool positive( true );
+
+   for( size_t c=0UL; c<n; ++c )
+   {
+      ET* const pc( a+(c*n+c)*W );
+
+      for( size_t l=0UL; l<W; ++l )
+      {
+         if( pc[l] > ET(0) ) {
+            pc[l] = sqrt( pc[l] );
+            s[l]  = ET(1) / pc[l];
+         }
+         else {
+            positive = false;
+            s[l] = ET(0);
+         }
+      }
+
+      for( size_t r=c+1UL; r<n; ++r ) {
+         batchedScale( a+(r*n+c)*W, s.data() );
+      }
+
+      for( size_t r=c+1UL; r<n; ++r ) {
+         for( size_t j=c+1UL; j<=r; ++j ) {
+            batchedUpdate( a+(r*n+j)*W, a+(r*n+c)*W, a+(j*n+c)*W );
+         }
+      }
+   }
+
+   return positive;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Interleaved in-place Gauss-Jordan inversion with partial pivoting.
+// \ingroup dense_tensor
+//
+// \param a Pointer to the interleaved \f$ n \times n \f$ pages.
+// \param n The order of the pages.
+// \param piv Pointer to the interleaved row interchanges (\f$ n \cdot size \f$ elements).
+// \return \a true in case all pages are nonsingular, \a false if not.
+*/
+template< typename ET >  // Element type of the tensor
+bool batchedInvertKernel( ET* a, size_t n, size_t* piv )
+{
+   constexpr size_t W( BatchedKernelHelper<ET>::size );
+
+   AlignedArray<ET,W> s;
+   AlignedArray<ET,W> f;
+   bool nonsingular( true );
+
+   for( size_t c=0UL; c<n; ++c )
+   {
+      if( !batchedPivot( a, n, c, 0UL, piv+c*W, s.data() ) )
+         nonsingular = false;
+
+      std::fill_n( a+(c*n+c)*W, W, ET(1) );
+
+      for( size_t j=0UL; j<n; ++j ) {
+         batchedScale( a+(c*n+j)*W, s.data() );
+      }
+
+      for( size_t r=0UL; r<n; ++r )
+      {
+         if( r == c ) continue;
+
+         std::copy_n( a+(r*n+c)*W, W, f.data() );
+         std::fill_n( a+(r*n+c)*W, W, ET(0) );
+
+         for( size_t j=0UL; j<n; ++j ) {
+            batchedUpdate( a+(r*n+j)*W, f.data(), a+(c*n+j)*W );
+         }
+      }
+   }
+
+   for( size_t c=n; c-- > 0UL; ) {
+      for( size_t l=0UL; l<W; ++l )
+      {
+         const size_t p( piv[c*W+l] );
+
+         if( p == c ) continue;
+
+         for( size_t i=0UL; i<n; ++i ) {
+            std::swap( a[(i*n+c)*W+l], a[(i*n+p)*W+l] );
+         }
+      }
+   }
+
+   return nonsingular;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Interleaved solution of linear systems by Gaussian elimination with partial pivoting.
+// \ingroup dense_tensor
+//
+// \param a Pointer to the interleaved \f$ n \times n \f$ system matrices.
+// \param b Pointer to the interleaved \f$ n \times q \f$ right-hand sides.
+// \param n The order of the system matrices.
+// \param q The number of right-hand sides.
+// \param piv Pointer to the interleaved row interchanges (\f$ n \cdot size \f$ elements).
+// \param d Pointer to the interleaved reciprocals of the pivots (\f$ n \cdot size \f$ elements).
+// \return \a true in case all system matrices are nonsingular, \a false if not.
+//
+// On exit \a b contains the interleaved solutions of the linear systems.
+*/
+template< typename ET >  // Element type of the tensor
+bool batchedSolveKernel( ET* a, ET* b, size_t n, size_t q, size_t* piv, ET* d )
+{
+   constexpr size_t W( BatchedKernelHelper<ET>::size );
+
+   bool nonsingular( true );
+
+   for( size_t c=0UL; c<n; ++c )
+   {
+      if( !batchedPivot( a, n, c, c, piv+c*W, d+c*W ) )
+         nonsingular = false;
+
+      for( size_t l=0UL; l<W; ++l ) {
+         const size_t p( piv[c*W+l] );
+         if( p == c ) continue;
+         for( size_t j=0UL; j<q; ++j ) {
+            std::swap( b[(c*q+j)*W+l], b[(p*q+j)*W+l] );
+         }
+      }
+
+      for( size_t r=c+1UL; r<n; ++r )
+      {
+         ET* const mr( a+(r*n+c)*W );
+         batchedScale( mr, d+c*W );
+
+         for( size_t j=c+1UL; j<n; ++j ) {
+            batchedUpdate( a+(r*n+j)*W, mr, a+(c*n+j)*W );
+         }
+         for( size_t j=0UL; j<q; ++j ) {
+            batchedUpdate( b+(r*q+j)*W, mr, b+(c*q+j)*W );
+         }
+      }
+   }
+
+   for( size_t c=n; c-- > 0UL; ) {
+      for( size_t j=0UL; j<q; ++j )
+      {
+         ET* const x( b+(c*q+j)*W );
+
+         for( size_t i=c+1UL; i<n; ++i ) {
+            batchedUpdate( x, a+(c*n+i)*W, b+(i*q+j)*W );
+         }
+         batchedScale( x, d+c*W );
+      }
+   }
+
+   return nonsingular;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  BACKEND FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns whether the pages of the given size are processed by the interleaved kernels.
+// \ingroup dense_tensor
+//
+// \param m The number of rows of the pages.
+// \param n The number of columns of the pages.
+// \return \a true in case the interleaved kernels are used, \a false if LAPACK is used.
+*/
+inline bool useBatchedKernel( size_t m, size_t n ) noexcept
+{
+   return m == n && n < BATCHED_DECOMPOSITION_THRESHOLD;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Executes the given loop body for all units of a batched operation.
+// \ingroup dense_tensor
+//
+// \param units The number of independent units of work (pages or groups of pages).
+// \param size The total number of elements of the processed tensor.
+// \param f The loop body.
+// \return void
+*/
+template< typename F >  // Type of the loop body
+inline void batchedFor( size_t units, size_t size, F&& f )
+{
+   if( size >= smpDTensAssignThreshold() ) smpFor( 0UL, units, f );
+   else serialFor( 0UL, units, f );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Copies a group of pages into an interleaved buffer.
+// \ingroup dense_tensor
+//
+// \param A The source tensor.
+// \param a Pointer to the interleaved buffer.
+// \param k0 The index of the first page of the group.
+// \param count The number of pages of the group.
+// \param transpose \a true in case the pages are stored transposed.
+// \return void
+//
+// Lanes that are not occupied by a page of \a A are filled with identity matrices.
+*/
+template< typename MT   // Type of the source tensor
+        , typename ET > // Element type of the buffer
+void batchedPack( const MT& A, ET* a, size_t k0, size_t count, bool transpose )
+{
+   constexpr size_t W( BatchedKernelHelper<ET>::size );
+
+   const size_t m( A.rows()    );
+   const size_t n( A.columns() );
+
+   for( size_t i=0UL; i<m; ++i ) {
+      for( size_t j=0UL; j<n; ++j )
+      {
+         ET* const element( transpose ? a+(j*m+i)*W : a+(i*n+j)*W );
+
+         for( size_t l=0UL; l<W; ++l ) {
+            element[l] = ( l < count ? A(k0+l,i,j) : ET( i == j ? 1 : 0 ) );
+         }
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Copies the occupied lanes of an interleaved buffer into a group of pages.
+// \ingroup dense_tensor
+//
+// \param a Pointer to the interleaved buffer.
+// \param A The target tensor.
+// \param k0 The index of the first page of the group.
+// \param count The number of pages of the group.
+// \return void
+*/
+template< typename ET   // Element type of the buffer
+        , typename MT > // Type of the target tensor
+void batchedUnpack( const ET* a, MT& A, size_t k0, size_t count )
+{
+   constexpr size_t W( BatchedKernelHelper<ET>::size );
+
+   const size_t m( A.rows()    );
+   const size_t n( A.columns() );
+
+   for( size_t l=0UL; l<count; ++l ) {
+      for( size_t i=0UL; i<m; ++i ) {
+         for( size_t j=0UL; j<n; ++j ) {
+            A(k0+l,i,j) = a[(i*n+j)*W+l];
+         }
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Interleaved backend implementation of the batched LU decomposition.
+// \ingroup dense_tensor
+//
+// \param A The tensor to be decomposed.
+// \param L The resulting lower triangular tensor.
+// \param U The resulting upper triangular tensor.
+// \param P The resulting permutation tensor.
+// \return void
+*/
+template< typename MT1    // Type of the tensor to be decomposed
+        , typename MT2    // Type of the lower triangular tensor
+        , typename MT3    // Type of the upper triangular tensor
+        , typename MT4 >  // Type of the permutation tensor
+void luKernel( const MT1& A, MT2& L, MT3& U, MT4& P )
+{
+   using ET = ElementType_t<MT1>;
+
+   constexpr size_t W( BatchedKernelHelper<ET>::size );
+
+   const size_t o( A.pages() );
+   const size_t n( A.rows()  );
+
+   batchedFor( ( o + W - 1UL ) / W, o*n*n, [&]( size_t g )
+   {
+      std::vector< ET, AlignedAllocator<ET> > a( n*n*W );
+      std::vector<size_t> piv( n*W );
+      std::vector<size_t> perm( n );
+
+      const size_t k0   ( g*W );
+      const size_t count( min( W, o-k0 ) );
+
+      // The decomposition A = L*U*P is computed via the decomposition P*A^T = U^T*L^T
+      batchedPack( A, a.data(), k0, count, true );
+      batchedLUKernel( a.data(), n, piv.data() );
+
+      for( size_t l=0UL; l<count; ++l )
+      {
+         const size_t k( k0+l );
+
+         for( size_t i=0UL; i<n; ++i ) {
+            perm[i] = i;
+         }
+         for( size_t c=0UL; c<n; ++c ) {
+            std::swap( perm[c], perm[piv[c*W+l]] );
+         }
+
+         for( size_t i=0UL; i<n; ++i ) {
+            for( size_t j=0UL; j<n; ++j ) {
+               L(k,i,j) = ( i >= j ? a[(j*n+i)*W+l] : ET(0) );
+               U(k,i,j) = ( i < j ? a[(j*n+i)*W+l] : ET( i == j ? 1 : 0 ) );
+               P(k,i,j) = ET( perm[i] == j ? 1 : 0 );
+            }
+         }
+      }
+   } );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief LAPACK backend implementation of the batched LU decomposition.
+// \ingroup dense_tensor
+//
+// \param A The tensor to be decomposed.
+// \param L The resulting lower triangular tensor.
+// \param U The resulting upper triangular tensor.
+// \param P The resulting permutation tensor.
+// \return void
+*/
+template< typename MT1    // Type of the tensor to be decomposed
+        , typename MT2    // Type of the lower triangular tensor
+        , typename MT3    // Type of the upper triangular tensor
+        , typename MT4 >  // Type of the permutation tensor
+void luLAPACK( const MT1& A, MT2& L, MT3& U, MT4& P )
+{
+   using ET = ElementType_t<MT1>;
+
+   batchedFor( A.pages(), A.pages()*A.rows()*A.columns(), [&]( size_t k )
+   {
+      DynamicMatrix<ET> Lk, Uk, Pk;
+
+      lu( pageslice( A, k ), Lk, Uk, Pk );
+
+      pageslice( L, k ) = Lk;
+      pageslice( U, k ) = Uk;
+      pageslice( P, k ) = Pk;
+   } );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend implementation of the batched LU decomposition for floating point tensors.
+// \ingroup dense_tensor
+*/
+template< typename MT1    // Type of the tensor to be decomposed
+        , typename MT2    // Type of the lower triangular tensor
+        , typename MT3    // Type of the upper triangular tensor
+        , typename MT4 >  // Type of the permutation tensor
+inline void lu_backend( const MT1& A, MT2& L, MT3& U, MT4& P, TrueType )
+{
+   if( useBatchedKernel( A.rows(), A.columns() ) )
+      luKernel( A, L, U, P );
+   else
+      luLAPACK( A, L, U, P );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend implementation of the batched LU decomposition for complex tensors.
+// \ingroup dense_tensor
+*/
+template< typename MT1    // Type of the tensor to be decomposed
+        , typename MT2    // Type of the lower triangular tensor
+        , typename MT3    // Type of the upper triangular tensor
+        , typename MT4 >  // Type of the permutation tensor
+inline void lu_backend( const MT1& A, MT2& L, MT3& U, MT4& P, FalseType )
+{
+   luLAPACK( A, L, U, P );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Interleaved backend implementation of the batched Cholesky decomposition.
+// \ingroup dense_tensor
+//
+// \param A The tensor to be decomposed.
+// \param L The resulting lower triangular tensor.
+// \return \a true in case all pages are positive definite, \a false if not.
+*/
+template< typename MT1    // Type of the tensor to be decomposed
+        , typename MT2 >  // Type of the lower triangular tensor
+bool llhKernel( const MT1& A, MT2& L )
+{
+   using ET = ElementType_t<MT1>;
+
+   constexpr size_t W( BatchedKernelHelper<ET>::size );
+
+   const size_t o( A.pages() );
+   const size_t n( A.rows()  );
+
+   std::atomic<bool> success( true );
+
+   batchedFor( ( o + W - 1UL ) / W, o*n*n, [&]( size_t g )
+   {
+      std::vector< ET, AlignedAllocator<ET> > a( n*n*W );
+
+      const size_t k0   ( g*W );
+      const size_t count( min( W, o-k0 ) );
+
+      batchedPack( A, a.data(), k0, count, false );
+
+      if( !batchedLLHKernel( a.data(), n ) )
+         success = false;
+
+      for( size_t i=0UL; i<n; ++i ) {
+         for( size_t j=i+1UL; j<n; ++j ) {
+            std::fill_n( a.data()+(i*n+j)*W, W, ET(0) );
+         }
+      }
+
+      batchedUnpack( a.data(), L, k0, count );
+   } );
+
+   return success;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief LAPACK backend implementation of the batched Cholesky decomposition.
+// \ingroup dense_tensor
+//
+// \param A The tensor to be decomposed.
+// \param L The resulting lower triangular tensor.
+// \return \a true in case all pages are positive definite, \a false if not.
+*/
+template< typename MT1    // Type of the tensor to be decomposed
+        , typename MT2 >  // Type of the lower triangular tensor
+bool llhLAPACK( const MT1& A, MT2& L )
+{
+   using ET = ElementType_t<MT1>;
+
+   std::atomic<bool> success( true );
+
+   batchedFor( A.pages(), A.pages()*A.rows()*A.columns(), [&]( size_t k )
+   {
+      DynamicMatrix<ET> Lk;
+
+      try {
+         llh( pageslice( A, k ), Lk );
+      }
+      catch( std::invalid_argument& ) {
+         success = false;
+         return;
+      }
+
+      pageslice( L, k ) = Lk;
+   } );
+
+   return success;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend implementation of the batched Cholesky decomposition for floating point tensors.
+// \ingroup dense_tensor
+*/
+template< typename MT1    // Type of the tensor to be decomposed
+        , typename MT2 >  // Type of the lower triangular tensor
+inline bool llh_backend( const MT1& A, MT2& L, TrueType )
+{
+   if( useBatchedKernel( A.rows(), A.columns() ) )
+      return llhKernel( A, L );
+   else
+      return llhLAPACK( A, L );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend implementation of the batched Cholesky decomposition for complex tensors.
+// \ingroup dense_tensor
+*/
+template< typename MT1    // Type of the tensor to be decomposed
+        , typename MT2 >  // Type of the lower triangular tensor
+inline bool llh_backend( const MT1& A, MT2& L, FalseType )
+{
+   return llhLAPACK( A, L );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Interleaved backend implementation of the batched in-place inversion.
+// \ingroup dense_tensor
+//
+// \param A The tensor to be inverted.
+// \return \a true in case all pages are nonsingular, \a false if not.
+*/
+template< typename MT >  // Type of the tensor to be inverted
+bool invertKernel( MT& A )
+{
+   using ET = ElementType_t<MT>;
+
+   constexpr size_t W( BatchedKernelHelper<ET>::size );
+
+   const size_t o( A.pages() );
+   const size_t n( A.rows()  );
+
+   std::atomic<bool> success( true );
+
+   batchedFor( ( o + W - 1UL ) / W, o*n*n, [&]( size_t g )
+   {
+      std::vector< ET, AlignedAllocator<ET> > a( n*n*W );
+      std::vector<size_t> piv( n*W );
+
+      const size_t k0   ( g*W );
+      const size_t count( min( W, o-k0 ) );
+
+      batchedPack( A, a.data(), k0, count, false );
+
+      if( !batchedInvertKernel( a.data(), n, piv.data() ) ) {
+         success = false;
+         return;
+      }
+
+      batchedUnpack( a.data(), A, k0, count );
+   } );
+
+   return success;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief LAPACK backend implementation of the batched in-place inversion.
+// \ingroup dense_tensor
+//
+// \param A The tensor to be inverted.
+// \return \a true in case all pages are nonsingular, \a false if not.
+*/
+template< typename MT >  // Type of the tensor to be inverted
+bool invertLAPACK( MT& A )
+{
+   using ET = ElementType_t<MT>;
+
+   std::atomic<bool> success( true );
+
+   batchedFor( A.pages(), A.pages()*A.rows()*A.columns(), [&]( size_t k )
+   {
+      DynamicMatrix<ET> Ak( pageslice( A, k ) );
+
+      try {
+         invert( Ak );
+      }
+      catch( std::invalid_argument& ) {
+         success = false;
+         return;
+      }
+
+      pageslice( A, k ) = Ak;
+   } );
+
+   return success;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend implementation of the batched in-place inversion for floating point tensors.
+// \ingroup dense_tensor
+*/
+template< typename MT >  // Type of the tensor to be inverted
+inline bool invert_backend( MT& A, TrueType )
+{
+   if( useBatchedKernel( A.rows(), A.columns() ) )
+      return invertKernel( A );
+   else
+      return invertLAPACK( A );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend implementation of the batched in-place inversion for complex tensors.
+// \ingroup dense_tensor
+*/
+template< typename MT >  // Type of the tensor to be inverted
+inline bool invert_backend( MT& A, FalseType )
+{
+   return invertLAPACK( A );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Interleaved backend implementation of the batched solution of linear systems.
+// \ingroup dense_tensor
+//
+// \param A The tensor of system matrices.
+// \param X The resulting tensor of solutions.
+// \param B The tensor of right-hand sides.
+// \return \a true in case all system matrices are nonsingular, \a false if not.
+*/
+template< typename MT1    // Type of the system tensor
+        , typename MT2    // Type of the solution tensor
+        , typename MT3 >  // Type of the right-hand side tensor
+bool solveKernel( const MT1& A, MT2& X, const MT3& B )
+{
+   using ET = ElementType_t<MT1>;
+
+   constexpr size_t W( BatchedKernelHelper<ET>::size );
+
+   const size_t o( A.pages()   );
+   const size_t n( A.rows()    );
+   const size_t q( B.columns() );
+
+   std::atomic<bool> success( true );
+
+   batchedFor( ( o + W - 1UL ) / W, o*n*( n + q ), [&]( size_t g )
+   {
+      std::vector< ET, AlignedAllocator<ET> > a( ( n*n + n*q + n )*W );
+      std::vector<size_t> piv( n*W );
+
+      ET* const b( a.data() + n*n*W );
+      ET* const d( b + n*q*W );
+
+      const size_t k0   ( g*W );
+      const size_t count( min( W, o-k0 ) );
+
+      batchedPack( A, a.data(), k0, count, false );
+      batchedPack( B, b, k0, count, false );
+
+      if( !batchedSolveKernel( a.data(), b, n, q, piv.data(), d ) ) {
+         success = false;
+         return;
+      }
+
+      batchedUnpack( b, X, k0, count );
+   } );
+
+   return success;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief LAPACK backend implementation of the batched solution of linear systems.
+// \ingroup dense_tensor
+//
+// \param A The tensor of system matrices.
+// \param X The resulting tensor of solutions.
+// \param B The tensor of right-hand sides.
+// \return \a true in case all system matrices are nonsingular, \a false if not.
+//
+// Every page is decomposed by the LAPACK based LU decomposition (\f$ A = L U P \f$), followed by
+// a forward substitution with \f$ L \f$, a back substitution with the unit upper triangular
+// \f$ U \f$ and the application of \f$ P^T \f$.
+*/
+template< typename MT1    // Type of the system tensor
+        , typename MT2    // Type of the solution tensor
+        , typename MT3 >  // Type of the right-hand side tensor
+bool solveLAPACK( const MT1& A, MT2& X, const MT3& B )
+{
+   using ET = ElementType_t<MT1>;
+
+   const size_t n( A.rows() );
+
+   std::atomic<bool> success( true );
+
+   batchedFor( A.pages(), A.pages()*n*( n + B.columns() ), [&]( size_t k )
+   {
+      DynamicMatrix<ET> Lk, Uk, Pk;
+      DynamicMatrix<ET> Yk( pageslice( B, k ) );
+
+      lu( pageslice( A, k ), Lk, Uk, Pk );
+
+      for( size_t i=0UL; i<n; ++i )
+      {
+         if( Lk(i,i) == ET(0) ) {
+            success = false;
+            return;
+         }
+
+         auto yi( row( Yk, i ) );
+
+         for( size_t j=0UL; j<i; ++j ) {
+            yi -= Lk(i,j) * row( Yk, j );
+         }
+         yi /= Lk(i,i);
+      }
+
+      for( size_t i=n; i-- > 0UL; )
+      {
+         auto yi( row( Yk, i ) );
+
+         for( size_t j=i+1UL; j<n; ++j ) {
+            yi -= Uk(i,j) * row( Yk, j );
+         }
+      }
+
+      pageslice( X, k ) = trans( Pk ) * Yk;
+   } );
+
+   return success;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend implementation of the batched solution of linear systems for floating point
+//        tensors.
+// \ingroup dense_tensor
+*/
+template< typename MT1    // Type of the system tensor
+        , typename MT2    // Type of the solution tensor
+        , typename MT3 >  // Type of the right-hand side tensor
+inline bool solve_backend( const MT1& A, MT2& X, const MT3& B, TrueType )
+{
+   if( useBatchedKernel( A.rows(), A.columns() ) )
+      return solveKernel( A, X, B );
+   else
+      return solveLAPACK( A, X, B );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend implementation of the batched solution of linear systems for complex tensors.
+// \ingroup dense_tensor
+*/
+template< typename MT1    // Type of the system tensor
+        , typename MT2    // Type of the solution tensor
+        , typename MT3 >  // Type of the right-hand side tensor
+inline bool solve_backend( const MT1& A, MT2& X, const MT3& B, FalseType )
+{
+   return solveLAPACK( A, X, B );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  BATCHED LINEAR ALGEBRA FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Page-wise LU decomposition of the given dense tensor.
+// \ingroup dense_tensor
+//
+// \param A The tensor to be decomposed.
+// \param L The resulting tensor of lower triangular pages.
+// \param U The resulting tensor of upper triangular pages.
+// \param P The resulting tensor of permutation pages.
+// \return void
+// \exception std::invalid_argument Dimensions of fixed size tensor do not match.
+//
+// This function computes the LU decomposition of every page of the given dense tensor \a A
+// with the semantics of the blaze::lu() function for row-major matrices, i.e. for every page
+// \f$ k \f$ of the \f$ o \times m \times n \f$ tensor \a A the decomposition
+// \f$ A_k = L_k U_k P_k \f$ is computed, where \f$ L_k \f$ is a lower triangular
+// \f$ m \times min(m,n) \f$ matrix, \f$ U_k \f$ is an upper unitriangular \f$ min(m,n) \times n \f$
+// matrix and \f$ P_k \f$ is a \f$ n \times n \f$ permutation matrix:
+
+   \code
+   blaze::DynamicTensor<double> A( 64UL, 4UL, 4UL );
+   // ... Initialization of A
+   blaze::DynamicTensor<double> L, U, P;
+
+   lu( A, L, U, P );  // Page-wise LU decomposition of A
+   assert( pageslice( A, 7UL ) == pageslice( L, 7UL ) * pageslice( U, 7UL ) * pageslice( P, 7UL ) );
+   \endcode
+
+// Square pages of single or double precision whose order is smaller than the
+// BLAZE_BATCHED_DECOMPOSITION_THRESHOLD are decomposed by an interleaved kernel that processes
+// one page per SIMD lane. All other pages are decomposed by individual LAPACK calls. In both
+// cases large tensors are processed in parallel. The function only works for tensors of
+// \c float, \c double, \c complex<float>, or \c complex<double> element type. The attempt to
+// call the function with tensors of any other element type results in a compile time error!
+//
+// \note This function can only be used if a fitting LAPACK library is available and linked to
+// the executable. Otherwise a linker error will be created.
+*/
+template< typename MT1    // Type of the tensor to be decomposed
+        , typename MT2    // Type of the lower triangular tensor
+        , typename MT3    // Type of the upper triangular tensor
+        , typename MT4 >  // Type of the permutation tensor
+void lu( const DenseTensor<MT1>& A, DenseTensor<MT2>& L, DenseTensor<MT3>& U, DenseTensor<MT4>& P )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   using ET = ElementType_t<MT1>;
+
+   BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( ET );
+
+   CompositeType_t<MT1> a( *A );
+
+   const size_t o ( a.pages()   );
+   const size_t m ( a.rows()    );
+   const size_t n ( a.columns() );
+   const size_t mn( min( m, n ) );
+
+   resize( *L, o, m, mn, false );
+   resize( *U, o, mn, n, false );
+   resize( *P, o, n, n, false );
+
+   lu_backend( a, *L, *U, *P, BoolConstant< IsFloatingPoint_v<ET> >() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Page-wise Cholesky (LLH) decomposition of the given dense tensor.
+// \ingroup dense_tensor
+//
+// \param A The tensor of positive definite pages to be decomposed.
+// \param L The resulting tensor of lower triangular pages.
+// \return void
+// \exception std::invalid_argument Invalid non-square tensor pages provided.
+// \exception std::invalid_argument Dimensions of fixed size tensor do not match.
+// \exception std::invalid_argument Decomposition of singular matrix failed.
+//
+// This function computes the Cholesky decomposition \f$ A_k = L_k L_k^H \f$ of every page of
+// the given dense tensor \a A. The pages of \a A are assumed to be symmetric (Hermitian) and
+// positive definite. In case the pages are not square, a \a std::invalid_argument exception is
+// thrown. In case any page is not positive definite, a \a std::invalid_argument exception is
+// thrown and the content of \a L is unspecified:
+
+   \code
+   blaze::DynamicTensor<double> A( 64UL, 4UL, 4UL );
+   // ... Initialization of A
+   blaze::DynamicTensor<double> L;
+
+   llh( A, L );  // Page-wise Cholesky decomposition of A
+   assert( pageslice( A, 7UL ) == pageslice( L, 7UL ) * ctrans( pageslice( L, 7UL ) ) );
+   \endcode
+
+// Pages of single or double precision whose order is smaller than the
+// BLAZE_BATCHED_DECOMPOSITION_THRESHOLD are decomposed by an interleaved kernel that processes
+// one page per SIMD lane. All other pages are decomposed by individual LAPACK calls. The
+// function only works for tensors of \c float, \c double, \c complex<float>, or
+// \c complex<double> element type. The attempt to call the function with tensors of any other
+// element type results in a compile time error!
+//
+// \note This function can only be used if a fitting LAPACK library is available and linked to
+// the executable. Otherwise a linker error will be created.
+*/
+template< typename MT1    // Type of the tensor to be decomposed
+        , typename MT2 >  // Type of the lower triangular tensor
+void llh( const DenseTensor<MT1>& A, DenseTensor<MT2>& L )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   using ET = ElementType_t<MT1>;
+
+   BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( ET );
+
+   CompositeType_t<MT1> a( *A );
+
+   if( a.rows() != a.columns() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid non-square matrix provided" );
+   }
+
+   resize( *L, a.pages(), a.rows(), a.columns(), false );
+
+   if( !llh_backend( a, *L, BoolConstant< IsFloatingPoint_v<ET> >() ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Decomposition of singular matrix failed" );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief In-place page-wise inversion of the given dense tensor.
+// \ingroup dense_tensor
+//
+// \param A The tensor to be inverted.
+// \return void
+// \exception std::invalid_argument Invalid non-square tensor pages provided.
+// \exception std::invalid_argument Inversion of singular matrix failed.
+//
+// This function inverts every page of the given dense tensor \a A by means of an LU
+// decomposition with partial pivoting. In case the pages are not square, a
+// \a std::invalid_argument exception is thrown. In case any page is singular, a
+// \a std::invalid_argument exception is thrown and the content of \a A is unspecified:
+
+   \code
+   blaze::DynamicTensor<double> A( 64UL, 4UL, 4UL );
+   // ... Initialization of A
+
+   invert( A );  // In-place inversion of all pages of A
+   \endcode
+
+// Pages of single or double precision whose order is smaller than the
+// BLAZE_BATCHED_DECOMPOSITION_THRESHOLD are inverted by an interleaved Gauss-Jordan kernel
+// that processes one page per SIMD lane. All other pages are inverted by individual LAPACK
+// calls. The function only works for tensors of \c float, \c double, \c complex<float>, or
+// \c complex<double> element type. The attempt to call the function with tensors of any other
+// element type results in a compile time error!
+//
+// \note This function can only be used if a fitting LAPACK library is available and linked to
+// the executable. Otherwise a linker error will be created.
+*/
+template< typename MT >  // Type of the tensor to be inverted
+void invert( DenseTensor<MT>& A )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   using ET = ElementType_t<MT>;
+
+   BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( ET );
+
+   if( (*A).rows() != (*A).columns() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid non-square matrix provided" );
+   }
+
+   if( !invert_backend( *A, BoolConstant< IsFloatingPoint_v<ET> >() ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Inversion of singular matrix failed" );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Page-wise inversion of the given dense tensor.
+// \ingroup dense_tensor
+//
+// \param A The tensor to be inverted.
+// \return The tensor of the inverted pages.
+// \exception std::invalid_argument Invalid non-square tensor pages provided.
+// \exception std::invalid_argument Inversion of singular matrix failed.
+//
+// This function returns a tensor containing the inverses of all pages of the given dense
+// tensor \a A (see the invert() function for details):
+
+   \code
+   blaze::DynamicTensor<double> A( 64UL, 4UL, 4UL );
+   // ... Initialization of A
+   blaze::DynamicTensor<double> B;
+
+   B = inv( A );  // Inversion of all pages of A
+   \endcode
+*/
+template< typename MT >  // Type of the tensor to be inverted
+DynamicTensor< ElementType_t<MT> > inv( const DenseTensor<MT>& A )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   DynamicTensor< ElementType_t<MT> > tmp( *A );
+   invert( tmp );
+
+   return tmp;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Page-wise solution of the linear systems \f$ A_k X_k = B_k \f$.
+// \ingroup dense_tensor
+//
+// \param A The tensor of system matrices.
+// \param X The resulting tensor of solutions.
+// \param B The tensor of right-hand sides.
+// \return void
+// \exception std::invalid_argument Invalid non-square tensor pages provided.
+// \exception std::invalid_argument Tensor sizes do not match.
+// \exception std::invalid_argument Dimensions of fixed size tensor do not match.
+// \exception std::invalid_argument Solution of singular system failed.
+//
+// This function solves the linear system \f$ A_k X_k = B_k \f$ for every page \f$ k \f$ of the
+// given \f$ o \times n \times n \f$ tensor \a A and the \f$ o \times n \times q \f$ tensor \a B
+// of right-hand sides by means of an LU decomposition with partial pivoting. In case any
+// system matrix is singular, a \a std::invalid_argument exception is thrown and the content of
+// \a X is unspecified:
+
+   \code
+   blaze::DynamicTensor<double> A( 64UL, 4UL, 4UL ), B( 64UL, 4UL, 2UL );
+   // ... Initialization of A and B
+   blaze::DynamicTensor<double> X;
+
+   solve( A, X, B );  // Solution of all 64 linear systems
+   \endcode
+
+// Systems of single or double precision whose order is smaller than the
+// BLAZE_BATCHED_DECOMPOSITION_THRESHOLD are solved by an interleaved kernel that processes one
+// system per SIMD lane. All other systems are solved on the basis of individual LAPACK calls.
+// The function only works for tensors of \c float, \c double, \c complex<float>, or
+// \c complex<double> element type. The attempt to call the function with tensors of any other
+// element type results in a compile time error!
+//
+// \note This function can only be used if a fitting LAPACK library is available and linked to
+// the executable. Otherwise a linker error will be created.
+*/
+template< typename MT1    // Type of the system tensor
+        , typename MT2    // Type of the solution tensor
+        , typename MT3 >  // Type of the right-hand side tensor
+void solve( const DenseTensor<MT1>& A, DenseTensor<MT2>& X, const DenseTensor<MT3>& B )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   using ET = ElementType_t<MT1>;
+
+   BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( ET );
+   BLAZE_CONSTRAINT_MUST_BE_SAME_TYPE( ET, ElementType_t<MT3> );
+
+   CompositeType_t<MT1> a( *A );
+   CompositeType_t<MT3> b( *B );
+
+   if( a.rows() != a.columns() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid non-square matrix provided" );
+   }
+
+   if( a.pages() != b.pages() || a.rows() != b.rows() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Tensor sizes do not match" );
+   }
+
+   resize( *X, b.pages(), b.rows(), b.columns(), false );
+
+   if( !solve_backend( a, *X, b, BoolConstant< IsFloatingPoint_v<ET> >() ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Solution of singular system failed" );
+   }
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
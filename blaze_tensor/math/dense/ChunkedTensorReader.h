@@ -0,0 +1,565 @@
+//=================================================================================================
+/*!
+//  \file blaze_tensor/math/dense/ChunkedTensorReader.h
+//  \brief Header file for the ChunkedTensorReader class template
+//
+//  Copyright (C) 2012-2018 Klaus Iglberger - All Rights Reserved
+//  Copyright (C) 2018 Hartmut Kaiser - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+
+#ifndef _BLAZE_TENSOR_MATH_DENSE_CHUNKEDTENSORREADER_H_
+#define _BLAZE_TENSOR_MATH_DENSE_CHUNKEDTENSORREADER_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <fstream>
+#include <future>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <blaze/math/AlignmentFlag.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/PaddingFlag.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/FunctionTrace.h>
+#include <blaze/util/Memory.h>
+#include <blaze/util/policies/Deallocate.h>
+#include <blaze/util/StaticAssert.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsNumeric.h>
+
+#include <blaze_tensor/math/dense/CustomTensor.h>
+#include <blaze_tensor/math/dense/MappedFormat.h>
+#include <blaze_tensor/math/ZeroPadded.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Double-buffered chunk-wise reader for tensor files.
+// \ingroup mapped_tensor
+//
+// The ChunkedTensorReader class template processes a tensor file (as written by writeMapped())
+// that does not fit into memory in chunks of consecutive pages. Each chunk is exposed as an
+// aligned and padded CustomTensor referring to one of a fixed pool of aligned buffers. While
+// the current chunk is processed, the following chunks are read into the remaining buffers by
+// background tasks, such that file input and computation overlap:
+
+   \code
+   blaze::ChunkedTensorReader<float> reader( "data.tensor", 16UL );  // 16 pages per chunk
+
+   double total( 0.0 );
+   while( reader.next() ) {
+      // reader.chunk() refers to the pages [reader.firstPage(), reader.firstPage()+reader.chunkPages())
+      total += sum( reader.chunk() );
+   }
+   \endcode
+
+// With \a buffers buffers, the \a buffers-1 chunks following the current chunk are read ahead
+// (i.e. with the default of two buffers the reader is double-buffered). Since the rows in the
+// file are already aligned and padded, each chunk is read with a single read operation directly
+// into its buffer, i.e. without any further copy. The memory footprint of the reader is \a buffers
+// times the size of a chunk, independent of the size of the file.
+//
+// A chunk remains valid until the next call to next(). Modifications of a chunk are not written
+// back to the file. Errors of background reads are rethrown by the call to next() that makes
+// the according chunk current.
+*/
+template< typename Type >  // Data type of the tensor
+class ChunkedTensorReader
+{
+ public:
+   //**Type definitions****************************************************************************
+   using ElementType = Type;                               //!< Type of the tensor elements.
+   using TensorType  = CustomTensor<Type,aligned,padded>;  //!< Type of a single chunk.
+   //**********************************************************************************************
+
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit inline ChunkedTensorReader( const std::string& path, size_t chunkPages, size_t buffers = 2UL );
+
+   ChunkedTensorReader( const ChunkedTensorReader& ) = delete;
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   /*!\name Destructor */
+   //@{
+   inline ~ChunkedTensorReader();
+   //@}
+   //**********************************************************************************************
+
+   //**Assignment operators************************************************************************
+   /*!\name Assignment operators */
+   //@{
+   ChunkedTensorReader& operator=( const ChunkedTensorReader& ) = delete;
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline bool              next();
+   inline TensorType&       chunk() noexcept;
+   inline const TensorType& chunk() const noexcept;
+   inline size_t            firstPage() const noexcept;
+   inline size_t            chunkPages() const noexcept;
+   inline size_t            chunks() const noexcept;
+   inline size_t            requested() const noexcept;
+   inline size_t            pages() const noexcept;
+   inline size_t            rows() const noexcept;
+   inline size_t            columns() const noexcept;
+   inline size_t            spacing() const noexcept;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Type definitions****************************************************************************
+   /*!\brief A single buffer of the pool, including the stream used to fill it. */
+   struct Slot {
+      std::unique_ptr< Type[], Deallocate > memory;  //!< The aligned buffer.
+      std::ifstream                         stream;  //!< The input stream of the background reads.
+      std::future<void>                     task;    //!< The pending background read.
+   };
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline void   prefetch( size_t index );
+   inline size_t pagesOf( size_t index ) const noexcept;
+   inline void   wait() noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string       path_;       //!< The path of the tensor file.
+   size_t            pages_;      //!< The number of pages of the tensor.
+   size_t            rows_;       //!< The number of rows of the tensor.
+   size_t            columns_;    //!< The number of columns of the tensor.
+   size_t            spacing_;    //!< The spacing between two rows.
+   size_t            offset_;     //!< The byte offset of the first element in the file.
+   size_t            chunk_;      //!< The number of pages per chunk.
+   size_t            current_;    //!< The index of the current chunk (chunks() before the first, chunks()+1 after the last chunk).
+   size_t            requested_;  //!< The number of chunks whose background read has been started.
+   std::vector<Slot> slots_;      //!< The pool of buffers.
+   TensorType        tensor_;     //!< The tensor referring to the current chunk.
+   //@}
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_STATIC_ASSERT_MSG( IsNumeric_v<Type>, "Chunked tensor readers require numeric element types" );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Opens a tensor file for chunk-wise reading.
+//
+// \param path The path of the tensor file.
+// \param chunkPages The number of pages per chunk.
+// \param buffers The number of buffers (at least 2).
+// \exception std::invalid_argument Invalid tensor file or invalid chunk setup.
+// \exception std::runtime_error File could not be read.
+//
+// The constructor validates the file and immediately starts reading the first \a buffers chunks
+// in the background, i.e. the first chunk and the \a buffers-1 chunks following it.
+*/
+template< typename Type >  // Data type of the tensor
+inline ChunkedTensorReader<Type>::ChunkedTensorReader( const std::string& path, size_t chunkPages, size_t buffers )
+   : path_     ( path )        // The path of the tensor file
+   , pages_    ( 0UL )         // The number of pages of the tensor
+   , rows_     ( 0UL )         // The number of rows of the tensor
+   , columns_  ( 0UL )         // The number of columns of the tensor
+   , spacing_  ( 0UL )         // The spacing between two rows
+   , offset_   ( 0UL )         // The byte offset of the first element in the file
+   , chunk_    ( chunkPages )  // The number of pages per chunk
+   , current_  ( 0UL )         // The index of the current chunk
+   , requested_( 0UL )         // The number of chunks whose background read has been started
+   , slots_    ( buffers )     // The pool of buffers
+   , tensor_   ()              // The tensor referring to the current chunk
+{
+   if( chunkPages == 0UL || buffers < 2UL ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid chunk setup" );
+   }
+
+   std::ifstream is( path, std::ios::binary );
+
+   if( !is ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Unable to open tensor file" );
+   }
+
+   is.seekg( 0, std::ios::end );
+   const size_t fileSize( static_cast<size_t>( is.tellg() ) );
+   const size_t size( std::min( fileSize, MappedFormat::dataAlignment ) );
+
+   std::vector<char> header( size );
+   is.seekg( 0, std::ios::beg );
+   if( !is.read( header.data(), static_cast<std::streamsize>( size ) ) ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Unable to read tensor file" );
+   }
+
+   size_t dims[3];
+   offset_  = parseMappedHeader<Type>( header.data(), size, fileSize, dims, 3UL, spacing_ );
+   columns_ = dims[0];
+   rows_    = dims[1];
+   pages_   = dims[2];
+   current_ = chunks();
+
+   for( Slot& slot : slots_ ) {
+      slot.memory.reset( allocate<Type>( std::max( chunk_ * rows_ * spacing_, size_t( 1UL ) ) ) );
+      slot.stream.open( path, std::ios::binary );
+
+      if( !slot.stream ) {
+         BLAZE_THROW_RUNTIME_ERROR( "Unable to open tensor file" );
+      }
+   }
+
+   for( size_t index=0UL; index<buffers; ++index ) {
+      prefetch( index );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DESTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The destructor for ChunkedTensorReader.
+//
+// The destructor waits for all pending background reads.
+*/
+template< typename Type >  // Data type of the tensor
+inline ChunkedTensorReader<Type>::~ChunkedTensorReader()
+{
+   wait();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Advances to the next chunk.
+//
+// \return \a true if a new chunk is available, \a false if all chunks have been processed.
+// \exception std::runtime_error Background read failed.
+//
+// The buffer of the previous chunk is released and immediately refilled with the chunk
+// \a buffers positions ahead of it. The function then waits until the next chunk is available,
+// such that the \a buffers-1 chunks following the returned chunk are being read in the
+// background while it is processed.
+*/
+template< typename Type >  // Data type of the tensor
+inline bool ChunkedTensorReader<Type>::next()
+{
+   BLAZE_FUNCTION_TRACE;
+
+   const size_t count( chunks() );
+
+   if( current_ > count ) {
+      return false;
+   }
+
+   const size_t index( current_ == count ? 0UL : current_ + 1UL );
+
+   if( current_ != count ) {
+      tensor_ = TensorType();
+      prefetch( current_ + slots_.size() );
+   }
+
+   if( index == count ) {
+      current_ = count + 1UL;
+      return false;
+   }
+
+   Slot& slot( slots_[index % slots_.size()] );
+
+   BLAZE_INTERNAL_ASSERT( slot.task.valid(), "Chunk has not been prefetched" );
+
+   slot.task.get();
+
+   current_ = index;
+   tensor_  = TensorType( zero_padded, slot.memory.get(), pagesOf( index ), rows_, columns_, spacing_ );
+
+   return true;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the current chunk.
+//
+// \return Reference to the tensor referring to the current chunk.
+*/
+template< typename Type >  // Data type of the tensor
+inline typename ChunkedTensorReader<Type>::TensorType& ChunkedTensorReader<Type>::chunk() noexcept
+{
+   return tensor_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the current chunk.
+//
+// \return Reference to the tensor referring to the current chunk.
+*/
+template< typename Type >  // Data type of the tensor
+inline const typename ChunkedTensorReader<Type>::TensorType& ChunkedTensorReader<Type>::chunk() const noexcept
+{
+   return tensor_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the index of the first page of the current chunk within the tensor.
+//
+// \return The index of the first page of the current chunk.
+*/
+template< typename Type >  // Data type of the tensor
+inline size_t ChunkedTensorReader<Type>::firstPage() const noexcept
+{
+   return current_ * chunk_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of pages of the current chunk.
+//
+// \return The number of pages of the current chunk.
+//
+// All chunks consist of the number of pages specified on construction, except for the last
+// chunk, which may be smaller.
+*/
+template< typename Type >  // Data type of the tensor
+inline size_t ChunkedTensorReader<Type>::chunkPages() const noexcept
+{
+   return tensor_.pages();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the total number of chunks.
+//
+// \return The number of chunks of the tensor.
+*/
+template< typename Type >  // Data type of the tensor
+inline size_t ChunkedTensorReader<Type>::chunks() const noexcept
+{
+   return ( pages_ + chunk_ - 1UL ) / chunk_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of chunks whose background read has been started.
+//
+// \return The number of requested chunks.
+//
+// Chunks are requested in order, i.e. the chunks \f$ [0..requested()) \f$ have been requested.
+*/
+template< typename Type >  // Data type of the tensor
+inline size_t ChunkedTensorReader<Type>::requested() const noexcept
+{
+   return requested_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of pages of the complete tensor.
+//
+// \return The number of pages of the tensor.
+*/
+template< typename Type >  // Data type of the tensor
+inline size_t ChunkedTensorReader<Type>::pages() const noexcept
+{
+   return pages_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of rows of the tensor.
+//
+// \return The number of rows of the tensor.
+*/
+template< typename Type >  // Data type of the tensor
+inline size_t ChunkedTensorReader<Type>::rows() const noexcept
+{
+   return rows_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of columns of the tensor.
+//
+// \return The number of columns of the tensor.
+*/
+template< typename Type >  // Data type of the tensor
+inline size_t ChunkedTensorReader<Type>::columns() const noexcept
+{
+   return columns_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the spacing between the beginning of two rows.
+//
+// \return The spacing between the beginning of two rows.
+*/
+template< typename Type >  // Data type of the tensor
+inline size_t ChunkedTensorReader<Type>::spacing() const noexcept
+{
+   return spacing_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Starts the background read of the given chunk.
+//
+// \param index The index of the chunk.
+// \return void
+//
+// The chunk is read into the buffer \a index modulo the number of buffers. Indices beyond the
+// last chunk are ignored.
+*/
+template< typename Type >  // Data type of the tensor
+inline void ChunkedTensorReader<Type>::prefetch( size_t index )
+{
+   if( index >= chunks() ) return;
+
+   BLAZE_INTERNAL_ASSERT( index == requested_, "Chunks must be requested in order" );
+
+   Slot& slot( slots_[index % slots_.size()] );
+
+   const size_t rowBytes( rows_ * spacing_ * sizeof( Type ) );
+   const size_t position( offset_ + index * chunk_ * rowBytes );
+   const size_t bytes   ( pagesOf( index ) * rowBytes );
+
+   std::ifstream& stream( slot.stream );
+   char* const    buffer( reinterpret_cast<char*>( slot.memory.get() ) );
+
+   slot.task = std::async( std::launch::async, [&stream,buffer,position,bytes]()
+   {
+      stream.clear();
+      stream.seekg( static_cast<std::streamoff>( position ) );
+
+      if( !stream.read( buffer, static_cast<std::streamsize>( bytes ) ) ) {
+         BLAZE_THROW_RUNTIME_ERROR( "Unable to read tensor chunk" );
+      }
+   } );
+
+   ++requested_;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the number of pages of the given chunk.
+//
+// \param index The index of the chunk.
+// \return The number of pages of the chunk.
+*/
+template< typename Type >  // Data type of the tensor
+inline size_t ChunkedTensorReader<Type>::pagesOf( size_t index ) const noexcept
+{
+   return std::min( chunk_, pages_ - index * chunk_ );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Waits for all pending background reads, discarding their errors.
+//
+// \return void
+*/
+template< typename Type >  // Data type of the tensor
+inline void ChunkedTensorReader<Type>::wait() noexcept
+{
+   for( Slot& slot : slots_ ) {
+      if( slot.task.valid() ) {
+         slot.task.wait();
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
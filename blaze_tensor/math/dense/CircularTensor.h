@@ -0,0 +1,407 @@
+//=================================================================================================
+/*!
+//  \file blaze_tensor/math/dense/CircularTensor.h
+//  \brief Header file for the CircularTensor class template
+//
+//  Copyright (C) 2012-2018 Klaus Iglberger - All Rights Reserved
+//  Copyright (C) 2018 Hartmut Kaiser - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+
+#ifndef _BLAZE_TENSOR_MATH_DENSE_CIRCULARTENSOR_H_
+#define _BLAZE_TENSOR_MATH_DENSE_CIRCULARTENSOR_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+
+#include <blaze/math/AlignmentFlag.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/PaddingFlag.h>
+#include <blaze/math/StorageOrder.h>
+#include <blaze/math/dense/CustomMatrix.h>
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/FunctionTrace.h>
+#include <blaze/util/Types.h>
+
+#include <blaze_tensor/math/dense/DynamicTensor.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Ring buffer of the last \a K pages of a stream of matrices.
+// \ingroup dense_tensor
+//
+// The CircularTensor class template keeps the most recent \a K pages of a stream of
+// \f$ M \times N \f$ matrices, e.g. the sliding window of a time series. Pushing a page writes it
+// into the storage of the oldest page once the window is full; the remaining pages are never
+// moved. The pages are accessed in chronological order via page(), which returns a matrix view
+// on the storage:
+
+   \code
+   blaze::CircularTensor<double> window( 8UL, 16UL, 32UL );  // The last 8 pages of 16x32 matrices
+   blaze::DynamicMatrix<double> sample( 16UL, 32UL );
+
+   for( ... ) {
+      // ... Computing the next sample
+      window.push( sample );
+      const double latest = max( window.page( window.pages()-1UL ) );
+   }
+
+   blaze::DynamicTensor<double> ordered;
+   window.copyTo( ordered );  // The pages in chronological order
+   \endcode
+
+// The underlying storage is a DynamicTensor with \a K pages (see storage()), in which the oldest
+// page is located at index head().
+*/
+template< typename Type >  // Data type of the tensor
+class CircularTensor
+{
+ public:
+   //**Type definitions****************************************************************************
+   using ElementType   = Type;                                                   //!< Type of the elements.
+   using StorageType   = DynamicTensor<Type>;                                    //!< Type of the storage.
+   using PageType      = CustomMatrix<Type,unaligned,unpadded,rowMajor>;        //!< Type of a page view.
+   using ConstPageType = CustomMatrix<const Type,unaligned,unpadded,rowMajor>;  //!< Type of a constant page view.
+   //**********************************************************************************************
+
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit inline CircularTensor( size_t window, size_t m, size_t n );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   template< typename MT, bool SO > inline void push( const DenseMatrix<MT,SO>& mat );
+
+   inline PageType           page( size_t k );
+   inline ConstPageType      page( size_t k ) const;
+   inline size_t             pages() const noexcept;
+   inline size_t             window() const noexcept;
+   inline size_t             rows() const noexcept;
+   inline size_t             columns() const noexcept;
+   inline bool               full() const noexcept;
+   inline size_t             head() const noexcept;
+   inline const StorageType& storage() const noexcept;
+   inline void               clear() noexcept;
+   inline void               copyTo( DynamicTensor<Type>& tens ) const;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t slot( size_t k ) const noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   StorageType storage_;  //!< The storage of all pages of the window.
+   size_t      head_;     //!< The storage index of the oldest page.
+   size_t      pages_;    //!< The current number of pages.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for a window of \a window pages of size \f$ m \times n \f$.
+//
+// \param window The maximum number of pages.
+// \param m The number of rows of each page.
+// \param n The number of columns of each page.
+// \exception std::invalid_argument Invalid window size.
+//
+// The window is initially empty.
+*/
+template< typename Type >  // Data type of the tensor
+inline CircularTensor<Type>::CircularTensor( size_t window, size_t m, size_t n )
+   : storage_( window, m, n )  // The storage of all pages of the window
+   , head_   ( 0UL )           // The storage index of the oldest page
+   , pages_  ( 0UL )           // The current number of pages
+{
+   if( window == 0UL ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid window size" );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Appends a page to the window.
+//
+// \param mat The matrix to be appended as most recent page.
+// \return void
+// \exception std::invalid_argument Matrix sizes do not match.
+//
+// In case the window is full, the oldest page is dropped and its storage is overwritten by the
+// given matrix. No other page is moved.
+*/
+template< typename Type >  // Data type of the tensor
+template< typename MT      // Type of the matrix
+        , bool SO >        // Storage order of the matrix
+inline void CircularTensor<Type>::push( const DenseMatrix<MT,SO>& mat )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   if( (*mat).rows() != rows() || (*mat).columns() != columns() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix sizes do not match" );
+   }
+
+   const size_t target( pages_ < window() ? slot( pages_ ) : head_ );
+
+   if( rows() > 0UL && columns() > 0UL ) {
+      PageType page( storage_.data( 0UL, target ), rows(), columns(), storage_.spacing() );
+      page = *mat;
+   }
+
+   if( pages_ < window() ) {
+      ++pages_;
+   }
+   else {
+      head_ = ( head_ + 1UL ) % window();
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns a view on the given page.
+//
+// \param k The chronological index of the page (0 for the oldest page).
+// \return View on the page.
+*/
+template< typename Type >  // Data type of the tensor
+inline typename CircularTensor<Type>::PageType CircularTensor<Type>::page( size_t k )
+{
+   BLAZE_USER_ASSERT( k < pages_, "Invalid page access index" );
+
+   return PageType( storage_.data( 0UL, slot( k ) ), rows(), columns(), storage_.spacing() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns a view on the given page.
+//
+// \param k The chronological index of the page (0 for the oldest page).
+// \return View on the page.
+*/
+template< typename Type >  // Data type of the tensor
+inline typename CircularTensor<Type>::ConstPageType CircularTensor<Type>::page( size_t k ) const
+{
+   BLAZE_USER_ASSERT( k < pages_, "Invalid page access index" );
+
+   return ConstPageType( storage_.data( 0UL, slot( k ) ), rows(), columns(), storage_.spacing() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the current number of pages.
+//
+// \return The number of pages in the window.
+*/
+template< typename Type >  // Data type of the tensor
+inline size_t CircularTensor<Type>::pages() const noexcept
+{
+   return pages_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the maximum number of pages.
+//
+// \return The size of the window.
+*/
+template< typename Type >  // Data type of the tensor
+inline size_t CircularTensor<Type>::window() const noexcept
+{
+   return storage_.pages();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of rows of each page.
+//
+// \return The number of rows.
+*/
+template< typename Type >  // Data type of the tensor
+inline size_t CircularTensor<Type>::rows() const noexcept
+{
+   return storage_.rows();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of columns of each page.
+//
+// \return The number of columns.
+*/
+template< typename Type >  // Data type of the tensor
+inline size_t CircularTensor<Type>::columns() const noexcept
+{
+   return storage_.columns();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the window is full.
+//
+// \return \a true if the window contains \a window() pages, \a false if not.
+*/
+template< typename Type >  // Data type of the tensor
+inline bool CircularTensor<Type>::full() const noexcept
+{
+   return pages_ == window();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the storage index of the oldest page.
+//
+// \return The index of the oldest page within storage().
+*/
+template< typename Type >  // Data type of the tensor
+inline size_t CircularTensor<Type>::head() const noexcept
+{
+   return head_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the underlying storage.
+//
+// \return Reference to the storage of all pages.
+//
+// The pages in the storage are not in chronological order; the oldest page is located at
+// index head().
+*/
+template< typename Type >  // Data type of the tensor
+inline const typename CircularTensor<Type>::StorageType& CircularTensor<Type>::storage() const noexcept
+{
+   return storage_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Removes all pages from the window.
+//
+// \return void
+*/
+template< typename Type >  // Data type of the tensor
+inline void CircularTensor<Type>::clear() noexcept
+{
+   head_  = 0UL;
+   pages_ = 0UL;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Copies all pages in chronological order into the given tensor.
+//
+// \param tens The target tensor (resized to pages() pages).
+// \return void
+*/
+template< typename Type >  // Data type of the tensor
+inline void CircularTensor<Type>::copyTo( DynamicTensor<Type>& tens ) const
+{
+   BLAZE_FUNCTION_TRACE;
+
+   tens.resize( pages_, rows(), columns(), false );
+
+   for( size_t k=0UL; k<pages_; ++k ) {
+      for( size_t i=0UL; i<rows(); ++i ) {
+         const Type* row( storage_.data( i, slot( k ) ) );
+         std::copy( row, row+columns(), tens.data( i, k ) );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the storage index of the given page.
+//
+// \param k The chronological index of the page.
+// \return The storage index of the page.
+*/
+template< typename Type >  // Data type of the tensor
+inline size_t CircularTensor<Type>::slot( size_t k ) const noexcept
+{
+   return ( head_ + k ) % window();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -51,9 +51,11 @@
 #include <blaze_tensor/math/InitializerList.h>
 #include <blaze_tensor/math/expressions/DenseArray.h>
 #include <blaze_tensor/math/SMP.h>
+#include <blaze_tensor/math/ZeroPadded.h>
 #include <blaze_tensor/math/traits/QuatSliceTrait.h>
 #include <blaze_tensor/math/typetraits/IsDenseArray.h>
 #include <blaze_tensor/math/typetraits/IsNdArray.h>
+#include <blaze_tensor/system/Thresholds.h>
 
 namespace blaze {
 
@@ -423,6 +425,8 @@ class CustomArray
    explicit inline CustomArray();
    template< typename... Dims >
    explicit inline CustomArray( Type const* ptr, Dims... dims );
+   template< typename... Dims >
+   explicit inline CustomArray( ZeroPadded, Type const* ptr, Dims... dims );
 
    inline CustomArray( const CustomArray& m );
    inline CustomArray( CustomArray&& m ) noexcept;
@@ -806,6 +810,48 @@ inline CustomArray<N,Type,AF,PF,RT>::CustomArray( Type const* ptr, Dims... dims
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Constructor for an array on zero-padded memory.
+//
+// \param ptr The array of elements to be used by the array.
+// \param dims The dimensions of the array, followed by the spacing between two rows.
+// \exception std::invalid_argument Invalid setup of custom array.
+//
+// This constructor creates a custom array in the same way as the constructor taking an explicit
+// spacing, but it does not reset the padding elements. The caller guarantees that all padding
+// elements of the given array are already zero (see \a zero_padded). Therefore the construction
+// does not access the array of elements at all.
+//
+// \note The custom array does \b NOT take responsibility for the given array of elements!
+*/
+template< size_t N       // Dimensionality of the array
+        , typename Type  // Data type of the array
+        , AlignmentFlag AF  // Alignment flag
+        , PaddingFlag PF    // Padding flag
+        , typename RT >  // Result type
+template< typename... Dims >
+inline CustomArray<N,Type,AF,PF,RT>::CustomArray( ZeroPadded, Type const* ptr, Dims... dims )
+   : dims_ ( initDimensions( dims... ) )   // The current dimensions of the array
+   , nn_( initSpacing( dims... ) )         // The number of elements between two rows
+   , v_ ( const_cast< Type* BLAZE_RESTRICT >(ptr) )  // The custom array of elements
+{
+   BLAZE_STATIC_ASSERT( N + 1 == sizeof...( dims ) );
+
+   if( ptr == nullptr ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid array of elements" );
+   }
+
+   if( AF && ( !checkAlignment( ptr ) || nn_ % SIMDSIZE != 0UL ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid alignment detected" );
+   }
+
+   if( PF && IsVectorizable_v<Type> && ( nn_ < nextMultiple<size_t>( dims_[0], SIMDSIZE ) ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Insufficient capacity for padded array" );
+   }
+}
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief The copy constructor for CustomArray.
 //
@@ -2796,7 +2842,7 @@ template< size_t N       // Dimensionality of the array
         , typename RT >  // Result type
 inline bool CustomArray<N,Type,AF,PF,RT>::canSMPAssign() const noexcept
 {
-   return ( capacity() >= SMP_DMATASSIGN_THRESHOLD );
+   return ( capacity() >= smpDArrAssignThreshold() );
 }
 //*************************************************************************************************
 
@@ -48,10 +48,12 @@
 #include <blaze_tensor/math/Forward.h>
 #include <blaze_tensor/math/InitializerList.h>
 #include <blaze_tensor/math/Tensor.h>
+#include <blaze_tensor/math/ZeroPadded.h>
 #include <blaze_tensor/math/expressions/DenseTensor.h>
 #include <blaze_tensor/math/SMP.h>
 #include <blaze_tensor/math/typetraits/IsDenseTensor.h>
 #include <blaze_tensor/math/typetraits/IsTensor.h>
+#include <blaze_tensor/system/Thresholds.h>
 
 namespace blaze {
 
@@ -419,6 +421,7 @@ class CustomTensor
    explicit inline CustomTensor();
    explicit inline CustomTensor( Type* ptr, size_t o, size_t m, size_t n );
    explicit inline CustomTensor( Type* ptr, size_t o, size_t m, size_t n, size_t nn );
+   explicit inline CustomTensor( ZeroPadded, Type* ptr, size_t o, size_t m, size_t n, size_t nn );
 
    inline CustomTensor( const CustomTensor& m );
    inline CustomTensor( CustomTensor&& m ) noexcept;
@@ -776,6 +779,51 @@ inline CustomTensor<Type,AF,PF,RT>::CustomTensor( Type* ptr, size_t o, size_t m,
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Constructor for a tensor of size \f$ m \times n \f$ on zero-padded memory.
+//
+// \param ptr The array of elements to be used by the tensor.
+// \param o The number of pages of the array of elements.
+// \param m The number of rows of the array of elements.
+// \param n The number of columns of the array of elements.
+// \param nn The total number of elements between two rows/columns.
+// \exception std::invalid_argument Invalid setup of custom tensor.
+//
+// This constructor creates a custom tensor of size \f$ m \times n \f$ in the same way as the
+// constructor taking an explicit spacing, but it does not reset the padding elements. The
+// caller guarantees that all padding elements of the given array are already zero (see
+// \a zero_padded). Therefore the construction does not access the array of elements at all.
+// The construction fails for the same reasons as for the constructor taking an explicit
+// spacing.
+//
+// \note The custom tensor does \b NOT take responsibility for the given array of elements!
+*/
+template< typename Type  // Data type of the tensor
+        , AlignmentFlag AF        // Alignment flag
+        , PaddingFlag PF        // Padding flag
+        , typename RT >  // Result type
+inline CustomTensor<Type,AF,PF,RT>::CustomTensor( ZeroPadded, Type* ptr, size_t o, size_t m, size_t n, size_t nn )
+   : o_ ( o )    // The current number of pages of the tensor
+   , m_ ( m )    // The current number of rows of the tensor
+   , n_ ( n )    // The current number of columns of the tensor
+   , nn_( nn )   // The number of elements between two rows
+   , v_ ( ptr )  // The custom array of elements
+{
+   if( ptr == nullptr ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid array of elements" );
+   }
+
+   if( AF && ( !checkAlignment( ptr ) || nn_ % SIMDSIZE != 0UL ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid alignment detected" );
+   }
+
+   if( PF && IsVectorizable_v<Type> && ( nn_ < nextMultiple<size_t>( n_, SIMDSIZE ) ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Insufficient capacity for padded tensor" );
+   }
+}
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief The copy constructor for CustomTensor.
 //
@@ -2143,7 +2191,7 @@ template< typename Type  // Data type of the tensor
         , typename RT >  // Result type
 inline bool CustomTensor<Type,AF,PF,RT>::canSMPAssign() const noexcept
 {
-   return ( rows() * columns() * pages() >= SMP_DMATASSIGN_THRESHOLD );
+   return ( rows() * columns() * pages() >= smpDTensAssignThreshold() );
 }
 //*************************************************************************************************
 
@@ -45,6 +45,7 @@
 #include <blaze/math/constraints/RequiresEvaluation.h>
 #include <blaze/math/shims/Equal.h>
 #include <blaze/math/shims/IsDefault.h>
+#include <blaze/math/shims/IsFinite.h>
 #include <blaze/math/shims/IsNaN.h>
 #include <blaze/math/shims/IsOne.h>
 #include <blaze/math/shims/IsReal.h>
@@ -61,6 +62,7 @@
 #include <blaze/util/typetraits/RemoveCV.h>
 #include <blaze/util/typetraits/RemoveReference.h>
 
+#include <blaze_tensor/math/dense/ParallelAnyOf.h>
 // #include <blaze_tensor/math/expressions/DTensDTensAddExpr.h>
 #include <blaze_tensor/math/expressions/DArrDArrEqualExpr.h>
 #include <blaze_tensor/math/expressions/DArrDArrMapExpr.h>
@@ -69,6 +71,7 @@
 // #include <blaze_tensor/math/expressions/DTensDTensSubExpr.h>
 // #include <blaze_tensor/math/expressions/DTensEvalExpr.h>
 #include <blaze_tensor/math/expressions/DArrMapExpr.h>
+#include <blaze_tensor/math/expressions/DArrNaryMapExpr.h>
 #include <blaze_tensor/math/expressions/DTensNormExpr.h>
 #include <blaze_tensor/math/expressions/DArrReduceExpr.h>
 #include <blaze_tensor/math/expressions/DArrScalarDivExpr.h>
@@ -362,6 +365,16 @@ inline auto operator/=( DenseArray<TT>&& arr, ST scalar )
 template< typename TT >
 bool isnan( const DenseArray<TT>& dm );
 
+template< typename TT >
+bool isfinite( const DenseArray<TT>& dm );
+
+template< RelaxationFlag RF, typename TT >
+bool isZero( const DenseArray<TT>& dm );
+
+template< typename TT1, typename TT2 >
+bool allclose( const DenseArray<TT1>& lhs, const DenseArray<TT2>& rhs,
+               double rtol = 1E-5, double atol = 1E-8 );
+
 // template< RelaxationFlag RF, typename MT >
 // bool isSymmetric( const DenseArray<MT>& dm );
 //
@@ -431,10 +444,87 @@ bool isnan( const DenseArray<TT>& dm )
 
    CT A( *dm );  // Evaluation of the dense array operand
 
-   return ArrayForEachGroupedAnyOf(
-      ( *dm ).dimensions(), [&]( std::array< size_t, N > const& dims ) {
-         return isnan( A( dims ) );
-      } );
+   return arrayAnyOf( A.dimensions(), [&]( std::array< size_t, N > const& dims ) {
+      return isnan( A( dims ) );
+   } );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checks if all elements of the given dense array are finite.
+// \ingroup dense_tensor
+//
+// \param dm The array to be checked.
+// \return \a true if all elements of the array are finite, \a false otherwise.
+//
+// This function checks the dense array for infinite and not-a-number (NaN) elements. If all
+// elements of the array are finite, the function returns \a true, otherwise it returns \a false.
+
+   \code
+   blaze::DynamicArray<3,double> A( 5UL, 3UL, 4UL );
+   // ... Initialization
+   if( !isfinite( A ) ) { ... }
+   \endcode
+
+// The check stops at the first non-finite element. Large arrays are checked in parallel.
+//
+// Note that this function only works for arrays with built-in or complex element types.
+*/
+template< typename TT > // Type of the dense array
+bool isfinite( const DenseArray<TT>& dm )
+{
+   using CT = CompositeType_t<TT>;
+
+   constexpr size_t N =
+      RemoveCV_t< RemoveReference_t< decltype( *dm ) > >::num_dimensions;
+
+   CT A( *dm );  // Evaluation of the dense array operand
+
+   return !arrayAnyOf( A.dimensions(), [&]( std::array< size_t, N > const& dims ) {
+      return !isfinite( A( dims ) );
+   } );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checks if the given dense array is a zero array.
+// \ingroup dense_tensor
+//
+// \param dm The dense array to be checked.
+// \return \a true if the array is a zero array, \a false if not.
+//
+// This function checks if the given dense array is a zero array, i.e. if all its elements are
+// zero. The check stops at the first non-zero element. Large arrays are checked in parallel.
+
+   \code
+   blaze::DynamicArray<3,double> A;
+   // ... Initialization
+   if( isZero( A ) ) { ... }
+   \endcode
+
+// Optionally, it is possible to switch between strict semantics (blaze::strict) and relaxed
+// semantics (blaze::relaxed):
+
+   \code
+   if( isZero<relaxed>( A ) ) { ... }
+   \endcode
+*/
+template< RelaxationFlag RF  // Relaxation flag
+        , typename TT >      // Type of the dense array
+bool isZero( const DenseArray<TT>& dm )
+{
+   using CT = CompositeType_t<TT>;
+
+   constexpr size_t N =
+      RemoveCV_t< RemoveReference_t< decltype( *dm ) > >::num_dimensions;
+
+   CT A( *dm );  // Evaluation of the dense array operand
+
+   return !arrayAnyOf( A.dimensions(), [&]( std::array< size_t, N > const& dims ) {
+      return !isZero<RF>( A( dims ) );
+   } );
 }
 //*************************************************************************************************
 
@@ -486,10 +576,9 @@ bool isUniform_backend( const DenseArray<MT>& dm )
    std::array< size_t, N > dims{};
    const auto& cmp( (*dm)( dims ) );
 
-   return ArrayForEachGroupedAllOf( ( *dm ).dimensions(),
-      [&]( std::array< size_t, N > const& ds ) {
-         return equal< RF >( ( *dm )( ds ), cmp );
-      } );
+   return !arrayAnyOf( ( *dm ).dimensions(), [&]( std::array< size_t, N > const& ds ) {
+      return !equal< RF >( ( *dm )( ds ), cmp );
+   } );
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -550,6 +639,52 @@ bool isUniform( const DenseArray<MT>& dm )
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Checks if two dense arrays are element-wise equal within a tolerance.
+// \ingroup dense_tensor
+//
+// \param lhs The left-hand side dense array.
+// \param rhs The right-hand side (reference) dense array.
+// \param rtol The relative tolerance (default: 1E-5).
+// \param atol The absolute tolerance (default: 1E-8).
+// \return \a true if all elements are close, \a false if not.
+//
+// This function checks if the two given dense arrays have the same dimensions and if all
+// elements satisfy \f$ |a-b| \leq atol + rtol \cdot |b| \f$. The semantics follow NumPy's
+// \c allclose() function, i.e. infinite elements are only close to identical infinite elements
+// and not-a-number elements are never close. The check stops at the first element that is not
+// close, large arrays are checked in parallel.
+
+   \code
+   blaze::DynamicArray<3,double> A, B;
+   // ... Initialization
+   if( allclose( A, B, 1E-3, 1E-6 ) ) { ... }
+   \endcode
+
+// Note that this function only works for arrays with built-in or complex element types.
+*/
+template< typename TT1    // Type of the left-hand side dense array
+        , typename TT2 >  // Type of the right-hand side dense array
+bool allclose( const DenseArray<TT1>& lhs, const DenseArray<TT2>& rhs, double rtol, double atol )
+{
+   using CT1 = CompositeType_t<TT1>;
+   using CT2 = CompositeType_t<TT2>;
+
+   constexpr size_t N =
+      RemoveCV_t< RemoveReference_t< decltype( *lhs ) > >::num_dimensions;
+
+   if( ( *lhs ).dimensions() != ( *rhs ).dimensions() )
+      return false;
+
+   CT1 A( *lhs );  // Evaluation of the left-hand side dense array operand
+   CT2 B( *rhs );  // Evaluation of the right-hand side dense array operand
+
+   return !arrayAnyOf( A.dimensions(), [&]( std::array< size_t, N > const& dims ) {
+      return !isClose( A( dims ), B( dims ), rtol, atol );
+   } );
+}
+//*************************************************************************************************
+
 } // namespace blaze
 
 #endif
@@ -41,24 +41,39 @@
 // Includes
 //*************************************************************************************************
 
+#include <limits>
+
 #include <blaze/math/Aliases.h>
+#include <blaze/math/SIMD.h>
 #include <blaze/math/constraints/RequiresEvaluation.h>
 #include <blaze/math/shims/Equal.h>
 #include <blaze/math/shims/IsDefault.h>
+#include <blaze/math/shims/IsFinite.h>
 #include <blaze/math/shims/IsNaN.h>
 #include <blaze/math/shims/IsOne.h>
 #include <blaze/math/shims/IsReal.h>
 #include <blaze/math/shims/IsZero.h>
+#include <blaze/math/typetraits/HasSIMDAdd.h>
+#include <blaze/math/typetraits/HasSIMDEqual.h>
+#include <blaze/math/typetraits/HasSIMDMax.h>
+#include <blaze/math/typetraits/HasSIMDMin.h>
+#include <blaze/math/typetraits/HasSIMDMult.h>
+#include <blaze/math/typetraits/HasSIMDSub.h>
 #include <blaze/math/typetraits/IsExpression.h>
 #include <blaze/math/typetraits/IsRestricted.h>
+#include <blaze/system/Optimizations.h>
 #include <blaze/util/Assert.h>
 #include <blaze/util/EnableIf.h>
 #include <blaze/util/IntegralConstant.h>
 #include <blaze/util/Types.h>
 #include <blaze/util/mpl/If.h>
 #include <blaze/util/typetraits/IsBuiltin.h>
+#include <blaze/util/typetraits/IsFloatingPoint.h>
 #include <blaze/util/typetraits/IsNumeric.h>
+#include <blaze/util/typetraits/IsSame.h>
+#include <blaze/util/typetraits/RemoveReference.h>
 
+#include <blaze_tensor/math/dense/ParallelAnyOf.h>
 #include <blaze_tensor/math/expressions/DTensDTensAddExpr.h>
 #include <blaze_tensor/math/expressions/DTensDTensEqualExpr.h>
 #include <blaze_tensor/math/expressions/DTensDTensMapExpr.h>
@@ -67,6 +82,7 @@
 #include <blaze_tensor/math/expressions/DTensDTensSubExpr.h>
 #include <blaze_tensor/math/expressions/DTensEvalExpr.h>
 #include <blaze_tensor/math/expressions/DTensMapExpr.h>
+#include <blaze_tensor/math/expressions/DTensNaryMapExpr.h>
 #include <blaze_tensor/math/expressions/DTensNormExpr.h>
 #include <blaze_tensor/math/expressions/DTensReduceExpr.h>
 #include <blaze_tensor/math/expressions/DTensScalarDivExpr.h>
@@ -353,6 +369,16 @@ inline auto operator/=( DenseTensor<TT>&& tens, ST scalar )
 template< typename TT >
 bool isnan( const DenseTensor<TT>& dm );
 
+template< typename TT >
+bool isfinite( const DenseTensor<TT>& dm );
+
+template< RelaxationFlag RF, typename TT >
+bool isZero( const DenseTensor<TT>& dm );
+
+template< typename TT1, typename TT2 >
+bool allclose( const DenseTensor<TT1>& lhs, const DenseTensor<TT2>& rhs,
+               double rtol = 1E-5, double atol = 1E-8 );
+
 // template< RelaxationFlag RF, typename MT >
 // bool isSymmetric( const DenseTensor<MT>& dm );
 //
@@ -392,6 +418,96 @@ auto softmax( const DenseTensor<MT>& dm );
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Auxiliary helper struct for the vectorized element checks of a dense tensor.
+// \ingroup dense_tensor
+*/
+template< typename TT >  // Type of the evaluated dense tensor
+struct DTensScanHelper
+{
+   //**Type definitions****************************************************************************
+   using ET = ElementType_t<TT>;  //!< Element type of the dense tensor.
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   //! Compilation switch for the vectorized comparison of the elements.
+   static constexpr bool compare =
+      ( useOptimizedKernels &&
+        TT::simdEnabled &&
+        HasSIMDEqual_v<ET,ET> );
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   //! Compilation switch for the vectorized check for non-finite elements.
+   static constexpr bool finite =
+      ( useOptimizedKernels &&
+        TT::simdEnabled &&
+        IsFloatingPoint_v<ET> &&
+        HasSIMDSub_v<ET,ET> );
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default check of a dense tensor for a non-finite element satisfying a predicate.
+// \ingroup dense_tensor
+//
+// \param A The dense tensor to be checked.
+// \param pred The predicate for a single element (only satisfied by non-finite elements).
+// \return \a true if at least one element satisfies the predicate, \a false if not.
+*/
+template< typename TT   // Type of the dense tensor
+        , typename F >  // Type of the predicate
+bool nonFiniteAnyOf_backend( const TT& A, const F& pred, FalseType )
+{
+   return tensorAnyOf<1UL>( A.pages(), A.rows(), A.columns(), pred, pred );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief SIMD optimized check of a dense tensor for a non-finite element satisfying a predicate.
+// \ingroup dense_tensor
+//
+// \param A The dense tensor to be checked.
+// \param pred The predicate for a single element (only satisfied by non-finite elements).
+// \return \a true if at least one element satisfies the predicate, \a false if not.
+//
+// For every SIMD pack the difference \f$ x - x \f$ is reduced. The result is zero if all elements
+// of the pack are finite and not-a-number otherwise. Only the elements of non-finite packs are
+// checked individually.
+*/
+template< typename TT   // Type of the dense tensor
+        , typename F >  // Type of the predicate
+bool nonFiniteAnyOf_backend( const TT& A, const F& pred, TrueType )
+{
+   using ET = ElementType_t<TT>;
+   using SIMDType = SIMDTrait_t<ET>;
+
+   constexpr size_t SIMDSIZE = SIMDTrait<ET>::size;
+
+   const auto simdPred( [&]( size_t k, size_t i, size_t j ) {
+      const SIMDType xmm( A.load(k,i,j) );
+      if( !isnan( sum( SIMDType( xmm - xmm ) ) ) )
+         return false;
+      for( size_t l=0UL; l<SIMDSIZE; ++l ) {
+         if( pred( k, i, j+l ) ) return true;
+      }
+      return false;
+   } );
+
+   return tensorAnyOf<SIMDSIZE>( A.pages(), A.rows(), A.columns(), simdPred, pred );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief Checks the given dense tensor for not-a-number elements.
 // \ingroup dense_tensor
@@ -409,6 +525,8 @@ auto softmax( const DenseTensor<MT>& dm );
    if( isnan( A ) ) { ... }
    \endcode
 
+// The check stops at the first not-a-number element. Large tensors are checked in parallel.
+//
 // Note that this function only works for matrices with floating point elements. The attempt to
 // use it for a tensor with a non-floating point element type results in a compile time error.
 */
@@ -419,14 +537,149 @@ bool isnan( const DenseTensor<TT>& dm )
 
    CT A( *dm );  // Evaluation of the dense tensor operand
 
-   for (size_t k=0UL; k<A.pages(); ++k) {
-      for (size_t i=0UL; i<A.rows(); ++i) {
-         for (size_t j=0UL; j<A.columns(); ++j)
-            if (isnan(A(k, i, j))) return true;
+   const auto pred( [&]( size_t k, size_t i, size_t j ) {
+      return isnan( A(k,i,j) );
+   } );
+
+   return nonFiniteAnyOf_backend(
+      A, pred, BoolConstant< DTensScanHelper< RemoveReference_t<CT> >::finite >() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checks if all elements of the given dense tensor are finite.
+// \ingroup dense_tensor
+//
+// \param dm The tensor to be checked.
+// \return \a true if all elements of the tensor are finite, \a false otherwise.
+//
+// This function checks the dense tensor for infinite and not-a-number (NaN) elements. If all
+// elements of the tensor are finite, the function returns \a true, otherwise it returns \a false.
+
+   \code
+   blaze::DynamicTensor<double> A( 5UL, 3UL, 4UL );
+   // ... Initialization
+   if( !isfinite( A ) ) { ... }
+   \endcode
+
+// The check stops at the first non-finite element. Large tensors are checked in parallel.
+//
+// Note that this function only works for tensors with built-in or complex element types.
+*/
+template< typename TT > // Type of the dense tensor
+bool isfinite( const DenseTensor<TT>& dm )
+{
+   using CT = CompositeType_t<TT>;
+
+   CT A( *dm );  // Evaluation of the dense tensor operand
+
+   const auto pred( [&]( size_t k, size_t i, size_t j ) {
+      return !isfinite( A(k,i,j) );
+   } );
+
+   return !nonFiniteAnyOf_backend(
+      A, pred, BoolConstant< DTensScanHelper< RemoveReference_t<CT> >::finite >() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default check whether the given dense tensor is a zero tensor.
+// \ingroup dense_tensor
+//
+// \param A The dense tensor to be checked.
+// \return \a true if the tensor is a zero tensor, \a false if not.
+*/
+template< RelaxationFlag RF  // Relaxation flag
+        , typename TT >      // Type of the dense tensor
+bool isZero_backend( const TT& A, FalseType )
+{
+   const auto nonzero( [&]( size_t k, size_t i, size_t j ) {
+      return !isZero<RF>( A(k,i,j) );
+   } );
+
+   return !tensorAnyOf<1UL>( A.pages(), A.rows(), A.columns(), nonzero, nonzero );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief SIMD optimized check whether the given dense tensor is a zero tensor.
+// \ingroup dense_tensor
+//
+// \param A The dense tensor to be checked.
+// \return \a true if the tensor is a zero tensor, \a false if not.
+//
+// SIMD packs that are exactly zero are accepted right away. The elements of all other packs are
+// checked individually, which takes the relaxation flag into account.
+*/
+template< RelaxationFlag RF  // Relaxation flag
+        , typename TT >      // Type of the dense tensor
+bool isZero_backend( const TT& A, TrueType )
+{
+   using ET = ElementType_t<TT>;
+   using SIMDType = SIMDTrait_t<ET>;
+
+   constexpr size_t SIMDSIZE = SIMDTrait<ET>::size;
+
+   const SIMDType zero( set( ET() ) );
+
+   const auto nonzero( [&]( size_t k, size_t i, size_t j ) {
+      return !isZero<RF>( A(k,i,j) );
+   } );
+
+   const auto simdNonzero( [&]( size_t k, size_t i, size_t j ) {
+      if( equal<strict>( A.load(k,i,j), zero ) )
+         return false;
+      for( size_t l=0UL; l<SIMDSIZE; ++l ) {
+         if( nonzero( k, i, j+l ) ) return true;
       }
-   }
+      return false;
+   } );
+
+   return !tensorAnyOf<SIMDSIZE>( A.pages(), A.rows(), A.columns(), simdNonzero, nonzero );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checks if the given dense tensor is a zero tensor.
+// \ingroup dense_tensor
+//
+// \param dm The dense tensor to be checked.
+// \return \a true if the tensor is a zero tensor, \a false if not.
+//
+// This function checks if the given dense tensor is a zero tensor, i.e. if all its elements are
+// zero. The check stops at the first non-zero element. Large tensors are checked in parallel.
+
+   \code
+   blaze::DynamicTensor<double> A;
+   // ... Initialization
+   if( isZero( A ) ) { ... }
+   \endcode
+
+// Optionally, it is possible to switch between strict semantics (blaze::strict) and relaxed
+// semantics (blaze::relaxed):
+
+   \code
+   if( isZero<relaxed>( A ) ) { ... }
+   \endcode
+*/
+template< RelaxationFlag RF  // Relaxation flag
+        , typename TT >      // Type of the dense tensor
+bool isZero( const DenseTensor<TT>& dm )
+{
+   using CT = CompositeType_t<TT>;
 
-   return false;
+   CT A( *dm );  // Evaluation of the dense tensor operand
+
+   return isZero_backend<RF>(
+      A, BoolConstant< DTensScanHelper< RemoveReference_t<CT> >::compare >() );
 }
 //*************************************************************************************************
 
@@ -452,6 +705,64 @@ auto softmax( const DenseTensor<MT>& dm )
 }
 //*************************************************************************************************
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default check if the given row-major general dense tensor is a uniform tensor.
+// \ingroup dense_tensor
+//
+// \param A The dense tensor to be checked.
+// \return \a true if the tensor is a uniform tensor, \a false if not.
+*/
+template< RelaxationFlag RF // Relaxation flag
+        , typename MT >  // Type of the dense tensor
+bool isUniform_backend( const MT& A, FalseType )
+{
+   const auto& cmp( A(0UL,0UL,0UL) );
+
+   const auto mismatch( [&]( size_t k, size_t i, size_t j ) {
+      return !equal<RF>( A(k,i,j), cmp );
+   } );
+
+   return !tensorAnyOf<1UL>( A.pages(), A.rows(), A.columns(), mismatch, mismatch );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief SIMD optimized check if the given row-major general dense tensor is a uniform tensor.
+// \ingroup dense_tensor
+//
+// \param A The dense tensor to be checked.
+// \return \a true if the tensor is a uniform tensor, \a false if not.
+*/
+template< RelaxationFlag RF // Relaxation flag
+        , typename MT >  // Type of the dense tensor
+bool isUniform_backend( const MT& A, TrueType )
+{
+   using ET = ElementType_t<MT>;
+   using SIMDType = SIMDTrait_t<ET>;
+
+   constexpr size_t SIMDSIZE = SIMDTrait<ET>::size;
+
+   const auto& cmp( A(0UL,0UL,0UL) );
+   const SIMDType xmm( set( cmp ) );
+
+   const auto simdMismatch( [&]( size_t k, size_t i, size_t j ) {
+      return !equal<RF>( A.load(k,i,j), xmm );
+   } );
+
+   const auto mismatch( [&]( size_t k, size_t i, size_t j ) {
+      return !equal<RF>( A(k,i,j), cmp );
+   } );
+
+   return !tensorAnyOf<SIMDSIZE>( A.pages(), A.rows(), A.columns(), simdMismatch, mismatch );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
 /*!\brief Checks if the given row-major general dense tensor is a uniform tensor.
@@ -459,6 +770,9 @@ auto softmax( const DenseTensor<MT>& dm )
 //
 // \param dm The dense tensor to be checked.
 // \return \a true if the tensor is a uniform tensor, \a false if not.
+//
+// The check stops at the first element that differs from the first element of the tensor. Large
+// tensors are checked in parallel.
 */
 template< RelaxationFlag RF // Relaxation flag
         , typename MT >  // Type of the dense tensor
@@ -470,18 +784,7 @@ bool isUniform_backend( const DenseTensor<MT>& dm )
    BLAZE_INTERNAL_ASSERT( (*dm).rows()    != 0UL, "Invalid number of rows detected"    );
    BLAZE_INTERNAL_ASSERT( (*dm).columns() != 0UL, "Invalid number of columns detected" );
 
-   const auto& cmp( (*dm)(0UL,0UL,0UL) );
-
-   for( size_t k=0UL; k<(*dm).pages(); ++k ) {
-      for( size_t i=0UL; i<(*dm).rows(); ++i ) {
-         for( size_t j=0UL; j<(*dm).columns(); ++j ) {
-            if( !equal<RF>( (*dm)(k,i,j), cmp ) )
-               return false;
-         }
-      }
-   }
-
-   return true;
+   return isUniform_backend<RF>( *dm, BoolConstant< DTensScanHelper<MT>::compare >() );
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -539,6 +842,168 @@ bool isUniform( const DenseTensor<MT>& dm )
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Auxiliary helper struct for the vectorized closeness check of two dense tensors.
+// \ingroup dense_tensor
+*/
+template< typename TT1    // Type of the evaluated left-hand side dense tensor
+        , typename TT2 >  // Type of the evaluated right-hand side dense tensor
+struct DTensDTensAllCloseHelper
+{
+   //**Type definitions****************************************************************************
+   using ET1 = ElementType_t<TT1>;  //!< Element type of the left-hand side dense tensor.
+   using ET2 = ElementType_t<TT2>;  //!< Element type of the right-hand side dense tensor.
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   static constexpr bool value =
+      ( useOptimizedKernels &&
+        TT1::simdEnabled &&
+        TT2::simdEnabled &&
+        IsSame_v<ET1,ET2> &&
+        IsFloatingPoint_v<ET1> &&
+        HasSIMDAdd_v<ET1,ET1> &&
+        HasSIMDSub_v<ET1,ET1> &&
+        HasSIMDMult_v<ET1,ET1> &&
+        HasSIMDMin_v<ET1,ET1> &&
+        HasSIMDMax_v<ET1,ET1> &&
+        HasSIMDEqual_v<ET1,ET1> );
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default closeness check of two dense tensors of the same size.
+// \ingroup dense_tensor
+//
+// \param A The left-hand side dense tensor.
+// \param B The right-hand side (reference) dense tensor.
+// \param rtol The relative tolerance.
+// \param atol The absolute tolerance.
+// \return \a true if all elements are close, \a false if not.
+*/
+template< typename TT1    // Type of the left-hand side dense tensor
+        , typename TT2 >  // Type of the right-hand side dense tensor
+bool allclose_backend( const TT1& A, const TT2& B, double rtol, double atol, FalseType )
+{
+   const auto notClose( [&]( size_t k, size_t i, size_t j ) {
+      return !isClose( A(k,i,j), B(k,i,j), rtol, atol );
+   } );
+
+   return !tensorAnyOf<1UL>( A.pages(), A.rows(), A.columns(), notClose, notClose );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief SIMD optimized closeness check of two dense tensors of the same size.
+// \ingroup dense_tensor
+//
+// \param A The left-hand side dense tensor.
+// \param B The right-hand side (reference) dense tensor.
+// \param rtol The relative tolerance.
+// \param atol The absolute tolerance.
+// \return \a true if all elements are close, \a false if not.
+//
+// SIMD packs with finite differences that are all within the tolerance are accepted right away.
+// The elements of all other packs (including packs with infinite or not-a-number elements) are
+// checked individually. Since the SIMD tolerance is computed in the precision of the element
+// type, it is shrunk by a safety margin that covers its rounding error. Therefore only packs
+// that are also accepted by the double precision check of the individual elements are accepted
+// right away and the result is independent of the SIMD width.
+*/
+template< typename TT1    // Type of the left-hand side dense tensor
+        , typename TT2 >  // Type of the right-hand side dense tensor
+bool allclose_backend( const TT1& A, const TT2& B, double rtol, double atol, TrueType )
+{
+   using ET = ElementType_t<TT1>;
+   using SIMDType = SIMDTrait_t<ET>;
+
+   constexpr size_t SIMDSIZE = SIMDTrait<ET>::size;
+
+   const SIMDType zero( set( ET() ) );
+   const SIMDType xrtol( set( static_cast<ET>( rtol ) ) );
+   const SIMDType xatol( set( static_cast<ET>( atol ) ) );
+   const SIMDType scale( set( ET(1) - ET(8) * std::numeric_limits<ET>::epsilon() ) );
+   const SIMDType tiny( set( std::numeric_limits<ET>::min() ) );
+
+   const auto notClose( [&]( size_t k, size_t i, size_t j ) {
+      return !isClose( A(k,i,j), B(k,i,j), rtol, atol );
+   } );
+
+   const auto simdNotClose( [&]( size_t k, size_t i, size_t j ) {
+      const SIMDType a( A.load(k,i,j) );
+      const SIMDType b( B.load(k,i,j) );
+      const SIMDType diff( max( SIMDType( a - b ), SIMDType( b - a ) ) );
+      const SIMDType tol( xatol + xrtol * max( b, SIMDType( zero - b ) ) );
+      const SIMDType safe( max( SIMDType( tol * scale - tiny ), zero ) );
+
+      if( equal<strict>( min( diff, safe ), diff ) && !isnan( sum( SIMDType( diff - diff ) ) ) )
+         return false;
+      for( size_t l=0UL; l<SIMDSIZE; ++l ) {
+         if( notClose( k, i, j+l ) ) return true;
+      }
+      return false;
+   } );
+
+   return !tensorAnyOf<SIMDSIZE>( A.pages(), A.rows(), A.columns(), simdNotClose, notClose );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checks if two dense tensors are element-wise equal within a tolerance.
+// \ingroup dense_tensor
+//
+// \param lhs The left-hand side dense tensor.
+// \param rhs The right-hand side (reference) dense tensor.
+// \param rtol The relative tolerance (default: 1E-5).
+// \param atol The absolute tolerance (default: 1E-8).
+// \return \a true if all elements are close, \a false if not.
+//
+// This function checks if the two given dense tensors have the same size and if all elements
+// satisfy \f$ |a-b| \leq atol + rtol \cdot |b| \f$. In contrast to the relaxed comparison via
+// blaze::equal() the tolerances are chosen by the caller. The semantics follow NumPy's
+// \c allclose() function, i.e. infinite elements are only close to identical infinite elements
+// and not-a-number elements are never close. The check stops at the first element that is not
+// close, large tensors are checked in parallel.
+
+   \code
+   blaze::DynamicTensor<double> A, B;
+   // ... Initialization
+   if( allclose( A, B ) ) { ... }
+   if( allclose( A, B, 1E-3, 1E-6 ) ) { ... }
+   \endcode
+
+// Note that this function only works for tensors with built-in or complex element types.
+*/
+template< typename TT1    // Type of the left-hand side dense tensor
+        , typename TT2 >  // Type of the right-hand side dense tensor
+bool allclose( const DenseTensor<TT1>& lhs, const DenseTensor<TT2>& rhs, double rtol, double atol )
+{
+   using CT1 = CompositeType_t<TT1>;
+   using CT2 = CompositeType_t<TT2>;
+
+   if( (*lhs).pages() != (*rhs).pages() || (*lhs).rows() != (*rhs).rows() ||
+       (*lhs).columns() != (*rhs).columns() )
+      return false;
+
+   CT1 A( *lhs );  // Evaluation of the left-hand side dense tensor operand
+   CT2 B( *rhs );  // Evaluation of the right-hand side dense tensor operand
+
+   using Helper = DTensDTensAllCloseHelper< RemoveReference_t<CT1>, RemoveReference_t<CT2> >;
+
+   return allclose_backend( A, B, rtol, atol, BoolConstant< Helper::value >() );
+}
+//*************************************************************************************************
+
 } // namespace blaze
 
 #endif
@@ -67,11 +67,14 @@
 #include <blaze_tensor/math/dense/DynamicTensor.h>
 #include <blaze_tensor/math/dense/Transposition.h>
 #include <blaze_tensor/math/expressions/DenseArray.h>
+#include <blaze_tensor/math/smp/FirstTouch.h>
 #include <blaze_tensor/math/traits/QuatSliceTrait.h>
 #include <blaze_tensor/math/typetraits/IsNdArray.h>
 #include <blaze_tensor/math/typetraits/IsDenseArray.h>
 #include <blaze_tensor/math/typetraits/IsRowMajorArray.h>
+#include <blaze_tensor/system/Thresholds.h>
 #include <blaze_tensor/util/ArrayForEach.h>
+#include <blaze_tensor/util/TensorArena.h>
 
 namespace blaze {
 
@@ -478,6 +481,7 @@ class DynamicArray
    inline static std::array< size_t, N > initDimensions( Dims... dims ) noexcept;
    inline static size_t addPadding( size_t value ) noexcept;
    inline size_t calcCapacity() const noexcept;
+   inline void   initStorage();
    template< typename... Dims >
    inline size_t index( Dims... dims ) const noexcept;
    inline size_t index( std::array< size_t, N > const& indices ) const noexcept;
@@ -546,13 +550,11 @@ inline DynamicArray< N, Type >::DynamicArray( size_t dim0, Dims... dims )
    : dims_    ( initDimensions( dim0, dims... ) )   // The current dimensions of the array
    , nn_      ( addPadding( dims_[0] ) )  // The length of a padded row
    , capacity_( calcCapacity() )          // The maximum capacity of the array
-   , v_( allocate< Type >( capacity_ ) )  // The array elements
+   , v_( arenaAllocate<Type>( capacity_ ) )  // The array elements
 {
    BLAZE_STATIC_ASSERT( N - 1 == sizeof...( dims ) );
 
-   if( IsVectorizable_v<Type> ) {
-      ArrayForEachPadded( dims_, nn_, [&]( size_t i ) { v_[i] = Type(); } );
-   }
+   initStorage();
 
    BLAZE_INTERNAL_ASSERT( isIntact(), "Invariant violation detected" );
 }
@@ -679,7 +681,7 @@ inline DynamicArray<N, Type>::DynamicArray( const DynamicArray& m )
    : dims_    ( m.dims_ )                 // The current dimensions of the array
    , nn_      ( m.nn_ )                   // The length of a padded row
    , capacity_( m.capacity_ )             // The maximum capacity of the array
-   , v_( allocate< Type >( capacity_ ) )  // The array elements
+   , v_( arenaAllocate<Type>( capacity_ ) )  // The array elements
 {
    smpAssign( *this, m );
 
@@ -827,11 +829,9 @@ inline DynamicArray<N, Type>::DynamicArray( const std::array<size_t, N>& dims )
    : dims_    ( dims )         // The current dimensions of the array
    , nn_      ( addPadding( dims_[0] ) )     // The length of a padded row
    , capacity_( calcCapacity() )             // The maximum capacity of the array
-   , v_( allocate< Type >( capacity_ ) )     // The array elements
+   , v_( arenaAllocate<Type>( capacity_ ) )     // The array elements
 {
-   if( IsVectorizable_v<Type> ) {
-      ArrayForEachPadded( dims_, nn_, [&]( size_t i ) { v_[i] = Type(); } );
-   }
+   initStorage();
 
    BLAZE_INTERNAL_ASSERT( isIntact(), "Invariant violation detected" );
 }
@@ -852,7 +852,7 @@ template< size_t N         // The dimensionality of the array
         , typename Type >  // Data type of the array
 inline DynamicArray<N, Type>::~DynamicArray()
 {
-   deallocate( v_ );
+   arenaDeallocate( v_ );
 }
 //*************************************************************************************************
 
@@ -1445,7 +1445,7 @@ template< size_t N         // The dimensionality of the array
         , typename Type >  // Data type of the array
 inline DynamicArray<N, Type>& DynamicArray<N, Type>::operator=( DynamicArray&& rhs ) noexcept
 {
-   deallocate( v_ );
+   arenaDeallocate( v_ );
 
    dims_     = std::move( rhs.dims_ );
    nn_       = rhs.nn_;
@@ -2247,7 +2247,7 @@ void DynamicArray<N, Type>::resize( std::array< size_t, N > const& dims, bool pr
 
    if( preserve )
    {
-      Type* BLAZE_RESTRICT v = allocate<Type>( new_capacity );
+      Type* BLAZE_RESTRICT v = arenaAllocate<Type>( new_capacity );
 
 //       const size_t min_m( min( m, m_ ) );
 //       const size_t min_n( min( n, n_ ) );
@@ -2265,14 +2265,20 @@ void DynamicArray<N, Type>::resize( std::array< size_t, N > const& dims, bool pr
 //       }
 
       swap( v_, v );
-      deallocate( v );
+      arenaDeallocate( v );
       capacity_ = new_capacity;
    }
    else if( new_capacity > capacity_ ) {
-      Type* BLAZE_RESTRICT v = allocate<Type>( new_capacity );
+      Type* BLAZE_RESTRICT v = arenaAllocate<Type>( new_capacity );
       swap( v_, v );
-      deallocate( v );
+      arenaDeallocate( v );
       capacity_ = new_capacity;
+
+      dims_ = dims;
+      nn_ = nn;
+
+      initStorage();
+      return;
    }
 
    dims_ = dims;
@@ -2331,7 +2337,7 @@ inline void DynamicArray<N, Type>::reserve( size_t elements )
    if( elements > capacity_ )
    {
       // Allocating a new array
-      Type* BLAZE_RESTRICT tmp = allocate<Type>( elements );
+      Type* BLAZE_RESTRICT tmp = arenaAllocate<Type>( elements );
 
       // Initializing the new array
       transfer( v_, v_ + capacity_, tmp );
@@ -2343,7 +2349,7 @@ inline void DynamicArray<N, Type>::reserve( size_t elements )
 
       // Replacing the old array
       swap( tmp, v_ );
-      deallocate( tmp );
+      arenaDeallocate( tmp );
       capacity_ = elements;
    }
 }
@@ -2457,6 +2463,36 @@ inline size_t DynamicArray<N, Type>::calcCapacity() const noexcept
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Initialization of newly allocated storage.
+//
+// \return void
+//
+// In case the \a numa_first_touch policy is active (see NumaScope), all elements are default
+// initialized in parallel according to the SMP partition of the array. Otherwise only the
+// padding elements of vectorizable element types are reset.
+*/
+template< size_t N         // The dimensionality of the array
+        , typename Type >  // Data type of the array
+inline void DynamicArray<N, Type>::initStorage()
+{
+   if( activeNumaPolicy() == numa_first_touch ) {
+      const size_t m( N > 1UL ? dims_[N > 1UL ? 1UL : 0UL] : 1UL );
+
+      size_t o( 1UL );
+      for( size_t i = 2; i < N; ++i ) {
+         o *= dims_[i];
+      }
+
+      smpFirstTouch( v_, o, m, dims_[0], nn_ );
+   }
+   else if( IsVectorizable_v<Type> ) {
+      ArrayForEachPadded( dims_, nn_, [&]( size_t i ) { v_[i] = Type(); } );
+   }
+}
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief Calculate index of first element in given row.
 //
@@ -2922,7 +2958,7 @@ template< size_t N         // The dimensionality of the array
         , typename Type >  // Data type of the array
 inline bool DynamicArray<N, Type>::canSMPAssign() const noexcept
 {
-   return ( capacity_ >= SMP_DMATASSIGN_THRESHOLD );
+   return ( capacity_ >= smpDArrAssignThreshold() );
 }
 //*************************************************************************************************
 
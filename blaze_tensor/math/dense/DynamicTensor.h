@@ -41,16 +41,19 @@
 // Includes
 //*************************************************************************************************
 
+#include <blaze/math/dense/CustomMatrix.h>
 #include <blaze/math/typetraits/IsDenseMatrix.h>
 
 #include <blaze_tensor/math/Forward.h>
 #include <blaze_tensor/math/InitializerList.h>
 #include <blaze_tensor/math/SMP.h>
 #include <blaze_tensor/math/Tensor.h>
+#include <blaze_tensor/math/dense/CustomTensor.h>
 #include <blaze_tensor/math/dense/DynamicMatrix.h>
 #include <blaze_tensor/math/dense/HybridMatrix.h>
 #include <blaze_tensor/math/dense/Transposition.h>
 #include <blaze_tensor/math/expressions/DenseTensor.h>
+#include <blaze_tensor/math/smp/FirstTouch.h>
 #include <blaze_tensor/math/traits/ColumnSliceTrait.h>
 #include <blaze_tensor/math/traits/DilatedSubtensorTrait.h>
 #include <blaze_tensor/math/traits/PageSliceTrait.h>
@@ -61,6 +64,9 @@
 #include <blaze_tensor/math/typetraits/IsDenseTensor.h>
 #include <blaze_tensor/math/typetraits/IsRowMajorTensor.h>
 #include <blaze_tensor/math/typetraits/IsTensor.h>
+#include <blaze_tensor/system/Thresholds.h>
+#include <blaze_tensor/util/KernelTrace.h>
+#include <blaze_tensor/util/TensorArena.h>
 
 namespace blaze {
 
@@ -269,6 +275,10 @@ class DynamicTensor
    inline void   reserve( size_t elements );
    inline void   shrinkToFit();
    inline void   swap( DynamicTensor& m ) noexcept;
+
+   template< typename MT, bool SO > inline void appendPage ( const DenseMatrix<MT,SO>& mat );
+   template< typename TT >          inline void appendPages( const DenseTensor<TT>& tens );
+   inline void popPages( size_t count = 1UL );
    //@}
    //**********************************************************************************************
 
@@ -400,6 +410,7 @@ class DynamicTensor
    /*!\name Utility functions */
    //@{
    inline size_t addPadding( size_t value ) const noexcept;
+   inline void   resizePages( size_t o );
    //@}
    //**********************************************************************************************
 
@@ -466,7 +477,9 @@ inline DynamicTensor<Type>::DynamicTensor() noexcept
 // \param n The number of columns of the tensor.
 //
 // \note This constructor is only responsible to allocate the required dynamic memory. No
-// element initialization is performed!
+// element initialization is performed! Only in case the \a numa_first_touch policy is active
+// (see NumaScope), all elements are default initialized in parallel in order to place the
+// memory pages on the NUMA nodes of the threads processing them.
 */
 template< typename Type > // Data type of the tensor
 inline DynamicTensor<Type>::DynamicTensor( size_t o, size_t m, size_t n )
@@ -475,9 +488,12 @@ inline DynamicTensor<Type>::DynamicTensor( size_t o, size_t m, size_t n )
    , n_       ( n )                            // The current number of columns of the tensor
    , nn_      ( addPadding( n ) )              // The alignment adjusted number of columns
    , capacity_( m_*nn_*o_ )                    // The maximum capacity of the tensor
-   , v_       ( allocate<Type>( capacity_ ) )  // The tensor elements
+   , v_       ( arenaAllocate<Type>( capacity_ ) )  // The tensor elements
 {
-   if( IsVectorizable_v<Type> ) {
+   if( activeNumaPolicy() == numa_first_touch ) {
+      smpFirstTouch( v_, o_, m_, n_, nn_ );
+   }
+   else if( IsVectorizable_v<Type> ) {
       for (size_t k=0UL; k<o_; ++k) {
          for (size_t i=0UL; i<m_; ++i) {
             size_t row_elements = (k*m_+i)*nn_;
@@ -730,7 +746,7 @@ inline DynamicTensor<Type>::DynamicTensor( const Tensor<MT>& m )
 template< typename Type > // Data type of the tensor
 inline DynamicTensor<Type>::~DynamicTensor()
 {
-   deallocate( v_ );
+   arenaDeallocate( v_ );
 }
 //*************************************************************************************************
 
@@ -1223,7 +1239,7 @@ inline DynamicTensor<Type>& DynamicTensor<Type>::operator=( const DynamicTensor&
 template< typename Type > // Data type of the tensor
 inline DynamicTensor<Type>& DynamicTensor<Type>::operator=( DynamicTensor&& rhs ) noexcept
 {
-   deallocate( v_ );
+   arenaDeallocate( v_ );
 
    o_        = rhs.o_;
    m_        = rhs.m_;
@@ -1601,6 +1617,11 @@ inline void DynamicTensor<Type>::clear()
 // ...) on the tensor if it is used to shrink the tensor. Additionally, the resize operation
 // potentially changes all tensor elements. In order to preserve the old tensor values, the
 // \a preserve flag can be set to \a true. However, new tensor elements are not initialized!
+// In case only the number of pages changes and the old values are preserved, the existing
+// pages are not moved: shrinking never reallocates and growing reallocates only in case the
+// capacity is exhausted, in which case the capacity grows geometrically. In case the
+// \a numa_first_touch policy is active (see NumaScope), newly allocated memory that does not
+// receive old values is initialized in parallel according to the SMP partition.
 //
 // The following example illustrates the resize operation of a \f$ 2 \times 4 \f$ tensor to a
 // \f$ 4 \times 2 \f$ tensor. The new, uninitialized elements are marked with \a x:
@@ -1631,9 +1652,14 @@ void DynamicTensor<Type>::resize( size_t o, size_t m, size_t n, bool preserve )
 
    const size_t nn( addPadding( n ) );
 
+   if( m == m_ && n == n_ && ( o < o_ || preserve ) ) {
+      resizePages( o );
+      return;
+   }
+
    if( preserve )
    {
-      Type* BLAZE_RESTRICT v = allocate<Type>( o*m*nn );
+      Type* BLAZE_RESTRICT v = arenaAllocate<Type>( o*m*nn );
       const size_t min_m( min( m, m_ ) );
       const size_t min_n( min( n, n_ ) );
       const size_t min_o( min( o, o_ ) );
@@ -1644,14 +1670,18 @@ void DynamicTensor<Type>::resize( size_t o, size_t m, size_t n, bool preserve )
          }
       }
       swap( v_, v );
-      deallocate( v );
+      arenaDeallocate( v );
       capacity_ = o*m*nn;
    }
    else if( o*m*nn > capacity_ ) {
-      Type* BLAZE_RESTRICT v = allocate<Type>( o*m*nn );
+      Type* BLAZE_RESTRICT v = arenaAllocate<Type>( o*m*nn );
       swap( v_, v );
-      deallocate( v );
+      arenaDeallocate( v );
       capacity_ = o*m*nn;
+
+      if( activeNumaPolicy() == numa_first_touch ) {
+         smpFirstTouch( v_, o, m, n, nn );
+      }
    }
 
    if( IsVectorizable_v<Type> ) {
@@ -1712,7 +1742,7 @@ inline void DynamicTensor<Type>::reserve( size_t elements )
    if( elements > capacity_ )
    {
       // Allocating a new array
-      Type* BLAZE_RESTRICT tmp = allocate<Type>( elements );
+      Type* BLAZE_RESTRICT tmp = arenaAllocate<Type>( elements );
 
       // Initializing the new array
       transfer( v_, v_+capacity_, tmp );
@@ -1724,7 +1754,7 @@ inline void DynamicTensor<Type>::reserve( size_t elements )
 
       // Replacing the old array
       swap( tmp, v_ );
-      deallocate( tmp );
+      arenaDeallocate( tmp );
       capacity_ = elements;
    }
 }
@@ -1751,6 +1781,123 @@ inline void DynamicTensor<Type>::shrinkToFit()
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Appending a page to the tensor.
+//
+// \param mat The matrix to be appended as new last page.
+// \return void
+// \exception std::invalid_argument Matrix sizes do not match.
+//
+// This function appends the given matrix (or matrix expression) as new last page of the tensor.
+// The matrix is assigned directly into the storage of the new page. In case the capacity of the
+// tensor is exhausted, the capacity grows geometrically, such that appending pages has amortized
+// constant cost per page. An empty tensor takes the size of the first appended matrix:
+
+   \code
+   blaze::DynamicTensor<double> series;
+   blaze::DynamicMatrix<double> sample( 16UL, 32UL );
+
+   for( ... ) {
+      // ... Computing the next sample
+      series.appendPage( sample );
+   }
+   \endcode
+
+// Note that in case of a reallocation all existing views on the tensor are invalidated.
+*/
+template< typename Type > // Data type of the tensor
+template< typename MT     // Type of the right-hand side matrix
+        , bool SO >       // Storage order of the right-hand side matrix
+inline void DynamicTensor<Type>::appendPage( const DenseMatrix<MT,SO>& mat )
+{
+   if( o_ == 0UL && ( m_ != (*mat).rows() || n_ != (*mat).columns() ) ) {
+      resize( 0UL, (*mat).rows(), (*mat).columns(), false );
+   }
+
+   if( (*mat).rows() != m_ || (*mat).columns() != n_ ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix sizes do not match" );
+   }
+
+   if( (*mat).isAliased( this ) ) {
+      const ResultType_t<MT> tmp( *mat );
+      appendPage( tmp );
+      return;
+   }
+
+   const size_t k( o_ );
+   resizePages( o_+1UL );
+
+   if( m_ == 0UL || n_ == 0UL ) return;
+
+   CustomMatrix<Type,unaligned,unpadded,rowMajor> page( v_+k*m_*nn_, m_, n_, nn_ );
+   page = *mat;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Appending pages to the tensor.
+//
+// \param tens The tensor whose pages are appended.
+// \return void
+// \exception std::invalid_argument Tensor sizes do not match.
+//
+// This function appends all pages of the given tensor (or tensor expression) after the last page
+// of the tensor. The capacity grows geometrically, such that appending pages has amortized
+// constant cost per page. An empty tensor takes the row and column count of the given tensor.
+// Note that in case of a reallocation all existing views on the tensor are invalidated.
+*/
+template< typename Type > // Data type of the tensor
+template< typename TT >   // Type of the right-hand side tensor
+inline void DynamicTensor<Type>::appendPages( const DenseTensor<TT>& tens )
+{
+   if( o_ == 0UL && ( m_ != (*tens).rows() || n_ != (*tens).columns() ) ) {
+      resize( 0UL, (*tens).rows(), (*tens).columns(), false );
+   }
+
+   if( (*tens).rows() != m_ || (*tens).columns() != n_ ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Tensor sizes do not match" );
+   }
+
+   if( (*tens).isAliased( this ) ) {
+      const ResultType_t<TT> tmp( *tens );
+      appendPages( tmp );
+      return;
+   }
+
+   const size_t k( o_ );
+   resizePages( o_+(*tens).pages() );
+
+   if( (*tens).pages() == 0UL || m_ == 0UL || n_ == 0UL ) return;
+
+   CustomTensor<Type,unaligned,unpadded> pages( v_+k*m_*nn_, (*tens).pages(), m_, n_, nn_ );
+   pages = *tens;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Removing pages from the end of the tensor.
+//
+// \param count The number of pages to be removed.
+// \return void
+// \exception std::invalid_argument Invalid number of pages.
+//
+// This function removes the last \a count pages of the tensor. The capacity of the tensor is not
+// changed, i.e. no reallocation takes place and views on the remaining pages stay valid.
+*/
+template< typename Type > // Data type of the tensor
+inline void DynamicTensor<Type>::popPages( size_t count )
+{
+   if( count > o_ ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid number of pages" );
+   }
+
+   o_ -= count;
+}
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief Swapping the contents of two matrices.
 //
@@ -1791,6 +1938,54 @@ inline size_t DynamicTensor<Type>::addPadding( size_t value ) const noexcept
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Changing the number of pages of the tensor, preserving all remaining pages.
+//
+// \param o The new number of pages.
+// \return void
+//
+// The rows and columns are not changed, therefore the existing pages do not move within the
+// storage. In case the capacity is insufficient, the capacity grows geometrically and the
+// existing pages are transferred by a single contiguous transfer.
+*/
+template< typename Type > // Data type of the tensor
+inline void DynamicTensor<Type>::resizePages( size_t o )
+{
+   using std::swap;
+   using blaze::max;
+
+   const size_t pageSize( m_*nn_ );
+
+   if( o*pageSize > capacity_ )
+   {
+      const size_t capacity( max( o*pageSize, 2UL*capacity_ ) );
+
+      Type* BLAZE_RESTRICT v = arenaAllocate<Type>( capacity );
+      transfer( v_, v_+o_*pageSize, v );
+      swap( v_, v );
+      arenaDeallocate( v );
+      capacity_ = capacity;
+
+      if( activeNumaPolicy() == numa_first_touch && o > o_ ) {
+         smpFirstTouch( v_+o_*pageSize, o-o_, m_, n_, nn_ );
+      }
+   }
+
+   if( IsVectorizable_v<Type> ) {
+      for( size_t k=o_; k<o; ++k ) {
+         for( size_t i=0UL; i<m_; ++i ) {
+            for( size_t j=n_; j<nn_; ++j ) {
+               v_[(k*m_+i)*nn_+j] = Type();
+            }
+         }
+      }
+   }
+
+   o_ = o;
+}
+//*************************************************************************************************
+
+
 
 
 //=================================================================================================
@@ -2079,7 +2274,7 @@ inline bool DynamicTensor<Type>::isAligned() const noexcept
 template< typename Type > // Data type of the tensor
 inline bool DynamicTensor<Type>::canSMPAssign() const noexcept
 {
-   return ( rows() * columns() >= SMP_DMATASSIGN_THRESHOLD );
+   return ( pages() * rows() * columns() >= smpDTensAssignThreshold() );
 }
 //*************************************************************************************************
 
@@ -2325,6 +2520,8 @@ inline auto DynamicTensor<Type>::assign( const DenseTensor<MT>& rhs )
    BLAZE_INTERNAL_ASSERT( n_ == (*rhs).columns(), "Invalid number of columns" );
    BLAZE_INTERNAL_ASSERT( o_ == (*rhs).pages(),   "Invalid number of pages" );
 
+   BLAZE_KERNEL_TRACE( "default assign", MT, *this, 1UL );
+
    const size_t jpos( n_ & size_t(-2) );
    BLAZE_INTERNAL_ASSERT( ( n_ - ( n_ % 2UL ) ) == jpos, "Invalid end calculation" );
 
@@ -2366,6 +2563,8 @@ inline auto DynamicTensor<Type>::assign( const DenseTensor<MT>& rhs )
    BLAZE_INTERNAL_ASSERT( n_ == (*rhs).columns(), "Invalid number of columns" );
    BLAZE_INTERNAL_ASSERT( o_ == (*rhs).pages(),   "Invalid number of pages" );
 
+   BLAZE_KERNEL_TRACE( "vectorized assign", MT, *this, 1UL );
+
    constexpr bool remainder( !IsPadded_v<MT> );
 
    const size_t jpos( ( remainder )?( n_ & size_t(-SIMDSIZE) ):( n_ ) );
@@ -2436,6 +2635,8 @@ inline auto DynamicTensor<Type>::addAssign( const DenseTensor<MT>& rhs )
    BLAZE_INTERNAL_ASSERT( n_ == (*rhs).columns(), "Invalid number of columns" );
    BLAZE_INTERNAL_ASSERT( o_ == (*rhs).pages(),   "Invalid number of pages" );
 
+   BLAZE_KERNEL_TRACE( "default add assign", MT, *this, 1UL );
+
    for (size_t k=0UL; k<o_; ++k) {
       for (size_t i=0UL; i<m_; ++i) {
          size_t row_elements = (k*m_+i)*nn_;
@@ -2480,6 +2681,8 @@ inline auto DynamicTensor<Type>::addAssign( const DenseTensor<MT>& rhs )
    BLAZE_INTERNAL_ASSERT( n_ == (*rhs).columns(), "Invalid number of columns" );
    BLAZE_INTERNAL_ASSERT( o_ == (*rhs).pages(),   "Invalid number of pages" );
 
+   BLAZE_KERNEL_TRACE( "vectorized add assign", MT, *this, 1UL );
+
    constexpr bool remainder( !IsPadded_v<MT> );
 
    for (size_t k=0UL; k<o_; ++k) {
@@ -2533,6 +2736,8 @@ inline auto DynamicTensor<Type>::subAssign( const DenseTensor<MT>& rhs )
    BLAZE_INTERNAL_ASSERT( n_ == (*rhs).columns(), "Invalid number of columns" );
    BLAZE_INTERNAL_ASSERT( o_ == (*rhs).pages(),   "Invalid number of pages" );
 
+   BLAZE_KERNEL_TRACE( "default sub assign", MT, *this, 1UL );
+
    for (size_t k=0UL; k<o_; ++k) {
       for (size_t i=0UL; i<m_; ++i) {
          size_t row_elements = (k*m_+i)*nn_;
@@ -2577,6 +2782,8 @@ inline auto DynamicTensor<Type>::subAssign( const DenseTensor<MT>& rhs )
    BLAZE_INTERNAL_ASSERT( n_ == (*rhs).columns(), "Invalid number of columns" );
    BLAZE_INTERNAL_ASSERT( o_ == (*rhs).pages(),   "Invalid number of pages" );
 
+   BLAZE_KERNEL_TRACE( "vectorized sub assign", MT, *this, 1UL );
+
    constexpr bool remainder( !IsPadded_v<MT> );
 
    for (size_t k=0UL; k<o_; ++k) {
@@ -2631,6 +2838,8 @@ inline auto DynamicTensor<Type>::schurAssign( const DenseTensor<MT>& rhs )
    BLAZE_INTERNAL_ASSERT( n_ == (*rhs).columns(), "Invalid number of columns" );
    BLAZE_INTERNAL_ASSERT( o_ == (*rhs).pages(),   "Invalid number of pages" );
 
+   BLAZE_KERNEL_TRACE( "default schur assign", MT, *this, 1UL );
+
    const size_t jpos( n_ & size_t(-2) );
    BLAZE_INTERNAL_ASSERT( ( n_ - ( n_ % 2UL ) ) == jpos, "Invalid end calculation" );
 
@@ -2672,6 +2881,8 @@ inline auto DynamicTensor<Type>::schurAssign( const DenseTensor<MT>& rhs )
    BLAZE_INTERNAL_ASSERT( n_ == (*rhs).columns(), "Invalid number of columns" );
    BLAZE_INTERNAL_ASSERT( o_ == (*rhs).pages(),   "Invalid number of pages" );
 
+   BLAZE_KERNEL_TRACE( "vectorized schur assign", MT, *this, 1UL );
+
    constexpr bool remainder( !IsPadded_v<MT> );
 
    for (size_t k=0UL; k<o_; ++k) {
@@ -0,0 +1,1283 @@
+//=================================================================================================
+/*!
+//  \file blaze_tensor/math/dense/FusedAssign.h
+//  \brief Header file for the fused multi-output assignment of dense tensor and array expressions
+//
+//  Copyright (C) 2012-2018 Klaus Iglberger - All Rights Reserved
+//  Copyright (C) 2018 Hartmut Kaiser - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+
+#ifndef _BLAZE_TENSOR_MATH_DENSE_FUSEDASSIGN_H_
+#define _BLAZE_TENSOR_MATH_DENSE_FUSEDASSIGN_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <array>
+#include <initializer_list>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <blaze/math/Aliases.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/SIMD.h>
+#include <blaze/math/constraints/RequiresEvaluation.h>
+#include <blaze/math/functors/Add.h>
+#include <blaze/math/smp/Functions.h>
+#include <blaze/math/smp/SerialSection.h>
+#include <blaze/math/typetraits/IsExpression.h>
+#include <blaze/math/typetraits/IsResizable.h>
+#include <blaze/math/typetraits/IsSIMDCombinable.h>
+#include <blaze/system/Optimizations.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/FunctionTrace.h>
+#include <blaze/util/IntegralConstant.h>
+#include <blaze/util/MaybeUnused.h>
+#include <blaze/util/StaticAssert.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/algorithms/Min.h>
+#include <blaze/util/typetraits/If.h>
+#include <blaze/util/typetraits/IsSame.h>
+
+#include <blaze_tensor/math/expressions/DenseArray.h>
+#include <blaze_tensor/math/expressions/DenseTensor.h>
+#include <blaze_tensor/math/expressions/DTensReduceExpr.h>
+#include <blaze_tensor/math/expressions/Tensor.h>
+#include <blaze_tensor/math/smp/ParallelFor.h>
+#include <blaze_tensor/math/typetraits/IsDenseArray.h>
+#include <blaze_tensor/system/Thresholds.h>
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS FUSEDREDUCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Reduction of a dense tensor or array expression within a fused assignment.
+// \ingroup dense_tensor
+//
+// A FusedReduction describes the reduction of a dense tensor or array expression by means of the
+// binary reduction operation \a OP. It does not perform any computation by itself, but can be
+// passed as source of a scalar target to the assignAll() function, which accumulates the reduction
+// in the same traversal as all other assignments (see fusedReduce() and fusedSum()).
+*/
+template< typename TT    // Type of the reduced dense tensor or array
+        , typename OP >  // Type of the reduction operation
+class FusedReduction
+{
+ private:
+   //**Type definitions****************************************************************************
+   //! Composite type of the reduced dense tensor or array.
+   using Operand = If_t< IsExpression_v<TT>, const TT, const TT& >;
+   //**********************************************************************************************
+
+ public:
+   //**Constructor*********************************************************************************
+   /*!\brief Constructor for the FusedReduction class.
+   //
+   // \param tens The reduced dense tensor or array.
+   // \param op The reduction operation.
+   */
+   explicit inline FusedReduction( const TT& tens, OP op )
+      : tens_( tens )  // The reduced dense tensor or array
+      , op_  ( op )    // The reduction operation
+   {}
+   //**********************************************************************************************
+
+   //**Operand access******************************************************************************
+   /*!\brief Returns the reduced dense tensor or array.
+   //
+   // \return The reduced dense tensor or array.
+   */
+   inline const TT& operand() const noexcept {
+      return tens_;
+   }
+   //**********************************************************************************************
+
+   //**Operation access****************************************************************************
+   /*!\brief Returns the reduction operation.
+   //
+   // \return The reduction operation.
+   */
+   inline OP operation() const {
+      return op_;
+   }
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   Operand tens_;  //!< The reduced dense tensor or array.
+   OP      op_;    //!< The reduction operation.
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_NOT_REQUIRE_EVALUATION( TT );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CLASS FUSEDTENSORSLOT
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Element-wise assignment of a dense tensor expression within a fused assignment.
+// \ingroup dense_tensor
+*/
+template< typename TT1   // Type of the left-hand side dense tensor
+        , typename TT2 > // Type of the right-hand side dense tensor
+class FusedTensorSlot
+{
+ public:
+   //**Type definitions****************************************************************************
+   using ElementType = ElementType_t<TT2>;  //!< Element type of the right-hand side operand.
+
+   //! Per-thread state of the assignment.
+   struct State {};
+   //**********************************************************************************************
+
+   //**Compilation flags***************************************************************************
+   //! Compilation switch for the vectorized assignment.
+   static constexpr bool simdEnabled =
+      ( TT1::simdEnabled && TT2::simdEnabled &&
+        IsSIMDCombinable_v< ElementType_t<TT1>, ElementType > );
+   //**********************************************************************************************
+
+   //**Constructor*********************************************************************************
+   /*!\brief Constructor for the FusedTensorSlot class.
+   //
+   // \param lhs The target left-hand side dense tensor.
+   // \param rhs The right-hand side dense tensor.
+   */
+   inline FusedTensorSlot( TT1& lhs, const TT2& rhs )
+      : lhs_( lhs )  // The target left-hand side dense tensor
+      , rhs_( rhs )  // The right-hand side dense tensor
+   {}
+   //**********************************************************************************************
+
+   //**Size functions******************************************************************************
+   inline size_t pages  () const noexcept { return rhs_.pages();   }
+   inline size_t rows   () const noexcept { return rhs_.rows();    }
+   inline size_t columns() const noexcept { return rhs_.columns(); }
+
+   inline std::array<size_t,3UL> dimensions() const noexcept {
+      return {{ rhs_.columns(), rhs_.rows(), rhs_.pages() }};
+   }
+   //**********************************************************************************************
+
+   //**Threshold function**************************************************************************
+   /*!\brief Returns the SMP assignment threshold of the dense tensor.
+   //
+   // \return The minimum number of elements for a parallel assignment.
+   */
+   static inline size_t threshold() noexcept { return smpDTensAssignThreshold(); }
+   //**********************************************************************************************
+
+   //**Check function******************************************************************************
+   /*!\brief Checks whether the target can take the size of the right-hand side dense tensor.
+   //
+   // \return void
+   // \exception std::invalid_argument Tensor cannot be resized.
+   */
+   inline void check() const {
+      if( !IsResizable_v<TT1> &&
+          ( lhs_.pages() != rhs_.pages() || lhs_.rows() != rhs_.rows() ||
+            lhs_.columns() != rhs_.columns() ) ) {
+         BLAZE_THROW_INVALID_ARGUMENT( "Tensor cannot be resized" );
+      }
+   }
+   //**********************************************************************************************
+
+   //**Prepare function****************************************************************************
+   /*!\brief Resizes the target to the size of the right-hand side dense tensor.
+   //
+   // \param chunks The number of independently processed chunks of rows.
+   // \return void
+   */
+   inline void prepare( size_t chunks ) {
+      MAYBE_UNUSED( chunks );
+      resize( lhs_, rhs_.pages(), rhs_.rows(), rhs_.columns(), false );
+   }
+   //**********************************************************************************************
+
+   //**Apply functions*****************************************************************************
+   /*!\brief Assigns a single element of the right-hand side dense tensor.
+   //
+   // \param k The page index of the element.
+   // \param i The row index of the element.
+   // \param j The column index of the element.
+   // \return void
+   */
+   BLAZE_ALWAYS_INLINE void apply( State&, size_t k, size_t i, size_t j ) const {
+      lhs_(k,i,j) = rhs_(k,i,j);
+   }
+
+   /*!\brief Assigns a SIMD pack of the right-hand side dense tensor.
+   //
+   // \param k The page index of the first element of the pack.
+   // \param i The row index of the first element of the pack.
+   // \param j The column index of the first element of the pack.
+   // \return void
+   */
+   BLAZE_ALWAYS_INLINE void applySIMD( State&, size_t k, size_t i, size_t j ) const {
+      lhs_.store( k, i, j, rhs_.load( k, i, j ) );
+   }
+   //**********************************************************************************************
+
+   //**Finish functions****************************************************************************
+   inline void finish( State&, size_t ) {}
+   inline void complete() {}
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   TT1&       lhs_;  //!< The target left-hand side dense tensor.
+   const TT2& rhs_;  //!< The right-hand side dense tensor.
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   BLAZE_CONSTRAINT_MUST_NOT_REQUIRE_EVALUATION( TT2 );
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CLASS FUSEDREDUCTIONSLOT
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Reduction of a dense tensor expression to a scalar within a fused assignment.
+// \ingroup dense_tensor
+//
+// Every thread accumulates its chunk of rows in a SIMD and a scalar accumulator. At the end of a
+// chunk both are combined into the partial result of the chunk, and after the traversal the
+// partial results of all chunks are combined in order of the chunks.
+*/
+template< typename T     // Type of the scalar target
+        , typename TT    // Type of the reduced dense tensor
+        , typename OP >  // Type of the reduction operation
+class FusedReductionSlot
+{
+ public:
+   //**Type definitions****************************************************************************
+   using ElementType = ElementType_t<TT>;        //!< Element type of the reduced dense tensor.
+   using SIMDType    = SIMDTrait_t<ElementType>;  //!< SIMD type of the reduced dense tensor.
+
+   //! Per-thread state of the reduction.
+   struct State {
+      SIMDType    xmm;        //!< The SIMD accumulator.
+      ElementType value;      //!< The scalar accumulator.
+      bool        simdValid;  //!< \a true in case the SIMD accumulator holds a value.
+      bool        valid;      //!< \a true in case the scalar accumulator holds a value.
+   };
+   //**********************************************************************************************
+
+   //**Compilation flags***************************************************************************
+   //! Compilation switch for the vectorized reduction.
+   static constexpr bool simdEnabled = DTensReduceExprHelper<TT,OP>::value;
+   //**********************************************************************************************
+
+   //**Constructor*********************************************************************************
+   /*!\brief Constructor for the FusedReductionSlot class.
+   //
+   // \param lhs The scalar target.
+   // \param rhs The reduction of the dense tensor.
+   */
+   inline FusedReductionSlot( T& lhs, const FusedReduction<TT,OP>& rhs )
+      : lhs_     ( lhs )               // The scalar target
+      , rhs_     ( rhs.operand() )     // The reduced dense tensor
+      , op_      ( rhs.operation() )  // The reduction operation
+      , partials_()                   // The partial results of all chunks
+   {}
+   //**********************************************************************************************
+
+   //**Size functions******************************************************************************
+   inline size_t pages  () const noexcept { return rhs_.pages();   }
+   inline size_t rows   () const noexcept { return rhs_.rows();    }
+   inline size_t columns() const noexcept { return rhs_.columns(); }
+
+   inline std::array<size_t,3UL> dimensions() const noexcept {
+      return {{ rhs_.columns(), rhs_.rows(), rhs_.pages() }};
+   }
+   //**********************************************************************************************
+
+   //**Threshold function**************************************************************************
+   /*!\brief Returns the SMP assignment threshold of the dense tensor.
+   //
+   // \return The minimum number of elements for a parallel assignment.
+   */
+   static inline size_t threshold() noexcept { return smpDTensAssignThreshold(); }
+   //**********************************************************************************************
+
+   //**Check function******************************************************************************
+   inline void check() const {}
+   //**********************************************************************************************
+
+   //**Prepare function****************************************************************************
+   /*!\brief Prepares the partial results of the given number of chunks.
+   //
+   // \param chunks The number of independently processed chunks of rows.
+   // \return void
+   */
+   inline void prepare( size_t chunks ) {
+      partials_.assign( chunks, std::make_pair( ElementType{}, false ) );
+   }
+   //**********************************************************************************************
+
+   //**Apply functions*****************************************************************************
+   /*!\brief Accumulates a single element of the reduced dense tensor.
+   //
+   // \param state The state of the calling thread.
+   // \param k The page index of the element.
+   // \param i The row index of the element.
+   // \param j The column index of the element.
+   // \return void
+   */
+   BLAZE_ALWAYS_INLINE void apply( State& state, size_t k, size_t i, size_t j ) const {
+      const ElementType x( rhs_(k,i,j) );
+      state.value = ( state.valid ? ElementType( op_( state.value, x ) ) : x );
+      state.valid = true;
+   }
+
+   /*!\brief Accumulates a SIMD pack of the reduced dense tensor.
+   //
+   // \param state The state of the calling thread.
+   // \param k The page index of the first element of the pack.
+   // \param i The row index of the first element of the pack.
+   // \param j The column index of the first element of the pack.
+   // \return void
+   */
+   BLAZE_ALWAYS_INLINE void applySIMD( State& state, size_t k, size_t i, size_t j ) const {
+      const SIMDType xmm( rhs_.load( k, i, j ) );
+      state.xmm = ( state.simdValid ? SIMDType( op_( state.xmm, xmm ) ) : xmm );
+      state.simdValid = true;
+   }
+   //**********************************************************************************************
+
+   //**Finish functions****************************************************************************
+   /*!\brief Stores the accumulated result of a chunk of rows.
+   //
+   // \param state The state of the thread that processed the chunk.
+   // \param chunk The index of the chunk.
+   // \return void
+   */
+   inline void finish( State& state, size_t chunk ) {
+      finishSIMD( state, BoolConstant<simdEnabled>() );
+      partials_[chunk] = std::make_pair( state.value, state.valid );
+   }
+
+   /*!\brief Combines the results of all chunks and assigns the reduction to the target.
+   //
+   // \return void
+   //
+   // In case the reduced dense tensor is empty, a default constructed value is assigned.
+   */
+   inline void complete() {
+      ElementType redux{};
+      bool valid( false );
+      for( const auto& partial : partials_ ) {
+         if( !partial.second ) continue;
+         redux = ( valid ? ElementType( op_( redux, partial.first ) ) : partial.first );
+         valid = true;
+      }
+      lhs_ = redux;
+   }
+   //**********************************************************************************************
+
+ private:
+   //**Finish functions****************************************************************************
+   /*!\brief Combines the SIMD accumulator with the scalar accumulator.
+   //
+   // \param state The state of the calling thread.
+   // \return void
+   */
+   inline void finishSIMD( State& state, TrueType ) const {
+      if( state.simdValid ) {
+         const ElementType redux( reduce( state.xmm, op_ ) );
+         state.value = ( state.valid ? ElementType( op_( state.value, redux ) ) : redux );
+         state.valid = true;
+      }
+   }
+
+   /*!\brief Combines the SIMD accumulator with the scalar accumulator (no-op without SIMD).
+   //
+   // \return void
+   */
+   inline void finishSIMD( State&, FalseType ) const {}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   T&                                         lhs_;       //!< The scalar target.
+   const TT&                                  rhs_;       //!< The reduced dense tensor.
+   OP                                         op_;        //!< The reduction operation.
+   std::vector< std::pair<ElementType,bool> > partials_;  //!< The partial results of all chunks.
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CLASS FUSEDARRAYSLOT
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the number of pages of a dense array within a fused assignment.
+// \ingroup dense_array
+//
+// \param dims The dimensions of the dense array.
+// \return The product of all dimensions except for the two innermost dimensions.
+//
+// Within a fused assignment the columns and rows of a dense array correspond to its two innermost
+// dimensions, all remaining dimensions are flattened into pages in storage order.
+*/
+template< size_t N >  // Number of dimensions
+inline size_t fusedPages( const std::array<size_t,N>& dims ) noexcept
+{
+   size_t pages( 1UL );
+   for( size_t d=2UL; d<N; ++d ) {
+      pages *= dims[d];
+   }
+   return pages;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Updates the array index of an element of a dense array within a fused assignment.
+// \ingroup dense_array
+//
+// \param index The array index to be updated.
+// \param page The cached flattened page index of \a index.
+// \param dims The dimensions of the dense array.
+// \param k The flattened page index of the element.
+// \param i The row index of the element.
+// \param j The column index of the element.
+// \return void
+//
+// The outer dimensions are only decoded in case the page changes, i.e. once per row at most.
+*/
+template< size_t N >  // Number of dimensions
+BLAZE_ALWAYS_INLINE void fusedIndex( std::array<size_t,N>& index, size_t& page,
+                                     const std::array<size_t,N>& dims,
+                                     size_t k, size_t i, size_t j )
+{
+   if( k != page ) {
+      page = k;
+      for( size_t d=2UL; d<N; ++d ) {
+         index[d] = k % dims[d];
+         k /= dims[d];
+      }
+   }
+   index[1UL] = i;
+   index[0UL] = j;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Element-wise assignment of a dense array expression within a fused assignment.
+// \ingroup dense_array
+*/
+template< typename AT1   // Type of the left-hand side dense array
+        , typename AT2 > // Type of the right-hand side dense array
+class FusedArraySlot
+{
+ public:
+   //**Type definitions****************************************************************************
+   using ElementType = ElementType_t<AT2>;  //!< Element type of the right-hand side operand.
+
+   //! Number of dimensions of the right-hand side dense array.
+   static constexpr size_t N = AT2::num_dimensions;
+
+   //! Per-thread state of the assignment.
+   struct State {
+      std::array<size_t,N> index;  //!< The array index of the current element.
+      size_t               page;   //!< The flattened page index of the current element.
+   };
+   //**********************************************************************************************
+
+   //**Compilation flags***************************************************************************
+   //! Compilation switch for the vectorized assignment.
+   static constexpr bool simdEnabled = false;
+   //**********************************************************************************************
+
+   //**Constructor*********************************************************************************
+   /*!\brief Constructor for the FusedArraySlot class.
+   //
+   // \param lhs The target left-hand side dense array.
+   // \param rhs The right-hand side dense array.
+   */
+   inline FusedArraySlot( AT1& lhs, const AT2& rhs )
+      : lhs_ ( lhs )                // The target left-hand side dense array
+      , rhs_ ( rhs )                // The right-hand side dense array
+      , dims_( rhs.dimensions() )  // The dimensions of the right-hand side dense array
+   {}
+   //**********************************************************************************************
+
+   //**Size functions******************************************************************************
+   inline size_t pages  () const noexcept { return fusedPages( dims_ ); }
+   inline size_t rows   () const noexcept { return dims_[1UL]; }
+   inline size_t columns() const noexcept { return dims_[0UL]; }
+
+   inline const std::array<size_t,N>& dimensions() const noexcept { return dims_; }
+   //**********************************************************************************************
+
+   //**Threshold function**************************************************************************
+   /*!\brief Returns the SMP assignment threshold of the dense array.
+   //
+   // \return The minimum number of elements for a parallel assignment.
+   */
+   static inline size_t threshold() noexcept { return smpDArrAssignThreshold(); }
+   //**********************************************************************************************
+
+   //**Check function******************************************************************************
+   /*!\brief Checks whether the target can take the size of the right-hand side dense array.
+   //
+   // \return void
+   // \exception std::invalid_argument Array cannot be resized.
+   */
+   inline void check() const {
+      if( !IsResizable_v<AT1> && lhs_.dimensions() != dims_ ) {
+         BLAZE_THROW_INVALID_ARGUMENT( "Array cannot be resized" );
+      }
+   }
+   //**********************************************************************************************
+
+   //**Prepare function****************************************************************************
+   /*!\brief Resizes the target to the size of the right-hand side dense array.
+   //
+   // \param chunks The number of independently processed chunks of rows.
+   // \return void
+   */
+   inline void prepare( size_t chunks ) {
+      MAYBE_UNUSED( chunks );
+      resize( BoolConstant< IsResizable_v<AT1> >() );
+   }
+   //**********************************************************************************************
+
+   //**Apply functions*****************************************************************************
+   /*!\brief Assigns a single element of the right-hand side dense array.
+   //
+   // \param state The state of the calling thread.
+   // \param k The flattened page index of the element.
+   // \param i The row index of the element.
+   // \param j The column index of the element.
+   // \return void
+   */
+   BLAZE_ALWAYS_INLINE void apply( State& state, size_t k, size_t i, size_t j ) const {
+      fusedIndex( state.index, state.page, dims_, k, i, j );
+      lhs_( state.index ) = rhs_( state.index );
+   }
+
+   /*!\brief Assigns a SIMD pack of the right-hand side dense array (never selected).
+   //
+   // \return void
+   */
+   BLAZE_ALWAYS_INLINE void applySIMD( State&, size_t, size_t, size_t ) const {}
+   //**********************************************************************************************
+
+   //**Finish functions****************************************************************************
+   inline void finish( State&, size_t ) {}
+   inline void complete() {}
+   //**********************************************************************************************
+
+ private:
+   //**Resize functions****************************************************************************
+   /*!\brief Resizes a resizable target.
+   //
+   // \return void
+   */
+   inline void resize( TrueType ) {
+      lhs_.resize( dims_, false );
+   }
+
+   /*!\brief Resizes a non-resizable target (no-op, the size has been checked before).
+   //
+   // \return void
+   */
+   inline void resize( FalseType ) {}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   AT1&                       lhs_;   //!< The target left-hand side dense array.
+   const AT2&                 rhs_;   //!< The right-hand side dense array.
+   const std::array<size_t,N> dims_;  //!< The dimensions of the right-hand side dense array.
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   BLAZE_CONSTRAINT_MUST_NOT_REQUIRE_EVALUATION( AT2 );
+   BLAZE_STATIC_ASSERT( AT1::num_dimensions == N );
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CLASS FUSEDARRAYREDUCTIONSLOT
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Reduction of a dense array expression to a scalar within a fused assignment.
+// \ingroup dense_array
+//
+// Every thread accumulates its chunk of rows in a scalar accumulator, which is stored as partial
+// result of the chunk. After the traversal the partial results of all chunks are combined in
+// order of the chunks.
+*/
+template< typename T     // Type of the scalar target
+        , typename AT    // Type of the reduced dense array
+        , typename OP >  // Type of the reduction operation
+class FusedArrayReductionSlot
+{
+ public:
+   //**Type definitions****************************************************************************
+   using ElementType = ElementType_t<AT>;  //!< Element type of the reduced dense array.
+
+   //! Number of dimensions of the reduced dense array.
+   static constexpr size_t N = AT::num_dimensions;
+
+   //! Per-thread state of the reduction.
+   struct State {
+      std::array<size_t,N> index;  //!< The array index of the current element.
+      size_t               page;   //!< The flattened page index of the current element.
+      ElementType          value;  //!< The scalar accumulator.
+      bool                 valid;  //!< \a true in case the scalar accumulator holds a value.
+   };
+   //**********************************************************************************************
+
+   //**Compilation flags***************************************************************************
+   //! Compilation switch for the vectorized reduction.
+   static constexpr bool simdEnabled = false;
+   //**********************************************************************************************
+
+   //**Constructor*********************************************************************************
+   /*!\brief Constructor for the FusedArrayReductionSlot class.
+   //
+   // \param lhs The scalar target.
+   // \param rhs The reduction of the dense array.
+   */
+   inline FusedArrayReductionSlot( T& lhs, const FusedReduction<AT,OP>& rhs )
+      : lhs_     ( lhs )                         // The scalar target
+      , rhs_     ( rhs.operand() )               // The reduced dense array
+      , dims_    ( rhs.operand().dimensions() )  // The dimensions of the reduced dense array
+      , op_      ( rhs.operation() )             // The reduction operation
+      , partials_()                              // The partial results of all chunks
+   {}
+   //**********************************************************************************************
+
+   //**Size functions******************************************************************************
+   inline size_t pages  () const noexcept { return fusedPages( dims_ ); }
+   inline size_t rows   () const noexcept { return dims_[1UL]; }
+   inline size_t columns() const noexcept { return dims_[0UL]; }
+
+   inline const std::array<size_t,N>& dimensions() const noexcept { return dims_; }
+   //**********************************************************************************************
+
+   //**Threshold function**************************************************************************
+   /*!\brief Returns the SMP assignment threshold of the dense array.
+   //
+   // \return The minimum number of elements for a parallel assignment.
+   */
+   static inline size_t threshold() noexcept { return smpDArrAssignThreshold(); }
+   //**********************************************************************************************
+
+   //**Check function******************************************************************************
+   inline void check() const {}
+   //**********************************************************************************************
+
+   //**Prepare function****************************************************************************
+   /*!\brief Prepares the partial results of the given number of chunks.
+   //
+   // \param chunks The number of independently processed chunks of rows.
+   // \return void
+   */
+   inline void prepare( size_t chunks ) {
+      partials_.assign( chunks, std::make_pair( ElementType{}, false ) );
+   }
+   //**********************************************************************************************
+
+   //**Apply functions*****************************************************************************
+   /*!\brief Accumulates a single element of the reduced dense array.
+   //
+   // \param state The state of the calling thread.
+   // \param k The flattened page index of the element.
+   // \param i The row index of the element.
+   // \param j The column index of the element.
+   // \return void
+   */
+   BLAZE_ALWAYS_INLINE void apply( State& state, size_t k, size_t i, size_t j ) const {
+      fusedIndex( state.index, state.page, dims_, k, i, j );
+      const ElementType x( rhs_( state.index ) );
+      state.value = ( state.valid ? ElementType( op_( state.value, x ) ) : x );
+      state.valid = true;
+   }
+
+   /*!\brief Accumulates a SIMD pack of the reduced dense array (never selected).
+   //
+   // \return void
+   */
+   BLAZE_ALWAYS_INLINE void applySIMD( State&, size_t, size_t, size_t ) const {}
+   //**********************************************************************************************
+
+   //**Finish functions****************************************************************************
+   /*!\brief Stores the accumulated result of a chunk of rows.
+   //
+   // \param state The state of the thread that processed the chunk.
+   // \param chunk The index of the chunk.
+   // \return void
+   */
+   inline void finish( State& state, size_t chunk ) {
+      partials_[chunk] = std::make_pair( state.value, state.valid );
+   }
+
+   /*!\brief Combines the results of all chunks and assigns the reduction to the target.
+   //
+   // \return void
+   //
+   // In case the reduced dense array is empty, a default constructed value is assigned.
+   */
+   inline void complete() {
+      ElementType redux{};
+      bool valid( false );
+      for( const auto& partial : partials_ ) {
+         if( !partial.second ) continue;
+         redux = ( valid ? ElementType( op_( redux, partial.first ) ) : partial.first );
+         valid = true;
+      }
+      lhs_ = redux;
+   }
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   T&                                         lhs_;       //!< The scalar target.
+   const AT&                                  rhs_;       //!< The reduced dense array.
+   const std::array<size_t,N>                 dims_;      //!< The dimensions of the dense array.
+   OP                                         op_;        //!< The reduction operation.
+   std::vector< std::pair<ElementType,bool> > partials_;  //!< The partial results of all chunks.
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  FUSED ASSIGNMENT KERNELS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Creates the slot for the assignment of a dense tensor to a dense tensor.
+// \ingroup dense_tensor
+*/
+template< typename TT1   // Type of the left-hand side dense tensor
+        , typename TT2 > // Type of the right-hand side dense tensor
+inline FusedTensorSlot<TT1,TT2> fusedSlot( DenseTensor<TT1>& lhs, const DenseTensor<TT2>& rhs )
+{
+   return FusedTensorSlot<TT1,TT2>( *lhs, *rhs );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Creates the slot for the assignment of a dense array to a dense array.
+// \ingroup dense_array
+*/
+template< typename AT1   // Type of the left-hand side dense array
+        , typename AT2 > // Type of the right-hand side dense array
+inline FusedArraySlot<AT1,AT2> fusedSlot( DenseArray<AT1>& lhs, const DenseArray<AT2>& rhs )
+{
+   return FusedArraySlot<AT1,AT2>( *lhs, *rhs );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Creates the slot for the assignment of a dense tensor reduction to a scalar.
+// \ingroup dense_tensor
+*/
+template< typename T     // Type of the scalar target
+        , typename TT    // Type of the reduced dense tensor
+        , typename OP >  // Type of the reduction operation
+inline EnableIf_t< !IsDenseArray_v<TT>, FusedReductionSlot<T,TT,OP> >
+   fusedSlot( T& lhs, const FusedReduction<TT,OP>& rhs )
+{
+   return FusedReductionSlot<T,TT,OP>( lhs, rhs );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Creates the slot for the assignment of a dense array reduction to a scalar.
+// \ingroup dense_array
+*/
+template< typename T     // Type of the scalar target
+        , typename AT    // Type of the reduced dense array
+        , typename OP >  // Type of the reduction operation
+inline EnableIf_t< IsDenseArray_v<AT>, FusedArrayReductionSlot<T,AT,OP> >
+   fusedSlot( T& lhs, const FusedReduction<AT,OP>& rhs )
+{
+   return FusedArrayReductionSlot<T,AT,OP>( lhs, rhs );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns whether the dimensions of two operands of a fused assignment match.
+// \ingroup dense_tensor
+*/
+template< size_t N >  // Number of dimensions
+inline bool fusedConforms( const std::array<size_t,N>& lhs, const std::array<size_t,N>& rhs )
+{
+   return lhs == rhs;
+}
+
+template< size_t N1    // Number of dimensions of the left-hand side operand
+        , size_t N2 >  // Number of dimensions of the right-hand side operand
+inline bool fusedConforms( const std::array<size_t,N1>&, const std::array<size_t,N2>& )
+{
+   return false;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Calls the given function once for every index of the given index sequence.
+// \ingroup dense_tensor
+//
+// \param f The function to be called with an \c std::integral_constant of every index.
+// \return void
+*/
+template< size_t... Is   // The sequence of indices
+        , typename F >   // Type of the function
+BLAZE_ALWAYS_INLINE void fusedForEach( std::index_sequence<Is...>, F&& f )
+{
+   const int dummy[] = { 0, ( f( std::integral_constant<size_t,Is>() ), 0 )... };
+   MAYBE_UNUSED( dummy );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns whether all given flags are set.
+// \ingroup dense_tensor
+*/
+constexpr bool fusedAll( std::initializer_list<bool> flags )
+{
+   for( bool flag : flags ) {
+      if( !flag ) return false;
+   }
+   return true;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default kernel of the fused assignment of a range of rows.
+// \ingroup dense_tensor
+//
+// \param slots The slots of all assignments.
+// \param states The per-thread states of all assignments.
+// \param begin The first flattened row index \f$ k \cdot m + i \f$ of the range.
+// \param end The flattened row index one past the last row of the range.
+// \param m The number of rows per page.
+// \param n The number of columns.
+// \return void
+*/
+template< bool SIMD         // Vectorization flag
+        , typename Slots    // Type of the assignment slots
+        , typename States > // Type of the per-thread states
+inline EnableIf_t< !SIMD >
+   fusedAssignRows( Slots& slots, States& states, size_t begin, size_t end, size_t m, size_t n )
+{
+   using Indices = std::make_index_sequence< std::tuple_size<Slots>::value >;
+
+   for( size_t r=begin; r<end; ++r ) {
+      const size_t k( r / m );
+      const size_t i( r % m );
+      for( size_t j=0UL; j<n; ++j ) {
+         fusedForEach( Indices(), [&]( auto I ) {
+            constexpr size_t index( decltype(I)::value );
+            std::get<index>( slots ).apply( std::get<index>( states ), k, i, j );
+         } );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief SIMD optimized kernel of the fused assignment of a range of rows.
+// \ingroup dense_tensor
+//
+// \param slots The slots of all assignments.
+// \param states The per-thread states of all assignments.
+// \param begin The first flattened row index \f$ k \cdot m + i \f$ of the range.
+// \param end The flattened row index one past the last row of the range.
+// \param m The number of rows per page.
+// \param n The number of columns.
+// \return void
+//
+// All assignments are performed SIMD pack by SIMD pack in the order of the slots, such that
+// every pack of the operands is loaded while the packs of the preceding assignments are still
+// in cache (or in registers).
+*/
+template< bool SIMD         // Vectorization flag
+        , typename Slots    // Type of the assignment slots
+        , typename States > // Type of the per-thread states
+inline EnableIf_t< SIMD >
+   fusedAssignRows( Slots& slots, States& states, size_t begin, size_t end, size_t m, size_t n )
+{
+   using Indices = std::make_index_sequence< std::tuple_size<Slots>::value >;
+   using ET = typename std::tuple_element_t<0UL,Slots>::ElementType;
+
+   constexpr size_t SIMDSIZE( SIMDTrait<ET>::size );
+
+   const size_t jpos( n & size_t(-SIMDSIZE) );
+   BLAZE_INTERNAL_ASSERT( ( n - ( n % SIMDSIZE ) ) == jpos, "Invalid end calculation" );
+
+   for( size_t r=begin; r<end; ++r ) {
+      const size_t k( r / m );
+      const size_t i( r % m );
+      size_t j( 0UL );
+      for( ; j<jpos; j+=SIMDSIZE ) {
+         fusedForEach( Indices(), [&]( auto I ) {
+            constexpr size_t index( decltype(I)::value );
+            std::get<index>( slots ).applySIMD( std::get<index>( states ), k, i, j );
+         } );
+      }
+      for( ; j<n; ++j ) {
+         fusedForEach( Indices(), [&]( auto I ) {
+            constexpr size_t index( decltype(I)::value );
+            std::get<index>( slots ).apply( std::get<index>( states ), k, i, j );
+         } );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend implementation of the fused assignment.
+// \ingroup dense_tensor
+//
+// \param slots The slots of all assignments.
+// \return void
+// \exception std::invalid_argument Tensor sizes do not match.
+// \exception std::invalid_argument Tensor cannot be resized.
+// \exception std::invalid_argument Array cannot be resized.
+//
+// Dense tensors are traversed page by page, dense arrays with more than three dimensions are
+// traversed as tensors whose pages are the flattened outer dimensions of the array. The first
+// slot determines the traversal and therefore also the SMP assignment threshold. All slots
+// are checked before the first target is resized, i.e. in case an exception is thrown all
+// targets are left unchanged.
+*/
+template< typename... Slots >  // Types of the assignment slots
+void fusedAssign( std::tuple<Slots...>& slots )
+{
+   using Indices = std::index_sequence_for<Slots...>;
+   using First = std::tuple_element_t< 0UL, std::tuple<Slots...> >;
+   using ET = typename First::ElementType;
+
+   constexpr bool simd( useOptimizedKernels &&
+                        fusedAll( { Slots::simdEnabled... } ) &&
+                        fusedAll( { IsSame_v< ET, typename Slots::ElementType >... } ) );
+
+   const size_t o( std::get<0UL>( slots ).pages()   );
+   const size_t m( std::get<0UL>( slots ).rows()    );
+   const size_t n( std::get<0UL>( slots ).columns() );
+
+   fusedForEach( Indices(), [&]( auto I ) {
+      const auto& slot( std::get<decltype(I)::value>( slots ) );
+      if( !fusedConforms( slot.dimensions(), std::get<0UL>( slots ).dimensions() ) ) {
+         BLAZE_THROW_INVALID_ARGUMENT( "Tensor sizes do not match" );
+      }
+      slot.check();
+   } );
+
+   const size_t rows( o*m );
+   const bool parallel( !isSerialSectionActive() && rows > 1UL &&
+                        rows*n >= First::threshold() );
+   const size_t chunks( parallel ? min( rows, getNumThreads()*4UL ) : 1UL );
+
+   fusedForEach( Indices(), [&]( auto I ) {
+      std::get<decltype(I)::value>( slots ).prepare( chunks );
+   } );
+
+   auto kernel = [&]( size_t chunk )
+   {
+      std::tuple<typename Slots::State...> states{};
+
+      fusedAssignRows<simd>( slots, states, ( rows*chunk ) / chunks,
+                             ( rows*(chunk+1UL) ) / chunks, m, n );
+
+      fusedForEach( Indices(), [&]( auto I ) {
+         constexpr size_t index( decltype(I)::value );
+         std::get<index>( slots ).finish( std::get<index>( states ), chunk );
+      } );
+   };
+
+   if( chunks > 1UL ) smpFor( 0UL, chunks, kernel );
+   else kernel( 0UL );
+
+   fusedForEach( Indices(), [&]( auto I ) {
+      std::get<decltype(I)::value>( slots ).complete();
+   } );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Pairs the targets with their sources and performs the fused assignment.
+// \ingroup dense_tensor
+*/
+template< typename... Targets  // Types of the targets
+        , size_t... Is         // Indices of the targets
+        , typename... Sources > // Types of the sources
+inline void assignAllBackend( std::tuple<Targets&...> targets, std::index_sequence<Is...>,
+                              const Sources&... sources )
+{
+   auto slots( std::make_tuple( fusedSlot( std::get<Is>( targets ), sources )... ) );
+
+   fusedAssign( slots );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Describes the reduction of a dense tensor within a fused assignment.
+// \ingroup dense_tensor
+//
+// \param tens The dense tensor to be reduced.
+// \param op The binary reduction operation.
+// \return The description of the reduction.
+//
+// The returned object can be passed as source of a scalar target to assignAll(). The reduction
+// operation is required to be associative and commutative.
+*/
+template< typename TT    // Type of the reduced dense tensor
+        , typename OP >  // Type of the reduction operation
+inline FusedReduction<TT,OP> fusedReduce( const DenseTensor<TT>& tens, OP op )
+{
+   return FusedReduction<TT,OP>( *tens, op );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Describes the summation of a dense tensor within a fused assignment.
+// \ingroup dense_tensor
+//
+// \param tens The dense tensor to be summed up.
+// \return The description of the summation.
+*/
+template< typename TT >  // Type of the reduced dense tensor
+inline FusedReduction<TT,Add> fusedSum( const DenseTensor<TT>& tens )
+{
+   return FusedReduction<TT,Add>( *tens, Add() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Describes the reduction of a dense array within a fused assignment.
+// \ingroup dense_array
+//
+// \param array The dense array to be reduced.
+// \param op The binary reduction operation.
+// \return The description of the reduction.
+//
+// The returned object can be passed as source of a scalar target to assignAll(). The reduction
+// operation is required to be associative and commutative.
+*/
+template< typename AT    // Type of the reduced dense array
+        , typename OP >  // Type of the reduction operation
+inline FusedReduction<AT,OP> fusedReduce( const DenseArray<AT>& array, OP op )
+{
+   return FusedReduction<AT,OP>( *array, op );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Describes the summation of a dense array within a fused assignment.
+// \ingroup dense_array
+//
+// \param array The dense array to be summed up.
+// \return The description of the summation.
+*/
+template< typename AT >  // Type of the reduced dense array
+inline FusedReduction<AT,Add> fusedSum( const DenseArray<AT>& array )
+{
+   return FusedReduction<AT,Add>( *array, Add() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Evaluates several element-wise dense tensor or array expressions in a single traversal.
+// \ingroup dense_tensor
+//
+// \param targets The targets, tied together via \c std::tie().
+// \param sources The dense tensor or array expressions and reductions assigned to the targets.
+// \return void
+// \exception std::invalid_argument Tensor sizes do not match.
+// \exception std::invalid_argument Tensor cannot be resized.
+// \exception std::invalid_argument Array cannot be resized.
+//
+// This function assigns the i-th source to the i-th target. Dense tensor and array targets are
+// assigned the corresponding dense tensor or array expression, scalar targets are assigned the
+// result of the corresponding reduction (see fusedReduce() and fusedSum()). In contrast to a
+// sequence of individual assignments, all assignments are performed in a single pass over the
+// operands: every row is traversed once and within each row all assignments are performed SIMD
+// pack by SIMD pack. Operands that are used by several sources are therefore only streamed once
+// from memory:
+
+   \code
+   blaze::DynamicTensor<float> w, g, m, v;
+   float gg( 0.0F );
+   // ... Resizing and initialization
+
+   // Adam moment update and squared gradient norm, reading g, m and v only once
+   blaze::assignAll( std::tie( m, v, gg ),
+                     0.9F*m + 0.1F*g, 0.999F*v + 0.001F*(g%g), blaze::fusedSum( g%g ) );
+   \endcode
+
+// The result is identical to the sequence of the individual assignments (apart from rounding
+// differences of the reductions), including the case that a target is used as operand of a
+// later source. For that reason all sources must be element-wise expressions, i.e. element
+// \f$ (k,i,j) \f$ of a source must only depend on the elements \f$ (k,i,j) \f$ of its
+// operands. Expressions that require an intermediate evaluation (as for instance tensor
+// multiplications) result in a compilation error. All sources must have the same size, and
+// resizable targets are resized accordingly. The sizes of all targets are checked before the
+// first target is resized, i.e. a failed assignment leaves all targets unchanged. The rows are
+// distributed among the threads of the active SMP backend in case the total number of elements
+// exceeds the SMP assignment threshold of the first source (i.e. the threshold of tensors or
+// arrays, respectively). The assignment is vectorized in case all sources and targets are
+// tensors that allow vectorization and share the same element type. Dense arrays of any
+// dimensionality can be used as well, element \f$ (k,i,j) \f$ then denotes the element with
+// column index \a j and row index \a i in the flattened page \a k of the array:
+
+   \code
+   blaze::DynamicArray<4,double> A( 2UL, 3UL, 40UL, 50UL ), B, C;
+   double total( 0.0 );
+   // ... Initialization
+
+   blaze::assignAll( std::tie( B, C, total ), A * 2.0, B * 0.5, blaze::fusedSum( A ) );
+   \endcode
+*/
+template< typename... Targets    // Types of the targets
+        , typename... Sources >  // Types of the sources
+inline void assignAll( std::tuple<Targets&...> targets, const Sources&... sources )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_STATIC_ASSERT_MSG( sizeof...( Targets ) == sizeof...( Sources ),
+                            "Number of targets and sources doesn't match" );
+   BLAZE_STATIC_ASSERT_MSG( sizeof...( Sources ) > 0UL, "No sources given" );
+
+   assignAllBackend( targets, std::index_sequence_for<Sources...>(), sources... );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
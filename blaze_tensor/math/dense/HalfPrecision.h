@@ -0,0 +1,475 @@
+//=================================================================================================
+/*!
+//  \file blaze_tensor/math/dense/HalfPrecision.h
+//  \brief Header file for the SIMD conversion between half-width and single precision tensors
+//
+//  Copyright (C) 2012-2018 Klaus Iglberger - All Rights Reserved
+//  Copyright (C) 2018 Hartmut Kaiser - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+
+#ifndef _BLAZE_TENSOR_MATH_DENSE_HALFPRECISION_H_
+#define _BLAZE_TENSOR_MATH_DENSE_HALFPRECISION_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <array>
+
+#include <blaze/math/Aliases.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/smp/SerialSection.h>
+#include <blaze/math/typetraits/HasConstDataAccess.h>
+#include <blaze/math/typetraits/HasMutableDataAccess.h>
+#include <blaze/math/typetraits/IsResizable.h>
+#include <blaze/system/Vectorization.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/FunctionTrace.h>
+#include <blaze/util/Types.h>
+
+#include <blaze_tensor/math/expressions/DenseArray.h>
+#include <blaze_tensor/math/expressions/DenseTensor.h>
+#include <blaze_tensor/math/smp/ParallelFor.h>
+#include <blaze_tensor/system/Thresholds.h>
+#include <blaze_tensor/util/HalfPrecision.h>
+
+#if defined(__F16C__) || BLAZE_AVX2_MODE || BLAZE_AVX512F_MODE
+#  include <immintrin.h>
+#endif
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  ROW CONVERSION KERNELS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Element-wise conversion of a row of elements.
+// \ingroup dense_tensor
+//
+// \param dst The first element of the target row.
+// \param src The first element of the source row.
+// \param n The number of elements.
+// \return void
+*/
+template< typename T1    // Type of the target elements
+        , typename T2 >  // Type of the source elements
+inline void convertRow( T1* dst, const T2* src, size_t n )
+{
+   for( size_t j=0UL; j<n; ++j ) {
+      dst[j] = src[j];
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief SIMD widening of a row of float16 elements to single precision.
+// \ingroup dense_tensor
+*/
+inline void convertRow( float* dst, const float16* src, size_t n ) noexcept
+{
+   size_t j( 0UL );
+
+#if BLAZE_AVX512F_MODE
+   for( ; j+16UL<=n; j+=16UL ) {
+      const __m256i h( _mm256_loadu_si256( reinterpret_cast<const __m256i*>( src+j ) ) );
+      _mm512_storeu_ps( dst+j, _mm512_cvtph_ps( h ) );
+   }
+#endif
+#if defined(__F16C__)
+   for( ; j+8UL<=n; j+=8UL ) {
+      const __m128i h( _mm_loadu_si128( reinterpret_cast<const __m128i*>( src+j ) ) );
+      _mm256_storeu_ps( dst+j, _mm256_cvtph_ps( h ) );
+   }
+#endif
+
+   for( ; j<n; ++j ) {
+      dst[j] = src[j];
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief SIMD rounding of a row of single precision elements to float16.
+// \ingroup dense_tensor
+*/
+inline void convertRow( float16* dst, const float* src, size_t n ) noexcept
+{
+   size_t j( 0UL );
+
+#if BLAZE_AVX512F_MODE
+   for( ; j+16UL<=n; j+=16UL ) {
+      const __m256i h( _mm512_cvtps_ph( _mm512_loadu_ps( src+j ), _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC ) );
+      _mm256_storeu_si256( reinterpret_cast<__m256i*>( dst+j ), h );
+   }
+#endif
+#if defined(__F16C__)
+   for( ; j+8UL<=n; j+=8UL ) {
+      const __m128i h( _mm256_cvtps_ph( _mm256_loadu_ps( src+j ), _MM_FROUND_TO_NEAREST_INT ) );
+      _mm_storeu_si128( reinterpret_cast<__m128i*>( dst+j ), h );
+   }
+#endif
+
+   for( ; j<n; ++j ) {
+      dst[j] = src[j];
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief SIMD widening of a row of bfloat16 elements to single precision.
+// \ingroup dense_tensor
+*/
+inline void convertRow( float* dst, const bfloat16* src, size_t n ) noexcept
+{
+   size_t j( 0UL );
+
+#if BLAZE_AVX512F_MODE
+   for( ; j+16UL<=n; j+=16UL ) {
+      const __m512i x( _mm512_cvtepu16_epi32( _mm256_loadu_si256( reinterpret_cast<const __m256i*>( src+j ) ) ) );
+      _mm512_storeu_ps( dst+j, _mm512_castsi512_ps( _mm512_slli_epi32( x, 16 ) ) );
+   }
+#endif
+#if BLAZE_AVX2_MODE
+   for( ; j+8UL<=n; j+=8UL ) {
+      const __m256i x( _mm256_cvtepu16_epi32( _mm_loadu_si128( reinterpret_cast<const __m128i*>( src+j ) ) ) );
+      _mm256_storeu_ps( dst+j, _mm256_castsi256_ps( _mm256_slli_epi32( x, 16 ) ) );
+   }
+#endif
+
+   for( ; j<n; ++j ) {
+      dst[j] = src[j];
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief SIMD rounding of a row of single precision elements to bfloat16.
+// \ingroup dense_tensor
+//
+// The SIMD kernels use the same integer rounding (round to nearest even, NaNs are quieted) as
+// the scalar conversion and therefore produce identical results on all instruction sets.
+*/
+inline void convertRow( bfloat16* dst, const float* src, size_t n ) noexcept
+{
+   size_t j( 0UL );
+
+#if BLAZE_AVX512F_MODE
+   {
+      const __m512i one  ( _mm512_set1_epi32( 1 ) );
+      const __m512i bias ( _mm512_set1_epi32( 0x7FFF ) );
+      const __m512i quiet( _mm512_set1_epi32( 0x00400000 ) );
+
+      for( ; j+16UL<=n; j+=16UL ) {
+         const __m512    v( _mm512_loadu_ps( src+j ) );
+         const __m512i   x( _mm512_castps_si512( v ) );
+         const __mmask16 nan( _mm512_cmp_ps_mask( v, v, _CMP_UNORD_Q ) );
+
+         __m512i r( _mm512_add_epi32( _mm512_add_epi32( x, bias ),
+                                      _mm512_and_si512( _mm512_srli_epi32( x, 16 ), one ) ) );
+         r = _mm512_mask_mov_epi32( r, nan, _mm512_or_si512( x, quiet ) );
+
+         _mm256_storeu_si256( reinterpret_cast<__m256i*>( dst+j ),
+                              _mm512_cvtepi32_epi16( _mm512_srli_epi32( r, 16 ) ) );
+      }
+   }
+#endif
+#if BLAZE_AVX2_MODE
+   {
+      const __m256i one  ( _mm256_set1_epi32( 1 ) );
+      const __m256i bias ( _mm256_set1_epi32( 0x7FFF ) );
+      const __m256i quiet( _mm256_set1_epi32( 0x00400000 ) );
+
+      for( ; j+8UL<=n; j+=8UL ) {
+         const __m256  v( _mm256_loadu_ps( src+j ) );
+         const __m256i x( _mm256_castps_si256( v ) );
+         const __m256i nan( _mm256_castps_si256( _mm256_cmp_ps( v, v, _CMP_UNORD_Q ) ) );
+
+         __m256i r( _mm256_add_epi32( _mm256_add_epi32( x, bias ),
+                                      _mm256_and_si256( _mm256_srli_epi32( x, 16 ), one ) ) );
+         r = _mm256_blendv_epi8( r, _mm256_or_si256( x, quiet ), nan );
+         r = _mm256_srli_epi32( r, 16 );
+
+         // Packing the low halves of all eight lanes in order
+         const __m256i packed( _mm256_permute4x64_epi64( _mm256_packus_epi32( r, r ), 0x08 ) );
+         _mm_storeu_si128( reinterpret_cast<__m128i*>( dst+j ), _mm256_castsi256_si128( packed ) );
+      }
+   }
+#endif
+
+   for( ; j<n; ++j ) {
+      dst[j] = src[j];
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONVERSION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Resizes a resizable target to the given size.
+// \ingroup dense_tensor
+*/
+template< typename TT >  // Type of the target tensor
+EnableIf_t< IsResizable_v<TT> > prepareConversion( TT& tens, size_t o, size_t m, size_t n )
+{
+   tens.resize( o, m, n, false );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Checks the size of a non-resizable target against the given size.
+// \ingroup dense_tensor
+*/
+template< typename TT >  // Type of the target tensor
+DisableIf_t< IsResizable_v<TT> > prepareConversion( TT& tens, size_t o, size_t m, size_t n )
+{
+   if( tens.pages() != o || tens.rows() != m || tens.columns() != n ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Tensor sizes do not match" );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Resizes a resizable target array to the given dimensions.
+// \ingroup dense_array
+*/
+template< typename AT  // Type of the target array
+        , size_t N >   // Number of dimensions
+EnableIf_t< IsResizable_v<AT> > prepareConversion( AT& arr, const std::array< size_t, N >& dims )
+{
+   arr.resize( dims, false );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Checks the dimensions of a non-resizable target array against the given dimensions.
+// \ingroup dense_array
+*/
+template< typename AT  // Type of the target array
+        , size_t N >   // Number of dimensions
+DisableIf_t< IsResizable_v<AT> > prepareConversion( AT& arr, const std::array< size_t, N >& dims )
+{
+   if( arr.dimensions() != dims ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Array sizes do not match" );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Row-wise conversion of a tensor with low-level data access.
+// \ingroup dense_tensor
+*/
+template< typename TT1    // Type of the target tensor
+        , typename TT2 >  // Type of the source tensor
+EnableIf_t< HasMutableDataAccess_v<TT1> && HasConstDataAccess_v<TT2> >
+   convertTensorElements( TT1& dst, const TT2& src )
+{
+   const size_t m( src.rows() );
+   const size_t n( src.columns() );
+   const size_t rows( src.pages() * m );
+
+   auto row = [&]( size_t r ) {
+      convertRow( dst.data( r % m, r / m ), src.data( r % m, r / m ), n );
+   };
+
+   if( !isSerialSectionActive() && rows*n >= smpDTensAssignThreshold() ) {
+      smpFor( 0UL, rows, row );
+   }
+   else {
+      serialFor( 0UL, rows, row );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Element-wise conversion of a tensor without low-level data access.
+// \ingroup dense_tensor
+*/
+template< typename TT1    // Type of the target tensor
+        , typename TT2 >  // Type of the source tensor
+DisableIf_t< HasMutableDataAccess_v<TT1> && HasConstDataAccess_v<TT2> >
+   convertTensorElements( TT1& dst, const TT2& src )
+{
+   dst = src;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Converts the elements of a dense tensor into the element type of another dense tensor.
+// \ingroup dense_tensor
+//
+// \param dst The target tensor.
+// \param src The source tensor.
+// \return void
+// \exception std::invalid_argument Tensor sizes do not match.
+//
+// This function assigns the elements of \a src to \a dst, converting them to the element type
+// of \a dst. Resizable targets are resized, other targets must have the size of \a src. The
+// conversion between half-width (blaze::float16, blaze::bfloat16) and single precision tensors
+// with low-level data access is vectorized (F16C, AVX2 and AVX-512 instructions) and executed
+// in parallel for large tensors:
+
+   \code
+   blaze::DynamicTensor<float> A( 64UL, 128UL, 128UL );
+   blaze::DynamicTensor<blaze::float16> H;
+   // ... Initialization
+
+   convert( H, A );  // Half the memory of A, rounded to nearest even
+   convert( A, H );  // Exact widening to single precision
+   \endcode
+*/
+template< typename TT1    // Type of the target tensor
+        , typename TT2 >  // Type of the source tensor
+void convert( DenseTensor<TT1>& dst, const DenseTensor<TT2>& src )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   prepareConversion( *dst, (*src).pages(), (*src).rows(), (*src).columns() );
+   convertTensorElements( *dst, *src );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Row-wise conversion of an array with low-level data access.
+// \ingroup dense_array
+*/
+template< typename AT1    // Type of the target array
+        , typename AT2 >  // Type of the source array
+EnableIf_t< HasMutableDataAccess_v<AT1> && HasConstDataAccess_v<AT2> >
+   convertArrayElements( AT1& dst, const AT2& src )
+{
+   const size_t n( src.dimensions()[0] );
+
+   size_t rows( 1UL );
+   for( size_t d=1UL; d<AT2::num_dimensions; ++d ) {
+      rows *= src.dimensions()[d];
+   }
+
+   auto row = [&]( size_t r ) {
+      convertRow( dst.data() + r*dst.spacing(), src.data() + r*src.spacing(), n );
+   };
+
+   if( !isSerialSectionActive() && rows*n >= smpDTensAssignThreshold() ) {
+      smpFor( 0UL, rows, row );
+   }
+   else {
+      serialFor( 0UL, rows, row );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Element-wise conversion of an array without low-level data access.
+// \ingroup dense_array
+*/
+template< typename AT1    // Type of the target array
+        , typename AT2 >  // Type of the source array
+DisableIf_t< HasMutableDataAccess_v<AT1> && HasConstDataAccess_v<AT2> >
+   convertArrayElements( AT1& dst, const AT2& src )
+{
+   dst = src;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Converts the elements of a dense array into the element type of another dense array.
+// \ingroup dense_array
+//
+// \param dst The target array.
+// \param src The source array.
+// \return void
+// \exception std::invalid_argument Array sizes do not match.
+//
+// This function is the ND array counterpart of the conversion of dense tensors: resizable
+// targets are resized, half-width/single precision conversions of arrays with low-level data
+// access are vectorized and executed in parallel for large arrays.
+*/
+template< typename AT1    // Type of the target array
+        , typename AT2 >  // Type of the source array
+void convert( DenseArray<AT1>& dst, const DenseArray<AT2>& src )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   prepareConversion( *dst, (*src).dimensions() );
+   convertArrayElements( *dst, *src );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
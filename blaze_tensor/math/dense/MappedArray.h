@@ -0,0 +1,443 @@
+//=================================================================================================
+/*!
+//  \file blaze_tensor/math/dense/MappedArray.h
+//  \brief Header file for the implementation of a memory mapped array
+//
+//  Copyright (C) 2012-2018 Klaus Iglberger - All Rights Reserved
+//  Copyright (C) 2018 Hartmut Kaiser - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+
+#ifndef _BLAZE_TENSOR_MATH_DENSE_MAPPEDARRAY_H_
+#define _BLAZE_TENSOR_MATH_DENSE_MAPPEDARRAY_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <array>
+#include <string>
+#include <utility>
+
+#include <blaze/math/AlignmentFlag.h>
+#include <blaze/math/PaddingFlag.h>
+#include <blaze/util/FunctionTrace.h>
+#include <blaze/util/StaticAssert.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsNumeric.h>
+
+#include <blaze_tensor/math/dense/CustomArray.h>
+#include <blaze_tensor/math/dense/MappedFormat.h>
+#include <blaze_tensor/math/expressions/DenseArray.h>
+#include <blaze_tensor/math/ZeroPadded.h>
+#include <blaze_tensor/util/MappedFile.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\defgroup mapped_array MappedArray
+// \ingroup dense_array
+*/
+/*!\brief Dense N-dimensional array backed by a memory mapped file.
+// \ingroup mapped_array
+//
+// The MappedArray class template is the N-dimensional counterpart of the MappedTensor class
+// template. It maps an array file into memory and exposes its content as an aligned and padded
+// CustomArray without reading the file:
+
+   \code
+   // Writing an array file
+   blaze::DynamicArray<4,float> A( 64UL, 3UL, 224UL, 224UL );
+   // ... Initialization
+   blaze::writeMapped( "images.array", A );
+
+   // Mapping the file for reading
+   blaze::MappedArray<4,float> mapped( "images.array" );
+   mapped.advise( blaze::MapAdvice::sequential );
+   \endcode
+
+// Tensor files are array files with three dimensions, i.e. a tensor file can also be mapped
+// by a \c MappedArray<3,Type> and vice versa. See MappedTensor for a description of the access
+// modes.
+//
+// \note The MappedArray class template requires a POSIX system.
+*/
+template< size_t N         // Dimensionality of the array
+        , typename Type >  // Data type of the array
+class MappedArray
+{
+ public:
+   //**Type definitions****************************************************************************
+   using ElementType = Type;                                //!< Type of the array elements.
+   using ArrayType   = CustomArray<N,Type,aligned,padded>;  //!< Type of the mapped array.
+   //**********************************************************************************************
+
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit inline MappedArray( const std::string& path, MapMode mode = MapMode::readOnly );
+   explicit inline MappedArray( const std::string& path, std::array< size_t, N > const& dims );
+
+   MappedArray( const MappedArray& ) = delete;
+   MappedArray( MappedArray&& ) = default;
+   //@}
+   //**********************************************************************************************
+
+   //**Assignment operators************************************************************************
+   /*!\name Assignment operators */
+   //@{
+   MappedArray& operator=( const MappedArray& ) = delete;
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline ArrayType&                     array() noexcept;
+   inline const ArrayType&               array() const noexcept;
+   inline std::array< size_t, N > const& dimensions() const noexcept;
+   inline size_t                         spacing() const noexcept;
+   inline MapMode                        mode() const noexcept;
+   inline void                           advise( MapAdvice advice ) const;
+   inline void                           advise( MapAdvice advice, size_t row, size_t rows ) const;
+   inline void                           flush( bool async = false ) const;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   static inline ArrayType openArray( const MappedFile& file );
+   static inline ArrayType createArray( const MappedFile& file, std::array< size_t, N > const& dims );
+
+   template< size_t... Is >
+   static inline ArrayType makeArray( Type* ptr, std::array< size_t, N > const& dims,
+                                      size_t spacing, std::index_sequence<Is...> );
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   MappedFile file_;   //!< The memory mapped file.
+   ArrayType  array_;  //!< The array referring to the mapped memory.
+   //@}
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_STATIC_ASSERT_MSG( IsNumeric_v<Type>, "Mapped arrays require numeric element types" );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Maps an existing array file.
+//
+// \param path The path of the array file.
+// \param mode The access mode of the mapping.
+// \exception std::runtime_error File could not be mapped.
+// \exception std::invalid_argument Invalid array file.
+//
+// This constructor maps the given array file. The construction fails if the file cannot be
+// mapped, if it is not an array file of dimensionality \a N, or if its element type does not
+// match \a Type.
+*/
+template< size_t N         // Dimensionality of the array
+        , typename Type >  // Data type of the array
+inline MappedArray<N,Type>::MappedArray( const std::string& path, MapMode mode )
+   : file_ ( path, mode )          // The memory mapped file
+   , array_( openArray( file_ ) )  // The array referring to the mapped memory
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Creates a new array file with the given dimensions.
+//
+// \param path The path of the array file.
+// \param dims The dimensions of the array, starting with the innermost (column) dimension.
+// \exception std::runtime_error File could not be created.
+//
+// This constructor creates a new array file (an existing file is replaced) and maps it in
+// \a readWrite mode. All elements of the new array are zero.
+*/
+template< size_t N         // Dimensionality of the array
+        , typename Type >  // Data type of the array
+inline MappedArray<N,Type>::MappedArray( const std::string& path, std::array< size_t, N > const& dims )
+   : file_ ( path, mappedFileSize<Type>( dims.data(), N ) )  // The memory mapped file
+   , array_( createArray( file_, dims ) )                   // The array referring to the mapped memory
+{}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the array referring to the mapped memory.
+//
+// \return Reference to the mapped array.
+*/
+template< size_t N         // Dimensionality of the array
+        , typename Type >  // Data type of the array
+inline typename MappedArray<N,Type>::ArrayType& MappedArray<N,Type>::array() noexcept
+{
+   return array_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the array referring to the mapped memory.
+//
+// \return Reference to the mapped array.
+*/
+template< size_t N         // Dimensionality of the array
+        , typename Type >  // Data type of the array
+inline const typename MappedArray<N,Type>::ArrayType& MappedArray<N,Type>::array() const noexcept
+{
+   return array_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the dimensions of the array.
+//
+// \return The dimensions of the array, starting with the innermost dimension.
+*/
+template< size_t N         // Dimensionality of the array
+        , typename Type >  // Data type of the array
+inline std::array< size_t, N > const& MappedArray<N,Type>::dimensions() const noexcept
+{
+   return array_.dimensions();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the spacing between the beginning of two rows.
+//
+// \return The spacing between the beginning of two rows.
+*/
+template< size_t N         // Dimensionality of the array
+        , typename Type >  // Data type of the array
+inline size_t MappedArray<N,Type>::spacing() const noexcept
+{
+   return array_.spacing();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the access mode of the mapping.
+//
+// \return The access mode of the mapping.
+*/
+template< size_t N         // Dimensionality of the array
+        , typename Type >  // Data type of the array
+inline MapMode MappedArray<N,Type>::mode() const noexcept
+{
+   return file_.mode();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Passes an access pattern hint for the complete array to the operating system.
+//
+// \param advice The access pattern hint.
+// \return void
+*/
+template< size_t N         // Dimensionality of the array
+        , typename Type >  // Data type of the array
+inline void MappedArray<N,Type>::advise( MapAdvice advice ) const
+{
+   file_.advise( advice );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Passes an access pattern hint for a range of rows to the operating system.
+//
+// \param advice The access pattern hint.
+// \param row The index of the first row the hint applies to.
+// \param rows The number of rows the hint applies to.
+// \return void
+//
+// The rows are counted over all dimensions but the innermost one, i.e. row \a r starts at
+// element \c r*spacing() of the array.
+*/
+template< size_t N         // Dimensionality of the array
+        , typename Type >  // Data type of the array
+inline void MappedArray<N,Type>::advise( MapAdvice advice, size_t row, size_t rows ) const
+{
+   const size_t bytes( array_.spacing() * sizeof( Type ) );
+
+   file_.advise( advice, mappedDataOffset( N ) + row * bytes, rows * bytes );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Writes all modifications of a \a readWrite mapping back to the file.
+//
+// \param async \a true to only schedule the write-back, \a false to wait for its completion.
+// \return void
+// \exception std::runtime_error Mapping could not be flushed.
+*/
+template< size_t N         // Dimensionality of the array
+        , typename Type >  // Data type of the array
+inline void MappedArray<N,Type>::flush( bool async ) const
+{
+   file_.flush( async );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Creates the array referring to an existing array file.
+//
+// \param file The mapping of the array file.
+// \return The array referring to the mapped memory.
+// \exception std::invalid_argument Invalid array file.
+*/
+template< size_t N         // Dimensionality of the array
+        , typename Type >  // Data type of the array
+inline typename MappedArray<N,Type>::ArrayType
+   MappedArray<N,Type>::openArray( const MappedFile& file )
+{
+   std::array< size_t, N > dims;
+   size_t spacing;
+
+   Type* const ptr( readMappedHeader<Type>( file, dims.data(), N, spacing ) );
+
+   return makeArray( ptr, dims, spacing, std::make_index_sequence<N>() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Creates the array referring to a new array file.
+//
+// \param file The writable mapping of the array file.
+// \param dims The dimensions of the array, starting with the innermost dimension.
+// \return The array referring to the mapped memory.
+*/
+template< size_t N         // Dimensionality of the array
+        , typename Type >  // Data type of the array
+inline typename MappedArray<N,Type>::ArrayType
+   MappedArray<N,Type>::createArray( const MappedFile& file, std::array< size_t, N > const& dims )
+{
+   Type* const ptr( writeMappedHeader<Type>( file, dims.data(), N ) );
+
+   return makeArray( ptr, dims, mappedSpacing<Type>( dims[0] ), std::make_index_sequence<N>() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructs the custom array on the mapped memory.
+//
+// \param ptr The first element of the array.
+// \param dims The dimensions of the array, starting with the innermost dimension.
+// \param spacing The spacing between two rows.
+// \return The array referring to the mapped memory.
+*/
+template< size_t N         // Dimensionality of the array
+        , typename Type >  // Data type of the array
+template< size_t... Is >
+inline typename MappedArray<N,Type>::ArrayType
+   MappedArray<N,Type>::makeArray( Type* ptr, std::array< size_t, N > const& dims,
+                                   size_t spacing, std::index_sequence<Is...> )
+{
+   return ArrayType( zero_padded, ptr, dims[N-1UL-Is]..., spacing );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Writes the given dense array into a new array file.
+// \ingroup mapped_array
+//
+// \param path The path of the array file.
+// \param arr The array to be written.
+// \return void
+// \exception std::runtime_error File could not be written.
+//
+// This function creates a new array file (an existing file is replaced) that can be mapped by
+// means of a MappedArray.
+*/
+template< typename AT >  // Type of the array
+void writeMapped( const std::string& path, const DenseArray<AT>& arr )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   MappedArray< AT::num_dimensions, ElementType_t<AT> > mapped( path, (*arr).dimensions() );
+
+   mapped.array() = *arr;
+   mapped.flush();
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,294 @@
+//=================================================================================================
+/*!
+//  \file blaze_tensor/math/dense/MappedFormat.h
+//  \brief Header file for the on-disk format of memory mapped tensors and arrays
+//
+//  Copyright (C) 2012-2018 Klaus Iglberger - All Rights Reserved
+//  Copyright (C) 2018 Hartmut Kaiser - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+
+#ifndef _BLAZE_TENSOR_MATH_DENSE_MAPPEDFORMAT_H_
+#define _BLAZE_TENSOR_MATH_DENSE_MAPPEDFORMAT_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstring>
+#include <limits>
+
+#include <blaze/math/Exception.h>
+#include <blaze/math/serialization/TypeValueMapping.h>
+#include <blaze/math/shims/NextMultiple.h>
+#include <blaze/util/Types.h>
+
+#include <blaze_tensor/util/MappedFile.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  ON-DISK FORMAT OF MAPPED TENSORS AND ARRAYS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Layout constants of memory mapped tensor and array files.
+// \ingroup util
+//
+// A mapped file starts with the following header (all values in native byte order):
+//
+//  - bytes  0- 7: the magic number \c "BLZTENSR"
+//  - byte      8: the format version (currently 1)
+//  - byte      9: the element type identifier (see \c TypeValueMapping)
+//  - byte     10: the size of a single element in bytes
+//  - byte     11: the number of dimensions \a D
+//  - bytes 12-15: reserved (zero)
+//  - bytes 16-23: the spacing between two rows in elements
+//  - bytes 24-31: the byte offset of the first element
+//  - bytes 32-  : the \a D extents, starting with the innermost (column) dimension
+//
+// The elements start at the next multiple of \a dataAlignment and are stored row by row. Each
+// row is padded with zeros to the spacing, which is a multiple of 64 bytes. Therefore the rows
+// are properly aligned and padded for all supported instruction sets and the payload can be
+// used in place as an aligned, padded custom tensor or array.
+*/
+struct MappedFormat
+{
+   static constexpr size_t headerSize    = 32UL;    //!< Size of the fixed part of the header.
+   static constexpr size_t dataAlignment = 4096UL;  //!< Alignment of the first element.
+   static constexpr size_t rowAlignment  = 64UL;    //!< Alignment of each row in bytes.
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the byte offset of the first element of a mapped file with \a D dimensions.
+// \ingroup util
+//
+// \param D The number of dimensions.
+// \return The byte offset of the first element.
+*/
+inline size_t mappedDataOffset( size_t D ) noexcept
+{
+   return nextMultiple<size_t>( MappedFormat::headerSize + D * sizeof( uint64_t ), MappedFormat::dataAlignment );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the padded spacing of rows with \a n elements in a mapped file.
+// \ingroup util
+//
+// \param n The number of elements per row.
+// \return The number of elements between two rows.
+*/
+template< typename Type >  // Data type of the elements
+inline size_t mappedSpacing( size_t n ) noexcept
+{
+   constexpr size_t width( sizeof( Type ) < MappedFormat::rowAlignment
+                           ? MappedFormat::rowAlignment / sizeof( Type )
+                           : 1UL );
+
+   return nextMultiple<size_t>( n, width );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the size in bytes of a mapped file with the given extents.
+// \ingroup util
+//
+// \param dims The extents, starting with the innermost dimension.
+// \param D The number of dimensions.
+// \return The size of the file in bytes.
+*/
+template< typename Type >  // Data type of the elements
+inline size_t mappedFileSize( const size_t* dims, size_t D ) noexcept
+{
+   size_t rows( 1UL );
+   for( size_t d=1UL; d<D; ++d ) {
+      rows *= dims[d];
+   }
+
+   return mappedDataOffset( D ) + rows * mappedSpacing<Type>( dims[0] ) * sizeof( Type );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Writes the header of a mapped file.
+// \ingroup util
+//
+// \param file The writable mapping of the file.
+// \param dims The extents, starting with the innermost dimension.
+// \param D The number of dimensions.
+// \return Pointer to the first element of the file.
+*/
+template< typename Type >  // Data type of the elements
+inline Type* writeMappedHeader( const MappedFile& file, const size_t* dims, size_t D )
+{
+   char* const base( file.data() );
+
+   const uint8_t  meta[4] = { 1U, uint8_t( TypeValueMapping<Type>::value ),
+                              uint8_t( sizeof( Type ) ), uint8_t( D ) };
+   const uint64_t spacing( mappedSpacing<Type>( dims[0] ) );
+   const uint64_t offset ( mappedDataOffset( D ) );
+
+   std::memcpy( base, "BLZTENSR", 8UL );
+   std::memcpy( base +  8UL, meta, 4UL );
+   std::memset( base + 12UL, 0, 4UL );
+   std::memcpy( base + 16UL, &spacing, sizeof( uint64_t ) );
+   std::memcpy( base + 24UL, &offset , sizeof( uint64_t ) );
+
+   for( size_t d=0UL; d<D; ++d ) {
+      const uint64_t extent( dims[d] );
+      std::memcpy( base + MappedFormat::headerSize + d*sizeof( uint64_t ), &extent, sizeof( uint64_t ) );
+   }
+
+   return reinterpret_cast<Type*>( base + offset );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Validates the header of a mapped file.
+// \ingroup util
+//
+// \param base The first byte of the file.
+// \param size The number of bytes available at \a base.
+// \param fileSize The total size of the file in bytes.
+// \param dims The extents, starting with the innermost dimension (output).
+// \param D The expected number of dimensions.
+// \param spacing The spacing between two rows (output).
+// \return The byte offset of the first element.
+// \exception std::invalid_argument Invalid mapped file.
+//
+// Only the header has to be available at \a base, which allows to validate files that are read
+// rather than mapped.
+*/
+template< typename Type >  // Data type of the elements
+inline size_t parseMappedHeader( const char* base, size_t size, size_t fileSize,
+                                 size_t* dims, size_t D, size_t& spacing )
+{
+   if( size < MappedFormat::headerSize + D * sizeof( uint64_t ) ||
+       std::memcmp( base, "BLZTENSR", 8UL ) != 0 ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid mapped file" );
+   }
+
+   uint8_t  meta[4];
+   uint64_t stored, offset;
+
+   std::memcpy( meta, base + 8UL, 4UL );
+   std::memcpy( &stored, base + 16UL, sizeof( uint64_t ) );
+   std::memcpy( &offset, base + 24UL, sizeof( uint64_t ) );
+
+   if( meta[0] != 1U ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid version of mapped file" );
+   }
+   else if( meta[1] != TypeValueMapping<Type>::value || meta[2] != sizeof( Type ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid element type of mapped file" );
+   }
+   else if( meta[3] != D ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid number of dimensions of mapped file" );
+   }
+   else if( offset < mappedDataOffset( D ) || offset % MappedFormat::dataAlignment != 0UL ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid data offset of mapped file" );
+   }
+
+   constexpr size_t limit( std::numeric_limits<size_t>::max() );
+
+   size_t rows( 1UL );
+   for( size_t d=0UL; d<D; ++d ) {
+      uint64_t extent;
+      std::memcpy( &extent, base + MappedFormat::headerSize + d*sizeof( uint64_t ), sizeof( uint64_t ) );
+      dims[d] = extent;
+      if( d > 0UL ) {
+         if( extent != 0UL && rows > limit / extent ) {
+            BLAZE_THROW_INVALID_ARGUMENT( "Invalid extents of mapped file" );
+         }
+         rows *= extent;
+      }
+   }
+
+   if( stored < dims[0] || stored != mappedSpacing<Type>( stored ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid row padding of mapped file" );
+   }
+   else if( stored != 0UL && rows > limit / sizeof( Type ) / stored ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid extents of mapped file" );
+   }
+   else if( offset > fileSize || rows * stored * sizeof( Type ) > fileSize - offset ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Truncated mapped file" );
+   }
+
+   spacing = stored;
+
+   return offset;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Reads and validates the header of a mapped file.
+// \ingroup util
+//
+// \param file The mapping of the file.
+// \param dims The extents, starting with the innermost dimension (output).
+// \param D The expected number of dimensions.
+// \param spacing The spacing between two rows (output).
+// \return Pointer to the first element of the file.
+// \exception std::invalid_argument Invalid mapped file.
+*/
+template< typename Type >  // Data type of the elements
+inline Type* readMappedHeader( const MappedFile& file, size_t* dims, size_t D, size_t& spacing )
+{
+   const size_t offset( parseMappedHeader<Type>( file.data(), file.size(), file.size(), dims, D, spacing ) );
+
+   return reinterpret_cast<Type*>( file.data() + offset );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,471 @@
+//=================================================================================================
+/*!
+//  \file blaze_tensor/math/dense/MappedTensor.h
+//  \brief Header file for the implementation of a memory mapped tensor
+//
+//  Copyright (C) 2012-2018 Klaus Iglberger - All Rights Reserved
+//  Copyright (C) 2018 Hartmut Kaiser - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+
+#ifndef _BLAZE_TENSOR_MATH_DENSE_MAPPEDTENSOR_H_
+#define _BLAZE_TENSOR_MATH_DENSE_MAPPEDTENSOR_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <string>
+
+#include <blaze/math/AlignmentFlag.h>
+#include <blaze/math/PaddingFlag.h>
+#include <blaze/util/FunctionTrace.h>
+#include <blaze/util/StaticAssert.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsNumeric.h>
+
+#include <blaze_tensor/math/dense/CustomTensor.h>
+#include <blaze_tensor/math/dense/MappedFormat.h>
+#include <blaze_tensor/math/expressions/DenseTensor.h>
+#include <blaze_tensor/math/ZeroPadded.h>
+#include <blaze_tensor/util/MappedFile.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\defgroup mapped_tensor MappedTensor
+// \ingroup dense_tensor
+*/
+/*!\brief Dense tensor backed by a memory mapped file.
+// \ingroup mapped_tensor
+//
+// The MappedTensor class template maps a tensor file into memory and exposes its content as an
+// aligned and padded CustomTensor without reading the file. Pages of the file are only loaded
+// by the operating system when they are accessed, which makes opening even very large tensors
+// a constant time operation. Since the rows in the file are already aligned and padded, all
+// vectorized kernels operate directly on the mapped memory:
+
+   \code
+   // Writing a tensor file
+   blaze::DynamicTensor<float> A( 1000UL, 512UL, 512UL );
+   // ... Initialization
+   blaze::writeMapped( "data.tensor", A );
+
+   // Mapping the file for reading
+   blaze::MappedTensor<float> mapped( "data.tensor" );
+   mapped.advise( blaze::MapAdvice::sequential );
+
+   const float total = sum( mapped.tensor() );
+   \endcode
+
+// The file can be mapped in one of three modes (see \a MapMode):
+//
+//  - \a readOnly: the tensor must not be modified; writing to it results in undefined behavior
+//    (typically a segmentation fault).
+//  - \a copyOnWrite: the tensor may be modified, modifications are private to the process and
+//    are never written back to the file.
+//  - \a readWrite: the tensor may be modified, modifications are written back to the file.
+//
+// A new tensor file is created by the constructor taking the path and the size of the tensor.
+// All elements of a new tensor file are zero. The format of the file is described by the
+// MappedFormat class.
+//
+// \note The MappedTensor class template requires a POSIX system.
+*/
+template< typename Type >  // Data type of the tensor
+class MappedTensor
+{
+ public:
+   //**Type definitions****************************************************************************
+   using ElementType = Type;                               //!< Type of the tensor elements.
+   using TensorType  = CustomTensor<Type,aligned,padded>;  //!< Type of the mapped tensor.
+   //**********************************************************************************************
+
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit inline MappedTensor( const std::string& path, MapMode mode = MapMode::readOnly );
+   explicit inline MappedTensor( const std::string& path, size_t o, size_t m, size_t n );
+
+   MappedTensor( const MappedTensor& ) = delete;
+   MappedTensor( MappedTensor&& ) = default;
+   //@}
+   //**********************************************************************************************
+
+   //**Assignment operators************************************************************************
+   /*!\name Assignment operators */
+   //@{
+   MappedTensor& operator=( const MappedTensor& ) = delete;
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline TensorType&       tensor() noexcept;
+   inline const TensorType& tensor() const noexcept;
+   inline size_t            pages() const noexcept;
+   inline size_t            rows() const noexcept;
+   inline size_t            columns() const noexcept;
+   inline size_t            spacing() const noexcept;
+   inline MapMode           mode() const noexcept;
+   inline void              advise( MapAdvice advice ) const;
+   inline void              advise( MapAdvice advice, size_t k, size_t pages ) const;
+   inline void              flush( bool async = false ) const;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   static inline TensorType openTensor( const MappedFile& file );
+   static inline TensorType createTensor( const MappedFile& file, size_t o, size_t m, size_t n );
+   static inline size_t     fileSize( size_t o, size_t m, size_t n ) noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   MappedFile file_;    //!< The memory mapped file.
+   TensorType tensor_;  //!< The tensor referring to the mapped memory.
+   //@}
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_STATIC_ASSERT_MSG( IsNumeric_v<Type>, "Mapped tensors require numeric element types" );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Maps an existing tensor file.
+//
+// \param path The path of the tensor file.
+// \param mode The access mode of the mapping.
+// \exception std::runtime_error File could not be mapped.
+// \exception std::invalid_argument Invalid tensor file.
+//
+// This constructor maps the given tensor file. The construction fails if the file cannot be
+// mapped, if it is not a tensor file, or if its element type does not match \a Type.
+*/
+template< typename Type >  // Data type of the tensor
+inline MappedTensor<Type>::MappedTensor( const std::string& path, MapMode mode )
+   : file_  ( path, mode )           // The memory mapped file
+   , tensor_( openTensor( file_ ) )  // The tensor referring to the mapped memory
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Creates a new tensor file of size \f$ o \times m \times n \f$.
+//
+// \param path The path of the tensor file.
+// \param o The number of pages of the tensor.
+// \param m The number of rows of the tensor.
+// \param n The number of columns of the tensor.
+// \exception std::runtime_error File could not be created.
+//
+// This constructor creates a new tensor file (an existing file is replaced) and maps it in
+// \a readWrite mode. All elements of the new tensor are zero.
+*/
+template< typename Type >  // Data type of the tensor
+inline MappedTensor<Type>::MappedTensor( const std::string& path, size_t o, size_t m, size_t n )
+   : file_  ( path, fileSize( o, m, n ) )      // The memory mapped file
+   , tensor_( createTensor( file_, o, m, n ) )  // The tensor referring to the mapped memory
+{}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the tensor referring to the mapped memory.
+//
+// \return Reference to the mapped tensor.
+*/
+template< typename Type >  // Data type of the tensor
+inline typename MappedTensor<Type>::TensorType& MappedTensor<Type>::tensor() noexcept
+{
+   return tensor_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the tensor referring to the mapped memory.
+//
+// \return Reference to the mapped tensor.
+*/
+template< typename Type >  // Data type of the tensor
+inline const typename MappedTensor<Type>::TensorType& MappedTensor<Type>::tensor() const noexcept
+{
+   return tensor_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the current number of pages of the tensor.
+//
+// \return The number of pages of the tensor.
+*/
+template< typename Type >  // Data type of the tensor
+inline size_t MappedTensor<Type>::pages() const noexcept
+{
+   return tensor_.pages();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the current number of rows of the tensor.
+//
+// \return The number of rows of the tensor.
+*/
+template< typename Type >  // Data type of the tensor
+inline size_t MappedTensor<Type>::rows() const noexcept
+{
+   return tensor_.rows();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the current number of columns of the tensor.
+//
+// \return The number of columns of the tensor.
+*/
+template< typename Type >  // Data type of the tensor
+inline size_t MappedTensor<Type>::columns() const noexcept
+{
+   return tensor_.columns();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the spacing between the beginning of two rows.
+//
+// \return The spacing between the beginning of two rows.
+*/
+template< typename Type >  // Data type of the tensor
+inline size_t MappedTensor<Type>::spacing() const noexcept
+{
+   return tensor_.spacing();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the access mode of the mapping.
+//
+// \return The access mode of the mapping.
+*/
+template< typename Type >  // Data type of the tensor
+inline MapMode MappedTensor<Type>::mode() const noexcept
+{
+   return file_.mode();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Passes an access pattern hint for the complete tensor to the operating system.
+//
+// \param advice The access pattern hint.
+// \return void
+//
+// For instance, \a MapAdvice::sequential enables aggressive read-ahead for page scans over the
+// complete tensor.
+*/
+template< typename Type >  // Data type of the tensor
+inline void MappedTensor<Type>::advise( MapAdvice advice ) const
+{
+   file_.advise( advice );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Passes an access pattern hint for a range of pages to the operating system.
+//
+// \param advice The access pattern hint.
+// \param k The index of the first page the hint applies to.
+// \param pages The number of pages the hint applies to.
+// \return void
+//
+// This function can for instance be used to prefetch the next pages of a page scan with
+// \a MapAdvice::willNeed, or to release already processed pages with \a MapAdvice::dontNeed.
+*/
+template< typename Type >  // Data type of the tensor
+inline void MappedTensor<Type>::advise( MapAdvice advice, size_t k, size_t pages ) const
+{
+   const size_t bytes( tensor_.rows() * tensor_.spacing() * sizeof( Type ) );
+
+   file_.advise( advice, mappedDataOffset( 3UL ) + k * bytes, pages * bytes );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Writes all modifications of a \a readWrite mapping back to the file.
+//
+// \param async \a true to only schedule the write-back, \a false to wait for its completion.
+// \return void
+// \exception std::runtime_error Mapping could not be flushed.
+*/
+template< typename Type >  // Data type of the tensor
+inline void MappedTensor<Type>::flush( bool async ) const
+{
+   file_.flush( async );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Creates the tensor referring to an existing tensor file.
+//
+// \param file The mapping of the tensor file.
+// \return The tensor referring to the mapped memory.
+// \exception std::invalid_argument Invalid tensor file.
+*/
+template< typename Type >  // Data type of the tensor
+inline typename MappedTensor<Type>::TensorType
+   MappedTensor<Type>::openTensor( const MappedFile& file )
+{
+   size_t dims[3];
+   size_t spacing;
+
+   Type* const ptr( readMappedHeader<Type>( file, dims, 3UL, spacing ) );
+
+   return TensorType( zero_padded, ptr, dims[2], dims[1], dims[0], spacing );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Creates the tensor referring to a new tensor file.
+//
+// \param file The writable mapping of the tensor file.
+// \param o The number of pages of the tensor.
+// \param m The number of rows of the tensor.
+// \param n The number of columns of the tensor.
+// \return The tensor referring to the mapped memory.
+*/
+template< typename Type >  // Data type of the tensor
+inline typename MappedTensor<Type>::TensorType
+   MappedTensor<Type>::createTensor( const MappedFile& file, size_t o, size_t m, size_t n )
+{
+   const size_t dims[3] = { n, m, o };
+
+   Type* const ptr( writeMappedHeader<Type>( file, dims, 3UL ) );
+
+   return TensorType( zero_padded, ptr, o, m, n, mappedSpacing<Type>( n ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the size of a tensor file of size \f$ o \times m \times n \f$.
+//
+// \param o The number of pages of the tensor.
+// \param m The number of rows of the tensor.
+// \param n The number of columns of the tensor.
+// \return The size of the tensor file in bytes.
+*/
+template< typename Type >  // Data type of the tensor
+inline size_t MappedTensor<Type>::fileSize( size_t o, size_t m, size_t n ) noexcept
+{
+   const size_t dims[3] = { n, m, o };
+
+   return mappedFileSize<Type>( dims, 3UL );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Writes the given dense tensor into a new tensor file.
+// \ingroup mapped_tensor
+//
+// \param path The path of the tensor file.
+// \param tens The tensor to be written.
+// \return void
+// \exception std::runtime_error File could not be written.
+//
+// This function creates a new tensor file (an existing file is replaced) that can be mapped by
+// means of a MappedTensor.
+*/
+template< typename TT >  // Type of the tensor
+void writeMapped( const std::string& path, const DenseTensor<TT>& tens )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   MappedTensor< ElementType_t<TT> > mapped( path, (*tens).pages(), (*tens).rows(), (*tens).columns() );
+
+   mapped.tensor() = *tens;
+   mapped.flush();
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,1728 @@
+//=================================================================================================
+/*!
+//  \file blaze_tensor/math/dense/Normalization.h
+//  \brief Header file for the fused axis-wise normalization functions of dense tensors and arrays
+//
+//  Copyright (C) 2012-2018 Klaus Iglberger - All Rights Reserved
+//  Copyright (C) 2018 Hartmut Kaiser - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+
+#ifndef _BLAZE_TENSOR_MATH_DENSE_NORMALIZATION_H_
+#define _BLAZE_TENSOR_MATH_DENSE_NORMALIZATION_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <array>
+#include <cmath>
+#include <vector>
+
+#include <blaze/math/Aliases.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/ReductionFlag.h>
+#include <blaze/math/SIMD.h>
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/smp/SerialSection.h>
+#include <blaze/math/typetraits/HasSIMDAdd.h>
+#include <blaze/math/typetraits/HasSIMDMult.h>
+#include <blaze/math/typetraits/HasSIMDSub.h>
+#include <blaze/math/typetraits/IsVectorizable.h>
+#include <blaze/util/AlignedArray.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/FunctionTrace.h>
+#include <blaze/util/StaticAssert.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/constraints/FloatingPoint.h>
+
+#include <blaze_tensor/math/ReductionFlag.h>
+#include <blaze_tensor/math/expressions/DenseArray.h>
+#include <blaze_tensor/math/expressions/DenseTensor.h>
+#include <blaze_tensor/math/smp/ParallelFor.h>
+#include <blaze_tensor/system/Thresholds.h>
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  NORMALIZATION KERNELS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Auxiliary helper struct for the selection of the vectorized normalization kernels.
+// \ingroup dense_tensor
+*/
+template< typename ET >  // Element type of the normalized tensor or array
+struct NormHelper
+{
+   //**********************************************************************************************
+   static constexpr bool value =
+      ( IsVectorizable_v<ET> && HasSIMDAdd_v<ET,ET> && HasSIMDSub_v<ET,ET> && HasSIMDMult_v<ET,ET> );
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Merges two sets of Welford statistics (count, mean and sum of squared deviations).
+// \ingroup dense_tensor
+//
+// \param count The number of samples of the first set (updated).
+// \param mean The mean of the first set (updated).
+// \param m2 The sum of squared deviations of the first set (updated).
+// \param count2 The number of samples of the second set.
+// \param mean2 The mean of the second set.
+// \param m22 The sum of squared deviations of the second set.
+// \return void
+*/
+template< typename ET >  // Element type of the statistics
+inline void welfordMerge( size_t& count, ET& mean, ET& m2, size_t count2, ET mean2, ET m22 )
+{
+   if( count2 == 0UL )
+      return;
+
+   const size_t total( count + count2 );
+   const ET delta( mean2 - mean );
+
+   mean += delta * ET( count2 ) / ET( total );
+   m2   += m22 + delta * delta * ET( count ) * ET( count2 ) / ET( total );
+   count = total;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Computes the mean and the (biased) variance of all elements of a group of rows.
+// \ingroup dense_tensor
+//
+// \param rows Callable returning a pointer to the first element of row \a t of the group.
+// \param length The number of rows of the group.
+// \param n The number of elements per row.
+// \param rms \a true in case the mean square is computed instead of mean and variance.
+// \param mean The resulting mean (zero in case of \a rms).
+// \param var The resulting variance (or mean square in case of \a rms).
+// \return void
+*/
+template< typename ET      // Element type of the rows
+        , typename Rows >  // Type of the row access
+inline auto normRowStats( const Rows& rows, size_t length, size_t n, bool rms, ET& mean, ET& var )
+   -> DisableIf_t< NormHelper<ET>::value >
+{
+   const size_t total( length*n );
+
+   size_t count( 0UL );
+   ET mu( 0 ), m2( 0 );
+
+   for( size_t t=0UL; t<length; ++t )
+   {
+      const ET* const x( rows( t ) );
+
+      if( rms ) {
+         for( size_t j=0UL; j<n; ++j ) {
+            m2 += x[j] * x[j];
+         }
+      }
+      else {
+         for( size_t j=0UL; j<n; ++j ) {
+            const ET delta( x[j] - mu );
+            mu += delta / ET( ++count );
+            m2 += delta * ( x[j] - mu );
+         }
+      }
+   }
+
+   mean = ( rms ? ET( 0 ) : mu );
+   var  = ( total != 0UL ? m2 / ET( total ) : ET( 0 ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief SIMD optimized computation of the mean and the (biased) variance of all elements of a
+//        group of rows.
+// \ingroup dense_tensor
+//
+// \param rows Callable returning a pointer to the first element of row \a t of the group.
+// \param length The number of rows of the group.
+// \param n The number of elements per row.
+// \param rms \a true in case the mean square is computed instead of mean and variance.
+// \param mean The resulting mean (zero in case of \a rms).
+// \param var The resulting variance (or mean square in case of \a rms).
+// \return void
+//
+// Every SIMD lane accumulates its own Welford statistics in a single pass over the rows. The
+// statistics of the lanes and of the scalar remainder are merged at the end.
+*/
+template< typename ET      // Element type of the rows
+        , typename Rows >  // Type of the row access
+inline auto normRowStats( const Rows& rows, size_t length, size_t n, bool rms, ET& mean, ET& var )
+   -> EnableIf_t< NormHelper<ET>::value >
+{
+   using SIMDType = SIMDTrait_t<ET>;
+
+   constexpr size_t SIMDSIZE( SIMDTrait<ET>::size );
+
+   const size_t jpos( n & size_t(-SIMDSIZE) );
+   BLAZE_INTERNAL_ASSERT( ( n - ( n % SIMDSIZE ) ) == jpos, "Invalid end calculation" );
+
+   const size_t total( length*n );
+
+   SIMDType xmean, xm2;
+   AlignedArray<ET,SIMDSIZE> lmean, lm2;
+
+   size_t count( 0UL ), vcount( 0UL );
+   ET mu( 0 ), m2( 0 );
+
+   if( rms )
+   {
+      for( size_t t=0UL; t<length; ++t )
+      {
+         const ET* const x( rows( t ) );
+
+         size_t j( 0UL );
+
+         for( ; j<jpos; j+=SIMDSIZE ) {
+            const SIMDType xmm( loadu( x+j ) );
+            xm2 += xmm * xmm;
+         }
+         for( ; j<n; ++j ) {
+            m2 += x[j] * x[j];
+         }
+      }
+
+      storea( lm2.data(), xm2 );
+
+      for( size_t l=0UL; l<SIMDSIZE; ++l ) {
+         m2 += lm2[l];
+      }
+
+      mean = ET( 0 );
+      var  = ( total != 0UL ? m2 / ET( total ) : ET( 0 ) );
+      return;
+   }
+
+   for( size_t t=0UL; t<length; ++t )
+   {
+      const ET* const x( rows( t ) );
+
+      size_t j( 0UL );
+
+      for( ; j<jpos; j+=SIMDSIZE ) {
+         const SIMDType xmm( loadu( x+j ) );
+         const SIMDType delta( xmm - xmean );
+         xmean += delta * set( ET( 1 ) / ET( ++vcount ) );
+         xm2   += delta * ( xmm - xmean );
+      }
+      for( ; j<n; ++j ) {
+         const ET delta( x[j] - mu );
+         mu += delta / ET( ++count );
+         m2 += delta * ( x[j] - mu );
+      }
+   }
+
+   storea( lmean.data(), xmean );
+   storea( lm2.data(), xm2 );
+
+   for( size_t l=0UL; l<SIMDSIZE; ++l ) {
+      welfordMerge( count, mu, m2, vcount, lmean[l], lm2[l] );
+   }
+
+   mean = mu;
+   var  = ( total != 0UL ? m2 / ET( total ) : ET( 0 ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Computes the element-wise mean and (biased) variance of a group of rows.
+// \ingroup dense_tensor
+//
+// \param rows Callable returning a pointer to the first element of row \a t of the group.
+// \param length The number of rows of the group.
+// \param n The number of elements per row.
+// \param rms \a true in case the mean square is computed instead of mean and variance.
+// \param mean Pointer to the \a n resulting means (zero in case of \a rms).
+// \param var Pointer to the \a n resulting variances (or mean squares in case of \a rms).
+// \return void
+*/
+template< typename ET      // Element type of the rows
+        , typename Rows >  // Type of the row access
+inline auto normColumnStats( const Rows& rows, size_t length, size_t n, bool rms, ET* mean, ET* var )
+   -> DisableIf_t< NormHelper<ET>::value >
+{
+   for( size_t j=0UL; j<n; ++j ) {
+      mean[j] = ET( 0 );
+      var[j]  = ET( 0 );
+   }
+
+   for( size_t t=0UL; t<length; ++t )
+   {
+      const ET* const x( rows( t ) );
+      const ET inv( ET( 1 ) / ET( t+1UL ) );
+
+      for( size_t j=0UL; j<n; ++j )
+      {
+         if( rms ) {
+            var[j] += x[j] * x[j];
+         }
+         else {
+            const ET delta( x[j] - mean[j] );
+            mean[j] += delta * inv;
+            var[j]  += delta * ( x[j] - mean[j] );
+         }
+      }
+   }
+
+   for( size_t j=0UL; j<n; ++j ) {
+      var[j] = ( length != 0UL ? var[j] / ET( length ) : ET( 0 ) );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief SIMD optimized computation of the element-wise mean and (biased) variance of a group
+//        of rows.
+// \ingroup dense_tensor
+//
+// \param rows Callable returning a pointer to the first element of row \a t of the group.
+// \param length The number of rows of the group.
+// \param n The number of elements per row.
+// \param rms \a true in case the mean square is computed instead of mean and variance.
+// \param mean Pointer to the \a n resulting means (zero in case of \a rms).
+// \param var Pointer to the \a n resulting variances (or mean squares in case of \a rms).
+// \return void
+//
+// The Welford statistics of all elements of a row are updated at once in a single pass over
+// the rows of the group.
+*/
+template< typename ET      // Element type of the rows
+        , typename Rows >  // Type of the row access
+inline auto normColumnStats( const Rows& rows, size_t length, size_t n, bool rms, ET* mean, ET* var )
+   -> EnableIf_t< NormHelper<ET>::value >
+{
+   using SIMDType = SIMDTrait_t<ET>;
+
+   constexpr size_t SIMDSIZE( SIMDTrait<ET>::size );
+
+   const size_t jpos( n & size_t(-SIMDSIZE) );
+   BLAZE_INTERNAL_ASSERT( ( n - ( n % SIMDSIZE ) ) == jpos, "Invalid end calculation" );
+
+   for( size_t j=0UL; j<n; ++j ) {
+      mean[j] = ET( 0 );
+      var[j]  = ET( 0 );
+   }
+
+   for( size_t t=0UL; t<length; ++t )
+   {
+      const ET* const x( rows( t ) );
+
+      size_t j( 0UL );
+
+      if( rms )
+      {
+         for( ; j<jpos; j+=SIMDSIZE ) {
+            const SIMDType xmm( loadu( x+j ) );
+            SIMDType xm2( loadu( var+j ) );
+            xm2 += xmm * xmm;
+            storeu( var+j, xm2 );
+         }
+         for( ; j<n; ++j ) {
+            var[j] += x[j] * x[j];
+         }
+      }
+      else
+      {
+         const ET inv( ET( 1 ) / ET( t+1UL ) );
+         const SIMDType xinv( set( inv ) );
+
+         for( ; j<jpos; j+=SIMDSIZE ) {
+            const SIMDType xmm( loadu( x+j ) );
+            SIMDType xmean( loadu( mean+j ) );
+            SIMDType xm2( loadu( var+j ) );
+            const SIMDType delta( xmm - xmean );
+            xmean += delta * xinv;
+            xm2   += delta * ( xmm - xmean );
+            storeu( mean+j, xmean );
+            storeu( var+j, xm2 );
+         }
+         for( ; j<n; ++j ) {
+            const ET delta( x[j] - mean[j] );
+            mean[j] += delta * inv;
+            var[j]  += delta * ( x[j] - mean[j] );
+         }
+      }
+   }
+
+   for( size_t j=0UL; j<n; ++j ) {
+      var[j] = ( length != 0UL ? var[j] / ET( length ) : ET( 0 ) );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Normalization coefficient that is uniform across a row.
+// \ingroup dense_tensor
+*/
+template< typename ET >  // Element type of the coefficient
+struct NormScalar
+{
+   //**********************************************************************************************
+   inline ET operator[]( size_t ) const noexcept { return value; }
+   BLAZE_ALWAYS_INLINE decltype(auto) load( size_t ) const noexcept { return set( value ); }
+   //**********************************************************************************************
+
+   ET value;  //!< The value of the coefficient.
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Normalization coefficient that varies along a row.
+// \ingroup dense_tensor
+*/
+template< typename ET >  // Element type of the coefficient
+struct NormVector
+{
+   //**********************************************************************************************
+   inline ET operator[]( size_t j ) const noexcept { return ptr[j]; }
+   BLAZE_ALWAYS_INLINE decltype(auto) load( size_t j ) const noexcept { return loadu( ptr+j ); }
+   //**********************************************************************************************
+
+   const ET* ptr;  //!< Pointer to the first coefficient of the row.
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief In-place normalization of a single row (\f$ y_j = ( y_j - mu_j ) r_j g_j + h_j \f$).
+// \ingroup dense_tensor
+//
+// \param y Pointer to the first element of the row.
+// \param n The number of elements of the row.
+// \param mu The mean.
+// \param r The reciprocal standard deviation.
+// \param g The scale.
+// \param h The shift.
+// \return void
+*/
+template< typename ET    // Element type of the row
+        , typename MU    // Type of the mean coefficient
+        , typename R     // Type of the reciprocal standard deviation coefficient
+        , typename G     // Type of the scale coefficient
+        , typename H >   // Type of the shift coefficient
+inline auto normApply( ET* y, size_t n, const MU& mu, const R& r, const G& g, const H& h )
+   -> DisableIf_t< NormHelper<ET>::value >
+{
+   for( size_t j=0UL; j<n; ++j ) {
+      y[j] = ( y[j] - mu[j] ) * r[j] * g[j] + h[j];
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief SIMD optimized in-place normalization of a single row
+//        (\f$ y_j = ( y_j - mu_j ) r_j g_j + h_j \f$).
+// \ingroup dense_tensor
+//
+// \param y Pointer to the first element of the row.
+// \param n The number of elements of the row.
+// \param mu The mean.
+// \param r The reciprocal standard deviation.
+// \param g The scale.
+// \param h The shift.
+// \return void
+*/
+template< typename ET    // Element type of the row
+        , typename MU    // Type of the mean coefficient
+        , typename R     // Type of the reciprocal standard deviation coefficient
+        , typename G     // Type of the scale coefficient
+        , typename H >   // Type of the shift coefficient
+inline auto normApply( ET* y, size_t n, const MU& mu, const R& r, const G& g, const H& h )
+   -> EnableIf_t< NormHelper<ET>::value >
+{
+   using SIMDType = SIMDTrait_t<ET>;
+
+   constexpr size_t SIMDSIZE( SIMDTrait<ET>::size );
+
+   const size_t jpos( n & size_t(-SIMDSIZE) );
+   BLAZE_INTERNAL_ASSERT( ( n - ( n % SIMDSIZE ) ) == jpos, "Invalid end calculation" );
+
+   size_t j( 0UL );
+
+   for( ; j<jpos; j+=SIMDSIZE ) {
+      SIMDType xmm( loadu( y+j ) );
+      xmm -= mu.load( j );
+      xmm *= r.load( j );
+      xmm *= g.load( j );
+      xmm += h.load( j );
+      storeu( y+j, xmm );
+   }
+   for( ; j<n; ++j ) {
+      y[j] = ( y[j] - mu[j] ) * r[j] * g[j] + h[j];
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  NORMALIZATION BACKEND
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Description of the row groups of a normalization.
+// \ingroup dense_tensor
+//
+// A tensor or array is treated as a sequence of contiguous rows (of \a n elements each). The
+// statistics of a normalization are computed over groups of \a length rows each. In case
+// \a perColumn is \a true, every group yields one statistic per column, otherwise a single
+// statistic per group is computed over all elements of its rows.
+*/
+struct NormLayout
+{
+   //**********************************************************************************************
+   /*!\brief Returns the index of row \a t of group \a g.
+   */
+   inline size_t row( size_t g, size_t t ) const noexcept {
+      const size_t a( swapped ? t : g );
+      const size_t b( swapped ? g : t );
+      return ( a / inner * extent + b ) * inner + a % inner;
+   }
+   //**********************************************************************************************
+
+   size_t groups;     //!< The number of groups.
+   size_t length;     //!< The number of rows per group.
+   size_t inner;      //!< The number of rows between consecutive indices of the normalized axis.
+   size_t extent;     //!< The extent of the normalized axis (in rows).
+   bool   perColumn;  //!< \a true in case every column of a group has its own statistic.
+   bool   swapped;    //!< \a true in case the groups run along the normalized axis.
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Computes the row groups of a normalization along the given dimension.
+// \ingroup dense_tensor
+//
+// \param dims The dimensions of the tensor or array (innermost first).
+// \param N The number of dimensions.
+// \param R The normalized dimension (0 denotes the innermost dimension).
+// \param batch \a true in case of a batch normalization, \a false for a layer normalization.
+// \return The row groups of the normalization.
+//
+// A layer normalization computes the statistics along dimension \a R separately for all
+// indices of the remaining dimensions. A batch normalization computes one statistic per index
+// of dimension \a R (the channel) over all remaining dimensions.
+*/
+inline NormLayout normLayout( const size_t* dims, size_t N, size_t R, bool batch ) noexcept
+{
+   size_t rows( 1UL );
+   for( size_t d=1UL; d<N; ++d ) {
+      rows *= dims[d];
+   }
+
+   if( R == 0UL ) {
+      return batch ? NormLayout{ 1UL, rows, 1UL, 1UL, true, true }
+                   : NormLayout{ rows, 1UL, 1UL, 1UL, false, false };
+   }
+
+   size_t inner( 1UL );
+   for( size_t d=1UL; d<R; ++d ) {
+      inner *= dims[d];
+   }
+
+   const size_t extent( dims[R] );
+   const size_t others( extent != 0UL ? rows / extent : 0UL );
+
+   return batch ? NormLayout{ extent, others, inner, extent, false, true }
+                : NormLayout{ others, extent, inner, extent, true, false };
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Executes the given loop body either in parallel or serially.
+// \ingroup dense_tensor
+//
+// \param units The number of independent units of work.
+// \param parallel \a true in case the units should be distributed over the threads.
+// \param f The loop body.
+// \return void
+*/
+template< typename F >  // Type of the loop body
+inline void normFor( size_t units, bool parallel, F&& f )
+{
+   if( parallel ) smpFor( 0UL, units, f );
+   else serialFor( 0UL, units, f );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend implementation of the fused normalizations.
+// \ingroup dense_tensor
+//
+// \param rowOf Callable returning a pointer to the first element of the given row.
+// \param layout The row groups of the normalization.
+// \param n The number of elements per row.
+// \param batch \a true in case the scale and shift are given per statistic (batch normalization).
+// \param rms \a true in case of an RMS normalization.
+// \param gamma Pointer to the scale coefficients (\c nullptr in case of no scaling).
+// \param beta Pointer to the shift coefficients (\c nullptr in case of no shift).
+// \param eps The value added to the variance for numerical stability.
+// \param mean Pointer to the resulting means (one per statistic).
+// \param rstd Pointer to the resulting reciprocal standard deviations (one per statistic).
+// \return void
+//
+// The normalization is performed in place in two passes. The first pass computes the Welford
+// mean and variance of all groups in parallel, the second pass normalizes, scales and shifts
+// all rows in parallel.
+*/
+template< typename ET       // Element type of the rows
+        , typename RowOf >  // Type of the row access
+void normalizeRows( const RowOf& rowOf, const NormLayout& layout, size_t n, bool batch,
+                    bool rms, const ET* gamma, const ET* beta, ET eps, ET* mean, ET* rstd )
+{
+   using std::sqrt;
+
+   const size_t rows( layout.groups * layout.length );
+   const bool parallel( !isSerialSectionActive() && rows*n >= smpDTensAssignThreshold() );
+
+   normFor( layout.groups, parallel, [&]( size_t g )
+   {
+      auto group = [&]( size_t t ) -> const ET* { return rowOf( layout.row( g, t ) ); };
+
+      if( layout.perColumn ) {
+         normColumnStats( group, layout.length, n, rms, mean+g*n, rstd+g*n );
+         for( size_t j=g*n; j<(g+1UL)*n; ++j ) {
+            rstd[j] = ET( 1 ) / sqrt( rstd[j] + eps );
+         }
+      }
+      else {
+         normRowStats( group, layout.length, n, rms, mean[g], rstd[g] );
+         rstd[g] = ET( 1 ) / sqrt( rstd[g] + eps );
+      }
+   } );
+
+   const size_t affine( batch ? layout.groups * ( layout.perColumn ? n : 1UL )
+                              : ( layout.perColumn ? layout.length : n ) );
+
+   std::vector<ET> ones, zeros;
+   if( gamma == nullptr ) {
+      ones.assign( affine, ET( 1 ) );
+      gamma = ones.data();
+   }
+   if( beta == nullptr ) {
+      zeros.assign( affine, ET( 0 ) );
+      beta = zeros.data();
+   }
+
+   normFor( rows, parallel, [&]( size_t gt )
+   {
+      const size_t g( gt / layout.length );
+      const size_t t( gt % layout.length );
+
+      ET* const y( rowOf( layout.row( g, t ) ) );
+
+      if( layout.perColumn ) {
+         const NormVector<ET> mu{ mean+g*n }, r{ rstd+g*n };
+         if( batch ) normApply( y, n, mu, r, NormVector<ET>{ gamma+g*n }, NormVector<ET>{ beta+g*n } );
+         else normApply( y, n, mu, r, NormScalar<ET>{ gamma[t] }, NormScalar<ET>{ beta[t] } );
+      }
+      else {
+         const NormScalar<ET> mu{ mean[g] }, r{ rstd[g] };
+         if( batch ) normApply( y, n, mu, r, NormScalar<ET>{ gamma[g] }, NormScalar<ET>{ beta[g] } );
+         else normApply( y, n, mu, r, NormVector<ET>{ gamma }, NormVector<ET>{ beta } );
+      }
+   } );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Converts the given optional scale or shift vector into a contiguous vector.
+// \ingroup dense_tensor
+//
+// \param vec The scale or shift vector.
+// \param size The required size of the vector.
+// \return The contiguous copy of the vector.
+// \exception std::invalid_argument Invalid size of scale or shift vector.
+*/
+template< typename ET    // Element type of the normalized tensor or array
+        , typename VT    // Type of the scale or shift vector
+        , bool TF >      // Transpose flag
+std::vector<ET> normCoefficients( const DenseVector<VT,TF>& vec, size_t size )
+{
+   if( (*vec).size() != size ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid size of scale or shift vector" );
+   }
+
+   std::vector<ET> tmp( size );
+   for( size_t i=0UL; i<size; ++i ) {
+      tmp[i] = (*vec)[i];
+   }
+
+   return tmp;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TENSOR NORMALIZATION OPERATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend implementation of the fused normalizations of dense tensors.
+// \ingroup dense_tensor
+//
+// \param tens The dense tensor to be normalized in place.
+// \param batch \a true in case of a batch normalization.
+// \param rms \a true in case of an RMS normalization.
+// \param gamma Pointer to the scale coefficients (\c nullptr in case of no scaling).
+// \param beta Pointer to the shift coefficients (\c nullptr in case of no shift).
+// \param eps The value added to the variance for numerical stability.
+// \param mean The resulting means.
+// \param rstd The resulting reciprocal standard deviations.
+// \return The number of statistics per row of the tensor of statistics.
+*/
+template< size_t RF     // Reduction flag
+        , typename TT   // Type of the dense tensor
+        , typename ET > // Element type of the dense tensor
+size_t normalize_backend( DenseTensor<TT>& tens, bool batch, bool rms, const ET* gamma,
+                          const ET* beta, ET eps, std::vector<ET>& mean, std::vector<ET>& rstd )
+{
+   constexpr size_t R( RF == rowwise ? 0UL : RF == columnwise ? 1UL : 2UL );
+
+   const size_t m( (*tens).rows() );
+   const size_t n( (*tens).columns() );
+   const std::array<size_t,3UL> dims{ { n, m, (*tens).pages() } };
+
+   const NormLayout layout( normLayout( dims.data(), 3UL, R, batch ) );
+   const size_t stats( layout.groups * ( layout.perColumn ? n : 1UL ) );
+
+   mean.resize( stats );
+   rstd.resize( stats );
+
+   if( m != 0UL ) {
+      TT& t( *tens );
+      normalizeRows( [&t,m]( size_t r ) { return t.data( r % m, r / m ); },
+                     layout, n, batch, rms, gamma, beta, eps, mean.data(), rstd.data() );
+   }
+
+   return layout.perColumn ? n : m;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Copies the statistics of a tensor normalization into the given dense matrix.
+// \ingroup dense_tensor
+//
+// \param stats The statistics.
+// \param columns The number of columns of the resulting matrix.
+// \param dm The resulting dense matrix.
+// \return void
+*/
+template< typename ET    // Element type of the statistics
+        , typename MT    // Type of the dense matrix
+        , bool SO >      // Storage order of the dense matrix
+void normStore( const std::vector<ET>& stats, size_t columns, DenseMatrix<MT,SO>& dm )
+{
+   const size_t rows( columns != 0UL ? stats.size() / columns : 0UL );
+
+   resize( *dm, rows, columns, false );
+
+   for( size_t i=0UL; i<rows; ++i ) {
+      for( size_t j=0UL; j<columns; ++j ) {
+         (*dm)(i,j) = stats[i*columns+j];
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Copies the statistics of a batch normalization into the given dense vector.
+// \ingroup dense_tensor
+//
+// \param stats The statistics.
+// \param dv The resulting dense vector.
+// \return void
+*/
+template< typename ET    // Element type of the statistics
+        , typename VT    // Type of the dense vector
+        , bool TF >      // Transpose flag of the dense vector
+void normStore( const std::vector<ET>& stats, DenseVector<VT,TF>& dv )
+{
+   resize( *dv, stats.size(), false );
+
+   for( size_t i=0UL; i<stats.size(); ++i ) {
+      (*dv)[i] = stats[i];
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Fused layer normalization of the given dense tensor along the given axis.
+// \ingroup dense_tensor
+//
+// \param dm The given dense tensor.
+// \param gamma The scale vector (one element per index of the normalized axis).
+// \param beta The shift vector (one element per index of the normalized axis).
+// \param eps The value added to the variance for numerical stability.
+// \param mean The resulting matrix of means.
+// \param rstd The resulting matrix of reciprocal standard deviations.
+// \return The normalized tensor.
+// \exception std::invalid_argument Invalid size of scale or shift vector.
+//
+// This function normalizes the given dense tensor \a dm along the axis selected by the reduction
+// flag \a RF, i.e. every fiber along this axis is shifted to zero mean and scaled to unit
+// (biased) variance, and afterwards scaled and shifted by the corresponding elements of \a gamma
+// and \a beta:
+
+      \f[ y = \frac{x - E[x]}{\sqrt{Var[x] + \epsilon}} \cdot \gamma + \beta \f]
+
+// The means and the reciprocal standard deviations \f$ 1/\sqrt{Var[x] + \epsilon} \f$ of all
+// fibers are stored in \a mean and \a rstd, which have the same dimensions as the result of
+// the partial reduction along \a RF (e.g. a pages \f$ \times \f$ rows matrix for
+// \a blaze::rowwise):
+
+   \code
+   using blaze::rowwise;
+
+   blaze::DynamicTensor<double> A( 8UL, 16UL, 512UL ), B;
+   blaze::DynamicVector<double> gamma( 512UL, 1.0 ), beta( 512UL, 0.0 );
+   blaze::DynamicMatrix<double> mean, rstd;
+   // ... Initialization
+
+   B = layernorm<rowwise>( A, gamma, beta, 1E-5, mean, rstd );
+   \endcode
+
+// In contrast to the composition of partial reductions and broadcast arithmetic, the mean and
+// the variance are computed in a single vectorized (Welford) pass, followed by a single pass
+// that normalizes, scales and shifts the elements. Both passes are executed in parallel for
+// large tensors.
+*/
+template< size_t RF     // Reduction flag
+        , typename MT   // Type of the dense tensor
+        , typename VT1  // Type of the scale vector
+        , typename VT2  // Type of the shift vector
+        , bool TF       // Transpose flag of the vectors
+        , typename MT1  // Type of the mean matrix
+        , bool SO1      // Storage order of the mean matrix
+        , typename MT2  // Type of the reciprocal standard deviation matrix
+        , bool SO2 >    // Storage order of the reciprocal standard deviation matrix
+ResultType_t<MT>
+   layernorm( const DenseTensor<MT>& dm, const DenseVector<VT1,TF>& gamma,
+              const DenseVector<VT2,TF>& beta, ElementType_t<MT> eps,
+              DenseMatrix<MT1,SO1>& mean, DenseMatrix<MT2,SO2>& rstd )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_STATIC_ASSERT_MSG( RF < 3UL, "Invalid reduction flag" );
+
+   using ET = ElementType_t<MT>;
+
+   BLAZE_CONSTRAINT_MUST_BE_FLOATING_POINT_TYPE( ET );
+
+   ResultType_t<MT> tmp( *dm );
+
+   const size_t size( RF == pagewise ? tmp.pages() : RF == columnwise ? tmp.rows() : tmp.columns() );
+   const std::vector<ET> g( normCoefficients<ET>( *gamma, size ) );
+   const std::vector<ET> b( normCoefficients<ET>( *beta, size ) );
+
+   std::vector<ET> mu, r;
+   const size_t columns( normalize_backend<RF>( tmp, false, false, g.data(), b.data(), eps, mu, r ) );
+
+   normStore( mu, columns, *mean );
+   normStore( r, columns, *rstd );
+
+   return tmp;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Fused layer normalization of the given dense tensor along the given axis.
+// \ingroup dense_tensor
+//
+// \param dm The given dense tensor.
+// \param gamma The scale vector (one element per index of the normalized axis).
+// \param beta The shift vector (one element per index of the normalized axis).
+// \param eps The value added to the variance for numerical stability.
+// \return The normalized tensor.
+// \exception std::invalid_argument Invalid size of scale or shift vector.
+*/
+template< size_t RF     // Reduction flag
+        , typename MT   // Type of the dense tensor
+        , typename VT1  // Type of the scale vector
+        , typename VT2  // Type of the shift vector
+        , bool TF >     // Transpose flag of the vectors
+ResultType_t<MT>
+   layernorm( const DenseTensor<MT>& dm, const DenseVector<VT1,TF>& gamma,
+              const DenseVector<VT2,TF>& beta, ElementType_t<MT> eps = ElementType_t<MT>( 1E-5 ) )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_STATIC_ASSERT_MSG( RF < 3UL, "Invalid reduction flag" );
+
+   using ET = ElementType_t<MT>;
+
+   BLAZE_CONSTRAINT_MUST_BE_FLOATING_POINT_TYPE( ET );
+
+   ResultType_t<MT> tmp( *dm );
+
+   const size_t size( RF == pagewise ? tmp.pages() : RF == columnwise ? tmp.rows() : tmp.columns() );
+   const std::vector<ET> g( normCoefficients<ET>( *gamma, size ) );
+   const std::vector<ET> b( normCoefficients<ET>( *beta, size ) );
+
+   std::vector<ET> mu, r;
+   normalize_backend<RF>( tmp, false, false, g.data(), b.data(), eps, mu, r );
+
+   return tmp;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Fused layer normalization of the given dense tensor along the given axis without
+//        scale and shift.
+// \ingroup dense_tensor
+//
+// \param dm The given dense tensor.
+// \param eps The value added to the variance for numerical stability.
+// \return The normalized tensor.
+*/
+template< size_t RF     // Reduction flag
+        , typename MT > // Type of the dense tensor
+ResultType_t<MT>
+   layernorm( const DenseTensor<MT>& dm, ElementType_t<MT> eps = ElementType_t<MT>( 1E-5 ) )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_STATIC_ASSERT_MSG( RF < 3UL, "Invalid reduction flag" );
+
+   using ET = ElementType_t<MT>;
+
+   BLAZE_CONSTRAINT_MUST_BE_FLOATING_POINT_TYPE( ET );
+
+   ResultType_t<MT> tmp( *dm );
+
+   std::vector<ET> mu, r;
+   normalize_backend<RF>( tmp, false, false, static_cast<const ET*>( nullptr ),
+                          static_cast<const ET*>( nullptr ), eps, mu, r );
+
+   return tmp;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Fused batch normalization of the given dense tensor with channels along the given axis.
+// \ingroup dense_tensor
+//
+// \param dm The given dense tensor.
+// \param gamma The scale vector (one element per channel).
+// \param beta The shift vector (one element per channel).
+// \param eps The value added to the variance for numerical stability.
+// \param mean The resulting vector of means (one element per channel).
+// \param rstd The resulting vector of reciprocal standard deviations (one element per channel).
+// \return The normalized tensor.
+// \exception std::invalid_argument Invalid size of scale or shift vector.
+//
+// This function treats every index of the axis selected by the reduction flag \a RF as a
+// channel. The elements of every channel (i.e. of all other axes) are shifted to zero mean and
+// scaled to unit (biased) variance and afterwards scaled and shifted by the corresponding
+// elements of \a gamma and \a beta:
+
+   \code
+   using blaze::pagewise;
+
+   blaze::DynamicTensor<float> A( 64UL, 28UL, 28UL ), B;
+   blaze::DynamicVector<float> gamma( 64UL, 1.0F ), beta( 64UL, 0.0F ), mean, rstd;
+   // ... Initialization
+
+   B = batchnorm<pagewise>( A, gamma, beta, 1E-5F, mean, rstd );  // One channel per page
+   \endcode
+
+// The statistics of all channels are computed in a single vectorized (Welford) pass, followed
+// by a single pass that normalizes, scales and shifts the elements.
+*/
+template< size_t RF     // Reduction flag
+        , typename MT   // Type of the dense tensor
+        , typename VT1  // Type of the scale vector
+        , typename VT2  // Type of the shift vector
+        , bool TF       // Transpose flag of the vectors
+        , typename VT3  // Type of the mean vector
+        , bool TF3      // Transpose flag of the mean vector
+        , typename VT4  // Type of the reciprocal standard deviation vector
+        , bool TF4 >    // Transpose flag of the reciprocal standard deviation vector
+ResultType_t<MT>
+   batchnorm( const DenseTensor<MT>& dm, const DenseVector<VT1,TF>& gamma,
+              const DenseVector<VT2,TF>& beta, ElementType_t<MT> eps,
+              DenseVector<VT3,TF3>& mean, DenseVector<VT4,TF4>& rstd )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_STATIC_ASSERT_MSG( RF < 3UL, "Invalid reduction flag" );
+
+   using ET = ElementType_t<MT>;
+
+   BLAZE_CONSTRAINT_MUST_BE_FLOATING_POINT_TYPE( ET );
+
+   ResultType_t<MT> tmp( *dm );
+
+   const size_t size( RF == pagewise ? tmp.pages() : RF == columnwise ? tmp.rows() : tmp.columns() );
+   const std::vector<ET> g( normCoefficients<ET>( *gamma, size ) );
+   const std::vector<ET> b( normCoefficients<ET>( *beta, size ) );
+
+   std::vector<ET> mu, r;
+   normalize_backend<RF>( tmp, true, false, g.data(), b.data(), eps, mu, r );
+
+   normStore( mu, *mean );
+   normStore( r, *rstd );
+
+   return tmp;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Fused batch normalization of the given dense tensor with channels along the given axis.
+// \ingroup dense_tensor
+//
+// \param dm The given dense tensor.
+// \param gamma The scale vector (one element per channel).
+// \param beta The shift vector (one element per channel).
+// \param eps The value added to the variance for numerical stability.
+// \return The normalized tensor.
+// \exception std::invalid_argument Invalid size of scale or shift vector.
+*/
+template< size_t RF     // Reduction flag
+        , typename MT   // Type of the dense tensor
+        , typename VT1  // Type of the scale vector
+        , typename VT2  // Type of the shift vector
+        , bool TF >     // Transpose flag of the vectors
+ResultType_t<MT>
+   batchnorm( const DenseTensor<MT>& dm, const DenseVector<VT1,TF>& gamma,
+              const DenseVector<VT2,TF>& beta, ElementType_t<MT> eps = ElementType_t<MT>( 1E-5 ) )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_STATIC_ASSERT_MSG( RF < 3UL, "Invalid reduction flag" );
+
+   using ET = ElementType_t<MT>;
+
+   BLAZE_CONSTRAINT_MUST_BE_FLOATING_POINT_TYPE( ET );
+
+   ResultType_t<MT> tmp( *dm );
+
+   const size_t size( RF == pagewise ? tmp.pages() : RF == columnwise ? tmp.rows() : tmp.columns() );
+   const std::vector<ET> g( normCoefficients<ET>( *gamma, size ) );
+   const std::vector<ET> b( normCoefficients<ET>( *beta, size ) );
+
+   std::vector<ET> mu, r;
+   normalize_backend<RF>( tmp, true, false, g.data(), b.data(), eps, mu, r );
+
+   return tmp;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Fused batch normalization of the given dense tensor without scale and shift.
+// \ingroup dense_tensor
+//
+// \param dm The given dense tensor.
+// \param eps The value added to the variance for numerical stability.
+// \return The normalized tensor.
+*/
+template< size_t RF     // Reduction flag
+        , typename MT > // Type of the dense tensor
+ResultType_t<MT>
+   batchnorm( const DenseTensor<MT>& dm, ElementType_t<MT> eps = ElementType_t<MT>( 1E-5 ) )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_STATIC_ASSERT_MSG( RF < 3UL, "Invalid reduction flag" );
+
+   using ET = ElementType_t<MT>;
+
+   BLAZE_CONSTRAINT_MUST_BE_FLOATING_POINT_TYPE( ET );
+
+   ResultType_t<MT> tmp( *dm );
+
+   std::vector<ET> mu, r;
+   normalize_backend<RF>( tmp, true, false, static_cast<const ET*>( nullptr ),
+                          static_cast<const ET*>( nullptr ), eps, mu, r );
+
+   return tmp;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Fused RMS normalization of the given dense tensor along the given axis.
+// \ingroup dense_tensor
+//
+// \param dm The given dense tensor.
+// \param gamma The scale vector (one element per index of the normalized axis).
+// \param eps The value added to the mean square for numerical stability.
+// \param rstd The resulting matrix of reciprocal root mean squares.
+// \return The normalized tensor.
+// \exception std::invalid_argument Invalid size of scale vector.
+//
+// This function scales every fiber of the given dense tensor \a dm along the axis selected by
+// the reduction flag \a RF by its reciprocal root mean square and afterwards by the
+// corresponding elements of \a gamma:
+
+      \f[ y = \frac{x}{\sqrt{E[x^2] + \epsilon}} \cdot \gamma \f]
+
+// The reciprocal root mean squares are stored in \a rstd, which has the same dimensions as the
+// result of the partial reduction along \a RF.
+*/
+template< size_t RF     // Reduction flag
+        , typename MT   // Type of the dense tensor
+        , typename VT   // Type of the scale vector
+        , bool TF       // Transpose flag of the scale vector
+        , typename MT2  // Type of the reciprocal root mean square matrix
+        , bool SO2 >    // Storage order of the reciprocal root mean square matrix
+ResultType_t<MT>
+   rmsnorm( const DenseTensor<MT>& dm, const DenseVector<VT,TF>& gamma,
+            ElementType_t<MT> eps, DenseMatrix<MT2,SO2>& rstd )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_STATIC_ASSERT_MSG( RF < 3UL, "Invalid reduction flag" );
+
+   using ET = ElementType_t<MT>;
+
+   BLAZE_CONSTRAINT_MUST_BE_FLOATING_POINT_TYPE( ET );
+
+   ResultType_t<MT> tmp( *dm );
+
+   const size_t size( RF == pagewise ? tmp.pages() : RF == columnwise ? tmp.rows() : tmp.columns() );
+   const std::vector<ET> g( normCoefficients<ET>( *gamma, size ) );
+
+   std::vector<ET> mu, r;
+   const size_t columns( normalize_backend<RF>( tmp, false, true, g.data(),
+                                                static_cast<const ET*>( nullptr ), eps, mu, r ) );
+
+   normStore( r, columns, *rstd );
+
+   return tmp;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Fused RMS normalization of the given dense tensor along the given axis.
+// \ingroup dense_tensor
+//
+// \param dm The given dense tensor.
+// \param gamma The scale vector (one element per index of the normalized axis).
+// \param eps The value added to the mean square for numerical stability.
+// \return The normalized tensor.
+// \exception std::invalid_argument Invalid size of scale vector.
+*/
+template< size_t RF     // Reduction flag
+        , typename MT   // Type of the dense tensor
+        , typename VT   // Type of the scale vector
+        , bool TF >     // Transpose flag of the scale vector
+ResultType_t<MT>
+   rmsnorm( const DenseTensor<MT>& dm, const DenseVector<VT,TF>& gamma,
+            ElementType_t<MT> eps = ElementType_t<MT>( 1E-5 ) )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_STATIC_ASSERT_MSG( RF < 3UL, "Invalid reduction flag" );
+
+   using ET = ElementType_t<MT>;
+
+   BLAZE_CONSTRAINT_MUST_BE_FLOATING_POINT_TYPE( ET );
+
+   ResultType_t<MT> tmp( *dm );
+
+   const size_t size( RF == pagewise ? tmp.pages() : RF == columnwise ? tmp.rows() : tmp.columns() );
+   const std::vector<ET> g( normCoefficients<ET>( *gamma, size ) );
+
+   std::vector<ET> mu, r;
+   normalize_backend<RF>( tmp, false, true, g.data(), static_cast<const ET*>( nullptr ), eps, mu, r );
+
+   return tmp;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Fused RMS normalization of the given dense tensor along the given axis without scale.
+// \ingroup dense_tensor
+//
+// \param dm The given dense tensor.
+// \param eps The value added to the mean square for numerical stability.
+// \return The normalized tensor.
+*/
+template< size_t RF     // Reduction flag
+        , typename MT > // Type of the dense tensor
+ResultType_t<MT>
+   rmsnorm( const DenseTensor<MT>& dm, ElementType_t<MT> eps = ElementType_t<MT>( 1E-5 ) )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_STATIC_ASSERT_MSG( RF < 3UL, "Invalid reduction flag" );
+
+   using ET = ElementType_t<MT>;
+
+   BLAZE_CONSTRAINT_MUST_BE_FLOATING_POINT_TYPE( ET );
+
+   ResultType_t<MT> tmp( *dm );
+
+   std::vector<ET> mu, r;
+   normalize_backend<RF>( tmp, false, true, static_cast<const ET*>( nullptr ),
+                          static_cast<const ET*>( nullptr ), eps, mu, r );
+
+   return tmp;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ARRAY NORMALIZATION OPERATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend implementation of the fused normalizations of dense arrays.
+// \ingroup dense_array
+//
+// \param arr The dense array to be normalized in place.
+// \param batch \a true in case of a batch normalization.
+// \param rms \a true in case of an RMS normalization.
+// \param gamma Pointer to the scale coefficients (\c nullptr in case of no scaling).
+// \param beta Pointer to the shift coefficients (\c nullptr in case of no shift).
+// \param eps The value added to the variance for numerical stability.
+// \param mean The resulting means.
+// \param rstd The resulting reciprocal standard deviations.
+// \return void
+*/
+template< size_t R      // Normalized dimension
+        , typename AT   // Type of the dense array
+        , typename ET > // Element type of the dense array
+void normalize_backend( DenseArray<AT>& arr, bool batch, bool rms, const ET* gamma,
+                        const ET* beta, ET eps, std::vector<ET>& mean, std::vector<ET>& rstd )
+{
+   constexpr size_t N( AT::num_dimensions );
+
+   const auto& dims( (*arr).dimensions() );
+   const size_t nn( (*arr).spacing() );
+
+   const NormLayout layout( normLayout( dims.data(), N, R, batch ) );
+   const size_t stats( layout.groups * ( layout.perColumn ? dims[0] : 1UL ) );
+
+   mean.resize( stats );
+   rstd.resize( stats );
+
+   ET* const base( (*arr).data() );
+
+   normalizeRows( [base,nn]( size_t r ) { return base + r*nn; },
+                  layout, dims[0], batch, rms, gamma, beta, eps, mean.data(), rstd.data() );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Copies the statistics of an array normalization along dimension \a R into the given
+//        dense array.
+// \ingroup dense_array
+//
+// \param stats The statistics.
+// \param dims The dimensions of the normalized array.
+// \param da The resulting (N-1)-dimensional dense array.
+// \return void
+*/
+template< size_t R      // Normalized dimension
+        , typename ET   // Element type of the statistics
+        , size_t N      // Number of dimensions of the normalized array
+        , typename AT > // Type of the resulting dense array
+void normStore( const std::vector<ET>& stats, const std::array<size_t,N>& dims, DenseArray<AT>& da )
+{
+   BLAZE_STATIC_ASSERT_MSG( AT::num_dimensions + 1UL == N, "Invalid number of array dimensions" );
+
+   std::array<size_t,N-1UL> rdims;
+   for( size_t d=0UL, r=0UL; d<N; ++d ) {
+      if( d != R ) rdims[r++] = dims[d];
+   }
+
+   (*da).resize( rdims, false );
+
+   const size_t columns( rdims[0] );
+   const size_t nn( (*da).spacing() );
+   ElementType_t<AT>* const out( (*da).data() );
+
+   for( size_t i=0UL; i<stats.size(); ++i ) {
+      out[( i / columns )*nn + i % columns] = stats[i];
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Fused layer normalization of the given dense array along the given dimension.
+// \ingroup dense_array
+//
+// \param dm The given dense array.
+// \param gamma The scale vector (one element per index of dimension \a R).
+// \param beta The shift vector (one element per index of dimension \a R).
+// \param eps The value added to the variance for numerical stability.
+// \param mean The resulting (N-1)-dimensional array of means.
+// \param rstd The resulting (N-1)-dimensional array of reciprocal standard deviations.
+// \return The normalized array.
+// \exception std::invalid_argument Invalid size of scale or shift vector.
+//
+// This function normalizes the given N-dimensional dense array \a dm along the dimension \a R
+// (\a R == 0 denotes the innermost dimension, i.e. the columns) in the same way as the
+// layernorm() function for dense tensors. The statistics arrays have the dimensions of \a dm
+// without dimension \a R.
+*/
+template< size_t R      // Normalized dimension
+        , typename MT   // Type of the dense array
+        , typename VT1  // Type of the scale vector
+        , typename VT2  // Type of the shift vector
+        , bool TF       // Transpose flag of the vectors
+        , typename AT1  // Type of the mean array
+        , typename AT2 > // Type of the reciprocal standard deviation array
+ResultType_t<MT>
+   layernorm( const DenseArray<MT>& dm, const DenseVector<VT1,TF>& gamma,
+              const DenseVector<VT2,TF>& beta, ElementType_t<MT> eps,
+              DenseArray<AT1>& mean, DenseArray<AT2>& rstd )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_STATIC_ASSERT_MSG( R < MT::num_dimensions, "Invalid normalization dimension" );
+
+   using ET = ElementType_t<MT>;
+
+   BLAZE_CONSTRAINT_MUST_BE_FLOATING_POINT_TYPE( ET );
+
+   ResultType_t<MT> tmp( *dm );
+
+   const size_t size( tmp.dimensions()[R] );
+   const std::vector<ET> g( normCoefficients<ET>( *gamma, size ) );
+   const std::vector<ET> b( normCoefficients<ET>( *beta, size ) );
+
+   std::vector<ET> mu, r;
+   normalize_backend<R>( tmp, false, false, g.data(), b.data(), eps, mu, r );
+
+   normStore<R>( mu, tmp.dimensions(), *mean );
+   normStore<R>( r, tmp.dimensions(), *rstd );
+
+   return tmp;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Fused layer normalization of the given dense array along the given dimension.
+// \ingroup dense_array
+//
+// \param dm The given dense array.
+// \param gamma The scale vector (one element per index of dimension \a R).
+// \param beta The shift vector (one element per index of dimension \a R).
+// \param eps The value added to the variance for numerical stability.
+// \return The normalized array.
+// \exception std::invalid_argument Invalid size of scale or shift vector.
+*/
+template< size_t R      // Normalized dimension
+        , typename MT   // Type of the dense array
+        , typename VT1  // Type of the scale vector
+        , typename VT2  // Type of the shift vector
+        , bool TF >     // Transpose flag of the vectors
+ResultType_t<MT>
+   layernorm( const DenseArray<MT>& dm, const DenseVector<VT1,TF>& gamma,
+              const DenseVector<VT2,TF>& beta, ElementType_t<MT> eps = ElementType_t<MT>( 1E-5 ) )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_STATIC_ASSERT_MSG( R < MT::num_dimensions, "Invalid normalization dimension" );
+
+   using ET = ElementType_t<MT>;
+
+   BLAZE_CONSTRAINT_MUST_BE_FLOATING_POINT_TYPE( ET );
+
+   ResultType_t<MT> tmp( *dm );
+
+   const size_t size( tmp.dimensions()[R] );
+   const std::vector<ET> g( normCoefficients<ET>( *gamma, size ) );
+   const std::vector<ET> b( normCoefficients<ET>( *beta, size ) );
+
+   std::vector<ET> mu, r;
+   normalize_backend<R>( tmp, false, false, g.data(), b.data(), eps, mu, r );
+
+   return tmp;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Fused layer normalization of the given dense array along the given dimension without
+//        scale and shift.
+// \ingroup dense_array
+//
+// \param dm The given dense array.
+// \param eps The value added to the variance for numerical stability.
+// \return The normalized array.
+*/
+template< size_t R      // Normalized dimension
+        , typename MT > // Type of the dense array
+ResultType_t<MT>
+   layernorm( const DenseArray<MT>& dm, ElementType_t<MT> eps = ElementType_t<MT>( 1E-5 ) )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_STATIC_ASSERT_MSG( R < MT::num_dimensions, "Invalid normalization dimension" );
+
+   using ET = ElementType_t<MT>;
+
+   BLAZE_CONSTRAINT_MUST_BE_FLOATING_POINT_TYPE( ET );
+
+   ResultType_t<MT> tmp( *dm );
+
+   std::vector<ET> mu, r;
+   normalize_backend<R>( tmp, false, false, static_cast<const ET*>( nullptr ),
+                         static_cast<const ET*>( nullptr ), eps, mu, r );
+
+   return tmp;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Fused batch normalization of the given dense array with channels along the given
+//        dimension.
+// \ingroup dense_array
+//
+// \param dm The given dense array.
+// \param gamma The scale vector (one element per channel).
+// \param beta The shift vector (one element per channel).
+// \param eps The value added to the variance for numerical stability.
+// \param mean The resulting vector of means (one element per channel).
+// \param rstd The resulting vector of reciprocal standard deviations (one element per channel).
+// \return The normalized array.
+// \exception std::invalid_argument Invalid size of scale or shift vector.
+//
+// This function treats every index of dimension \a R of the given N-dimensional dense array
+// \a dm as a channel and normalizes the elements of every channel in the same way as the
+// batchnorm() function for dense tensors.
+*/
+template< size_t R      // Channel dimension
+        , typename MT   // Type of the dense array
+        , typename VT1  // Type of the scale vector
+        , typename VT2  // Type of the shift vector
+        , bool TF       // Transpose flag of the vectors
+        , typename VT3  // Type of the mean vector
+        , bool TF3      // Transpose flag of the mean vector
+        , typename VT4  // Type of the reciprocal standard deviation vector
+        , bool TF4 >    // Transpose flag of the reciprocal standard deviation vector
+ResultType_t<MT>
+   batchnorm( const DenseArray<MT>& dm, const DenseVector<VT1,TF>& gamma,
+              const DenseVector<VT2,TF>& beta, ElementType_t<MT> eps,
+              DenseVector<VT3,TF3>& mean, DenseVector<VT4,TF4>& rstd )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_STATIC_ASSERT_MSG( R < MT::num_dimensions, "Invalid channel dimension" );
+
+   using ET = ElementType_t<MT>;
+
+   BLAZE_CONSTRAINT_MUST_BE_FLOATING_POINT_TYPE( ET );
+
+   ResultType_t<MT> tmp( *dm );
+
+   const size_t size( tmp.dimensions()[R] );
+   const std::vector<ET> g( normCoefficients<ET>( *gamma, size ) );
+   const std::vector<ET> b( normCoefficients<ET>( *beta, size ) );
+
+   std::vector<ET> mu, r;
+   normalize_backend<R>( tmp, true, false, g.data(), b.data(), eps, mu, r );
+
+   normStore( mu, *mean );
+   normStore( r, *rstd );
+
+   return tmp;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Fused batch normalization of the given dense array with channels along the given
+//        dimension.
+// \ingroup dense_array
+//
+// \param dm The given dense array.
+// \param gamma The scale vector (one element per channel).
+// \param beta The shift vector (one element per channel).
+// \param eps The value added to the variance for numerical stability.
+// \return The normalized array.
+// \exception std::invalid_argument Invalid size of scale or shift vector.
+*/
+template< size_t R      // Channel dimension
+        , typename MT   // Type of the dense array
+        , typename VT1  // Type of the scale vector
+        , typename VT2  // Type of the shift vector
+        , bool TF >     // Transpose flag of the vectors
+ResultType_t<MT>
+   batchnorm( const DenseArray<MT>& dm, const DenseVector<VT1,TF>& gamma,
+              const DenseVector<VT2,TF>& beta, ElementType_t<MT> eps = ElementType_t<MT>( 1E-5 ) )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_STATIC_ASSERT_MSG( R < MT::num_dimensions, "Invalid channel dimension" );
+
+   using ET = ElementType_t<MT>;
+
+   BLAZE_CONSTRAINT_MUST_BE_FLOATING_POINT_TYPE( ET );
+
+   ResultType_t<MT> tmp( *dm );
+
+   const size_t size( tmp.dimensions()[R] );
+   const std::vector<ET> g( normCoefficients<ET>( *gamma, size ) );
+   const std::vector<ET> b( normCoefficients<ET>( *beta, size ) );
+
+   std::vector<ET> mu, r;
+   normalize_backend<R>( tmp, true, false, g.data(), b.data(), eps, mu, r );
+
+   return tmp;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Fused batch normalization of the given dense array without scale and shift.
+// \ingroup dense_array
+//
+// \param dm The given dense array.
+// \param eps The value added to the variance for numerical stability.
+// \return The normalized array.
+*/
+template< size_t R      // Channel dimension
+        , typename MT > // Type of the dense array
+ResultType_t<MT>
+   batchnorm( const DenseArray<MT>& dm, ElementType_t<MT> eps = ElementType_t<MT>( 1E-5 ) )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_STATIC_ASSERT_MSG( R < MT::num_dimensions, "Invalid channel dimension" );
+
+   using ET = ElementType_t<MT>;
+
+   BLAZE_CONSTRAINT_MUST_BE_FLOATING_POINT_TYPE( ET );
+
+   ResultType_t<MT> tmp( *dm );
+
+   std::vector<ET> mu, r;
+   normalize_backend<R>( tmp, true, false, static_cast<const ET*>( nullptr ),
+                         static_cast<const ET*>( nullptr ), eps, mu, r );
+
+   return tmp;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Fused RMS normalization of the given dense array along the given dimension.
+// \ingroup dense_array
+//
+// \param dm The given dense array.
+// \param gamma The scale vector (one element per index of dimension \a R).
+// \param eps The value added to the mean square for numerical stability.
+// \param rstd The resulting (N-1)-dimensional array of reciprocal root mean squares.
+// \return The normalized array.
+// \exception std::invalid_argument Invalid size of scale vector.
+*/
+template< size_t R      // Normalized dimension
+        , typename MT   // Type of the dense array
+        , typename VT   // Type of the scale vector
+        , bool TF       // Transpose flag of the scale vector
+        , typename AT > // Type of the reciprocal root mean square array
+ResultType_t<MT>
+   rmsnorm( const DenseArray<MT>& dm, const DenseVector<VT,TF>& gamma,
+            ElementType_t<MT> eps, DenseArray<AT>& rstd )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_STATIC_ASSERT_MSG( R < MT::num_dimensions, "Invalid normalization dimension" );
+
+   using ET = ElementType_t<MT>;
+
+   BLAZE_CONSTRAINT_MUST_BE_FLOATING_POINT_TYPE( ET );
+
+   ResultType_t<MT> tmp( *dm );
+
+   const std::vector<ET> g( normCoefficients<ET>( *gamma, tmp.dimensions()[R] ) );
+
+   std::vector<ET> mu, r;
+   normalize_backend<R>( tmp, false, true, g.data(), static_cast<const ET*>( nullptr ), eps, mu, r );
+
+   normStore<R>( r, tmp.dimensions(), *rstd );
+
+   return tmp;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Fused RMS normalization of the given dense array along the given dimension.
+// \ingroup dense_array
+//
+// \param dm The given dense array.
+// \param gamma The scale vector (one element per index of dimension \a R).
+// \param eps The value added to the mean square for numerical stability.
+// \return The normalized array.
+// \exception std::invalid_argument Invalid size of scale vector.
+*/
+template< size_t R      // Normalized dimension
+        , typename MT   // Type of the dense array
+        , typename VT   // Type of the scale vector
+        , bool TF >     // Transpose flag of the scale vector
+ResultType_t<MT>
+   rmsnorm( const DenseArray<MT>& dm, const DenseVector<VT,TF>& gamma,
+            ElementType_t<MT> eps = ElementType_t<MT>( 1E-5 ) )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_STATIC_ASSERT_MSG( R < MT::num_dimensions, "Invalid normalization dimension" );
+
+   using ET = ElementType_t<MT>;
+
+   BLAZE_CONSTRAINT_MUST_BE_FLOATING_POINT_TYPE( ET );
+
+   ResultType_t<MT> tmp( *dm );
+
+   const std::vector<ET> g( normCoefficients<ET>( *gamma, tmp.dimensions()[R] ) );
+
+   std::vector<ET> mu, r;
+   normalize_backend<R>( tmp, false, true, g.data(), static_cast<const ET*>( nullptr ), eps, mu, r );
+
+   return tmp;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Fused RMS normalization of the given dense array along the given dimension without
+//        scale.
+// \ingroup dense_array
+//
+// \param dm The given dense array.
+// \param eps The value added to the mean square for numerical stability.
+// \return The normalized array.
+*/
+template< size_t R      // Normalized dimension
+        , typename MT > // Type of the dense array
+ResultType_t<MT>
+   rmsnorm( const DenseArray<MT>& dm, ElementType_t<MT> eps = ElementType_t<MT>( 1E-5 ) )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_STATIC_ASSERT_MSG( R < MT::num_dimensions, "Invalid normalization dimension" );
+
+   using ET = ElementType_t<MT>;
+
+   BLAZE_CONSTRAINT_MUST_BE_FLOATING_POINT_TYPE( ET );
+
+   ResultType_t<MT> tmp( *dm );
+
+   std::vector<ET> mu, r;
+   normalize_backend<R>( tmp, false, true, static_cast<const ET*>( nullptr ),
+                         static_cast<const ET*>( nullptr ), eps, mu, r );
+
+   return tmp;
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
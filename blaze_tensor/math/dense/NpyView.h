@@ -0,0 +1,576 @@
+//=================================================================================================
+/*!
+//  \file blaze_tensor/math/dense/NpyView.h
+//  \brief Header file for the NpyTensorView and NpyArrayView class templates
+//
+//  Copyright (C) 2012-2018 Klaus Iglberger - All Rights Reserved
+//  Copyright (C) 2018 Hartmut Kaiser - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+
+#ifndef _BLAZE_TENSOR_MATH_DENSE_NPYVIEW_H_
+#define _BLAZE_TENSOR_MATH_DENSE_NPYVIEW_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <array>
+#include <limits>
+#include <string>
+#include <utility>
+
+#include <blaze/math/AlignmentFlag.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/PaddingFlag.h>
+#include <blaze/util/StaticAssert.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsNumeric.h>
+
+#include <blaze_tensor/math/dense/CustomArray.h>
+#include <blaze_tensor/math/dense/CustomTensor.h>
+#include <blaze_tensor/math/serialization/Npy.h>
+#include <blaze_tensor/math/serialization/NpyFormat.h>
+#include <blaze_tensor/math/serialization/Npz.h>
+#include <blaze_tensor/util/MappedFile.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  AUXILIARY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Locates and validates the .npy data at the given offset of a mapped file.
+// \ingroup npy
+//
+// \param file The mapped file.
+// \param offset The offset of the .npy data within the file.
+// \param header The parsed header of the .npy data.
+// \return Pointer to the first element.
+// \exception std::invalid_argument The data cannot be viewed in place.
+//
+// The data can only be viewed in place if the element type matches \a Type exactly, if the data
+// is stored in native byte order and C order, and if the first element is properly aligned.
+*/
+template< typename Type >  // Data type of the view
+Type* npyViewData( const MappedFile& file, size_t offset, NpyHeader& header )
+{
+   if( offset > file.size() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid npy offset" );
+   }
+
+   header = readNpyHeader( file.data() + offset, file.size() - offset );
+
+   if( !npyMatches<Type>( header ) || npySwapped( header ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Npy element type does not match the view" );
+   }
+
+   if( header.fortran ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Fortran ordered npy data is not supported" );
+   }
+
+   constexpr size_t limit( std::numeric_limits<size_t>::max() );
+
+   size_t number( 1UL );
+   for( size_t extent : header.shape ) {
+      if( extent != 0UL && number > limit / extent ) {
+         BLAZE_THROW_INVALID_ARGUMENT( "Invalid npy shape" );
+      }
+      number *= extent;
+   }
+
+   if( number > limit / sizeof( Type ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid npy shape" );
+   }
+
+   if( header.offset > file.size() - offset ||
+       number * sizeof( Type ) > file.size() - offset - header.offset ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Truncated npy data" );
+   }
+
+   char* const ptr( file.data() + offset + header.offset );
+
+   if( reinterpret_cast<size_t>( ptr ) % alignof( Type ) != 0UL ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Misaligned npy data" );
+   }
+
+   return reinterpret_cast<Type*>( ptr );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the offset of the given .npz entry.
+// \ingroup npy
+*/
+inline size_t npzViewOffset( const std::string& path, const std::string& name )
+{
+   NpzReader npz( path );
+   return npz.entryOffset( name );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CLASS NPYTENSORVIEW
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Zero-copy view on a tensor stored in a NumPy .npy file or an uncompressed .npz entry.
+// \ingroup npy
+//
+// The NpyTensorView class template maps a .npy file (or the .npz archive containing the entry)
+// into memory and exposes the C-ordered data in place as an unaligned and unpadded CustomTensor.
+// No data is read or copied on construction. Data with less than three dimensions is viewed
+// with leading extents of one. The view requires that the stored element type matches \a Type
+// exactly and that the data is stored in native byte order; otherwise readNpy() has to be used.
+
+   \code
+   blaze::NpyTensorView<float> view( "A.npy" );
+
+   // Vectorized copy into the aligned and padded layout of a dynamic tensor
+   blaze::DynamicTensor<float> A( view.tensor() );
+
+   // Direct access to an entry of an archive
+   blaze::NpyTensorView<double> B( "data.npz", "B" );
+   \endcode
+
+// The access mode of the mapping (see \a MapMode) determines whether the view may be modified
+// and whether modifications are written back to the file.
+//
+// \note The NpyTensorView class template requires a POSIX system.
+*/
+template< typename Type >  // Data type of the tensor
+class NpyTensorView
+{
+ public:
+   //**Type definitions****************************************************************************
+   using ElementType = Type;                                 //!< Type of the tensor elements.
+   using TensorType  = CustomTensor<Type,unaligned,unpadded>;  //!< Type of the viewed tensor.
+   //**********************************************************************************************
+
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit inline NpyTensorView( const std::string& path, MapMode mode = MapMode::readOnly );
+   explicit inline NpyTensorView( const std::string& path, const std::string& name,
+                                  MapMode mode = MapMode::readOnly );
+
+   NpyTensorView( const NpyTensorView& ) = delete;
+   NpyTensorView( NpyTensorView&& ) = default;
+   //@}
+   //**********************************************************************************************
+
+   //**Assignment operators************************************************************************
+   /*!\name Assignment operators */
+   //@{
+   NpyTensorView& operator=( const NpyTensorView& ) = delete;
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline TensorType&       tensor() noexcept;
+   inline const TensorType& tensor() const noexcept;
+   inline void              advise( MapAdvice advice ) const;
+   inline void              flush( bool async = false ) const;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   static inline TensorType makeTensor( const MappedFile& file, size_t offset );
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   MappedFile file_;    //!< The memory mapped file.
+   TensorType tensor_;  //!< The tensor referring to the mapped memory.
+   //@}
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_STATIC_ASSERT_MSG( IsNumeric_v<Type>, "Npy views require numeric element types" );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Maps the given .npy file.
+//
+// \param path The path of the .npy file.
+// \param mode The access mode of the mapping.
+// \exception std::runtime_error File could not be mapped.
+// \exception std::invalid_argument The data cannot be viewed as tensor of type \a Type.
+*/
+template< typename Type >  // Data type of the tensor
+inline NpyTensorView<Type>::NpyTensorView( const std::string& path, MapMode mode )
+   : file_  ( path, mode )                // The memory mapped file
+   , tensor_( makeTensor( file_, 0UL ) )  // The tensor referring to the mapped memory
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Maps the given entry of an uncompressed .npz archive.
+//
+// \param path The path of the .npz archive.
+// \param name The name of the entry (without the .npy suffix).
+// \param mode The access mode of the mapping.
+// \exception std::runtime_error File could not be mapped.
+// \exception std::invalid_argument Unknown or compressed entry, or the data cannot be viewed
+//                                  as tensor of type \a Type.
+*/
+template< typename Type >  // Data type of the tensor
+inline NpyTensorView<Type>::NpyTensorView( const std::string& path, const std::string& name, MapMode mode )
+   : file_  ( path, mode )                                      // The memory mapped file
+   , tensor_( makeTensor( file_, npzViewOffset( path, name ) ) )  // The tensor referring to the mapped memory
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the tensor referring to the mapped memory.
+//
+// \return Reference to the viewed tensor.
+*/
+template< typename Type >  // Data type of the tensor
+inline typename NpyTensorView<Type>::TensorType& NpyTensorView<Type>::tensor() noexcept
+{
+   return tensor_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the tensor referring to the mapped memory.
+//
+// \return Reference to the viewed tensor.
+*/
+template< typename Type >  // Data type of the tensor
+inline const typename NpyTensorView<Type>::TensorType& NpyTensorView<Type>::tensor() const noexcept
+{
+   return tensor_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Passes an access pattern hint for the mapped file to the operating system.
+//
+// \param advice The access pattern hint.
+// \return void
+*/
+template< typename Type >  // Data type of the tensor
+inline void NpyTensorView<Type>::advise( MapAdvice advice ) const
+{
+   file_.advise( advice );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Writes modifications of a writable mapping back to the file.
+//
+// \param async \a true to schedule the write-back without waiting for its completion.
+// \return void
+*/
+template< typename Type >  // Data type of the tensor
+inline void NpyTensorView<Type>::flush( bool async ) const
+{
+   file_.flush( async );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructs the custom tensor on the mapped .npy data.
+//
+// \param file The mapped file.
+// \param offset The offset of the .npy data within the file.
+// \return The tensor referring to the mapped memory.
+*/
+template< typename Type >  // Data type of the tensor
+inline typename NpyTensorView<Type>::TensorType
+   NpyTensorView<Type>::makeTensor( const MappedFile& file, size_t offset )
+{
+   NpyHeader header;
+   Type* const ptr( npyViewData<Type>( file, offset, header ) );
+   const std::array< size_t, 3UL > shape( npyTensorShape( header ) );
+
+   return TensorType( ptr, shape[0], shape[1], shape[2] );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CLASS NPYARRAYVIEW
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Zero-copy view on an ND array stored in a NumPy .npy file or an uncompressed .npz entry.
+// \ingroup npy
+//
+// The NpyArrayView class template is the \a N-dimensional counterpart of the NpyTensorView
+// class template. It exposes the C-ordered data in place as an unaligned and unpadded
+// CustomArray. Data with less than \a N dimensions is viewed with leading extents of one.
+
+   \code
+   blaze::NpyArrayView<4UL,float> view( "batch.npy" );
+   blaze::DynamicArray<4UL,float> batch( view.array() );
+   \endcode
+
+// \note The NpyArrayView class template requires a POSIX system.
+*/
+template< size_t N         // Dimensionality of the array
+        , typename Type >  // Data type of the array
+class NpyArrayView
+{
+ public:
+   //**Type definitions****************************************************************************
+   using ElementType = Type;                                  //!< Type of the array elements.
+   using ArrayType   = CustomArray<N,Type,unaligned,unpadded>;  //!< Type of the viewed array.
+   //**********************************************************************************************
+
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit inline NpyArrayView( const std::string& path, MapMode mode = MapMode::readOnly );
+   explicit inline NpyArrayView( const std::string& path, const std::string& name,
+                                 MapMode mode = MapMode::readOnly );
+
+   NpyArrayView( const NpyArrayView& ) = delete;
+   NpyArrayView( NpyArrayView&& ) = default;
+   //@}
+   //**********************************************************************************************
+
+   //**Assignment operators************************************************************************
+   /*!\name Assignment operators */
+   //@{
+   NpyArrayView& operator=( const NpyArrayView& ) = delete;
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline ArrayType&       array() noexcept;
+   inline const ArrayType& array() const noexcept;
+   inline void             advise( MapAdvice advice ) const;
+   inline void             flush( bool async = false ) const;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   static inline ArrayType makeArray( const MappedFile& file, size_t offset );
+
+   template< size_t... Is >
+   static inline ArrayType makeArray( Type* ptr, std::array< size_t, N > const& dims,
+                                      std::index_sequence<Is...> );
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   MappedFile file_;   //!< The memory mapped file.
+   ArrayType  array_;  //!< The array referring to the mapped memory.
+   //@}
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_STATIC_ASSERT_MSG( IsNumeric_v<Type>, "Npy views require numeric element types" );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Maps the given .npy file.
+//
+// \param path The path of the .npy file.
+// \param mode The access mode of the mapping.
+// \exception std::runtime_error File could not be mapped.
+// \exception std::invalid_argument The data cannot be viewed as array of type \a Type.
+*/
+template< size_t N         // Dimensionality of the array
+        , typename Type >  // Data type of the array
+inline NpyArrayView<N,Type>::NpyArrayView( const std::string& path, MapMode mode )
+   : file_ ( path, mode )               // The memory mapped file
+   , array_( makeArray( file_, 0UL ) )  // The array referring to the mapped memory
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Maps the given entry of an uncompressed .npz archive.
+//
+// \param path The path of the .npz archive.
+// \param name The name of the entry (without the .npy suffix).
+// \param mode The access mode of the mapping.
+// \exception std::runtime_error File could not be mapped.
+// \exception std::invalid_argument Unknown or compressed entry, or the data cannot be viewed
+//                                  as array of type \a Type.
+*/
+template< size_t N         // Dimensionality of the array
+        , typename Type >  // Data type of the array
+inline NpyArrayView<N,Type>::NpyArrayView( const std::string& path, const std::string& name, MapMode mode )
+   : file_ ( path, mode )                                     // The memory mapped file
+   , array_( makeArray( file_, npzViewOffset( path, name ) ) )  // The array referring to the mapped memory
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the array referring to the mapped memory.
+//
+// \return Reference to the viewed array.
+*/
+template< size_t N         // Dimensionality of the array
+        , typename Type >  // Data type of the array
+inline typename NpyArrayView<N,Type>::ArrayType& NpyArrayView<N,Type>::array() noexcept
+{
+   return array_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the array referring to the mapped memory.
+//
+// \return Reference to the viewed array.
+*/
+template< size_t N         // Dimensionality of the array
+        , typename Type >  // Data type of the array
+inline const typename NpyArrayView<N,Type>::ArrayType& NpyArrayView<N,Type>::array() const noexcept
+{
+   return array_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Passes an access pattern hint for the mapped file to the operating system.
+//
+// \param advice The access pattern hint.
+// \return void
+*/
+template< size_t N         // Dimensionality of the array
+        , typename Type >  // Data type of the array
+inline void NpyArrayView<N,Type>::advise( MapAdvice advice ) const
+{
+   file_.advise( advice );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Writes modifications of a writable mapping back to the file.
+//
+// \param async \a true to schedule the write-back without waiting for its completion.
+// \return void
+*/
+template< size_t N         // Dimensionality of the array
+        , typename Type >  // Data type of the array
+inline void NpyArrayView<N,Type>::flush( bool async ) const
+{
+   file_.flush( async );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructs the custom array on the mapped .npy data.
+//
+// \param file The mapped file.
+// \param offset The offset of the .npy data within the file.
+// \return The array referring to the mapped memory.
+*/
+template< size_t N         // Dimensionality of the array
+        , typename Type >  // Data type of the array
+inline typename NpyArrayView<N,Type>::ArrayType
+   NpyArrayView<N,Type>::makeArray( const MappedFile& file, size_t offset )
+{
+   NpyHeader header;
+   Type* const ptr( npyViewData<Type>( file, offset, header ) );
+
+   return makeArray( ptr, npyArrayDims<N>( header ), std::make_index_sequence<N>() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructs the custom array on the given memory.
+//
+// \param ptr The first element of the array.
+// \param dims The dimensions of the array, starting with the innermost dimension.
+// \return The array referring to the mapped memory.
+*/
+template< size_t N         // Dimensionality of the array
+        , typename Type >  // Data type of the array
+template< size_t... Is >
+inline typename NpyArrayView<N,Type>::ArrayType
+   NpyArrayView<N,Type>::makeArray( Type* ptr, std::array< size_t, N > const& dims,
+                                    std::index_sequence<Is...> )
+{
+   return ArrayType( ptr, dims[N-1UL-Is]... );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,341 @@
+//=================================================================================================
+/*!
+//  \file blaze_tensor/math/dense/ParallelAnyOf.h
+//  \brief Header file for the early-exit element scan kernels of dense tensors and arrays
+//
+//  Copyright (C) 2012-2018 Klaus Iglberger - All Rights Reserved
+//  Copyright (C) 2018 Hartmut Kaiser - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+
+#ifndef _BLAZE_TENSOR_MATH_DENSE_PARALLELANYOF_H_
+#define _BLAZE_TENSOR_MATH_DENSE_PARALLELANYOF_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <array>
+#include <atomic>
+
+#include <blaze/math/shims/Abs.h>
+#include <blaze/math/shims/IsFinite.h>
+#include <blaze/math/smp/Functions.h>
+#include <blaze/math/smp/SerialSection.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/IntegralConstant.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/algorithms/Min.h>
+#include <blaze/util/typetraits/IsComplex.h>
+
+#include <blaze_tensor/math/smp/ParallelFor.h>
+#include <blaze_tensor/system/Thresholds.h>
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the distance between two real values.
+// \ingroup math
+//
+// \param a The first value.
+// \param b The second value.
+// \return The distance \f$ |a-b| \f$.
+//
+// The distance is computed without the subtraction of the larger value from the smaller one,
+// which would wrap around for unsigned types.
+*/
+template< typename T1    // Type of the first value
+        , typename T2 >  // Type of the second value
+inline auto closeDistance( const T1& a, const T2& b, FalseType )
+{
+   return a < b ? b - a : a - b;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the distance between two values, at least one of which is complex.
+// \ingroup math
+//
+// \param a The first value.
+// \param b The second value.
+// \return The distance \f$ |a-b| \f$.
+*/
+template< typename T1    // Type of the first value
+        , typename T2 >  // Type of the second value
+inline auto closeDistance( const T1& a, const T2& b, TrueType )
+{
+   return abs( a - b );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Checks whether two values are close to each other.
+// \ingroup math
+//
+// \param a The first value.
+// \param b The second (reference) value.
+// \param rtol The relative tolerance.
+// \param atol The absolute tolerance.
+// \return \a true if \f$ |a-b| \leq atol + rtol \cdot |b| \f$, \a false if not.
+//
+// The check follows the semantics of NumPy's \c isclose() function: Infinite values are only
+// close to identical infinite values and not-a-number values are never close. Complex values
+// are finite if both their real and imaginary part are finite.
+*/
+template< typename T1    // Type of the first value
+        , typename T2 >  // Type of the second value
+inline bool isClose( const T1& a, const T2& b, double rtol, double atol )
+{
+   using Complex = BoolConstant< IsComplex_v<T1> || IsComplex_v<T2> >;
+
+   return a == b ||
+          ( isfinite( a ) && isfinite( b ) &&
+            closeDistance( a, b, Complex() ) <= atol + rtol * abs( b ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TENSOR KERNELS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Checks the given range of rows of a dense tensor for an element satisfying a predicate.
+// \ingroup dense_tensor
+//
+// \param M The number of rows per page.
+// \param N The number of columns.
+// \param begin The first (page-major) row of the range.
+// \param end The row one past the last row of the range.
+// \param simd The predicate for the \a SIMDSIZE elements starting at \c (k,i,j).
+// \param scalar The predicate for the single element \c (k,i,j).
+// \param found The shared cancellation flag.
+// \return \a true if a predicate is satisfied within the range, \a false if not.
+//
+// The scalar predicate is used for the remaining elements at the end of each row. Before each
+// row the cancellation flag is checked and the scan stops in case a different range already
+// satisfied the predicate. For a non-vectorized scan \a SIMDSIZE is 1 and both predicates are
+// usually identical.
+*/
+template< size_t SIMDSIZE  // Number of elements checked by the SIMD predicate
+        , typename SF      // Type of the SIMD predicate
+        , typename F >     // Type of the scalar predicate
+bool tensorRowsAnyOf( size_t M, size_t N, size_t begin, size_t end,
+                      const SF& simd, const F& scalar, const std::atomic<bool>& found )
+{
+   const size_t jpos( N & size_t(-SIMDSIZE) );
+   BLAZE_INTERNAL_ASSERT( ( N - ( N % SIMDSIZE ) ) == jpos, "Invalid end calculation" );
+
+   for( size_t r=begin; r<end; ++r )
+   {
+      if( found.load( std::memory_order_relaxed ) )
+         return false;
+
+      const size_t k( r / M );
+      const size_t i( r % M );
+
+      size_t j( 0UL );
+
+      for( ; (j+SIMDSIZE*3UL) < jpos; j+=SIMDSIZE*4UL ) {
+         if( simd( k, i, j             ) || simd( k, i, j+SIMDSIZE     ) ||
+             simd( k, i, j+SIMDSIZE*2UL ) || simd( k, i, j+SIMDSIZE*3UL ) )
+            return true;
+      }
+      for( ; j<jpos; j+=SIMDSIZE ) {
+         if( simd( k, i, j ) ) return true;
+      }
+      for( ; SIMDSIZE > 1UL && j<N; ++j ) {
+         if( scalar( k, i, j ) ) return true;
+      }
+   }
+
+   return false;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Checks whether any element of a dense tensor satisfies a predicate.
+// \ingroup dense_tensor
+//
+// \param O The number of pages.
+// \param M The number of rows per page.
+// \param N The number of columns.
+// \param simd The predicate for the \a SIMDSIZE elements starting at \c (k,i,j).
+// \param scalar The predicate for the single element \c (k,i,j).
+// \return \a true if a predicate is satisfied for any element, \a false if not.
+//
+// This function stops at the first element (or SIMD pack) that satisfies the predicate. Large
+// tensors are split into contiguous chunks of rows (across all pages) that are checked in
+// parallel (see blaze::smpAnyOf()). The chunks share a cancellation flag, i.e. all threads stop
+// after the next row as soon as one thread found a match. The predicates are called concurrently
+// and must therefore not modify shared state.
+*/
+template< size_t SIMDSIZE  // Number of elements checked by the SIMD predicate
+        , typename SF      // Type of the SIMD predicate
+        , typename F >     // Type of the scalar predicate
+bool tensorAnyOf( size_t O, size_t M, size_t N, const SF& simd, const F& scalar )
+{
+   const size_t rows( O*M );
+
+   const bool parallel( !isSerialSectionActive() && rows > 1UL &&
+                        rows*N >= smpDTensAssignThreshold() );
+
+   if( !parallel ) {
+      const std::atomic<bool> found( false );
+      return tensorRowsAnyOf<SIMDSIZE>( M, N, 0UL, rows, simd, scalar, found );
+   }
+
+   const size_t chunks( min( rows, getNumThreads()*4UL ) );
+
+   return smpAnyOf( 0UL, chunks, [&]( size_t chunk, const std::atomic<bool>& found ) {
+      return tensorRowsAnyOf<SIMDSIZE>( M, N, ( rows*chunk ) / chunks,
+                                        ( rows*(chunk+1UL) ) / chunks, simd, scalar, found );
+   } );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ARRAY KERNELS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Checks the given range of rows of a dense array for an element satisfying a predicate.
+// \ingroup dense_array
+//
+// \param dims The dimensions of the array.
+// \param begin The first row of the range.
+// \param end The row one past the last row of the range.
+// \param pred The predicate for a single element.
+// \param found The shared cancellation flag.
+// \return \a true if the predicate is satisfied within the range, \a false if not.
+//
+// A row consists of all elements that only differ in the innermost index (\c dims[0]). Before
+// each row the cancellation flag is checked and the scan stops in case a different range already
+// satisfied the predicate.
+*/
+template< size_t N      // Number of dimensions
+        , typename F >  // Type of the predicate
+bool arrayRowsAnyOf( const std::array<size_t,N>& dims, size_t begin, size_t end,
+                     const F& pred, const std::atomic<bool>& found )
+{
+   std::array<size_t,N> index{};
+
+   for( size_t r=begin; r<end; ++r )
+   {
+      if( found.load( std::memory_order_relaxed ) )
+         return false;
+
+      size_t row( r );
+      for( size_t d=1UL; d<N; ++d ) {
+         index[d] = row % dims[d];
+         row /= dims[d];
+      }
+
+      for( index[0]=0UL; index[0]<dims[0]; ++index[0] ) {
+         if( pred( index ) ) return true;
+      }
+   }
+
+   return false;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Checks whether any element of a dense array satisfies a predicate.
+// \ingroup dense_array
+//
+// \param dims The dimensions of the array.
+// \param pred The predicate for a single element.
+// \return \a true if the predicate is satisfied for any element, \a false if not.
+//
+// This function stops at the first element that satisfies the predicate. Large arrays are split
+// into contiguous chunks of rows that are checked in parallel and that share a cancellation flag
+// (see blaze::tensorAnyOf()).
+*/
+template< size_t N      // Number of dimensions
+        , typename F >  // Type of the predicate
+bool arrayAnyOf( const std::array<size_t,N>& dims, const F& pred )
+{
+   size_t rows( 1UL );
+   for( size_t d=1UL; d<N; ++d ) {
+      rows *= dims[d];
+   }
+
+   const bool parallel( !isSerialSectionActive() && rows > 1UL &&
+                        rows*dims[0] >= smpDArrAssignThreshold() );
+
+   if( !parallel || dims[0] == 0UL ) {
+      const std::atomic<bool> found( false );
+      return arrayRowsAnyOf( dims, 0UL, rows, pred, found );
+   }
+
+   const size_t chunks( min( rows, getNumThreads()*4UL ) );
+
+   return smpAnyOf( 0UL, chunks, [&]( size_t chunk, const std::atomic<bool>& found ) {
+      return arrayRowsAnyOf( dims, ( rows*chunk ) / chunks, ( rows*(chunk+1UL) ) / chunks,
+                             pred, found );
+   } );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,643 @@
+//=================================================================================================
+/*!
+//  \file blaze_tensor/math/dense/ParallelRandom.h
+//  \brief Header file for the counter-based random initialization of dense tensors and arrays
+//
+//  Copyright (C) 2012-2018 Klaus Iglberger - All Rights Reserved
+//  Copyright (C) 2018 Hartmut Kaiser - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+
+#ifndef _BLAZE_TENSOR_MATH_DENSE_PARALLELRANDOM_H_
+#define _BLAZE_TENSOR_MATH_DENSE_PARALLELRANDOM_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <random>
+#include <type_traits>
+
+#include <blaze/math/Aliases.h>
+#include <blaze/math/smp/Functions.h>
+#include <blaze/math/smp/SerialSection.h>
+#include <blaze/math/typetraits/HasMutableDataAccess.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/FunctionTrace.h>
+#include <blaze/util/MaybeUnused.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/algorithms/Min.h>
+
+#include <blaze_tensor/math/expressions/DenseArray.h>
+#include <blaze_tensor/math/expressions/DenseTensor.h>
+#include <blaze_tensor/math/smp/ParallelFor.h>
+#include <blaze_tensor/system/Thresholds.h>
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  PHILOX COUNTER-BASED GENERATOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Number of Philox blocks generated at once by the counter-based random kernels.
+// \ingroup dense_tensor
+*/
+constexpr size_t philoxBatchSize = 16UL;
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Applies the Philox4x32-10 bijection to a batch of counters.
+// \ingroup dense_tensor
+//
+// \param c The four words of the counters, one array of blaze::philoxBatchSize values per word.
+// \param seed The key of the generator.
+// \return void
+//
+// This function replaces each of the counters by its Philox4x32-10 random block (see Salmon
+// et al., "Parallel Random Numbers: As Easy as 1, 2, 3", SC'11). The counters are stored as a
+// structure of arrays, such that the rounds of all counters of the batch are computed in the
+// same loop and can be vectorized by the compiler.
+*/
+inline void philox4x32( std::array<std::array<uint32_t,philoxBatchSize>,4UL>& c, uint64_t seed )
+{
+   constexpr uint64_t M0( 0xD2511F53UL );
+   constexpr uint64_t M1( 0xCD9E8D57UL );
+   constexpr uint32_t W0( 0x9E3779B9U );
+   constexpr uint32_t W1( 0xBB67AE85U );
+
+   uint32_t k0( static_cast<uint32_t>( seed ) );
+   uint32_t k1( static_cast<uint32_t>( seed >> 32 ) );
+
+   for( size_t round=0UL; round<10UL; ++round )
+   {
+      for( size_t l=0UL; l<philoxBatchSize; ++l )
+      {
+         const uint64_t p0( M0 * c[0UL][l] );
+         const uint64_t p1( M1 * c[2UL][l] );
+
+         const uint32_t c1( c[1UL][l] );
+         const uint32_t c3( c[3UL][l] );
+
+         c[0UL][l] = static_cast<uint32_t>( p1 >> 32 ) ^ c1 ^ k0;
+         c[1UL][l] = static_cast<uint32_t>( p1 );
+         c[2UL][l] = static_cast<uint32_t>( p0 >> 32 ) ^ c3 ^ k1;
+         c[3UL][l] = static_cast<uint32_t>( p0 );
+      }
+
+      k0 += W0;
+      k1 += W1;
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Converts a 32-bit random word into a single precision value in the range \f$ [0..1) \f$.
+// \ingroup dense_tensor
+*/
+inline float philoxUnit( uint32_t u ) noexcept
+{
+   return float( u >> 8 ) * ( 1.0F / 16777216.0F );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Converts two 32-bit random words into a double precision value in the range
+//        \f$ [0..1) \f$.
+// \ingroup dense_tensor
+*/
+inline double philoxUnit( uint32_t hi, uint32_t lo ) noexcept
+{
+   return double( ( ( uint64_t( hi ) << 32 ) | lo ) >> 11 ) * ( 1.0 / 9007199254740992.0 );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DISTRIBUTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Conversion of Philox blocks into the variates of a given distribution.
+// \ingroup dense_tensor
+//
+// The specializations of this class template determine how many variates are extracted from
+// each Philox block (\a size) and convert a batch of Philox blocks into variates (\a convert).
+// Only the parameters of the given distribution object are used, never its internal state.
+*/
+template< typename Dist >  // Type of the distribution
+struct PhiloxDistribution
+{
+   static constexpr bool value = false;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Specialization of PhiloxDistribution for uniform real distributions.
+// \ingroup dense_tensor
+*/
+template< typename T >  // Type of the variates
+struct PhiloxDistribution< std::uniform_real_distribution<T> >
+{
+   static constexpr bool value = true;
+   static constexpr bool wide = ( sizeof( T ) > sizeof( float ) );
+   static constexpr size_t size = ( wide ? 2UL : 4UL );
+
+   template< typename Blocks >  // Type of the Philox blocks
+   static void convert( const std::uniform_real_distribution<T>& dist, const Blocks& c, T* out )
+   {
+      const T a( dist.a() );
+      const T d( dist.b() - dist.a() );
+
+      for( size_t l=0UL; l<philoxBatchSize; ++l ) {
+         if( wide ) {
+            out[2UL*l    ] = a + d * T( philoxUnit( c[0UL][l], c[1UL][l] ) );
+            out[2UL*l+1UL] = a + d * T( philoxUnit( c[2UL][l], c[3UL][l] ) );
+         }
+         else {
+            out[4UL*l    ] = a + d * T( philoxUnit( c[0UL][l] ) );
+            out[4UL*l+1UL] = a + d * T( philoxUnit( c[1UL][l] ) );
+            out[4UL*l+2UL] = a + d * T( philoxUnit( c[2UL][l] ) );
+            out[4UL*l+3UL] = a + d * T( philoxUnit( c[3UL][l] ) );
+         }
+      }
+   }
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Specialization of PhiloxDistribution for normal distributions.
+// \ingroup dense_tensor
+//
+// The variates are generated pairwise by the Box-Muller transform.
+*/
+template< typename T >  // Type of the variates
+struct PhiloxDistribution< std::normal_distribution<T> >
+{
+   static constexpr bool value = true;
+   static constexpr bool wide = ( sizeof( T ) > sizeof( float ) );
+   static constexpr size_t size = ( wide ? 2UL : 4UL );
+
+   template< typename U >  // Type of the uniform variates
+   static inline void boxMuller( U u1, U u2, T mean, T stddev, T* out )
+   {
+      using std::cos;
+      using std::log;
+      using std::sin;
+      using std::sqrt;
+
+      constexpr U twoPi( U( 6.283185307179586476925286766559 ) );
+
+      const U radius( sqrt( U(-2) * log( U(1) - u1 ) ) );
+
+      out[0UL] = mean + stddev * T( radius * cos( twoPi * u2 ) );
+      out[1UL] = mean + stddev * T( radius * sin( twoPi * u2 ) );
+   }
+
+   template< typename Blocks >  // Type of the Philox blocks
+   static void convert( const std::normal_distribution<T>& dist, const Blocks& c, T* out )
+   {
+      const T mean  ( dist.mean()   );
+      const T stddev( dist.stddev() );
+
+      for( size_t l=0UL; l<philoxBatchSize; ++l ) {
+         if( wide ) {
+            boxMuller( philoxUnit( c[0UL][l], c[1UL][l] ), philoxUnit( c[2UL][l], c[3UL][l] ),
+                       mean, stddev, out + 2UL*l );
+         }
+         else {
+            boxMuller( philoxUnit( c[0UL][l] ), philoxUnit( c[1UL][l] ),
+                       mean, stddev, out + 4UL*l );
+            boxMuller( philoxUnit( c[2UL][l] ), philoxUnit( c[3UL][l] ),
+                       mean, stddev, out + 4UL*l + 2UL );
+         }
+      }
+   }
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Specialization of PhiloxDistribution for uniform integer distributions.
+// \ingroup dense_tensor
+*/
+template< typename T >  // Type of the variates
+struct PhiloxDistribution< std::uniform_int_distribution<T> >
+{
+   static constexpr bool value = true;
+   static constexpr size_t size = 2UL;
+
+   template< typename Blocks >  // Type of the Philox blocks
+   static void convert( const std::uniform_int_distribution<T>& dist, const Blocks& c, T* out )
+   {
+      using UT = std::make_unsigned_t<T>;
+
+      const uint64_t range( uint64_t( UT( dist.b() ) - UT( dist.a() ) ) + 1UL );
+
+      auto variate = [&]( uint32_t hi, uint32_t lo ) {
+         const uint64_t u( ( uint64_t( hi ) << 32 ) | lo );
+         return T( UT( dist.a() ) + UT( range == 0UL ? u : u % range ) );
+      };
+
+      for( size_t l=0UL; l<philoxBatchSize; ++l ) {
+         out[2UL*l    ] = variate( c[0UL][l], c[1UL][l] );
+         out[2UL*l+1UL] = variate( c[2UL][l], c[3UL][l] );
+      }
+   }
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  KERNELS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Fills a single row with counter-based random variates.
+// \ingroup dense_tensor
+//
+// \param dist The distribution of the variates.
+// \param seed The seed of the generator.
+// \param row The (logical) index of the row.
+// \param n The number of elements of the row.
+// \param out The elements of the row (pointer or row proxy).
+// \return void
+//
+// The \a j-th element of the row is taken from the Philox block with counter
+// \f$ ( j / size, row ) \f$, where \a size is the number of variates per block. Therefore every
+// element only depends on the seed and on its position, but not on the partitioning of the rows.
+*/
+template< typename Dist   // Type of the distribution
+        , typename Out >  // Type of the row elements
+void philoxRow( const Dist& dist, uint64_t seed, uint64_t row, size_t n, Out&& out )
+{
+   using PD = PhiloxDistribution<Dist>;
+   using RT = typename Dist::result_type;
+
+   constexpr size_t values( philoxBatchSize * PD::size );
+
+   std::array<std::array<uint32_t,philoxBatchSize>,4UL> c;
+   std::array<RT,values> buffer;
+
+   for( size_t jbegin=0UL; jbegin<n; jbegin+=values )
+   {
+      const uint64_t block( jbegin / PD::size );
+
+      for( size_t l=0UL; l<philoxBatchSize; ++l ) {
+         c[0UL][l] = static_cast<uint32_t>( block + l );
+         c[1UL][l] = static_cast<uint32_t>( ( block + l ) >> 32 );
+         c[2UL][l] = static_cast<uint32_t>( row );
+         c[3UL][l] = static_cast<uint32_t>( row >> 32 );
+      }
+
+      philox4x32( c, seed );
+      PD::convert( dist, c, buffer.data() );
+
+      const size_t jend( min( jbegin + values, n ) );
+      for( size_t j=jbegin; j<jend; ++j ) {
+         out[j] = buffer[j-jbegin];
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Proxy for the element access to a single row of a dense tensor without data access.
+// \ingroup dense_tensor
+*/
+template< typename TT >  // Type of the dense tensor
+struct PhiloxTensorRow
+{
+   inline decltype(auto) operator[]( size_t j ) const { return tensor( k, i, j ); }
+
+   TT& tensor;  //!< The dense tensor.
+   size_t k;    //!< The page index of the row.
+   size_t i;    //!< The row index of the row.
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the row \a i of page \a k of a dense tensor with mutable data access.
+// \ingroup dense_tensor
+*/
+template< typename TT >  // Type of the dense tensor
+inline auto philoxTensorRow( TT& tensor, size_t k, size_t i )
+   -> EnableIf_t< HasMutableDataAccess_v<TT>, ElementType_t<TT>* >
+{
+   return tensor.data( i, k );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the row \a i of page \a k of a dense tensor without mutable data access.
+// \ingroup dense_tensor
+*/
+template< typename TT >  // Type of the dense tensor
+inline auto philoxTensorRow( TT& tensor, size_t k, size_t i )
+   -> EnableIf_t< !HasMutableDataAccess_v<TT>, PhiloxTensorRow<TT> >
+{
+   return PhiloxTensorRow<TT>{ tensor, k, i };
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Proxy for the element access to a single row of a dense array without data access.
+// \ingroup dense_array
+*/
+template< typename AT >  // Type of the dense array
+struct PhiloxArrayRow
+{
+   inline decltype(auto) operator[]( size_t j ) {
+      index[0UL] = j;
+      return array( index );
+   }
+
+   AT& array;                                     //!< The dense array.
+   std::array<size_t,AT::num_dimensions> index;  //!< The index of the current element.
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the row \a r of a dense array with mutable data access.
+// \ingroup dense_array
+//
+// The rows along the innermost dimension are stored consecutively, each one padded to the
+// spacing of the array.
+*/
+template< typename AT >  // Type of the dense array
+inline auto philoxArrayRow( AT& array, const std::array<size_t,AT::num_dimensions>& dims, size_t r )
+   -> EnableIf_t< HasMutableDataAccess_v<AT>, ElementType_t<AT>* >
+{
+   MAYBE_UNUSED( dims );
+
+   return array.data() + r*array.spacing();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the row \a r of a dense array without mutable data access.
+// \ingroup dense_array
+*/
+template< typename AT >  // Type of the dense array
+inline auto philoxArrayRow( AT& array, const std::array<size_t,AT::num_dimensions>& dims, size_t r )
+   -> EnableIf_t< !HasMutableDataAccess_v<AT>, PhiloxArrayRow<AT> >
+{
+   PhiloxArrayRow<AT> row{ array, {} };
+
+   for( size_t d=1UL; d<AT::num_dimensions; ++d ) {
+      row.index[d] = r % dims[d];
+      r /= dims[d];
+   }
+
+   return row;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Distributes the rows of a random fill over the available threads.
+// \ingroup dense_tensor
+//
+// \param rows The total number of rows.
+// \param size The total number of elements.
+// \param f The kernel for a single row.
+// \return void
+*/
+template< typename F >  // Type of the row kernel
+void philoxFor( size_t rows, size_t size, F&& f )
+{
+   const bool parallel( !isSerialSectionActive() && rows > 1UL &&
+                        size >= smpDTensAssignThreshold() );
+
+   if( !parallel ) {
+      for( size_t r=0UL; r<rows; ++r ) f( r );
+      return;
+   }
+
+   const size_t chunks( min( rows, getNumThreads()*4UL ) );
+
+   smpFor( 0UL, chunks, [&]( size_t chunk ) {
+      const size_t end( ( rows*(chunk+1UL) ) / chunks );
+      for( size_t r=( rows*chunk ) / chunks; r<end; ++r ) f( r );
+   } );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Randomizes all elements of the given dense tensor by a counter-based generator.
+// \ingroup dense_tensor
+//
+// \param tensor The dense tensor to be randomized.
+// \param dist The distribution of the random values.
+// \param seed The seed of the random number generator.
+// \return void
+//
+// This function fills the given dense tensor (or tensor view) with random values of the given
+// distribution. Supported are \c std::uniform_real_distribution, \c std::normal_distribution
+// and \c std::uniform_int_distribution; only the parameters of \a dist are used. In contrast to
+// the element-wise randomize() functions, the values are drawn from the Philox4x32-10 counter-
+// based generator, which allows to generate the rows in parallel and in batches. Each element
+// only depends on the seed and its position (page, row, column), i.e. the result is identical
+// for any number of threads:
+
+   \code
+   blaze::DynamicTensor<float> A( 64UL, 128UL, 128UL );
+
+   blaze::randomize( A, std::normal_distribution<float>( 0.0F, 1.0F ), 42UL );
+   blaze::randomize( subtensor( A, 0UL, 0UL, 0UL, 8UL, 128UL, 128UL ),
+                     std::uniform_real_distribution<float>( -1.0F, 1.0F ), 7UL );
+   \endcode
+
+// The values of tensors with low-level data access are directly written into the rows of the
+// tensor; padding elements are not touched.
+*/
+template< typename TT      // Type of the dense tensor
+        , typename Dist >  // Type of the distribution
+auto randomize( DenseTensor<TT>& tensor, const Dist& dist, uint64_t seed )
+   -> EnableIf_t< PhiloxDistribution<Dist>::value >
+{
+   BLAZE_FUNCTION_TRACE;
+
+   const size_t M( (*tensor).rows()    );
+   const size_t N( (*tensor).columns() );
+   const size_t rows( (*tensor).pages() * M );
+
+   philoxFor( rows, rows*N, [&]( size_t r ) {
+      philoxRow( dist, seed, r, N, philoxTensorRow( *tensor, r / M, r % M ) );
+   } );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Randomizes all elements of the given temporary dense tensor view by a counter-based
+//        generator.
+// \ingroup dense_tensor
+//
+// \param tensor The temporary dense tensor view to be randomized.
+// \param dist The distribution of the random values.
+// \param seed The seed of the random number generator.
+// \return void
+//
+// This function fills the given dense tensor view with random values of the given distribution
+// (see the randomize() function for lvalue dense tensors for details).
+*/
+template< typename TT      // Type of the dense tensor
+        , typename Dist >  // Type of the distribution
+inline auto randomize( DenseTensor<TT>&& tensor, const Dist& dist, uint64_t seed )
+   -> EnableIf_t< PhiloxDistribution<Dist>::value >
+{
+   randomize( *tensor, dist, seed );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Randomizes all elements of the given dense array by a counter-based generator.
+// \ingroup dense_array
+//
+// \param array The dense array to be randomized.
+// \param dist The distribution of the random values.
+// \param seed The seed of the random number generator.
+// \return void
+//
+// This function fills the given dense array with random values of the given distribution (see
+// the randomize() function for dense tensors for details). The rows along the innermost
+// dimension are generated in parallel; each element only depends on the seed and its index.
+// The values of arrays with low-level data access are directly written into the rows of the
+// array; padding elements are not touched.
+*/
+template< typename AT      // Type of the dense array
+        , typename Dist >  // Type of the distribution
+auto randomize( DenseArray<AT>& array, const Dist& dist, uint64_t seed )
+   -> EnableIf_t< PhiloxDistribution<Dist>::value >
+{
+   BLAZE_FUNCTION_TRACE;
+
+   constexpr size_t N( AT::num_dimensions );
+
+   const std::array<size_t,N> dims( (*array).dimensions() );
+
+   size_t rows( 1UL );
+   for( size_t d=1UL; d<N; ++d ) {
+      rows *= dims[d];
+   }
+
+   philoxFor( rows, rows*dims[0UL], [&]( size_t r ) {
+      philoxRow( dist, seed, r, dims[0UL], philoxArrayRow( *array, dims, r ) );
+   } );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Randomizes all elements of the given temporary dense array by a counter-based generator.
+// \ingroup dense_array
+//
+// \param array The temporary dense array to be randomized.
+// \param dist The distribution of the random values.
+// \param seed The seed of the random number generator.
+// \return void
+*/
+template< typename AT      // Type of the dense array
+        , typename Dist >  // Type of the distribution
+inline auto randomize( DenseArray<AT>&& array, const Dist& dist, uint64_t seed )
+   -> EnableIf_t< PhiloxDistribution<Dist>::value >
+{
+   randomize( *array, dist, seed );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,793 @@
+//=================================================================================================
+/*!
+//  \file blaze_tensor/math/dense/QuantizedTensor.h
+//  \brief Header file for the implementation of the QuantizedTensor class template
+//
+//  Copyright (C) 2012-2018 Klaus Iglberger - All Rights Reserved
+//  Copyright (C) 2018 Hartmut Kaiser - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+
+#ifndef _BLAZE_TENSOR_MATH_DENSE_QUANTIZEDTENSOR_H_
+#define _BLAZE_TENSOR_MATH_DENSE_QUANTIZEDTENSOR_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+#include <blaze/math/Aliases.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/dense/DynamicVector.h>
+#include <blaze/math/smp/SerialSection.h>
+#include <blaze/system/Vectorization.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/FunctionTrace.h>
+#include <blaze/util/StaticAssert.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsSame.h>
+
+#include <blaze_tensor/math/dense/DynamicTensor.h>
+#include <blaze_tensor/math/dense/HalfPrecision.h>
+#include <blaze_tensor/math/expressions/DenseTensor.h>
+#include <blaze_tensor/math/smp/ParallelFor.h>
+#include <blaze_tensor/system/Thresholds.h>
+
+#if BLAZE_AVX2_MODE || BLAZE_AVX512BW_MODE
+#  include <immintrin.h>
+#endif
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  QUANTIZATION GRANULARITY
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Granularity of the scale and zero point of a quantized tensor.
+// \ingroup dense_tensor
+*/
+enum QuantizationGranularity : int
+{
+   quantizePerPage = 0,  //!< One scale and zero point for every page.
+   quantizePerRow  = 1   //!< One scale and zero point for every row of every page.
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Affine int8 quantization of a single precision tensor.
+// \ingroup dense_tensor
+//
+// The QuantizedTensor class template stores a tensor as 8-bit integers together with a scale
+// \f$ s \f$ and a zero point \f$ z \f$ per page or per row (see QuantizationGranularity). An
+// element \f$ q \f$ represents the real value \f$ s \cdot (q - z) \f$. The quantization maps
+// the range of every page or row onto \f$ [-128..127] \f$ (asymmetric) or onto \f$ [-127..127] \f$
+// with a zero point of zero (symmetric), rounding to nearest even. The real value zero is always
+// represented exactly.
+
+   \code
+   blaze::DynamicTensor<float> X( 32UL, 64UL, 256UL );   // Activations
+   blaze::DynamicTensor<float> W( 1UL, 128UL, 256UL );   // Weights, one row per output
+   // ... Initialization
+
+   blaze::QuantizedTensor<int8_t> qX( X );                                 // Per page
+   blaze::QuantizedTensor<int8_t> qW( W, blaze::quantizePerRow, true );    // Symmetric, per row
+
+   blaze::DynamicTensor<float> Y;
+   multTrans( Y, qX, qW );       // Y(k) = X(k) * trans( W(0) ), 32x64x128
+
+   blaze::DynamicTensor<float> R( dequantize( qX ) );  // Approximation of X
+   \endcode
+
+// Compared to single precision the int8 values need a quarter of the memory and memory bandwidth.
+// The page-wise product multTrans() computes exact int32 dot products with AVX-512 VNNI, AVX-512
+// or AVX2 instructions and applies the scales and zero points afterwards.
+*/
+template< typename Type = int8_t >  // Data type of the quantized values
+class QuantizedTensor
+{
+ public:
+   //**Type definitions****************************************************************************
+   using ElementType = Type;                  //!< Type of the quantized values.
+   using StorageType = DynamicTensor<Type>;   //!< Type of the storage of the quantized values.
+   //**********************************************************************************************
+
+   //**Compilation flags***************************************************************************
+   BLAZE_STATIC_ASSERT_MSG( ( IsSame_v<Type,int8_t> ), "Only int8_t quantization is supported" );
+   //**********************************************************************************************
+
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   inline QuantizedTensor();
+
+   template< typename TT >
+   explicit inline QuantizedTensor( const DenseTensor<TT>& tens,
+                                    QuantizationGranularity granularity = quantizePerPage,
+                                    bool symmetric = false );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   template< typename TT >
+   inline void quantize( const DenseTensor<TT>& tens,
+                         QuantizationGranularity granularity = quantizePerPage,
+                         bool symmetric = false );
+
+   template< typename TT >
+   inline void dequantize( DenseTensor<TT>& tens ) const;
+
+   inline size_t                         pages() const noexcept;
+   inline size_t                         rows() const noexcept;
+   inline size_t                         columns() const noexcept;
+   inline QuantizationGranularity        granularity() const noexcept;
+   inline float                          scale( size_t k, size_t i ) const noexcept;
+   inline int32_t                        zeroPoint( size_t k, size_t i ) const noexcept;
+   inline const StorageType&             values() const noexcept;
+   inline const DynamicVector<float>&    scales() const noexcept;
+   inline const DynamicVector<int32_t>&  zeroPoints() const noexcept;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t group( size_t k, size_t i ) const noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   StorageType             values_;       //!< The quantized values.
+   DynamicVector<float>    scales_;       //!< The scales of all pages or rows.
+   DynamicVector<int32_t>  zeroPoints_;   //!< The zero points of all pages or rows.
+   QuantizationGranularity granularity_;  //!< The granularity of the scales and zero points.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The default constructor for QuantizedTensor.
+*/
+template< typename Type >  // Data type of the quantized values
+inline QuantizedTensor<Type>::QuantizedTensor()
+   : values_     ()                   // The quantized values
+   , scales_     ()                   // The scales of all pages or rows
+   , zeroPoints_ ()                   // The zero points of all pages or rows
+   , granularity_( quantizePerPage )  // The granularity of the scales and zero points
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for the quantization of the given dense tensor.
+//
+// \param tens The tensor to be quantized.
+// \param granularity The granularity of the scales and zero points.
+// \param symmetric \a true for a symmetric quantization with zero points of zero.
+*/
+template< typename Type >  // Data type of the quantized values
+template< typename TT >    // Type of the tensor
+inline QuantizedTensor<Type>::QuantizedTensor( const DenseTensor<TT>& tens,
+                                               QuantizationGranularity granularity,
+                                               bool symmetric )
+   : QuantizedTensor()
+{
+   quantize( tens, granularity, symmetric );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Quantizes the given dense tensor.
+//
+// \param tens The tensor to be quantized.
+// \param granularity The granularity of the scales and zero points.
+// \param symmetric \a true for a symmetric quantization with zero points of zero.
+// \return void
+//
+// The range of every page or row, extended to contain zero, is mapped onto \f$ [-128..127] \f$
+// (asymmetric) or the largest absolute value onto 127 (symmetric). Large tensors are quantized
+// in parallel.
+*/
+template< typename Type >  // Data type of the quantized values
+template< typename TT >    // Type of the tensor
+inline void QuantizedTensor<Type>::quantize( const DenseTensor<TT>& tens,
+                                             QuantizationGranularity granularity,
+                                             bool symmetric )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   CompositeType_t<TT> A( *tens );  // Evaluation of the tensor
+
+   const size_t o( A.pages() );
+   const size_t m( A.rows() );
+   const size_t n( A.columns() );
+   const size_t groups( granularity == quantizePerRow ? o*m : o );
+
+   values_.resize( o, m, n, false );
+   scales_.resize( groups, false );
+   zeroPoints_.resize( groups, false );
+   granularity_ = granularity;
+
+   const bool parallel( !isSerialSectionActive() && o*m*n >= smpDTensAssignThreshold() );
+
+   // Range of all rows
+   std::vector<float> lower( o*m ), upper( o*m );
+
+   auto range = [&]( size_t r ) {
+      const size_t k( r / m ), i( r % m );
+      float lo( 0.0F ), hi( 0.0F );
+      for( size_t j=0UL; j<n; ++j ) {
+         const float x( static_cast<float>( A(k,i,j) ) );
+         lo = std::min( lo, x );
+         hi = std::max( hi, x );
+      }
+      lower[r] = lo;
+      upper[r] = hi;
+   };
+
+   if( parallel ) smpFor( 0UL, o*m, range );
+   else serialFor( 0UL, o*m, range );
+
+   // Scale and zero point of all groups
+   const size_t span( granularity == quantizePerRow ? 1UL : m );
+
+   for( size_t g=0UL; g<groups; ++g )
+   {
+      const float lo( *std::min_element( lower.begin()+g*span, lower.begin()+(g+1UL)*span ) );
+      const float hi( *std::max_element( upper.begin()+g*span, upper.begin()+(g+1UL)*span ) );
+
+      float s( symmetric ? std::max( -lo, hi ) / 127.0F : ( hi - lo ) / 255.0F );
+      if( !( s > 0.0F ) || !std::isfinite( s ) ) s = 1.0F;
+
+      scales_[g] = s;
+      zeroPoints_[g] = symmetric ? 0
+                                 : static_cast<int32_t>( std::min( 127.0F, std::max( -128.0F, std::nearbyint( -128.0F - lo / s ) ) ) );
+   }
+
+   // Quantization of all rows
+   const float qmin( symmetric ? -127.0F : -128.0F );
+
+   auto quant = [&]( size_t r ) {
+      const size_t k( r / m ), i( r % m );
+      const size_t g( granularity == quantizePerRow ? r : k );
+      const float inv( 1.0F / scales_[g] );
+      const float z( static_cast<float>( zeroPoints_[g] ) );
+      Type* q( values_.data( i, k ) );
+      for( size_t j=0UL; j<n; ++j ) {
+         const float x( std::nearbyint( static_cast<float>( A(k,i,j) ) * inv ) + z );
+         q[j] = static_cast<Type>( std::min( 127.0F, std::max( qmin, x ) ) );
+      }
+   };
+
+   if( parallel ) smpFor( 0UL, o*m, quant );
+   else serialFor( 0UL, o*m, quant );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Dequantizes the tensor into the given dense tensor.
+//
+// \param tens The target tensor.
+// \return void
+// \exception std::invalid_argument Tensor sizes do not match.
+//
+// Resizable targets are resized, other targets must have the size of the quantized tensor.
+*/
+template< typename Type >  // Data type of the quantized values
+template< typename TT >    // Type of the target tensor
+inline void QuantizedTensor<Type>::dequantize( DenseTensor<TT>& tens ) const
+{
+   BLAZE_FUNCTION_TRACE;
+
+   const size_t o( pages() );
+   const size_t m( rows() );
+   const size_t n( columns() );
+
+   prepareConversion( *tens, o, m, n );
+
+   auto row = [&]( size_t r ) {
+      const size_t k( r / m ), i( r % m );
+      const float s( scale( k, i ) );
+      const int32_t z( zeroPoint( k, i ) );
+      const Type* q( values_.data( i, k ) );
+      for( size_t j=0UL; j<n; ++j ) {
+         (*tens)(k,i,j) = s * static_cast<float>( static_cast<int32_t>( q[j] ) - z );
+      }
+   };
+
+   if( !isSerialSectionActive() && o*m*n >= smpDTensAssignThreshold() ) {
+      smpFor( 0UL, o*m, row );
+   }
+   else {
+      serialFor( 0UL, o*m, row );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the current number of pages of the tensor.
+//
+// \return The number of pages of the tensor.
+*/
+template< typename Type >  // Data type of the quantized values
+inline size_t QuantizedTensor<Type>::pages() const noexcept
+{
+   return values_.pages();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the current number of rows of the tensor.
+//
+// \return The number of rows of the tensor.
+*/
+template< typename Type >  // Data type of the quantized values
+inline size_t QuantizedTensor<Type>::rows() const noexcept
+{
+   return values_.rows();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the current number of columns of the tensor.
+//
+// \return The number of columns of the tensor.
+*/
+template< typename Type >  // Data type of the quantized values
+inline size_t QuantizedTensor<Type>::columns() const noexcept
+{
+   return values_.columns();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the granularity of the scales and zero points.
+//
+// \return The granularity of the scales and zero points.
+*/
+template< typename Type >  // Data type of the quantized values
+inline QuantizationGranularity QuantizedTensor<Type>::granularity() const noexcept
+{
+   return granularity_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the scale of the given row.
+//
+// \param k The page index.
+// \param i The row index.
+// \return The scale of row \a i of page \a k.
+*/
+template< typename Type >  // Data type of the quantized values
+inline float QuantizedTensor<Type>::scale( size_t k, size_t i ) const noexcept
+{
+   return scales_[group( k, i )];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the zero point of the given row.
+//
+// \param k The page index.
+// \param i The row index.
+// \return The zero point of row \a i of page \a k.
+*/
+template< typename Type >  // Data type of the quantized values
+inline int32_t QuantizedTensor<Type>::zeroPoint( size_t k, size_t i ) const noexcept
+{
+   return zeroPoints_[group( k, i )];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the quantized values.
+//
+// \return Reference to the tensor of quantized values.
+*/
+template< typename Type >  // Data type of the quantized values
+inline const typename QuantizedTensor<Type>::StorageType&
+   QuantizedTensor<Type>::values() const noexcept
+{
+   return values_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the scales of all pages (per page) or all rows (per row).
+//
+// \return Reference to the vector of scales.
+*/
+template< typename Type >  // Data type of the quantized values
+inline const DynamicVector<float>& QuantizedTensor<Type>::scales() const noexcept
+{
+   return scales_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the zero points of all pages (per page) or all rows (per row).
+//
+// \return Reference to the vector of zero points.
+*/
+template< typename Type >  // Data type of the quantized values
+inline const DynamicVector<int32_t>& QuantizedTensor<Type>::zeroPoints() const noexcept
+{
+   return zeroPoints_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the index of the scale and zero point of the given row.
+//
+// \param k The page index.
+// \param i The row index.
+// \return The index of the scale and zero point.
+*/
+template< typename Type >  // Data type of the quantized values
+inline size_t QuantizedTensor<Type>::group( size_t k, size_t i ) const noexcept
+{
+   BLAZE_USER_ASSERT( k < pages() && i < rows(), "Invalid row access index" );
+
+   return ( granularity_ == quantizePerRow ? k*rows()+i : k );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  INT8 DOT PRODUCT KERNELS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Computes the int32 dot products of one int8 row with four other int8 rows.
+// \ingroup dense_tensor
+//
+// \param a The row of the left-hand side operand.
+// \param b The four rows of the right-hand side operand.
+// \param bsum The sums of the four rows of the right-hand side operand.
+// \param n The length of the rows.
+// \param res The four dot products.
+// \return void
+//
+// With AVX-512 VNNI the left-hand side row is biased to unsigned by adding 128 (vpdpbusd), which
+// is compensated with the row sums of the right-hand side. Otherwise the values are widened to
+// 16 bits (vpmaddwd). All products are exact, the accumulation does not saturate.
+*/
+inline void qdot4( const int8_t* a, const int8_t* const* b, const int32_t* bsum,
+                   size_t n, int32_t* res ) noexcept
+{
+#if BLAZE_AVX512BW_MODE && defined(__AVX512VNNI__)
+   const __m512i bias( _mm512_set1_epi8( -128 ) );
+   __m512i xmm0( _mm512_setzero_si512() ), xmm1( xmm0 ), xmm2( xmm0 ), xmm3( xmm0 );
+
+   for( size_t j=0UL; j<n; j+=64UL ) {
+      const __mmask64 mask( n-j >= 64UL ? ~__mmask64( 0 ) : ( __mmask64( 1 ) << ( n-j ) ) - 1UL );
+      const __m512i va( _mm512_xor_si512( _mm512_maskz_loadu_epi8( mask, a+j ), bias ) );
+      xmm0 = _mm512_dpbusd_epi32( xmm0, va, _mm512_maskz_loadu_epi8( mask, b[0]+j ) );
+      xmm1 = _mm512_dpbusd_epi32( xmm1, va, _mm512_maskz_loadu_epi8( mask, b[1]+j ) );
+      xmm2 = _mm512_dpbusd_epi32( xmm2, va, _mm512_maskz_loadu_epi8( mask, b[2]+j ) );
+      xmm3 = _mm512_dpbusd_epi32( xmm3, va, _mm512_maskz_loadu_epi8( mask, b[3]+j ) );
+   }
+
+   res[0] = _mm512_reduce_add_epi32( xmm0 ) - 128*bsum[0];
+   res[1] = _mm512_reduce_add_epi32( xmm1 ) - 128*bsum[1];
+   res[2] = _mm512_reduce_add_epi32( xmm2 ) - 128*bsum[2];
+   res[3] = _mm512_reduce_add_epi32( xmm3 ) - 128*bsum[3];
+#else
+   static_cast<void>( bsum );
+
+   size_t j( 0UL );
+   int32_t s0( 0 ), s1( 0 ), s2( 0 ), s3( 0 );
+
+#  if BLAZE_AVX512BW_MODE
+   __m512i xmm0( _mm512_setzero_si512() ), xmm1( xmm0 ), xmm2( xmm0 ), xmm3( xmm0 );
+
+   for( ; j+32UL<=n; j+=32UL ) {
+      const __m512i va( _mm512_cvtepi8_epi16( _mm256_loadu_si256( reinterpret_cast<const __m256i*>( a+j ) ) ) );
+      xmm0 = _mm512_add_epi32( xmm0, _mm512_madd_epi16( va, _mm512_cvtepi8_epi16( _mm256_loadu_si256( reinterpret_cast<const __m256i*>( b[0]+j ) ) ) ) );
+      xmm1 = _mm512_add_epi32( xmm1, _mm512_madd_epi16( va, _mm512_cvtepi8_epi16( _mm256_loadu_si256( reinterpret_cast<const __m256i*>( b[1]+j ) ) ) ) );
+      xmm2 = _mm512_add_epi32( xmm2, _mm512_madd_epi16( va, _mm512_cvtepi8_epi16( _mm256_loadu_si256( reinterpret_cast<const __m256i*>( b[2]+j ) ) ) ) );
+      xmm3 = _mm512_add_epi32( xmm3, _mm512_madd_epi16( va, _mm512_cvtepi8_epi16( _mm256_loadu_si256( reinterpret_cast<const __m256i*>( b[3]+j ) ) ) ) );
+   }
+
+   s0 = _mm512_reduce_add_epi32( xmm0 );
+   s1 = _mm512_reduce_add_epi32( xmm1 );
+   s2 = _mm512_reduce_add_epi32( xmm2 );
+   s3 = _mm512_reduce_add_epi32( xmm3 );
+#  elif BLAZE_AVX2_MODE
+   __m256i xmm0( _mm256_setzero_si256() ), xmm1( xmm0 ), xmm2( xmm0 ), xmm3( xmm0 );
+
+   for( ; j+16UL<=n; j+=16UL ) {
+      const __m256i va( _mm256_cvtepi8_epi16( _mm_loadu_si128( reinterpret_cast<const __m128i*>( a+j ) ) ) );
+      xmm0 = _mm256_add_epi32( xmm0, _mm256_madd_epi16( va, _mm256_cvtepi8_epi16( _mm_loadu_si128( reinterpret_cast<const __m128i*>( b[0]+j ) ) ) ) );
+      xmm1 = _mm256_add_epi32( xmm1, _mm256_madd_epi16( va, _mm256_cvtepi8_epi16( _mm_loadu_si128( reinterpret_cast<const __m128i*>( b[1]+j ) ) ) ) );
+      xmm2 = _mm256_add_epi32( xmm2, _mm256_madd_epi16( va, _mm256_cvtepi8_epi16( _mm_loadu_si128( reinterpret_cast<const __m128i*>( b[2]+j ) ) ) ) );
+      xmm3 = _mm256_add_epi32( xmm3, _mm256_madd_epi16( va, _mm256_cvtepi8_epi16( _mm_loadu_si128( reinterpret_cast<const __m128i*>( b[3]+j ) ) ) ) );
+   }
+
+   // Horizontal reduction of the four accumulators (one sum per 32-bit lane)
+   const __m256i t0( _mm256_hadd_epi32( _mm256_hadd_epi32( xmm0, xmm1 ), _mm256_hadd_epi32( xmm2, xmm3 ) ) );
+   const __m128i t1( _mm_add_epi32( _mm256_castsi256_si128( t0 ), _mm256_extracti128_si256( t0, 1 ) ) );
+
+   s0 = _mm_extract_epi32( t1, 0 );
+   s1 = _mm_extract_epi32( t1, 1 );
+   s2 = _mm_extract_epi32( t1, 2 );
+   s3 = _mm_extract_epi32( t1, 3 );
+#  endif
+
+   for( ; j<n; ++j ) {
+      const int32_t x( a[j] );
+      s0 += x * b[0][j];
+      s1 += x * b[1][j];
+      s2 += x * b[2][j];
+      s3 += x * b[3][j];
+   }
+
+   res[0] = s0;
+   res[1] = s1;
+   res[2] = s2;
+   res[3] = s3;
+#endif
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Computes the sum of an int8 row.
+// \ingroup dense_tensor
+*/
+inline int32_t qsum( const int8_t* a, size_t n ) noexcept
+{
+   int32_t s( 0 );
+   for( size_t j=0UL; j<n; ++j ) {
+      s += a[j];
+   }
+   return s;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name QuantizedTensor functions */
+//@{
+template< typename TT >
+QuantizedTensor<int8_t> quantize( const DenseTensor<TT>& tens,
+                                  QuantizationGranularity granularity = quantizePerPage,
+                                  bool symmetric = false );
+
+template< typename Type >
+DynamicTensor<float> dequantize( const QuantizedTensor<Type>& tens );
+
+template< typename TT, typename Type >
+void multTrans( DenseTensor<TT>& C, const QuantizedTensor<Type>& A, const QuantizedTensor<Type>& B );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Quantizes the given dense tensor to int8.
+// \ingroup dense_tensor
+//
+// \param tens The tensor to be quantized.
+// \param granularity The granularity of the scales and zero points.
+// \param symmetric \a true for a symmetric quantization with zero points of zero.
+// \return The quantized tensor.
+*/
+template< typename TT >  // Type of the tensor
+QuantizedTensor<int8_t> quantize( const DenseTensor<TT>& tens,
+                                  QuantizationGranularity granularity, bool symmetric )
+{
+   return QuantizedTensor<int8_t>( tens, granularity, symmetric );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Dequantizes the given quantized tensor to single precision.
+// \ingroup dense_tensor
+//
+// \param tens The quantized tensor.
+// \return The dequantized tensor.
+*/
+template< typename Type >  // Data type of the quantized values
+DynamicTensor<float> dequantize( const QuantizedTensor<Type>& tens )
+{
+   DynamicTensor<float> res;
+   tens.dequantize( res );
+   return res;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Page-wise product of a quantized tensor with the transpose of another quantized tensor.
+// \ingroup dense_tensor
+//
+// \param C The target tensor for the (dequantized) result.
+// \param A The left-hand side quantized tensor (\f$ O \times M \times K \f$).
+// \param B The right-hand side quantized tensor (\f$ O \times N \times K \f$ or \f$ 1 \times N \times K \f$).
+// \return void
+// \exception std::invalid_argument Tensor sizes do not match.
+//
+// This function computes \f$ C_k = A_k \cdot B_k^T \f$ for all pages \f$ k \f$, where \f$ A_k \f$
+// and \f$ B_k \f$ represent the dequantized pages. A right-hand side operand with a single page
+// (e.g. a weight matrix) is used for all pages of \a A. Storing the right-hand side operand
+// transposed (one row per output column) makes both operands of every dot product contiguous
+// and allows one scale per output column (quantizePerRow). The dot products are computed exactly
+// in int32 arithmetic with AVX-512 VNNI (vpdpbusd), AVX-512 or AVX2 (vpmaddwd) instructions;
+// the scales and zero points are applied to the int32 results:
+
+      \f[ C(k,i,j) = s^A_{ki} s^B_{kj} \left( \sum_p a_{kip} b_{kjp} - z^B_{kj} \sum_p a_{kip}
+                   - z^A_{ki} \sum_p b_{kjp} + K z^A_{ki} z^B_{kj} \right) \f]
+
+// Resizable targets are resized, other targets must have the size \f$ O \times M \times N \f$.
+// Large products are computed in parallel.
+*/
+template< typename TT      // Type of the target tensor
+        , typename Type >  // Data type of the quantized values
+void multTrans( DenseTensor<TT>& C, const QuantizedTensor<Type>& A, const QuantizedTensor<Type>& B )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   if( A.columns() != B.columns() || ( B.pages() != A.pages() && B.pages() != 1UL ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Tensor sizes do not match" );
+   }
+
+   const size_t o( A.pages() );
+   const size_t m( A.rows() );
+   const size_t n( B.rows() );
+   const size_t K( A.columns() );
+
+   prepareConversion( *C, o, m, n );
+
+   if( o == 0UL || m == 0UL || n == 0UL ) return;
+
+   // Row sums of both operands for the zero point correction
+   std::vector<int32_t> asum( o*m ), bsum( B.pages()*n );
+
+   for( size_t r=0UL; r<o*m; ++r ) {
+      asum[r] = qsum( A.values().data( r % m, r / m ), K );
+   }
+   for( size_t r=0UL; r<B.pages()*n; ++r ) {
+      bsum[r] = qsum( B.values().data( r % n, r / n ), K );
+   }
+
+   auto row = [&]( size_t r )
+   {
+      const size_t k( r / m ), i( r % m );
+      const size_t kb( B.pages() == 1UL ? 0UL : k );
+
+      const int8_t* a( A.values().data( i, k ) );
+      const float   sa( A.scale( k, i ) );
+      const int64_t za( A.zeroPoint( k, i ) );
+      const int64_t sumA( asum[r] );
+
+      const int8_t* b[4];
+      int32_t bs[4];
+      int32_t dot[4];
+
+      for( size_t j=0UL; j<n; j+=4UL )
+      {
+         const size_t jend( std::min( j+4UL, n ) );
+
+         // The last block repeats the last row of B
+         for( size_t l=0UL; l<4UL; ++l ) {
+            const size_t jj( std::min( j+l, n-1UL ) );
+            b[l]  = B.values().data( jj, kb );
+            bs[l] = bsum[kb*n+jj];
+         }
+
+         qdot4( a, b, bs, K, dot );
+
+         for( size_t jj=j; jj<jend; ++jj ) {
+            const int64_t zb( B.zeroPoint( kb, jj ) );
+            const int64_t acc( dot[jj-j] - zb*sumA - za*bsum[kb*n+jj] + static_cast<int64_t>( K )*za*zb );
+            (*C)(k,i,jj) = sa * B.scale( kb, jj ) * static_cast<float>( acc );
+         }
+      }
+   };
+
+   if( !isSerialSectionActive() && o*m*n >= smpDTensAssignThreshold() ) {
+      smpFor( 0UL, o*m, row );
+   }
+   else {
+      serialFor( 0UL, o*m, row );
+   }
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,639 @@
+//=================================================================================================
+/*!
+//  \file blaze_tensor/math/dense/Scan.h
+//  \brief Header file for the axis-wise scan operations of dense tensors and arrays
+//
+//  Copyright (C) 2012-2018 Klaus Iglberger - All Rights Reserved
+//  Copyright (C) 2018 Hartmut Kaiser - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+
+#ifndef _BLAZE_TENSOR_MATH_DENSE_SCAN_H_
+#define _BLAZE_TENSOR_MATH_DENSE_SCAN_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/Aliases.h>
+#include <blaze/math/ReductionFlag.h>
+#include <blaze/math/SIMD.h>
+#include <blaze/math/functors/Add.h>
+#include <blaze/math/functors/Max.h>
+#include <blaze/math/functors/Mult.h>
+#include <blaze/math/smp/Functions.h>
+#include <blaze/math/smp/SerialSection.h>
+#include <blaze/math/typetraits/IsSIMDEnabled.h>
+#include <blaze/math/typetraits/IsVectorizable.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/FunctionTrace.h>
+#include <blaze/util/IntegralConstant.h>
+#include <blaze/util/StaticAssert.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/algorithms/Min.h>
+#include <blaze/util/mpl/If.h>
+#include <blaze/util/typetraits/HasMember.h>
+
+#include <blaze_tensor/math/ReductionFlag.h>
+#include <blaze_tensor/math/expressions/DenseArray.h>
+#include <blaze_tensor/math/expressions/DenseTensor.h>
+#include <blaze_tensor/math/smp/ParallelFor.h>
+#include <blaze_tensor/system/Thresholds.h>
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  SCAN KERNELS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Auxiliary helper struct for the selection of the vectorized scan kernels.
+// \ingroup dense_tensor
+*/
+template< typename ET    // Element type of the scanned tensor or array
+        , typename OP >  // Type of the scan operation
+struct ScanHelper
+{
+   //**Type definitions****************************************************************************
+   //! Definition of the HasSIMDEnabled type trait.
+   BLAZE_CREATE_HAS_DATA_OR_FUNCTION_MEMBER_TYPE_TRAIT( HasSIMDEnabled, simdEnabled );
+
+   //! Definition of the HasLoad type trait.
+   BLAZE_CREATE_HAS_DATA_OR_FUNCTION_MEMBER_TYPE_TRAIT( HasLoad, load );
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   static constexpr bool value =
+      ( IsVectorizable_v<ET> &&
+        If_t< HasSIMDEnabled_v<OP>, GetSIMDEnabled<OP,ET,ET>, HasLoad<OP> >::value );
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default combination of two consecutive scan segments (\f$ dst_j = op( src_j, dst_j ) \f$).
+// \ingroup dense_tensor
+//
+// \param src Pointer to the first element of the preceding (already scanned) segment.
+// \param dst Pointer to the first element of the segment to be updated.
+// \param n The number of elements in both segments.
+// \param op The scan operation.
+// \return void
+*/
+template< typename ET    // Element type of the segments
+        , typename OP >  // Type of the scan operation
+inline auto scanCombine( const ET* src, ET* dst, size_t n, OP& op )
+   -> DisableIf_t< ScanHelper<ET,OP>::value >
+{
+   for( size_t j=0UL; j<n; ++j ) {
+      dst[j] = op( src[j], dst[j] );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief SIMD optimized combination of two consecutive scan segments
+//        (\f$ dst_j = op( src_j, dst_j ) \f$).
+// \ingroup dense_tensor
+//
+// \param src Pointer to the first element of the preceding (already scanned) segment.
+// \param dst Pointer to the first element of the segment to be updated.
+// \param n The number of elements in both segments.
+// \param op The scan operation.
+// \return void
+*/
+template< typename ET    // Element type of the segments
+        , typename OP >  // Type of the scan operation
+inline auto scanCombine( const ET* src, ET* dst, size_t n, OP& op )
+   -> EnableIf_t< ScanHelper<ET,OP>::value >
+{
+   constexpr size_t SIMDSIZE( SIMDTrait<ET>::size );
+
+   const size_t jpos( n & size_t(-SIMDSIZE) );
+   BLAZE_INTERNAL_ASSERT( ( n - ( n % SIMDSIZE ) ) == jpos, "Invalid end calculation" );
+
+   size_t j( 0UL );
+
+   for( ; (j+SIMDSIZE*2UL) <= jpos; j+=SIMDSIZE*2UL ) {
+      storeu( dst+j         , op( loadu( src+j          ), loadu( dst+j          ) ) );
+      storeu( dst+j+SIMDSIZE, op( loadu( src+j+SIMDSIZE ), loadu( dst+j+SIMDSIZE ) ) );
+   }
+   for( ; j<jpos; j+=SIMDSIZE ) {
+      storeu( dst+j, op( loadu( src+j ), loadu( dst+j ) ) );
+   }
+   for( ; j<n; ++j ) {
+      dst[j] = op( src[j], dst[j] );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend implementation of a scan over a set of independent chains of segments.
+// \ingroup dense_tensor
+//
+// \param chains The number of independent chains.
+// \param length The number of segments per chain (i.e. the extent of the scanned axis).
+// \param width The number of elements per segment.
+// \param at Callable returning a pointer to the first element of segment \a t of chain \a c.
+// \param op The scan operation.
+// \param parallel \a true in case the scan is supposed to be executed in parallel.
+// \return void
+//
+// Every chain is scanned independently, segment by segment, where each segment is combined
+// element-wise with its already scanned predecessor. For scans along an outer axis a segment
+// is a complete (contiguous) row, which allows to vectorize the combination. For scans along
+// the innermost axis the segments consist of a single element. In case there are enough
+// chains to keep all threads busy, the chains are distributed among the threads. Otherwise
+// the scanned axis itself is split into one block per thread and the scan is performed in
+// two passes: first all blocks are scanned locally in parallel, then the carries of the
+// preceding blocks are propagated serially along the block boundaries and finally applied
+// to the remaining segments of every block in parallel. The latter strategy requires the
+// scan operation to be associative.
+*/
+template< typename OP      // Type of the scan operation
+        , typename Acc >   // Type of the segment access
+void scanChains( size_t chains, size_t length, size_t width, Acc at, OP op, bool parallel )
+{
+   if( chains == 0UL || length < 2UL || width == 0UL )
+      return;
+
+   const size_t threads( parallel ? getNumThreads() : 1UL );
+
+   if( threads <= 1UL || chains >= threads || length < 4UL*threads )
+   {
+      auto scanChain = [&]( size_t c )
+      {
+         for( size_t t=1UL; t<length; ++t ) {
+            scanCombine( at( c, t-1UL ), at( c, t ), width, op );
+         }
+      };
+
+      if( threads > 1UL ) smpFor( 0UL, chains, scanChain );
+      else serialFor( 0UL, chains, scanChain );
+
+      return;
+   }
+
+   const size_t blocks( threads );
+   auto blockBegin = [length,blocks]( size_t b ) { return ( length * b ) / blocks; };
+
+   // First pass: local scan of each block
+   smpFor( 0UL, chains*blocks, [&]( size_t cb )
+   {
+      const size_t c( cb / blocks );
+      const size_t b( cb % blocks );
+      const size_t end( blockBegin( b+1UL ) );
+
+      for( size_t t=blockBegin( b )+1UL; t<end; ++t ) {
+         scanCombine( at( c, t-1UL ), at( c, t ), width, op );
+      }
+   } );
+
+   // Propagation of the carries along the last segments of all blocks
+   for( size_t c=0UL; c<chains; ++c ) {
+      for( size_t b=1UL; b<blocks; ++b ) {
+         scanCombine( at( c, blockBegin( b )-1UL ), at( c, blockBegin( b+1UL )-1UL ), width, op );
+      }
+   }
+
+   // Second pass: application of the carries to the remaining segments of all blocks
+   smpFor( 0UL, chains*(blocks-1UL), [&]( size_t cb )
+   {
+      const size_t c( cb / (blocks-1UL) );
+      const size_t b( cb % (blocks-1UL) + 1UL );
+      const size_t begin( blockBegin( b ) );
+      const size_t end( blockBegin( b+1UL ) - 1UL );
+
+      for( size_t t=begin; t<end; ++t ) {
+         scanCombine( at( c, begin-1UL ), at( c, t ), width, op );
+      }
+   } );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns whether a scan over the given number of elements should be executed in parallel.
+// \ingroup dense_tensor
+//
+// \param size The total number of scanned elements.
+// \return \a true in case the scan should be parallelized, \a false if not.
+*/
+inline bool useSMPScan( size_t size )
+{
+   return !isSerialSectionActive() && size >= smpDTensAssignThreshold();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TENSOR SCAN OPERATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Page-wise in-place scan of a dense tensor.
+// \ingroup dense_tensor
+//
+// \param tens The dense tensor to be scanned in place.
+// \param op The scan operation.
+// \return void
+*/
+template< typename TT    // Type of the dense tensor
+        , typename OP >  // Type of the scan operation
+inline void scan_backend( TT& tens, OP op, IntegralConstant<size_t,pagewise> )
+{
+   using ET = ElementType_t<TT>;
+
+   scanChains( tens.rows(), tens.pages(), tens.columns(),
+               [&tens]( size_t i, size_t k ) -> ET* { return tens.data( i, k ); },
+               op, useSMPScan( tens.pages() * tens.rows() * tens.columns() ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Column-wise in-place scan of a dense tensor.
+// \ingroup dense_tensor
+//
+// \param tens The dense tensor to be scanned in place.
+// \param op The scan operation.
+// \return void
+*/
+template< typename TT    // Type of the dense tensor
+        , typename OP >  // Type of the scan operation
+inline void scan_backend( TT& tens, OP op, IntegralConstant<size_t,columnwise> )
+{
+   using ET = ElementType_t<TT>;
+
+   scanChains( tens.pages(), tens.rows(), tens.columns(),
+               [&tens]( size_t k, size_t i ) -> ET* { return tens.data( i, k ); },
+               op, useSMPScan( tens.pages() * tens.rows() * tens.columns() ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Row-wise in-place scan of a dense tensor.
+// \ingroup dense_tensor
+//
+// \param tens The dense tensor to be scanned in place.
+// \param op The scan operation.
+// \return void
+*/
+template< typename TT    // Type of the dense tensor
+        , typename OP >  // Type of the scan operation
+inline void scan_backend( TT& tens, OP op, IntegralConstant<size_t,rowwise> )
+{
+   using ET = ElementType_t<TT>;
+
+   const size_t m( tens.rows() );
+
+   scanChains( tens.pages() * m, tens.columns(), 1UL,
+               [&tens,m]( size_t c, size_t j ) -> ET* { return tens.data( c % m, c / m ) + j; },
+               op, useSMPScan( tens.pages() * m * tens.columns() ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the inclusive scan of the given dense tensor along the given axis.
+// \ingroup dense_tensor
+//
+// \param dm The given dense tensor for the scan operation.
+// \param op The scan operation.
+// \return The tensor of partial results.
+//
+// This function computes the inclusive scan (prefix reduction) of the given dense tensor \a dm
+// along the axis selected by the reduction flag \a RF by means of the given binary operation
+// \a op. In case \a RF is set to \a blaze::pagewise, the tensor is scanned along its pages,
+// in case \a RF is set to \a blaze::columnwise the elements of every column are scanned (i.e.
+// along the rows) and in case \a RF is set to \a blaze::rowwise the elements of every row are
+// scanned (i.e. along the columns). The result has the same dimensions as \a dm:
+
+   \code
+   using blaze::rowwise;
+
+   blaze::DynamicTensor<int> A{ { { 1, 2, 3 }, { 4, 5, 6 } } };
+   blaze::DynamicTensor<int> B;
+
+   B = scan<rowwise>( A, blaze::Add() );  // Results in ( ( 1 3 6 ) ( 4 9 15 ) )
+   \endcode
+
+// Scans along the pages and along the rows are vectorized across the contiguous columns of
+// the tensor, provided that \a op is a vectorizable operation. Large scans are executed in
+// parallel. In case the number of independent rows or columns is too small to keep all threads
+// busy, the scanned axis is split into blocks that are scanned concurrently, which requires
+// \a op to be associative. The operation is undefined if \a op modifies the values.
+*/
+template< size_t RF      // Reduction flag
+        , typename MT    // Type of the dense tensor
+        , typename OP >  // Type of the scan operation
+inline ResultType_t<MT> scan( const DenseTensor<MT>& dm, OP op )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_STATIC_ASSERT_MSG( RF < 3UL, "Invalid reduction flag" );
+
+   ResultType_t<MT> tmp( *dm );
+   scan_backend( tmp, op, IntegralConstant<size_t,RF>() );
+
+   return tmp;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the cumulative sum of the given dense tensor along the given axis.
+// \ingroup dense_tensor
+//
+// \param dm The given dense tensor.
+// \return The tensor of cumulative sums.
+//
+   \code
+   using blaze::columnwise;
+
+   blaze::DynamicTensor<int> A{ { { 1, 2 }, { 3, 4 } } };
+   blaze::DynamicTensor<int> B;
+
+   B = cumsum<columnwise>( A );  // Results in ( ( 1 2 ) ( 4 6 ) )
+   \endcode
+*/
+template< size_t RF     // Reduction flag
+        , typename MT > // Type of the dense tensor
+inline ResultType_t<MT> cumsum( const DenseTensor<MT>& dm )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return scan<RF>( *dm, Add() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the cumulative product of the given dense tensor along the given axis.
+// \ingroup dense_tensor
+//
+// \param dm The given dense tensor.
+// \return The tensor of cumulative products.
+//
+   \code
+   using blaze::rowwise;
+
+   blaze::DynamicTensor<int> A{ { { 1, 2, 3 }, { 4, 5, 6 } } };
+   blaze::DynamicTensor<int> B;
+
+   B = cumprod<rowwise>( A );  // Results in ( ( 1 2 6 ) ( 4 20 120 ) )
+   \endcode
+*/
+template< size_t RF     // Reduction flag
+        , typename MT > // Type of the dense tensor
+inline ResultType_t<MT> cumprod( const DenseTensor<MT>& dm )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return scan<RF>( *dm, Mult() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the cumulative maximum of the given dense tensor along the given axis.
+// \ingroup dense_tensor
+//
+// \param dm The given dense tensor.
+// \return The tensor of running maxima.
+//
+   \code
+   using blaze::rowwise;
+
+   blaze::DynamicTensor<int> A{ { { 1, 3, 2 }, { 6, 4, 5 } } };
+   blaze::DynamicTensor<int> B;
+
+   B = cummax<rowwise>( A );  // Results in ( ( 1 3 3 ) ( 6 6 6 ) )
+   \endcode
+*/
+template< size_t RF     // Reduction flag
+        , typename MT > // Type of the dense tensor
+inline ResultType_t<MT> cummax( const DenseTensor<MT>& dm )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return scan<RF>( *dm, Max() );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ARRAY SCAN OPERATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief In-place scan of a dense array along the given dimension.
+// \ingroup dense_array
+//
+// \param arr The dense array to be scanned in place.
+// \param op The scan operation.
+// \return void
+//
+// The dimension \a R indexes the dimensions of the array as returned by \c dimensions(), i.e.
+// \a R == 0 denotes the innermost (contiguous) dimension.
+*/
+template< size_t R       // Scanned dimension
+        , typename AT    // Type of the dense array
+        , typename OP >  // Type of the scan operation
+void scan_backend( AT& arr, OP op )
+{
+   using ET = ElementType_t<AT>;
+
+   constexpr size_t N( AT::num_dimensions );
+
+   const auto& dims( arr.dimensions() );
+   const size_t nn( arr.spacing() );
+
+   size_t rows( 1UL );
+   for( size_t d=1UL; d<N; ++d ) {
+      rows *= dims[d];
+   }
+
+   ET* const base( arr.data() );
+   const bool parallel( useSMPScan( rows * dims[0] ) );
+
+   if( R == 0UL ) {
+      scanChains( rows, dims[0], 1UL,
+                  [base,nn]( size_t c, size_t j ) -> ET* { return base + c*nn + j; },
+                  op, parallel );
+      return;
+   }
+
+   size_t inner( 1UL );
+   for( size_t d=1UL; d<R; ++d ) {
+      inner *= dims[d];
+   }
+
+   const size_t length( dims[R] );
+   const size_t outer ( length != 0UL ? rows / ( inner * length ) : 0UL );
+
+   scanChains( outer * inner, length, dims[0],
+               [base,nn,inner,length]( size_t c, size_t t ) -> ET* {
+                  return base + ( ( c / inner * length + t ) * inner + c % inner ) * nn;
+               },
+               op, parallel );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the inclusive scan of the given dense array along the given dimension.
+// \ingroup dense_array
+//
+// \param dm The given dense array for the scan operation.
+// \param op The scan operation.
+// \return The array of partial results.
+//
+// This function computes the inclusive scan (prefix reduction) of the given dense array \a dm
+// along the dimension \a R by means of the given binary operation \a op. As for the partial
+// reduction operations, \a R indexes the dimensions of the array from the innermost dimension
+// (\a R == 0, the columns) outwards (\a R == 1 denotes the rows, \a R == 2 the pages, ...):
+
+   \code
+   blaze::DynamicArray<3,int> A( 2UL, 3UL, 4UL );
+   blaze::DynamicArray<3,int> B;
+   // ... Initialization
+
+   B = scan<2>( A, blaze::Add() );  // Cumulative sum along the pages
+   \endcode
+
+// Scans along any but the innermost dimension are vectorized across the contiguous columns of
+// the array, provided that \a op is a vectorizable operation. Large scans are executed in
+// parallel, which for a small number of independent chains requires \a op to be associative.
+*/
+template< size_t R       // Scanned dimension
+        , typename MT    // Type of the dense array
+        , typename OP >  // Type of the scan operation
+inline ResultType_t<MT> scan( const DenseArray<MT>& dm, OP op )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_STATIC_ASSERT_MSG( R < MT::num_dimensions, "Invalid scan dimension" );
+
+   ResultType_t<MT> tmp( *dm );
+   scan_backend<R>( tmp, op );
+
+   return tmp;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the cumulative sum of the given dense array along the given dimension.
+// \ingroup dense_array
+//
+// \param dm The given dense array.
+// \return The array of cumulative sums.
+*/
+template< size_t R      // Scanned dimension
+        , typename MT > // Type of the dense array
+inline ResultType_t<MT> cumsum( const DenseArray<MT>& dm )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return scan<R>( *dm, Add() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the cumulative product of the given dense array along the given dimension.
+// \ingroup dense_array
+//
+// \param dm The given dense array.
+// \return The array of cumulative products.
+*/
+template< size_t R      // Scanned dimension
+        , typename MT > // Type of the dense array
+inline ResultType_t<MT> cumprod( const DenseArray<MT>& dm )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return scan<R>( *dm, Mult() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the cumulative maximum of the given dense array along the given dimension.
+// \ingroup dense_array
+//
+// \param dm The given dense array.
+// \return The array of running maxima.
+*/
+template< size_t R      // Scanned dimension
+        , typename MT > // Type of the dense array
+inline ResultType_t<MT> cummax( const DenseArray<MT>& dm )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return scan<R>( *dm, Max() );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
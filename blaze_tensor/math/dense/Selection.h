@@ -0,0 +1,1007 @@
+//=================================================================================================
+/*!
+//  \file blaze_tensor/math/dense/Selection.h
+//  \brief Header file for the index selecting reduction operations (argmin, argmax, topk)
+//
+//  Copyright (C) 2012-2018 Klaus Iglberger - All Rights Reserved
+//  Copyright (C) 2018 Hartmut Kaiser - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+
+#ifndef _BLAZE_TENSOR_MATH_DENSE_SELECTION_H_
+#define _BLAZE_TENSOR_MATH_DENSE_SELECTION_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <array>
+#include <utility>
+#include <vector>
+
+#include <blaze/math/Aliases.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/ReductionFlag.h>
+#include <blaze/math/SIMD.h>
+#include <blaze/math/dense/DynamicMatrix.h>
+#include <blaze/math/functors/Max.h>
+#include <blaze/math/functors/Min.h>
+#include <blaze/math/typetraits/HasConstDataAccess.h>
+#include <blaze/math/typetraits/HasSIMDMax.h>
+#include <blaze/math/typetraits/HasSIMDMin.h>
+#include <blaze/math/typetraits/IsVectorizable.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/FunctionTrace.h>
+#include <blaze/util/IntegralConstant.h>
+#include <blaze/util/StaticAssert.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/algorithms/Min.h>
+#include <blaze/util/mpl/If.h>
+#include <blaze/util/typetraits/IsSame.h>
+
+#include <blaze_tensor/math/ReductionFlag.h>
+#include <blaze_tensor/math/dense/DynamicArray.h>
+#include <blaze_tensor/math/dense/DynamicTensor.h>
+#include <blaze_tensor/math/expressions/DenseArray.h>
+#include <blaze_tensor/math/expressions/DenseTensor.h>
+#include <blaze_tensor/math/smp/ParallelFor.h>
+#include <blaze_tensor/system/Thresholds.h>
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  SELECTION KERNELS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Ordering of the elements for the argmax() and topk() operations.
+// \ingroup dense_tensor
+*/
+struct SelectMax
+{
+   using Op = Max;  //!< The corresponding (vectorizable) reduction operation.
+
+   template< typename ET >
+   static constexpr bool simdEnabled = ( IsVectorizable_v<ET> && HasSIMDMax_v<ET,ET> );
+
+   template< typename T >
+   static inline bool better( const T& a, const T& b ) { return a > b; }
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Ordering of the elements for the argmin() operation.
+// \ingroup dense_tensor
+*/
+struct SelectMin
+{
+   using Op = Min;  //!< The corresponding (vectorizable) reduction operation.
+
+   template< typename ET >
+   static constexpr bool simdEnabled = ( IsVectorizable_v<ET> && HasSIMDMin_v<ET,ET> );
+
+   template< typename T >
+   static inline bool better( const T& a, const T& b ) { return a < b; }
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default search for the position of the first extremal element of a contiguous range.
+// \ingroup dense_tensor
+//
+// \param p Pointer to the first element of the range.
+// \param n The number of elements in the range (must be larger than 0).
+// \return The index of the first extremal element.
+*/
+template< typename SEL   // Type of the element ordering
+        , typename ET >  // Element type
+inline auto selectContiguous( const ET* p, size_t n )
+   -> DisableIf_t< SEL::template simdEnabled<ET>, size_t >
+{
+   BLAZE_INTERNAL_ASSERT( n > 0UL, "Invalid range size detected" );
+
+   size_t pos( 0UL );
+
+   for( size_t j=1UL; j<n; ++j ) {
+      if( SEL::better( p[j], p[pos] ) )
+         pos = j;
+   }
+
+   return pos;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief SIMD optimized search for the position of the first extremal element of a contiguous
+//        range.
+// \ingroup dense_tensor
+//
+// \param p Pointer to the first element of the range.
+// \param n The number of elements in the range (must be larger than 0).
+// \return The index of the first extremal element.
+//
+// The range is processed in blocks of four SIMD vectors. For every block the extremal value is
+// determined by means of vectorized min/max operations and only the position of the best block
+// is tracked. The exact position of the extremal element is determined at the very end by a
+// search within the best block only, i.e. the range is traversed exactly once.
+*/
+template< typename SEL   // Type of the element ordering
+        , typename ET >  // Element type
+inline auto selectContiguous( const ET* p, size_t n )
+   -> EnableIf_t< SEL::template simdEnabled<ET>, size_t >
+{
+   BLAZE_INTERNAL_ASSERT( n > 0UL, "Invalid range size detected" );
+
+   using Op = typename SEL::Op;
+
+   constexpr size_t SIMDSIZE( SIMDTrait<ET>::size );
+   constexpr size_t BLOCKSIZE( SIMDSIZE*4UL );
+
+   const size_t jpos( n - ( n % BLOCKSIZE ) );
+
+   ET value( p[0] );
+   size_t pos( 0UL );
+   size_t block( n );
+
+   Op op;
+
+   for( size_t j=0UL; j<jpos; j+=BLOCKSIZE )
+   {
+      const auto xmm1( op( loadu( p+j            ), loadu( p+j+SIMDSIZE     ) ) );
+      const auto xmm2( op( loadu( p+j+SIMDSIZE*2UL ), loadu( p+j+SIMDSIZE*3UL ) ) );
+      const ET tmp( reduce( op( xmm1, xmm2 ), op ) );
+
+      if( SEL::better( tmp, value ) ) {
+         value = tmp;
+         block = j;
+      }
+   }
+
+   for( size_t j=jpos; j<n; ++j ) {
+      if( SEL::better( p[j], value ) ) {
+         value = p[j];
+         pos   = j;
+         block = n;
+      }
+   }
+
+   if( block != n ) {
+      pos = block;
+      while( p[pos] != value ) {
+         ++pos;
+      }
+      BLAZE_INTERNAL_ASSERT( pos < block + BLOCKSIZE, "Invalid block search" );
+   }
+
+   return pos;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Search for the positions of the first extremal elements of a set of lanes.
+// \ingroup dense_tensor
+//
+// \param at Callable returning a pointer to segment \a t of the lanes.
+// \param length The number of segments (i.e. the extent of the reduced axis).
+// \param width The number of lanes (i.e. the number of elements per segment).
+// \param best Buffer for the current extremal values of all lanes.
+// \param out Pointer to the first of \a width resulting indices.
+// \return void
+//
+// The segments are traversed in memory order. The update of the current best value and index
+// of every lane is formulated branch-free, which allows the compiler to vectorize the loop.
+*/
+template< typename SEL   // Type of the element ordering
+        , typename ET    // Element type
+        , typename Acc > // Type of the segment access
+inline void selectLanes( Acc at, size_t length, size_t width, ET* best, size_t* out )
+{
+   BLAZE_INTERNAL_ASSERT( length > 0UL, "Invalid number of segments detected" );
+
+   const ET* p( at( 0UL ) );
+
+   for( size_t j=0UL; j<width; ++j ) {
+      best[j] = p[j];
+      out[j]  = 0UL;
+   }
+
+   for( size_t t=1UL; t<length; ++t )
+   {
+      p = at( t );
+
+      for( size_t j=0UL; j<width; ++j ) {
+         const bool b( SEL::better( p[j], best[j] ) );
+         best[j] = b ? p[j] : best[j];
+         out[j]  = b ? t    : out[j];
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Partial selection of the \a k largest elements of a set of lanes.
+// \ingroup dense_tensor
+//
+// \param at Callable returning a pointer to segment \a t of the lanes.
+// \param length The number of segments (i.e. the extent of the reduced axis).
+// \param width The number of lanes (i.e. the number of elements per segment).
+// \param k The number of elements to select per lane.
+// \param store Callable storing the \a r-th largest element (index and value) of a lane.
+// \return void
+//
+// For every lane a heap of the \a k best elements seen so far is maintained, with the worst of
+// these elements on top. Every new element is compared against the top of the heap only and
+// inserted in case it is better. Equal elements are ordered by their index, i.e. the selection
+// is stable. The selected elements are stored in decreasing order.
+*/
+template< typename ET      // Element type
+        , typename Acc     // Type of the segment access
+        , typename Store > // Type of the result storage
+void topkLanes( Acc at, size_t length, size_t width, size_t k, Store store )
+{
+   using Entry = std::pair<ET,size_t>;
+
+   BLAZE_INTERNAL_ASSERT( k <= length, "Invalid number of selected elements" );
+
+   if( k == 0UL )
+      return;
+
+   auto better = []( const Entry& a, const Entry& b ) {
+      return ( a.first > b.first ) || ( !( b.first > a.first ) && a.second < b.second );
+   };
+
+   std::vector<Entry> heaps( width*k );
+
+   for( size_t t=0UL; t<k; ++t ) {
+      const ET* p( at( t ) );
+      for( size_t j=0UL; j<width; ++j ) {
+         heaps[j*k+t] = Entry( p[j], t );
+      }
+   }
+
+   for( size_t j=0UL; j<width; ++j ) {
+      std::make_heap( heaps.begin()+j*k, heaps.begin()+(j+1UL)*k, better );
+   }
+
+   for( size_t t=k; t<length; ++t )
+   {
+      const ET* p( at( t ) );
+
+      for( size_t j=0UL; j<width; ++j )
+      {
+         const auto first( heaps.begin()+j*k );
+
+         if( !( p[j] > first->first ) )
+            continue;
+
+         std::pop_heap( first, first+k, better );
+         *(first+k-1UL) = Entry( p[j], t );
+         std::push_heap( first, first+k, better );
+      }
+   }
+
+   for( size_t j=0UL; j<width; ++j )
+   {
+      const auto first( heaps.begin()+j*k );
+      std::sort_heap( first, first+k, better );
+
+      for( size_t r=0UL; r<k; ++r ) {
+         store( r, j, first[r].second, first[r].first );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns whether a selection over the given number of elements should be executed in
+//        parallel.
+// \ingroup dense_tensor
+//
+// \param size The total number of elements.
+// \return \a true in case the selection should be parallelized, \a false if not.
+*/
+inline bool useSMPSelection( size_t size )
+{
+   return size >= smpDTensAssignThreshold();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Executes the given loop body either in parallel or serially.
+// \ingroup dense_tensor
+//
+// \param units The number of independent units of work.
+// \param parallel \a true in case the units should be distributed over the threads.
+// \param f The loop body.
+// \return void
+*/
+template< typename F >  // Type of the loop body
+inline void selectionFor( size_t units, bool parallel, F&& f )
+{
+   if( parallel ) smpFor( 0UL, units, f );
+   else serialFor( 0UL, units, f );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Number of lanes that are processed together within a single unit of work.
+// \ingroup dense_tensor
+*/
+constexpr size_t SELECTION_LANE_BLOCK = 256UL;
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TENSOR SELECTION BACKENDS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Evaluation of a dense tensor operand into a form that provides access to its rows.
+// \ingroup dense_tensor
+*/
+template< typename MT >  // Type of the dense tensor
+using SelectionOperand_t =
+   If_t< HasConstDataAccess_v<MT>, const MT&, const ResultType_t<MT> >;
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the argmin() and argmax() operations along the columns of a dense tensor.
+// \ingroup dense_tensor
+*/
+template< typename SEL   // Type of the element ordering
+        , typename MT >  // Type of the dense tensor
+DynamicMatrix<size_t> select_backend( const MT& A, IntegralConstant<size_t,rowwise> )
+{
+   DynamicMatrix<size_t> res( A.pages(), A.rows() );
+
+   const size_t m( A.rows() );
+
+   selectionFor( A.pages()*m, useSMPSelection( A.pages()*m*A.columns() ), [&]( size_t c )
+   {
+      const size_t k( c / m );
+      const size_t i( c % m );
+      res(k,i) = selectContiguous<SEL>( A.data( i, k ), A.columns() );
+   } );
+
+   return res;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the argmin() and argmax() operations along the rows or pages of a dense
+//        tensor.
+// \ingroup dense_tensor
+//
+// \param chains The number of independent sets of lanes.
+// \param length The extent of the reduced axis.
+// \param width The number of lanes per set (i.e. the number of columns).
+// \param at Callable returning a pointer to segment \a t of lane set \a c.
+// \param res The resulting matrix of indices (one row per lane set).
+// \return void
+*/
+template< typename SEL   // Type of the element ordering
+        , typename ET    // Element type
+        , typename Acc   // Type of the segment access
+        , typename RT >  // Type of the result matrix
+void select_lanes_backend( size_t chains, size_t length, size_t width, Acc at, RT& res )
+{
+   const size_t blocks( ( width + SELECTION_LANE_BLOCK - 1UL ) / SELECTION_LANE_BLOCK );
+
+   selectionFor( chains*blocks, useSMPSelection( chains*length*width ), [&]( size_t cb )
+   {
+      const size_t c    ( cb / blocks );
+      const size_t jbegin( ( cb % blocks ) * SELECTION_LANE_BLOCK );
+      const size_t jsize( min( SELECTION_LANE_BLOCK, width - jbegin ) );
+
+      std::array<ET,SELECTION_LANE_BLOCK> best;
+
+      selectLanes<SEL>( [&]( size_t t ) { return at( c, t ) + jbegin; },
+                        length, jsize, best.data(), res.data( c ) + jbegin );
+   } );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the argmin() and argmax() operations along the rows of a dense tensor.
+// \ingroup dense_tensor
+*/
+template< typename SEL   // Type of the element ordering
+        , typename MT >  // Type of the dense tensor
+DynamicMatrix<size_t> select_backend( const MT& A, IntegralConstant<size_t,columnwise> )
+{
+   using ET = ElementType_t<MT>;
+
+   DynamicMatrix<size_t> res( A.pages(), A.columns() );
+
+   select_lanes_backend<SEL,ET>( A.pages(), A.rows(), A.columns(),
+                                 [&A]( size_t k, size_t i ) { return A.data( i, k ); }, res );
+
+   return res;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the argmin() and argmax() operations along the pages of a dense tensor.
+// \ingroup dense_tensor
+*/
+template< typename SEL   // Type of the element ordering
+        , typename MT >  // Type of the dense tensor
+DynamicMatrix<size_t> select_backend( const MT& A, IntegralConstant<size_t,pagewise> )
+{
+   using ET = ElementType_t<MT>;
+
+   DynamicMatrix<size_t> res( A.rows(), A.columns() );
+
+   select_lanes_backend<SEL,ET>( A.rows(), A.pages(), A.columns(),
+                                 [&A]( size_t i, size_t k ) { return A.data( i, k ); }, res );
+
+   return res;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the argmin() and argmax() operations for dense tensors.
+// \ingroup dense_tensor
+*/
+template< typename SEL   // Type of the element ordering
+        , size_t RF      // Reduction flag
+        , typename MT >  // Type of the dense tensor
+DynamicMatrix<size_t> select_backend( const DenseTensor<MT>& dm )
+{
+   BLAZE_STATIC_ASSERT_MSG( RF < 3UL, "Invalid reduction flag" );
+
+   const size_t length( RF == pagewise ? (*dm).pages()
+                      : RF == columnwise ? (*dm).rows() : (*dm).columns() );
+
+   if( length == 0UL ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid selection along an empty axis" );
+   }
+
+   SelectionOperand_t<MT> A( *dm );
+
+   return select_backend<SEL>( A, IntegralConstant<size_t,RF>() );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the topk() operation for dense tensors.
+// \ingroup dense_tensor
+//
+// \param dm The given dense tensor.
+// \param k The number of elements to select.
+// \param store Callable storing the \a r-th largest element of the lane \f$ (k,i,j) \f$.
+// \return void
+*/
+template< size_t RF        // Reduction flag
+        , typename MT      // Type of the dense tensor
+        , typename Store > // Type of the result storage
+void topk_backend( const DenseTensor<MT>& dm, size_t k, Store store )
+{
+   using ET = ElementType_t<MT>;
+
+   BLAZE_STATIC_ASSERT_MSG( RF < 3UL, "Invalid reduction flag" );
+
+   SelectionOperand_t<MT> A( *dm );
+
+   const size_t o( A.pages() );
+   const size_t m( A.rows() );
+   const size_t n( A.columns() );
+
+   const size_t length( RF == pagewise ? o : RF == columnwise ? m : n );
+
+   if( k > length ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid number of selected elements" );
+   }
+
+   const bool parallel( useSMPSelection( o*m*n ) );
+
+   if( RF == rowwise ) {
+      selectionFor( o*m, parallel, [&]( size_t c )
+      {
+         const ET* row( A.data( c % m, c / m ) );
+         topkLanes<ET>( [row]( size_t t ) { return row + t; }, n, 1UL, k,
+                        [&]( size_t r, size_t, size_t idx, const ET& value ) {
+                           store( c / m, c % m, r, idx, value );
+                        } );
+      } );
+      return;
+   }
+
+   const size_t chains( RF == pagewise ? m : o );
+   const size_t blocks( ( n + SELECTION_LANE_BLOCK - 1UL ) / SELECTION_LANE_BLOCK );
+
+   selectionFor( chains*blocks, parallel, [&]( size_t cb )
+   {
+      const size_t c    ( cb / blocks );
+      const size_t jbegin( ( cb % blocks ) * SELECTION_LANE_BLOCK );
+      const size_t jsize( min( SELECTION_LANE_BLOCK, n - jbegin ) );
+
+      if( RF == pagewise ) {
+         topkLanes<ET>( [&]( size_t t ) { return A.data( c, t ) + jbegin; }, length, jsize, k,
+                        [&]( size_t r, size_t j, size_t idx, const ET& value ) {
+                           store( r, c, jbegin+j, idx, value );
+                        } );
+      }
+      else {
+         topkLanes<ET>( [&]( size_t t ) { return A.data( t, c ) + jbegin; }, length, jsize, k,
+                        [&]( size_t r, size_t j, size_t idx, const ET& value ) {
+                           store( c, r, jbegin+j, idx, value );
+                        } );
+      }
+   } );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TENSOR SELECTION OPERATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Computes the indices of the maximum elements along the given axis of a dense tensor.
+// \ingroup dense_tensor
+//
+// \param dm The given dense tensor.
+// \return The matrix of indices of the maximum elements.
+// \exception std::invalid_argument Invalid selection along an empty axis.
+//
+// This function returns the positions of the maximum elements of the given dense tensor \a dm
+// along the axis selected by the reduction flag \a RF. In case of several maximum elements,
+// the position of the first one is returned. In case \a RF is set to \a blaze::pagewise the
+// resulting matrix has the dimensions rows \f$ \times \f$ columns of \a dm, in case \a RF is
+// set to \a blaze::columnwise the result is a pages \f$ \times \f$ columns matrix of row
+// indices, and in case \a RF is set to \a blaze::rowwise the result is a pages \f$ \times \f$
+// rows matrix of column indices:
+
+   \code
+   using blaze::rowwise;
+
+   blaze::DynamicTensor<int> A{ { { 1, 5, 2 }, { 7, 4, 7 } } };
+   blaze::DynamicMatrix<size_t> B;
+
+   B = argmax<rowwise>( A );  // Results in ( ( 1 0 ) )
+   \endcode
+
+// The search along the contiguous axis (\a blaze::rowwise) is vectorized for all element types
+// that provide a vectorized maximum operation. Large tensors are processed in parallel over the
+// axes that are not reduced.
+*/
+template< size_t RF     // Reduction flag
+        , typename MT > // Type of the dense tensor
+inline DynamicMatrix<size_t> argmax( const DenseTensor<MT>& dm )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return select_backend<SelectMax,RF>( *dm );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the indices of the minimum elements along the given axis of a dense tensor.
+// \ingroup dense_tensor
+//
+// \param dm The given dense tensor.
+// \return The matrix of indices of the minimum elements.
+// \exception std::invalid_argument Invalid selection along an empty axis.
+//
+// This function returns the positions of the minimum elements of the given dense tensor \a dm
+// along the axis selected by the reduction flag \a RF. See argmax() for the dimensions of the
+// resulting matrix.
+*/
+template< size_t RF     // Reduction flag
+        , typename MT > // Type of the dense tensor
+inline DynamicMatrix<size_t> argmin( const DenseTensor<MT>& dm )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return select_backend<SelectMin,RF>( *dm );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the indices of the \a k largest elements along the given axis of a dense tensor.
+// \ingroup dense_tensor
+//
+// \param dm The given dense tensor.
+// \param k The number of elements to select.
+// \return The tensor of indices of the \a k largest elements.
+// \exception std::invalid_argument Invalid number of selected elements.
+//
+// This function selects the \a k largest elements of the given dense tensor \a dm along the
+// axis selected by the reduction flag \a RF and returns their positions along this axis. The
+// resulting tensor has the same dimensions as \a dm, except for the reduced axis which has
+// the extent \a k. The indices are sorted by decreasing value, equal values are ordered by
+// their position:
+
+   \code
+   using blaze::rowwise;
+
+   blaze::DynamicTensor<int> A{ { { 1, 5, 2, 9 }, { 7, 4, 7, 3 } } };
+   blaze::DynamicTensor<size_t> B;
+
+   B = topk<rowwise>( A, 2UL );  // Results in ( ( ( 3 1 ) ( 0 2 ) ) )
+   \endcode
+*/
+template< size_t RF     // Reduction flag
+        , typename MT > // Type of the dense tensor
+DynamicTensor<size_t> topk( const DenseTensor<MT>& dm, size_t k )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   DynamicTensor<size_t> indices( RF == pagewise   ? k : (*dm).pages(),
+                                  RF == columnwise ? k : (*dm).rows(),
+                                  RF == rowwise    ? k : (*dm).columns() );
+
+   topk_backend<RF>( *dm, k,
+      [&indices]( size_t l, size_t i, size_t j, size_t idx, const ElementType_t<MT>& ) {
+         indices(l,i,j) = idx;
+      } );
+
+   return indices;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Selects the \a k largest elements along the given axis of a dense tensor.
+// \ingroup dense_tensor
+//
+// \param dm The given dense tensor.
+// \param k The number of elements to select.
+// \param values The resulting tensor of the \a k largest values.
+// \param indices The resulting tensor of the indices of the \a k largest values.
+// \return void
+// \exception std::invalid_argument Invalid number of selected elements.
+//
+// This function selects the \a k largest elements of the given dense tensor \a dm along the
+// axis selected by the reduction flag \a RF. Both \a values and \a indices are assigned tensors
+// with the dimensions of \a dm, except for the reduced axis which has the extent \a k. See the
+// topk( const DenseTensor<MT>&, size_t ) function for details.
+*/
+template< size_t RF      // Reduction flag
+        , typename MT    // Type of the dense tensor
+        , typename VT    // Type of the tensor of values
+        , typename IT >  // Type of the tensor of indices
+void topk( const DenseTensor<MT>& dm, size_t k, DenseTensor<VT>& values, DenseTensor<IT>& indices )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   const size_t o( RF == pagewise   ? k : (*dm).pages()   );
+   const size_t m( RF == columnwise ? k : (*dm).rows()    );
+   const size_t n( RF == rowwise    ? k : (*dm).columns() );
+
+   DynamicTensor< ElementType_t<MT> > tmpValues( o, m, n );
+   DynamicTensor< size_t > tmpIndices( o, m, n );
+
+   topk_backend<RF>( *dm, k,
+      [&]( size_t l, size_t i, size_t j, size_t idx, const ElementType_t<MT>& value ) {
+         tmpValues (l,i,j) = value;
+         tmpIndices(l,i,j) = idx;
+      } );
+
+   (*values)  = tmpValues;
+   (*indices) = tmpIndices;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ARRAY SELECTION OPERATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the argmin() and argmax() operations for dense arrays.
+// \ingroup dense_array
+//
+// \param dm The given dense array.
+// \return The array of indices of the extremal elements.
+// \exception std::invalid_argument Invalid selection along an empty axis.
+*/
+template< typename SEL   // Type of the element ordering
+        , size_t R       // Reduced dimension
+        , typename MT >  // Type of the dense array
+DynamicArray< MT::num_dimensions-1UL, size_t > select_backend( const DenseArray<MT>& dm )
+{
+   using ET = ElementType_t<MT>;
+   using RT = ResultType_t<MT>;
+
+   constexpr size_t N( MT::num_dimensions );
+
+   BLAZE_STATIC_ASSERT_MSG( N > 2UL, "Invalid number of array dimensions" );
+   BLAZE_STATIC_ASSERT_MSG( R < N, "Invalid reduction dimension" );
+
+   If_t< IsSame_v<MT,RT>, const MT&, const RT > A( *dm );
+
+   const auto& dims( A.dimensions() );
+   const size_t length( dims[R] );
+
+   if( length == 0UL ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid selection along an empty axis" );
+   }
+
+   std::array<size_t,N-1UL> rdims;
+   for( size_t d=0UL, r=0UL; d<N; ++d ) {
+      if( d != R ) rdims[r++] = dims[d];
+   }
+
+   DynamicArray<N-1UL,size_t> res( rdims );
+
+   size_t rows( 1UL );
+   for( size_t d=1UL; d<N; ++d ) {
+      rows *= dims[d];
+   }
+
+   const ET* const base( A.data() );
+   const size_t nn ( A.spacing() );
+   const size_t rnn( res.spacing() );
+   size_t* const out( res.data() );
+
+   if( R == 0UL ) {
+      selectionFor( rows, useSMPSelection( rows*length ), [&]( size_t c ) {
+         out[( c / dims[1] )*rnn + c % dims[1]] = selectContiguous<SEL>( base + c*nn, length );
+      } );
+      return res;
+   }
+
+   size_t inner( 1UL );
+   for( size_t d=1UL; d<R; ++d ) {
+      inner *= dims[d];
+   }
+
+   const size_t chains( rows / length );
+   const size_t width ( dims[0] );
+   const size_t blocks( ( width + SELECTION_LANE_BLOCK - 1UL ) / SELECTION_LANE_BLOCK );
+
+   selectionFor( chains*blocks, useSMPSelection( rows*width ), [&]( size_t cb )
+   {
+      const size_t c    ( cb / blocks );
+      const size_t jbegin( ( cb % blocks ) * SELECTION_LANE_BLOCK );
+      const size_t jsize( min( SELECTION_LANE_BLOCK, width - jbegin ) );
+
+      std::array<ET,SELECTION_LANE_BLOCK> best;
+
+      selectLanes<SEL>( [&]( size_t t ) {
+                           return base + ( ( c / inner * length + t ) * inner + c % inner ) * nn + jbegin;
+                        },
+                        length, jsize, best.data(), out + c*rnn + jbegin );
+   } );
+
+   return res;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the indices of the maximum elements along the given dimension of a dense array.
+// \ingroup dense_array
+//
+// \param dm The given dense array.
+// \return The array of indices of the maximum elements.
+// \exception std::invalid_argument Invalid selection along an empty axis.
+//
+// This function returns the positions of the maximum elements of the given N-dimensional dense
+// array \a dm along the dimension \a R (\a R == 0 denotes the innermost dimension, i.e. the
+// columns). The result is an (N-1)-dimensional array. In case of several maximum elements, the
+// position of the first one is returned.
+*/
+template< size_t R      // Reduced dimension
+        , typename MT > // Type of the dense array
+inline decltype(auto) argmax( const DenseArray<MT>& dm )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return select_backend<SelectMax,R>( *dm );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the indices of the minimum elements along the given dimension of a dense array.
+// \ingroup dense_array
+//
+// \param dm The given dense array.
+// \return The array of indices of the minimum elements.
+// \exception std::invalid_argument Invalid selection along an empty axis.
+//
+// This function returns the positions of the minimum elements of the given N-dimensional dense
+// array \a dm along the dimension \a R (\a R == 0 denotes the innermost dimension, i.e. the
+// columns). The result is an (N-1)-dimensional array.
+*/
+template< size_t R      // Reduced dimension
+        , typename MT > // Type of the dense array
+inline decltype(auto) argmin( const DenseArray<MT>& dm )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return select_backend<SelectMin,R>( *dm );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the indices of the \a k largest elements along the given dimension of a dense
+//        array.
+// \ingroup dense_array
+//
+// \param dm The given dense array.
+// \param k The number of elements to select.
+// \return The array of indices of the \a k largest elements.
+// \exception std::invalid_argument Invalid number of selected elements.
+//
+// This function selects the \a k largest elements of the given dense array \a dm along the
+// dimension \a R (\a R == 0 denotes the innermost dimension, i.e. the columns) and returns
+// their positions along this dimension. The resulting array has the same dimensions as \a dm,
+// except for dimension \a R which has the extent \a k. The indices are sorted by decreasing
+// value, equal values are ordered by their position.
+*/
+template< size_t R      // Reduced dimension
+        , typename MT > // Type of the dense array
+DynamicArray< MT::num_dimensions, size_t > topk( const DenseArray<MT>& dm, size_t k )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   using ET = ElementType_t<MT>;
+   using RT = ResultType_t<MT>;
+
+   constexpr size_t N( MT::num_dimensions );
+
+   BLAZE_STATIC_ASSERT_MSG( R < N, "Invalid reduction dimension" );
+
+   If_t< IsSame_v<MT,RT>, const MT&, const RT > A( *dm );
+
+   const auto& dims( A.dimensions() );
+   const size_t length( dims[R] );
+
+   if( k > length ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid number of selected elements" );
+   }
+
+   std::array<size_t,N> rdims( dims );
+   rdims[R] = k;
+
+   DynamicArray<N,size_t> res( rdims );
+
+   size_t rows( 1UL );
+   for( size_t d=1UL; d<N; ++d ) {
+      rows *= dims[d];
+   }
+
+   const ET* const base( A.data() );
+   const size_t nn ( A.spacing() );
+   const size_t rnn( res.spacing() );
+   size_t* const out( res.data() );
+
+   if( R == 0UL ) {
+      selectionFor( rows, useSMPSelection( rows*length ), [&]( size_t c )
+      {
+         const ET* row( base + c*nn );
+         topkLanes<ET>( [row]( size_t t ) { return row + t; }, length, 1UL, k,
+                        [&]( size_t r, size_t, size_t idx, const ET& ) {
+                           out[c*rnn + r] = idx;
+                        } );
+      } );
+      return res;
+   }
+
+   size_t inner( 1UL );
+   for( size_t d=1UL; d<R; ++d ) {
+      inner *= dims[d];
+   }
+
+   const size_t chains( length > 0UL ? rows / length : 0UL );
+   const size_t width ( dims[0] );
+   const size_t blocks( ( width + SELECTION_LANE_BLOCK - 1UL ) / SELECTION_LANE_BLOCK );
+
+   selectionFor( chains*blocks, useSMPSelection( rows*width ), [&]( size_t cb )
+   {
+      const size_t c    ( cb / blocks );
+      const size_t jbegin( ( cb % blocks ) * SELECTION_LANE_BLOCK );
+      const size_t jsize( min( SELECTION_LANE_BLOCK, width - jbegin ) );
+
+      topkLanes<ET>( [&]( size_t t ) {
+                        return base + ( ( c / inner * length + t ) * inner + c % inner ) * nn + jbegin;
+                     },
+                     length, jsize, k,
+                     [&]( size_t r, size_t j, size_t idx, const ET& ) {
+                        out[( ( c / inner * k + r ) * inner + c % inner ) * rnn + jbegin + j] = idx;
+                     } );
+   } );
+
+   return res;
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
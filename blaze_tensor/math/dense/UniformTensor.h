@@ -103,6 +103,7 @@
 #include <blaze_tensor/math/traits/SubtensorTrait.h>
 #include <blaze_tensor/math/typetraits/IsDenseTensor.h>
 #include <blaze_tensor/math/typetraits/IsTensor.h>
+#include <blaze_tensor/system/Thresholds.h>
 
 #include <utility>
 
@@ -1367,7 +1368,7 @@ inline bool UniformTensor<Type>::isAligned() const noexcept
 template< typename Type > // Data type of the tensor
 inline bool UniformTensor<Type>::canSMPAssign() const noexcept
 {
-   return ( pages() * rows() * columns() >= SMP_DMATASSIGN_THRESHOLD );
+   return ( pages() * rows() * columns() >= smpDTensAssignThreshold() );
 }
 //*************************************************************************************************
 
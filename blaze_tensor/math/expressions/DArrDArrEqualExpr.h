@@ -43,6 +43,7 @@
 
 #include <blaze/math/expressions/DMatDMatEqualExpr.h>
 
+#include <blaze_tensor/math/dense/ParallelAnyOf.h>
 #include <blaze_tensor/math/expressions/DenseArray.h>
 #include <blaze_tensor/util/ArrayForEach.h>
 
@@ -126,10 +127,9 @@ inline bool //EnableIf_t< !DArrDArrEqualExprHelper<MT1,MT2>::value, bool >
 
    // In order to compare the two arrays, the data values of the lower-order data
    // type are converted to the higher-order data type within the equal function.
-   return ArrayForEachGroupedAllOf(
-      ( *lhs ).dimensions(), [&]( std::array< size_t, N > const& dims ) {
-         return equal( A( dims ), B( dims ) );
-      } );
+   return !arrayAnyOf( A.dimensions(), [&]( std::array< size_t, N > const& dims ) {
+      return !equal< RF >( A( dims ), B( dims ) );
+   } );
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -0,0 +1,1127 @@
+//=================================================================================================
+/*!
+//  \file blaze_tensor/math/expressions/DArrNaryMapExpr.h
+//  \brief Header file for the dense array n-ary map expression
+//
+//  Copyright (C) 2012-2018 Klaus Iglberger - All Rights Reserved
+//  Copyright (C) 2018 Hartmut Kaiser - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+
+#ifndef _BLAZE_TENSOR_MATH_EXPRESSIONS_DARRNARYMAPEXPR_H_
+#define _BLAZE_TENSOR_MATH_EXPRESSIONS_DARRNARYMAPEXPR_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <iterator>
+#include <tuple>
+#include <utility>
+#include <blaze/math/expressions/Forward.h>
+#include <blaze/math/expressions/DMatDMatMapExpr.h>
+#include <blaze/math/typetraits/IsSIMDEnabled.h>
+#include <blaze/util/StaticAssert.h>
+
+#include <blaze_tensor/math/dense/Forward.h>
+#include <blaze_tensor/math/expressions/DenseArray.h>
+#include <blaze_tensor/math/expressions/Forward.h>
+#include <blaze_tensor/math/expressions/NaryMapExpr.h>
+#include <blaze_tensor/math/functors/Select.h>
+#include <blaze_tensor/math/typetraits/IsDenseArray.h>
+#include <blaze_tensor/util/ArrayForEach.h>
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DARRNARYMAPEXPR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Expression object for the n-ary dense array map() function.
+// \ingroup dense_array_expression
+//
+// The DArrNaryMapExpr class represents the compile time expression for the element-wise
+// evaluation of a custom operation on the elements of three or more dense arrays via the
+// map() function. In contrast to a nesting of binary map expressions, all operands are
+// traversed in a single pass and the SIMD \a load() function of the custom operation is
+// directly applied to the SIMD elements of all operands.
+*/
+template< typename OP        // Type of the custom operation
+        , typename... MTs >  // Types of the dense array operands
+class DArrNaryMapExpr
+   : public NaryMapExpr< DenseArray< DArrNaryMapExpr<OP,MTs...> > >
+   , private Computation
+{
+ private:
+   //**Type definitions****************************************************************************
+   //! Type of the first dense array operand.
+   using MT1 = std::tuple_element_t< 0UL, std::tuple<MTs...> >;
+
+   //! Index sequence over all dense array operands.
+   using Indices = std::index_sequence_for<MTs...>;
+
+   //! Composite type of a single dense array operand.
+   template< typename MT >
+   using Operand_t = If_t< IsExpression_v<MT>, const MT, const MT& >;
+
+   //! Type of a single dense array operand after an optional intermediate evaluation.
+   template< typename MT >
+   using Evaluated_t = If_t< RequiresEvaluation_v<MT>, const ResultType_t<MT>, const MT& >;
+
+   //! Operand type of the map expression over the intermediately evaluated operands.
+   template< typename MT >
+   using EvaluatedOperand_t = If_t< RequiresEvaluation_v<MT>, ResultType_t<MT>, MT >;
+
+   //! Definition of the HasSIMDEnabled type trait.
+   BLAZE_CREATE_HAS_DATA_OR_FUNCTION_MEMBER_TYPE_TRAIT( HasSIMDEnabled, simdEnabled );
+
+   //! Definition of the HasLoad type trait.
+   BLAZE_CREATE_HAS_DATA_OR_FUNCTION_MEMBER_TYPE_TRAIT( HasLoad, load );
+   //**********************************************************************************************
+
+   //**Serial evaluation strategy******************************************************************
+   //! Compilation switch for the serial evaluation strategy of the map expression.
+   /*! The \a useAssign compile time constant expression represents a compilation switch for
+       the serial evaluation strategy of the map expression. In case any of the dense array
+       operands requires an intermediate evaluation, \a useAssign will be set to 1 and the
+       map expression will be evaluated via the \a assign function family. Otherwise
+       \a useAssign will be set to 0 and the expression will be evaluated via the subscript
+       operator. */
+   static constexpr bool useAssign = !NaryAnd< !RequiresEvaluation_v<MTs>... >::value;
+
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper variable template for the explicit application of the SFINAE principle.
+   template< typename MT >
+   static constexpr bool UseAssign_v = useAssign;
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Parallel evaluation strategy****************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper variable template for the explicit application of the SFINAE principle.
+   /*! This variable template is a helper for the selection of the parallel evaluation strategy.
+       In case at least one of the dense array operands is not SMP assignable and at least one
+       of the operands requires an intermediate evaluation, the variable is set to 1 and the
+       expression specific evaluation strategy is selected. Otherwise the variable is set to 0
+       and the default strategy is chosen. */
+   template< typename MT >
+   static constexpr bool UseSMPAssign_v =
+      ( !NaryAnd< MTs::smpAssignable... >::value && useAssign );
+   /*! \endcond */
+   //**********************************************************************************************
+
+ public:
+   //**Type definitions****************************************************************************
+   using This = DArrNaryMapExpr<OP,MTs...>;  //!< Type of this DArrNaryMapExpr instance.
+
+   //! Return type for expression template evaluations.
+   using ReturnType = decltype( std::declval<OP>()( std::declval< ReturnType_t<MTs> >()... ) );
+
+   using ElementType   = RemoveCV_t< RemoveReference_t<ReturnType> >;  //!< Resulting element type.
+   using ResultType    = DynamicArray<MT1::num_dimensions,ElementType>;  //!< Result type for expression template evaluations.
+   using OppositeType  = OppositeType_t<ResultType>;                     //!< Result type with opposite storage order for expression template evaluations.
+   using TransposeType = TransposeType_t<ResultType>;                    //!< Transpose type for expression template evaluations.
+
+   //! Data type for composite expression templates.
+   using CompositeType = If_t< useAssign, const ResultType, const DArrNaryMapExpr& >;
+
+   //! Composite types of all dense array operands.
+   using Operands = std::tuple< Operand_t<MTs>... >;
+
+   //! Data type of the custom operation.
+   using Operation = OP;
+   //**********************************************************************************************
+
+   //**ConstIterator class definition**************************************************************
+   /*!\brief Iterator over the elements of the dense array map expression.
+   */
+   class ConstIterator
+   {
+    public:
+      //**Type definitions*************************************************************************
+      using IteratorCategory = std::random_access_iterator_tag;  //!< The iterator category.
+      using ValueType        = ElementType;                      //!< Type of the underlying elements.
+      using PointerType      = ElementType*;                     //!< Pointer return type.
+      using ReferenceType    = ElementType&;                     //!< Reference return type.
+      using DifferenceType   = ptrdiff_t;                        //!< Difference between two iterators.
+
+      // STL iterator requirements
+      using iterator_category = IteratorCategory;  //!< The iterator category.
+      using value_type        = ValueType;         //!< Type of the underlying elements.
+      using pointer           = PointerType;       //!< Pointer return type.
+      using reference         = ReferenceType;     //!< Reference return type.
+      using difference_type   = DifferenceType;    //!< Difference between two iterators.
+
+      //! ConstIterator types of all dense array operands.
+      using IteratorTypes = std::tuple< ConstIterator_t<MTs>... >;
+      //*******************************************************************************************
+
+      //**Constructor******************************************************************************
+      /*!\brief Constructor for the ConstIterator class.
+      //
+      // \param its Iterators to the initial elements of all operands.
+      // \param op The custom operation.
+      */
+      explicit inline ConstIterator( IteratorTypes its, OP op )
+         : its_( its )  // Iterators to the current elements of all operands
+         , op_ ( op  )  // The custom operation
+      {}
+      //*******************************************************************************************
+
+      //**Addition assignment operator*************************************************************
+      /*!\brief Addition assignment operator.
+      //
+      // \param inc The increment of the iterator.
+      // \return The incremented iterator.
+      */
+      inline ConstIterator& operator+=( size_t inc ) {
+         increment( inc, Indices() );
+         return *this;
+      }
+      //*******************************************************************************************
+
+      //**Subtraction assignment operator**********************************************************
+      /*!\brief Subtraction assignment operator.
+      //
+      // \param dec The decrement of the iterator.
+      // \return The decremented iterator.
+      */
+      inline ConstIterator& operator-=( size_t dec ) {
+         decrement( dec, Indices() );
+         return *this;
+      }
+      //*******************************************************************************************
+
+      //**Prefix increment operator****************************************************************
+      /*!\brief Pre-increment operator.
+      //
+      // \return Reference to the incremented iterator.
+      */
+      inline ConstIterator& operator++() {
+         increment( 1UL, Indices() );
+         return *this;
+      }
+      //*******************************************************************************************
+
+      //**Postfix increment operator***************************************************************
+      /*!\brief Post-increment operator.
+      //
+      // \return The previous position of the iterator.
+      */
+      inline const ConstIterator operator++( int ) {
+         const ConstIterator tmp( *this );
+         increment( 1UL, Indices() );
+         return tmp;
+      }
+      //*******************************************************************************************
+
+      //**Prefix decrement operator****************************************************************
+      /*!\brief Pre-decrement operator.
+      //
+      // \return Reference to the decremented iterator.
+      */
+      inline ConstIterator& operator--() {
+         decrement( 1UL, Indices() );
+         return *this;
+      }
+      //*******************************************************************************************
+
+      //**Postfix decrement operator***************************************************************
+      /*!\brief Post-decrement operator.
+      //
+      // \return The previous position of the iterator.
+      */
+      inline const ConstIterator operator--( int ) {
+         const ConstIterator tmp( *this );
+         decrement( 1UL, Indices() );
+         return tmp;
+      }
+      //*******************************************************************************************
+
+      //**Element access operator******************************************************************
+      /*!\brief Direct access to the element at the current iterator position.
+      //
+      // \return The resulting value.
+      */
+      inline ReturnType operator*() const {
+         return dereference( Indices() );
+      }
+      //*******************************************************************************************
+
+      //**Load function****************************************************************************
+      /*!\brief Access to the SIMD elements of the array.
+      //
+      // \return The resulting SIMD element.
+      */
+      inline auto load() const noexcept {
+         return loadAll( Indices() );
+      }
+      //*******************************************************************************************
+
+      //**Equality operator************************************************************************
+      /*!\brief Equality comparison between two ConstIterator objects.
+      //
+      // \param rhs The right-hand side iterator.
+      // \return \a true if the iterators refer to the same element, \a false if not.
+      */
+      inline bool operator==( const ConstIterator& rhs ) const {
+         return std::get<0UL>( its_ ) == std::get<0UL>( rhs.its_ );
+      }
+      //*******************************************************************************************
+
+      //**Inequality operator**********************************************************************
+      /*!\brief Inequality comparison between two ConstIterator objects.
+      //
+      // \param rhs The right-hand side iterator.
+      // \return \a true if the iterators don't refer to the same element, \a false if they do.
+      */
+      inline bool operator!=( const ConstIterator& rhs ) const {
+         return std::get<0UL>( its_ ) != std::get<0UL>( rhs.its_ );
+      }
+      //*******************************************************************************************
+
+      //**Less-than operator***********************************************************************
+      /*!\brief Less-than comparison between two ConstIterator objects.
+      //
+      // \param rhs The right-hand side iterator.
+      // \return \a true if the left-hand side iterator is smaller, \a false if not.
+      */
+      inline bool operator<( const ConstIterator& rhs ) const {
+         return std::get<0UL>( its_ ) < std::get<0UL>( rhs.its_ );
+      }
+      //*******************************************************************************************
+
+      //**Greater-than operator********************************************************************
+      /*!\brief Greater-than comparison between two ConstIterator objects.
+      //
+      // \param rhs The right-hand side iterator.
+      // \return \a true if the left-hand side iterator is greater, \a false if not.
+      */
+      inline bool operator>( const ConstIterator& rhs ) const {
+         return std::get<0UL>( its_ ) > std::get<0UL>( rhs.its_ );
+      }
+      //*******************************************************************************************
+
+      //**Less-or-equal-than operator**************************************************************
+      /*!\brief Less-than comparison between two ConstIterator objects.
+      //
+      // \param rhs The right-hand side iterator.
+      // \return \a true if the left-hand side iterator is smaller or equal, \a false if not.
+      */
+      inline bool operator<=( const ConstIterator& rhs ) const {
+         return std::get<0UL>( its_ ) <= std::get<0UL>( rhs.its_ );
+      }
+      //*******************************************************************************************
+
+      //**Greater-or-equal-than operator***********************************************************
+      /*!\brief Greater-than comparison between two ConstIterator objects.
+      //
+      // \param rhs The right-hand side iterator.
+      // \return \a true if the left-hand side iterator is greater or equal, \a false if not.
+      */
+      inline bool operator>=( const ConstIterator& rhs ) const {
+         return std::get<0UL>( its_ ) >= std::get<0UL>( rhs.its_ );
+      }
+      //*******************************************************************************************
+
+      //**Subtraction operator*********************************************************************
+      /*!\brief Calculating the number of elements between two iterators.
+      //
+      // \param rhs The right-hand side iterator.
+      // \return The number of elements between the two iterators.
+      */
+      inline DifferenceType operator-( const ConstIterator& rhs ) const {
+         return std::get<0UL>( its_ ) - std::get<0UL>( rhs.its_ );
+      }
+      //*******************************************************************************************
+
+      //**Addition operator************************************************************************
+      /*!\brief Addition between a ConstIterator and an integral value.
+      //
+      // \param it The iterator to be incremented.
+      // \param inc The number of elements the iterator is incremented.
+      // \return The incremented iterator.
+      */
+      friend inline const ConstIterator operator+( const ConstIterator& it, size_t inc ) {
+         ConstIterator tmp( it );
+         return tmp += inc;
+      }
+      //*******************************************************************************************
+
+      //**Addition operator************************************************************************
+      /*!\brief Addition between an integral value and a ConstIterator.
+      //
+      // \param inc The number of elements the iterator is incremented.
+      // \param it The iterator to be incremented.
+      // \return The incremented iterator.
+      */
+      friend inline const ConstIterator operator+( size_t inc, const ConstIterator& it ) {
+         ConstIterator tmp( it );
+         return tmp += inc;
+      }
+      //*******************************************************************************************
+
+      //**Subtraction operator*********************************************************************
+      /*!\brief Subtraction between a ConstIterator and an integral value.
+      //
+      // \param it The iterator to be decremented.
+      // \param dec The number of elements the iterator is decremented.
+      // \return The decremented iterator.
+      */
+      friend inline const ConstIterator operator-( const ConstIterator& it, size_t dec ) {
+         ConstIterator tmp( it );
+         return tmp -= dec;
+      }
+      //*******************************************************************************************
+
+    private:
+      //**Iterator helpers*************************************************************************
+      /*! \cond BLAZE_INTERNAL */
+      template< size_t... I >
+      inline void increment( size_t inc, std::index_sequence<I...> ) {
+         using Swallow = int[];
+         (void)Swallow{ 0, ( std::get<I>( its_ ) += inc, 0 )... };
+      }
+
+      template< size_t... I >
+      inline void decrement( size_t dec, std::index_sequence<I...> ) {
+         using Swallow = int[];
+         (void)Swallow{ 0, ( std::get<I>( its_ ) -= dec, 0 )... };
+      }
+
+      template< size_t... I >
+      inline ReturnType dereference( std::index_sequence<I...> ) const {
+         return op_( *std::get<I>( its_ )... );
+      }
+
+      template< size_t... I >
+      inline auto loadAll( std::index_sequence<I...> ) const noexcept {
+         return op_.load( std::get<I>( its_ ).load()... );
+      }
+      /*! \endcond */
+      //*******************************************************************************************
+
+      //**Member variables*************************************************************************
+      IteratorTypes its_;  //!< Iterators to the current elements of all operands.
+      OP            op_;   //!< The custom operation.
+      //*******************************************************************************************
+   };
+   //**********************************************************************************************
+
+   //**Compilation flags***************************************************************************
+   //! Compilation switch for the expression template evaluation strategy.
+   static constexpr bool simdEnabled =
+      ( NaryAnd< MTs::simdEnabled... >::value &&
+        If_t< HasSIMDEnabled_v<OP>, GetNarySIMDEnabled< OP, ElementType_t<MTs>... >, HasLoad<OP> >::value );
+
+   //! Compilation switch for the expression template assignment strategy.
+   static constexpr bool smpAssignable = NaryAnd< MTs::smpAssignable... >::value;
+   //**********************************************************************************************
+
+   //**SIMD properties*****************************************************************************
+   //! The number of elements packed within a single SIMD element.
+   static constexpr size_t SIMDSIZE = SIMDTrait<ElementType>::size;
+   //**********************************************************************************************
+
+   //**Constructor*********************************************************************************
+   /*!\brief Constructor for the DArrNaryMapExpr class.
+   //
+   // \param operands The dense array operands of the map expression.
+   // \param op The custom operation.
+   */
+   explicit inline DArrNaryMapExpr( const MTs&... operands, OP op ) noexcept
+      : operands_( operands... )  // Dense array operands of the map expression
+      , op_      ( op          )  // The custom operation
+   {}
+   //**********************************************************************************************
+
+   //**Access operator*****************************************************************************
+   /*!\brief ND-access to the array elements.
+   //
+   // \param dims Access indices for all dimensions of the array, outermost first.
+   // \return The resulting value.
+   */
+   template< typename... Dims >
+   inline ReturnType operator()( Dims... dims ) const {
+      return evaluate( Indices(), dims... );
+   }
+   //**********************************************************************************************
+
+   //**At function*********************************************************************************
+   /*!\brief Checked access to the array elements.
+   //
+   // \param dims Access indices for all dimensions of the array, outermost first.
+   // \return The resulting value.
+   // \exception std::out_of_range Invalid array access index.
+   */
+   template< typename... Dims >
+   inline ReturnType at( Dims... dims ) const {
+      const size_t indices[] = { size_t( dims )... };
+
+      ArrayDimForEach( dimensions(), [&]( size_t i, size_t dim ) {
+         if( indices[num_dimensions - i - 1] >= dim ) {
+            BLAZE_THROW_OUT_OF_RANGE( "Invalid array access index" );
+         }
+      } );
+      return (*this)(dims...);
+   }
+   //**********************************************************************************************
+
+   //**Load function*******************************************************************************
+   /*!\brief Access to the SIMD elements of the array.
+   //
+   // \param dims Access indices for all dimensions of the array, outermost first.
+   // \return Reference to the accessed values.
+   */
+   template< typename... Dims >
+   BLAZE_ALWAYS_INLINE auto load( Dims... dims ) const noexcept {
+      return loadAll( Indices(), dims... );
+   }
+   //**********************************************************************************************
+
+   //**Begin function******************************************************************************
+   /*!\brief Returns an iterator to the first non-zero element of row \a i.
+   //
+   // \param i The row index.
+   // \param dims The indices of the remaining outer dimensions.
+   // \return Iterator to the first non-zero element of row \a i.
+   */
+   template< typename... Dims >
+   inline ConstIterator begin( size_t i, Dims... dims ) const {
+      return beginAll( Indices(), i, dims... );
+   }
+   //**********************************************************************************************
+
+   //**End function********************************************************************************
+   /*!\brief Returns an iterator just past the last non-zero element of row \a i.
+   //
+   // \param i The row index.
+   // \param dims The indices of the remaining outer dimensions.
+   // \return Iterator just past the last non-zero element of row \a i.
+   */
+   template< typename... Dims >
+   inline ConstIterator end( size_t i, Dims... dims ) const {
+      return endAll( Indices(), i, dims... );
+   }
+   //**********************************************************************************************
+
+   //**Dimensions function*************************************************************************
+   //! The number of dimensions of the array.
+   static constexpr size_t num_dimensions = MT1::num_dimensions;
+
+   /*!\brief Returns the current dimensions of the array.
+   //
+   // \return The dimensions of the array.
+   */
+   inline decltype(auto) dimensions() const noexcept {
+      return std::get<0UL>( operands_ ).dimensions();
+   }
+   //**********************************************************************************************
+
+   //**Dimension function**************************************************************************
+   /*!\brief Returns the current number of elements in the given dimension of the array.
+   //
+   // \return The number of elements in the given dimension of the array.
+   */
+   template< size_t Dim >
+   inline size_t dimension() const noexcept {
+      return std::get<0UL>( operands_ ).template dimension<Dim>();
+   }
+   //**********************************************************************************************
+
+   //**Operand access******************************************************************************
+   /*!\brief Returns the \a I-th dense array operand.
+   //
+   // \return The \a I-th dense array operand.
+   */
+   template< size_t I >
+   inline std::tuple_element_t<I,Operands> operand() const noexcept {
+      return std::get<I>( operands_ );
+   }
+   //**********************************************************************************************
+
+   //**Operation access****************************************************************************
+   /*!\brief Returns a copy of the custom operation.
+   //
+   // \return A copy of the custom operation.
+   */
+   inline Operation operation() const {
+      return op_;
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Returns whether the expression can alias with the given address \a alias.
+   //
+   // \param alias The alias to be checked.
+   // \return \a true in case the expression can alias, \a false otherwise.
+   */
+   template< typename T >
+   inline bool canAlias( const T* alias ) const noexcept {
+      return canAliasAny( alias, Indices() );
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Returns whether the expression is aliased with the given address \a alias.
+   //
+   // \param alias The alias to be checked.
+   // \return \a true in case an alias effect is detected, \a false otherwise.
+   */
+   template< typename T >
+   inline bool isAliased( const T* alias ) const noexcept {
+      return isAliasedAny( alias, Indices() );
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Returns whether the operands of the expression are properly aligned in memory.
+   //
+   // \return \a true in case the operands are aligned, \a false if not.
+   */
+   inline bool isAligned() const noexcept {
+      return isAlignedAll( Indices() );
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Returns whether the expression can be used in SMP assignments.
+   //
+   // \return \a true in case the expression can be used in SMP assignments, \a false if not.
+   */
+   inline bool canSMPAssign() const noexcept {
+      return canSMPAssignAll( Indices() );
+   }
+   //**********************************************************************************************
+
+ private:
+   //**Operand helpers*****************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   template< size_t... I, typename... Dims >
+   BLAZE_ALWAYS_INLINE ReturnType evaluate( std::index_sequence<I...>, Dims... dims ) const {
+      return op_( std::get<I>( operands_ )(dims...)... );
+   }
+
+   template< size_t... I, typename... Dims >
+   BLAZE_ALWAYS_INLINE auto loadAll( std::index_sequence<I...>, Dims... dims ) const noexcept {
+      return op_.load( std::get<I>( operands_ ).load(dims...)... );
+   }
+
+   template< size_t... I, typename... Dims >
+   inline ConstIterator beginAll( std::index_sequence<I...>, size_t i, Dims... dims ) const {
+      using IteratorTypes = typename ConstIterator::IteratorTypes;
+      return ConstIterator( IteratorTypes( std::get<I>( operands_ ).begin(i,dims...)... ), op_ );
+   }
+
+   template< size_t... I, typename... Dims >
+   inline ConstIterator endAll( std::index_sequence<I...>, size_t i, Dims... dims ) const {
+      using IteratorTypes = typename ConstIterator::IteratorTypes;
+      return ConstIterator( IteratorTypes( std::get<I>( operands_ ).end(i,dims...)... ), op_ );
+   }
+
+   template< typename T, size_t... I >
+   inline bool canAliasAny( const T* alias, std::index_sequence<I...> ) const noexcept {
+      return naryAny( { ( IsExpression_v<MTs> && std::get<I>( operands_ ).canAlias( alias ) )... } );
+   }
+
+   template< typename T, size_t... I >
+   inline bool isAliasedAny( const T* alias, std::index_sequence<I...> ) const noexcept {
+      return naryAny( { std::get<I>( operands_ ).isAliased( alias )... } );
+   }
+
+   template< size_t... I >
+   inline bool isAlignedAll( std::index_sequence<I...> ) const noexcept {
+      return naryAll( { std::get<I>( operands_ ).isAligned()... } );
+   }
+
+   template< size_t... I >
+   inline bool canSMPAssignAll( std::index_sequence<I...> ) const noexcept {
+      return naryAll( { std::get<I>( operands_ ).canSMPAssign()... } );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Intermediate evaluation*********************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Evaluation of an operand that requires an intermediate evaluation.
+   */
+   template< typename MT >
+   static inline EnableIf_t< RequiresEvaluation_v<MT>, ResultType_t<MT> >
+      evaluateOperand( const MT& operand )
+   {
+      return ResultType_t<MT>( operand );
+   }
+
+   /*!\brief Pass-through of an operand that does not require an intermediate evaluation.
+   */
+   template< typename MT >
+   static inline EnableIf_t< !RequiresEvaluation_v<MT>, const MT& >
+      evaluateOperand( const MT& operand )
+   {
+      return operand;
+   }
+
+   /*!\brief Evaluates all operands requiring an intermediate evaluation and passes the map
+   //        expression over the evaluated operands to the given assignment function.
+   //
+   // \param assignment The assignment function to be applied to the resulting map expression.
+   // \return void
+   */
+   template< typename F, size_t... I >
+   inline void evaluateOperands( F&& assignment, std::index_sequence<I...> ) const
+   {
+      using Evaluated = DArrNaryMapExpr< OP, EvaluatedOperand_t<MTs>... >;
+
+      const std::tuple< Evaluated_t<MTs>... > evaluated(
+         evaluateOperand<MTs>( std::get<I>( operands_ ) )... );
+
+      assignment( Evaluated( std::get<I>( evaluated )..., op_ ) );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   Operands  operands_;  //!< Dense array operands of the map expression.
+   Operation op_;        //!< The custom operation.
+   //**********************************************************************************************
+
+   //**Assignment to dense arrays*****************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Assignment of an n-ary dense array map expression to a dense array.
+   // \ingroup dense_array
+   //
+   // \param lhs The target left-hand side dense array.
+   // \param rhs The right-hand side map expression to be assigned.
+   // \return void
+   //
+   // This function implements the performance optimized assignment of an n-ary dense array
+   // map expression to a dense array. Due to the explicit application of the SFINAE principle,
+   // this function can only be selected by the compiler in case any of the operands requires
+   // an intermediate evaluation.
+   */
+   template< typename MT > // Type of the target dense array
+   friend inline EnableIf_t< UseAssign_v<MT> >
+      assign( DenseArray<MT>& lhs, const DArrNaryMapExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (*lhs).dimensions() == rhs.dimensions(), "Invalid number of elements" );
+
+      rhs.evaluateOperands( [&lhs]( const auto& expr ){ assign( *lhs, expr ); }, Indices() );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Addition assignment to dense arrays********************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Addition assignment of an n-ary dense array map expression to a dense array.
+   // \ingroup dense_array
+   //
+   // \param lhs The target left-hand side dense array.
+   // \param rhs The right-hand side map expression to be added.
+   // \return void
+   //
+   // This function implements the performance optimized addition assignment of an n-ary dense
+   // array map expression to a dense array. Due to the explicit application of the SFINAE
+   // principle, this function can only be selected by the compiler in case any of the operands
+   // requires an intermediate evaluation.
+   */
+   template< typename MT > // Type of the target dense array
+   friend inline EnableIf_t< UseAssign_v<MT> >
+      addAssign( DenseArray<MT>& lhs, const DArrNaryMapExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (*lhs).dimensions() == rhs.dimensions(), "Invalid number of elements" );
+
+      rhs.evaluateOperands( [&lhs]( const auto& expr ){ addAssign( *lhs, expr ); }, Indices() );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Subtraction assignment to dense arrays*****************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Subtraction assignment of an n-ary dense array map expression to a dense array.
+   // \ingroup dense_array
+   //
+   // \param lhs The target left-hand side dense array.
+   // \param rhs The right-hand side map expression to be subtracted.
+   // \return void
+   //
+   // This function implements the performance optimized subtraction assignment of an n-ary
+   // dense array map expression to a dense array. Due to the explicit application of the
+   // SFINAE principle, this function can only be selected by the compiler in case any of the
+   // operands requires an intermediate evaluation.
+   */
+   template< typename MT > // Type of the target dense array
+   friend inline EnableIf_t< UseAssign_v<MT> >
+      subAssign( DenseArray<MT>& lhs, const DArrNaryMapExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (*lhs).dimensions() == rhs.dimensions(), "Invalid number of elements" );
+
+      rhs.evaluateOperands( [&lhs]( const auto& expr ){ subAssign( *lhs, expr ); }, Indices() );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Schur product assignment to dense arrays***************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Schur product assignment of an n-ary dense array map expression to a dense array.
+   // \ingroup dense_array
+   //
+   // \param lhs The target left-hand side dense array.
+   // \param rhs The right-hand side map expression for the Schur product.
+   // \return void
+   //
+   // This function implements the performance optimized Schur product assignment of an n-ary
+   // dense array map expression to a dense array. Due to the explicit application of the
+   // SFINAE principle, this function can only be selected by the compiler in case any of the
+   // operands requires an intermediate evaluation.
+   */
+   template< typename MT > // Type of the target dense array
+   friend inline EnableIf_t< UseAssign_v<MT> >
+      schurAssign( DenseArray<MT>& lhs, const DArrNaryMapExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (*lhs).dimensions() == rhs.dimensions(), "Invalid number of elements" );
+
+      rhs.evaluateOperands( [&lhs]( const auto& expr ){ schurAssign( *lhs, expr ); }, Indices() );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**SMP assignment to dense arrays*************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMP assignment of an n-ary dense array map expression to a dense array.
+   // \ingroup dense_array
+   //
+   // \param lhs The target left-hand side dense array.
+   // \param rhs The right-hand side map expression to be assigned.
+   // \return void
+   //
+   // This function implements the performance optimized SMP assignment of an n-ary dense
+   // array map expression to a dense array. Due to the explicit application of the SFINAE
+   // principle, this function can only be selected by the compiler in case the expression
+   // specific parallel evaluation strategy is selected.
+   */
+   template< typename MT > // Type of the target dense array
+   friend inline EnableIf_t< UseSMPAssign_v<MT> >
+      smpAssign( DenseArray<MT>& lhs, const DArrNaryMapExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (*lhs).dimensions() == rhs.dimensions(), "Invalid number of elements" );
+
+      rhs.evaluateOperands( [&lhs]( const auto& expr ){ smpAssign( *lhs, expr ); }, Indices() );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**SMP addition assignment to dense arrays****************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMP addition assignment of an n-ary dense array map expression to a dense array.
+   // \ingroup dense_array
+   //
+   // \param lhs The target left-hand side dense array.
+   // \param rhs The right-hand side map expression to be added.
+   // \return void
+   //
+   // This function implements the performance optimized SMP addition assignment of an n-ary
+   // dense array map expression to a dense array. Due to the explicit application of the
+   // SFINAE principle, this function can only be selected by the compiler in case the
+   // expression specific parallel evaluation strategy is selected.
+   */
+   template< typename MT > // Type of the target dense array
+   friend inline EnableIf_t< UseSMPAssign_v<MT> >
+      smpAddAssign( DenseArray<MT>& lhs, const DArrNaryMapExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (*lhs).dimensions() == rhs.dimensions(), "Invalid number of elements" );
+
+      rhs.evaluateOperands( [&lhs]( const auto& expr ){ smpAddAssign( *lhs, expr ); }, Indices() );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**SMP subtraction assignment to dense arrays*************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMP subtraction assignment of an n-ary dense array map expression to a dense array.
+   // \ingroup dense_array
+   //
+   // \param lhs The target left-hand side dense array.
+   // \param rhs The right-hand side map expression to be subtracted.
+   // \return void
+   //
+   // This function implements the performance optimized SMP subtraction assignment of an
+   // n-ary dense array map expression to a dense array. Due to the explicit application of
+   // the SFINAE principle, this function can only be selected by the compiler in case the
+   // expression specific parallel evaluation strategy is selected.
+   */
+   template< typename MT > // Type of the target dense array
+   friend inline EnableIf_t< UseSMPAssign_v<MT> >
+      smpSubAssign( DenseArray<MT>& lhs, const DArrNaryMapExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (*lhs).dimensions() == rhs.dimensions(), "Invalid number of elements" );
+
+      rhs.evaluateOperands( [&lhs]( const auto& expr ){ smpSubAssign( *lhs, expr ); }, Indices() );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**SMP Schur product assignment to dense arrays***********************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMP Schur product assignment of an n-ary dense array map expression to a dense
+   //        array.
+   // \ingroup dense_array
+   //
+   // \param lhs The target left-hand side dense array.
+   // \param rhs The right-hand side map expression for the Schur product.
+   // \return void
+   //
+   // This function implements the performance optimized SMP Schur product assignment of an
+   // n-ary dense array map expression to a dense array. Due to the explicit application of
+   // the SFINAE principle, this function can only be selected by the compiler in case the
+   // expression specific parallel evaluation strategy is selected.
+   */
+   template< typename MT > // Type of the target dense array
+   friend inline EnableIf_t< UseSMPAssign_v<MT> >
+      smpSchurAssign( DenseArray<MT>& lhs, const DArrNaryMapExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (*lhs).dimensions() == rhs.dimensions(), "Invalid number of elements" );
+
+      rhs.evaluateOperands( [&lhs]( const auto& expr ){ smpSchurAssign( *lhs, expr ); }, Indices() );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_STATIC_ASSERT( sizeof...( MTs ) > 2UL );
+   BLAZE_STATIC_ASSERT( NaryAnd< IsDenseArray_v<MTs>... >::value );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend implementation of the n-ary map() function for dense arrays.
+// \ingroup dense_array
+//
+// \param op The custom operation.
+// \param first The first dense array operand.
+// \param rest The remaining dense array operands.
+// \return The custom operation applied to each single element of the given operands.
+// \exception std::invalid_argument Array sizes do not match.
+*/
+template< typename OP        // Type of the custom operation
+        , typename MT1       // Type of the first dense array
+        , typename... MTs >  // Types of the remaining dense arrays
+inline decltype(auto)
+   nmap_backend( OP op, const DenseArray<MT1>& first, const DenseArray<MTs>&... rest )
+{
+   if( !naryAll( { ( (*rest).dimensions() == (*first).dimensions() )... } ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Array sizes do not match" );
+   }
+
+   using ReturnType = const DArrNaryMapExpr<OP,MT1,MTs...>;
+   return ReturnType( *first, *rest..., op );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Evaluates the given custom operation on each single element of three or more dense
+//        arrays.
+// \ingroup dense_array
+//
+// \param a1 The first dense array operand.
+// \param a2 The second dense array operand.
+// \param a3 The third dense array operand.
+// \param args Any further dense array operands, followed by the custom operation.
+// \return The custom operation applied to each single element of the given operands.
+// \exception std::invalid_argument Array sizes do not match.
+//
+// The \a map() function evaluates the given custom operation on each element of the given
+// input arrays. All operands are traversed in a single pass, i.e. each array is read exactly
+// once, and in case the custom operation provides a \a load() function and all operands are
+// SIMD enabled, the evaluation is vectorized across all operands. The following example
+// demonstrates the fused update \f$ Y = aX + bY + cZ \f$:
+
+   \code
+   struct Axpbypcz
+   {
+      double a, b, c;
+
+      template< typename T >
+      T operator()( const T& x, const T& y, const T& z ) const { return a*x + b*y + c*z; }
+
+      template< typename T >
+      T load( const T& x, const T& y, const T& z ) const { return set(a)*x + set(b)*y + set(c)*z; }
+   };
+
+   blaze::DynamicArray<4UL,double> X, Y, Z;
+   // ... Resizing and initialization
+   Y = map( X, Y, Z, Axpbypcz{ 2.0, 3.0, 4.0 } );
+   \endcode
+*/
+template< typename MT1       // Type of the first dense array
+        , typename MT2       // Type of the second dense array
+        , typename MT3       // Type of the third dense array
+        , typename... Args > // Types of the further operands and the custom operation
+inline decltype(auto)
+   map( const DenseArray<MT1>& a1, const DenseArray<MT2>& a2, const DenseArray<MT3>& a3,
+        const Args&... args )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return nmap_backend( std::forward_as_tuple( a1, a2, a3, args... ),
+                        std::make_index_sequence< 2UL + sizeof...( Args ) >() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Element-wise selection between the elements of two dense arrays.
+// \ingroup dense_array
+//
+// \param mask The dense array mask.
+// \param lhs The dense array providing the elements for non-zero mask elements.
+// \param rhs The dense array providing the elements for zero mask elements.
+// \return The element-wise selection between \a lhs and \a rhs.
+// \exception std::invalid_argument Array sizes do not match.
+//
+// The \a select() function returns an expression representing the element-wise selection
+// between the two dense arrays \a lhs and \a rhs, i.e. each element of the result is the
+// corresponding element of \a lhs in case the corresponding element of \a mask is non-zero
+// and the element of \a rhs otherwise. The three arrays are traversed in a single pass:
+
+   \code
+   blaze::DynamicArray<4UL,bool> M;
+   blaze::DynamicArray<4UL,double> A, B, C;
+   // ... Resizing and initialization
+   C = select( M, A, B );
+   \endcode
+*/
+template< typename MT1  // Type of the dense array mask
+        , typename MT2  // Type of the left-hand side dense array
+        , typename MT3 > // Type of the right-hand side dense array
+inline decltype(auto)
+   select( const DenseArray<MT1>& mask, const DenseArray<MT2>& lhs, const DenseArray<MT3>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return nmap_backend( Select(), *mask, *lhs, *rhs );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Element-wise selection between the elements of two dense arrays.
+// \ingroup dense_array
+//
+// \param mask The dense array mask.
+// \param lhs The dense array providing the elements for non-zero mask elements.
+// \param rhs The dense array providing the elements for zero mask elements.
+// \return The element-wise selection between \a lhs and \a rhs.
+// \exception std::invalid_argument Array sizes do not match.
+//
+// This function is a synonym for the select() function.
+*/
+template< typename MT1  // Type of the dense array mask
+        , typename MT2  // Type of the left-hand side dense array
+        , typename MT3 > // Type of the right-hand side dense array
+inline decltype(auto)
+   where( const DenseArray<MT1>& mask, const DenseArray<MT2>& lhs, const DenseArray<MT3>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return select( *mask, *lhs, *rhs );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ISALIGNED SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename OP, typename... MTs >
+struct IsAligned< DArrNaryMapExpr<OP,MTs...> >
+   : public BoolConstant< NaryAnd< IsAligned_v<MTs>... >::value >
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ISPADDED SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename OP, typename... MTs >
+struct IsPadded< DArrNaryMapExpr<OP,MTs...> >
+   : public BoolConstant< NaryAnd< IsPadded_v<MTs>... >::value >
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
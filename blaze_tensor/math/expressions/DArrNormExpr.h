@@ -41,11 +41,14 @@
 // Includes
 //*************************************************************************************************
 
+#include <array>
 #include <utility>
+#include <vector>
 
 #include <blaze/math/Aliases.h>
 #include <blaze/math/SIMD.h>
 #include <blaze/math/functors/Abs.h>
+#include <blaze/math/functors/Add.h>
 #include <blaze/math/functors/Bind2nd.h>
 #include <blaze/math/functors/Cbrt.h>
 #include <blaze/math/functors/L1Norm.h>
@@ -53,6 +56,7 @@
 #include <blaze/math/functors/L3Norm.h>
 #include <blaze/math/functors/L4Norm.h>
 #include <blaze/math/functors/LpNorm.h>
+#include <blaze/math/functors/Max.h>
 #include <blaze/math/functors/Noop.h>
 #include <blaze/math/functors/Pow.h>
 #include <blaze/math/functors/Pow2.h>
@@ -63,6 +67,8 @@
 #include <blaze/math/shims/Evaluate.h>
 #include <blaze/math/shims/Invert.h>
 #include <blaze/math/shims/IsZero.h>
+#include <blaze/math/smp/Functions.h>
+#include <blaze/math/smp/SerialSection.h>
 #include <blaze/math/traits/MultTrait.h>
 #include <blaze/math/typetraits/HasLoad.h>
 #include <blaze/math/typetraits/HasSIMDAdd.h>
@@ -76,13 +82,17 @@
 #include <blaze/util/StaticAssert.h>
 #include <blaze/util/TypeList.h>
 #include <blaze/util/Types.h>
+#include <blaze/util/algorithms/Min.h>
 #include <blaze/util/mpl/And.h>
 #include <blaze/util/mpl/If.h>
 #include <blaze/util/typetraits/HasMember.h>
+#include <blaze/util/typetraits/IsBuiltin.h>
 #include <blaze/util/typetraits/RemoveConst.h>
 #include <blaze/util/typetraits/RemoveReference.h>
 
 #include <blaze_tensor/math/expressions/DenseArray.h>
+#include <blaze_tensor/math/smp/ParallelFor.h>
+#include <blaze_tensor/system/Thresholds.h>
 #include <blaze_tensor/util/ArrayForEach.h>
 
 namespace blaze {
@@ -134,6 +144,119 @@ struct DArrNormHelper
 //=================================================================================================
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Kernel for the accumulation of a range of rows of a dense array.
+// \ingroup dense_array
+//
+// \param tmp The given (evaluated) dense array.
+// \param abs The functor for the abs operation.
+// \param power The functor for the power operation.
+// \param acc The functor for the accumulation (blaze::Add or blaze::Max).
+// \param begin The first row of the range.
+// \param end The row after the last row of the range.
+// \return The accumulated partial result of the given range of rows.
+//
+// This function accumulates the elements of the rows \a begin to \a end of the given array. A
+// row is a contiguous run of elements along the innermost dimension; the rows are numbered in
+// storage order over all remaining dimensions.
+*/
+template< typename AT     // Type of the dense array
+        , typename Abs    // Type of the abs operation
+        , typename Power  // Type of the power operation
+        , typename Acc >  // Type of the accumulation operation
+inline ElementType_t<AT>
+   normRows( const DenseArray<AT>& tmp, Abs abs, Power power, Acc acc, size_t begin, size_t end )
+{
+   using ET = ElementType_t<AT>;
+
+   constexpr size_t N( AT::num_dimensions );
+
+   const std::array<size_t,N>& dims( (*tmp).dimensions() );
+
+   std::array<size_t,N> index{};
+   ET norm{};
+
+   for( size_t r=begin; r<end; ++r )
+   {
+      size_t row( r );
+      for( size_t d=1UL; d<N; ++d ) {
+         index[d] = row % dims[d];
+         row /= dims[d];
+      }
+
+      for( index[0]=0UL; index[0]<dims[0]; ++index[0] ) {
+         norm = acc( norm, power( abs( (*tmp)( index ) ) ) );
+      }
+   }
+
+   return norm;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Accumulates all elements of a dense array for the norm computation.
+// \ingroup dense_array
+//
+// \param dm The given non-empty dense array.
+// \param abs The functor for the abs operation.
+// \param power The functor for the power operation.
+// \param acc The functor for the accumulation (blaze::Add or blaze::Max).
+// \return The accumulated result, i.e. the norm before the application of the root operation.
+//
+// In case the array is large enough and no serial section is active, the rows of the array are
+// split into several contiguous chunks that are accumulated in parallel (see blaze::smpFor()).
+// The partial results of the chunks are combined in chunk order afterwards.
+*/
+template< typename MT     // Type of the dense array
+        , typename Abs    // Type of the abs operation
+        , typename Power  // Type of the power operation
+        , typename Acc >  // Type of the accumulation operation
+ElementType_t<MT> normAccumulate( const DenseArray<MT>& dm, Abs abs, Power power, Acc acc )
+{
+   using CT = CompositeType_t<MT>;
+   using ET = ElementType_t<MT>;
+
+   CT tmp( *dm );
+
+   BLAZE_INTERNAL_ASSERT( tmp.dimensions() == (*dm).dimensions(), "Invalid number of elements" );
+
+   constexpr size_t N( MT::num_dimensions );
+
+   size_t rows( 1UL );
+   for( size_t d=1UL; d<N; ++d ) {
+      rows *= tmp.dimensions()[d];
+   }
+
+   const bool parallel( !isSerialSectionActive() && rows > 1UL &&
+                        rows*tmp.dimensions()[0] >= smpDArrAssignThreshold() );
+
+   if( !parallel ) {
+      return normRows( tmp, abs, power, acc, 0UL, rows );
+   }
+
+   const size_t chunks( min( rows, getNumThreads()*4UL ) );
+   std::vector<ET> partials( chunks );
+
+   smpFor( 0UL, chunks, [&]( size_t chunk ) {
+      partials[chunk] = normRows( tmp, abs, power, acc, ( rows*chunk ) / chunks,
+                                  ( rows*(chunk+1UL) ) / chunks );
+   } );
+
+   ET norm( partials[0UL] );
+   for( size_t chunk=1UL; chunk<chunks; ++chunk ) {
+      norm = acc( norm, partials[chunk] );
+   }
+
+   return norm;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
 /*!\brief Computes a custom norm for the given dense array.
@@ -161,7 +284,6 @@ template< typename MT      // Type of the dense array
         , typename Root >  // Type of the root operation
 decltype(auto) norm_backend( const DenseArray<MT>& dm, Abs abs, Power power, Root root )
 {
-   using CT = CompositeType_t<MT>;
    using ET = ElementType_t<MT>;
    using RT = decltype( evaluate( root( std::declval<ET>() ) ) );
 
@@ -170,22 +292,7 @@ decltype(auto) norm_backend( const DenseArray<MT>& dm, Abs abs, Power power, Roo
       return RT{};
    }
 
-   CT tmp( *dm );
-
-   BLAZE_INTERNAL_ASSERT( tmp.dimensions() == (*dm).dimensions(), "Invalid number of elements" );
-
-   using AT = RemoveCV_t<RemoveReference_t< decltype( *dm ) > >;
-   constexpr size_t N = AT::num_dimensions;
-
-   std::array< size_t, N > dims{};
-   ET norm( power( abs( tmp( dims ) ) ) );
-
-   ArrayForEachGrouped( ( *dm ).dimensions(),
-      [&]( std::array< size_t, N > const& ds ) {
-         norm += power( abs( tmp( ds ) ) );
-      } );
-
-   return evaluate( root( norm ) );
+   return evaluate( root( normAccumulate( *dm, abs, power, Add() ) ) );
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -409,6 +516,41 @@ inline decltype(auto) lpNorm( const DenseArray<MT>& dm )
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend implementation of the maximum norm for arrays with built-in element type.
+// \ingroup dense_array
+*/
+template< typename MT > // Type of the dense array
+inline decltype(auto) maxNorm_backend( const DenseArray<MT>& dm, TrueType )
+{
+   using ET = ElementType_t<MT>;
+
+   if( ArrayDimAnyOf( ( *dm ).dimensions(),
+          []( size_t i, size_t dim ) { return dim == 0; } ) ) {
+      return ET{};
+   }
+
+   return normAccumulate( *dm, Abs(), Noop(), Max() );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend implementation of the maximum norm for arrays with non-built-in element type.
+// \ingroup dense_array
+*/
+template< typename MT > // Type of the dense array
+inline decltype(auto) maxNorm_backend( const DenseArray<MT>& dm, FalseType )
+{
+   return max( abs( *dm ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief Computes the maximum norm for the given dense array.
 // \ingroup dense_array
@@ -429,7 +571,7 @@ decltype(auto) maxNorm( const DenseArray<MT>& dm )
 {
    BLAZE_FUNCTION_TRACE;
 
-   return max( abs( *dm ) );
+   return maxNorm_backend( *dm, Bool_t< IsBuiltin_v< ElementType_t<MT> > >() );
 }
 //*************************************************************************************************
 
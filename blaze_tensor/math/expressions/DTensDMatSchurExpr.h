@@ -639,7 +639,7 @@ class DTensDMatSchurExpr
    */
    inline bool canSMPAssign() const noexcept {
       return lhs_.canSMPAssign() || rhs_.canSMPAssign() ||
-             ( rows() * columns() * pages() >= SMP_DTENSDMATSCHUR_THRESHOLD );
+             ( rows() * columns() * pages() >= smpDTensDMatSchurThreshold() );
    }
    //**********************************************************************************************
 
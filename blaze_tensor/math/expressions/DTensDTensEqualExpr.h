@@ -43,6 +43,7 @@
 
 #include <blaze/math/expressions/DMatDMatEqualExpr.h>
 
+#include <blaze_tensor/math/dense/ParallelAnyOf.h>
 #include <blaze_tensor/math/expressions/DenseTensor.h>
 
 namespace blaze {
@@ -122,15 +123,11 @@ inline EnableIf_t< !DTensDTensEqualExprHelper<MT1,MT2>::value, bool >
 
    // In order to compare the two matrices, the data values of the lower-order data
    // type are converted to the higher-order data type within the equal function.
-   for (size_t k=0UL; k<A.pages(); ++k) {
-      for (size_t i=0UL; i<A.rows(); ++i) {
-         for (size_t j=0UL; j<A.columns(); ++j) {
-            if (!equal(A(k, i, j), B(k, i, j)))
-               return false;
-         }
-      }
-   }
-   return true;
+   const auto mismatch( [&]( size_t k, size_t i, size_t j ) {
+      return !equal<RF>( A(k,i,j), B(k,i,j) );
+   } );
+
+   return !tensorAnyOf<1UL>( A.pages(), A.rows(), A.columns(), mismatch, mismatch );
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -157,8 +154,6 @@ inline EnableIf_t< DTensDTensEqualExprHelper<MT1,MT2>::value, bool >
 {
    using CT1 = CompositeType_t<MT1>;
    using CT2 = CompositeType_t<MT2>;
-   using XT1 = RemoveReference_t<CT1>;
-   using XT2 = RemoveReference_t<CT2>;
 
    // Early exit in case the tensor sizes don't match
    if( (*lhs).rows() != (*rhs).rows() || (*lhs).columns() != (*rhs).columns() || (*lhs).pages() != (*rhs).pages() )
@@ -169,40 +164,16 @@ inline EnableIf_t< DTensDTensEqualExprHelper<MT1,MT2>::value, bool >
    CT2 B( *rhs );
 
    constexpr size_t SIMDSIZE = SIMDTrait< ElementType_t<MT1> >::size;
-   constexpr bool remainder( !IsPadded_v<XT1> || !IsPadded_v<XT2> );
-
-   const size_t M( A.rows()    );
-   const size_t N( A.columns() );
-   const size_t O( A.pages()   );
-
-   const size_t jpos( ( remainder )?( N & size_t(-SIMDSIZE) ):( N ) );
-   BLAZE_INTERNAL_ASSERT( !remainder || ( N - ( N % SIMDSIZE ) ) == jpos, "Invalid end calculation" );
-
-   for (size_t k=0UL; k<O; ++k)
-   {
-      for (size_t i=0UL; i<M; ++i)
-      {
-         size_t j(0UL);
-
-         for (; (j+SIMDSIZE*3UL) < jpos; j+=SIMDSIZE*4UL) {
-            if (!equal(A.load(k, i, j), B.load(k, i, j))) return false;
-            if (!equal(A.load(k, i, j+SIMDSIZE), B.load(k, i, j+SIMDSIZE))) return false;
-            if (!equal(A.load(k, i, j+SIMDSIZE*2UL), B.load(k, i, j+SIMDSIZE*2UL))) return false;
-            if (!equal(A.load(k, i, j+SIMDSIZE*3UL), B.load(k, i, j+SIMDSIZE*3UL))) return false;
-         }
-         for (; (j+SIMDSIZE) < jpos; j+=SIMDSIZE*2UL) {
-            if (!equal(A.load(k, i, j), B.load(k, i, j))) return false;
-            if (!equal(A.load(k, i, j+SIMDSIZE), B.load(k, i, j+SIMDSIZE))) return false;
-         }
-         for (; j<jpos; j+=SIMDSIZE) {
-            if (!equal(A.load(k, i, j), B.load(k, i, j))) return false;
-         }
-         for (; remainder && j<A.columns(); ++j) {
-            if (!equal(A(k, i, j), B(k, i, j))) return false;
-         }
-      }
-   }
-   return true;
+
+   const auto simdMismatch( [&]( size_t k, size_t i, size_t j ) {
+      return !equal<RF>( A.load(k,i,j), B.load(k,i,j) );
+   } );
+
+   const auto mismatch( [&]( size_t k, size_t i, size_t j ) {
+      return !equal<RF>( A(k,i,j), B(k,i,j) );
+   } );
+
+   return !tensorAnyOf<SIMDSIZE>( A.pages(), A.rows(), A.columns(), simdMismatch, mismatch );
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -50,6 +50,7 @@
 #include <blaze_tensor/math/expressions/Forward.h>
 #include <blaze_tensor/math/expressions/TensScalarMultExpr.h>
 #include <blaze_tensor/math/expressions/TensTensMultExpr.h>
+#include <blaze_tensor/util/KernelTrace.h>
 
 namespace blaze {
 
@@ -720,6 +721,8 @@ class DTensDTensMultExpr
    static inline EnableIf_t< !UseVectorizedDefaultKernel_v<MT3,MT4,MT5> >
       selectSmallAssignKernel( MT3& C, const MT4& A, const MT5& B )
    {
+      BLAZE_KERNEL_TRACE( "default small assign", DTensDTensMultExpr, C, 1UL );
+
       selectDefaultAssignKernel( C, A, B );
    }
    /*! \endcond */
@@ -746,6 +749,8 @@ class DTensDTensMultExpr
    static inline EnableIf_t< UseVectorizedDefaultKernel_v<MT3,MT4,MT5> >
       selectSmallAssignKernel( DenseTensor<MT3>& C, const MT4& A, const MT5& B )
    {
+      BLAZE_KERNEL_TRACE( "vectorized small assign", DTensDTensMultExpr, *C, 1UL );
+
       constexpr bool remainder( !IsPadded_v<MT3> || !IsPadded_v<MT5> );
 
       const size_t M( A.rows()    );
@@ -1296,6 +1301,8 @@ class DTensDTensMultExpr
    static inline EnableIf_t< !UseVectorizedDefaultKernel_v<MT3,MT4,MT5> >
       selectLargeAssignKernel( MT3& C, const MT4& A, const MT5& B )
    {
+      BLAZE_KERNEL_TRACE( "default large assign", DTensDTensMultExpr, C, 1UL );
+
       selectDefaultAssignKernel( C, A, B );
    }
    /*! \endcond */
@@ -1321,6 +1328,8 @@ class DTensDTensMultExpr
    static inline EnableIf_t< UseVectorizedDefaultKernel_v<MT3,MT4,MT5> >
       selectLargeAssignKernel( MT3& C, const MT4& A, const MT5& B )
    {
+      BLAZE_KERNEL_TRACE( "vectorized large assign", DTensDTensMultExpr, C, 1UL );
+
       if( SYM )
          smmm( C, A, B, ElementType(1) );
       else if( HERM )
@@ -1379,6 +1388,8 @@ class DTensDTensMultExpr
    static inline EnableIf_t< UseBlasKernel_v<MT3,MT4,MT5> >
       selectBlasAssignKernel( MT3& C, const MT4& A, const MT5& B )
    {
+      BLAZE_KERNEL_TRACE( "blas assign", DTensDTensMultExpr, C, 1UL );
+
       using ET = ElementType_t<MT3>;
 
       gemm( C, A, B, ET(1), ET(0) );
@@ -1671,6 +1682,8 @@ class DTensDTensMultExpr
    static inline EnableIf_t< !UseVectorizedDefaultKernel_v<MT3,MT4,MT5> >
       selectSmallAddAssignKernel( MT3& C, const MT4& A, const MT5& B )
    {
+      BLAZE_KERNEL_TRACE( "default small add assign", DTensDTensMultExpr, C, 1UL );
+
       selectDefaultAddAssignKernel( C, A, B );
    }
    /*! \endcond */
@@ -1697,6 +1710,8 @@ class DTensDTensMultExpr
    static inline EnableIf_t< UseVectorizedDefaultKernel_v<MT3,MT4,MT5> >
       selectSmallAddAssignKernel( DenseTensor<MT3>& C, const MT4& A, const MT5& B )
    {
+      BLAZE_KERNEL_TRACE( "vectorized small add assign", DTensDTensMultExpr, *C, 1UL );
+
       constexpr bool remainder( !IsPadded_v<MT3> || !IsPadded_v<MT5> );
 
       const size_t M( A.rows()    );
@@ -2410,6 +2425,8 @@ class DTensDTensMultExpr
    static inline EnableIf_t< !UseVectorizedDefaultKernel_v<MT3,MT4,MT5> >
       selectLargeAddAssignKernel( MT3& C, const MT4& A, const MT5& B )
    {
+      BLAZE_KERNEL_TRACE( "default large add assign", DTensDTensMultExpr, C, 1UL );
+
       selectDefaultAddAssignKernel( C, A, B );
    }
    /*! \endcond */
@@ -2436,6 +2453,8 @@ class DTensDTensMultExpr
    static inline EnableIf_t< UseVectorizedDefaultKernel_v<MT3,MT4,MT5> >
       selectLargeAddAssignKernel( MT3& C, const MT4& A, const MT5& B )
    {
+      BLAZE_KERNEL_TRACE( "vectorized large add assign", DTensDTensMultExpr, C, 1UL );
+
       if( LOW )
          lmmm( C, A, B, ElementType(1), ElementType(1) );
       else if( UPP )
@@ -2492,6 +2511,8 @@ class DTensDTensMultExpr
    static inline EnableIf_t< UseBlasKernel_v<MT3,MT4,MT5> >
       selectBlasAddAssignKernel( MT3& C, const MT4& A, const MT5& B )
    {
+      BLAZE_KERNEL_TRACE( "blas add assign", DTensDTensMultExpr, C, 1UL );
+
       using ET = ElementType_t<MT3>;
 
       if( IsTriangular_v<MT4> ) {
@@ -2797,6 +2818,8 @@ class DTensDTensMultExpr
    static inline EnableIf_t< !UseVectorizedDefaultKernel_v<MT3,MT4,MT5> >
       selectSmallSubAssignKernel( MT3& C, const MT4& A, const MT5& B )
    {
+      BLAZE_KERNEL_TRACE( "default small sub assign", DTensDTensMultExpr, C, 1UL );
+
       selectDefaultSubAssignKernel( C, A, B );
    }
    /*! \endcond */
@@ -2823,6 +2846,8 @@ class DTensDTensMultExpr
    static inline EnableIf_t< UseVectorizedDefaultKernel_v<MT3,MT4,MT5> >
       selectSmallSubAssignKernel( DenseTensor<MT3>& C, const MT4& A, const MT5& B )
    {
+      BLAZE_KERNEL_TRACE( "vectorized small sub assign", DTensDTensMultExpr, *C, 1UL );
+
       constexpr bool remainder( !IsPadded_v<MT3> || !IsPadded_v<MT5> );
 
       const size_t M( A.rows()    );
@@ -3536,6 +3561,8 @@ class DTensDTensMultExpr
    static inline EnableIf_t< !UseVectorizedDefaultKernel_v<MT3,MT4,MT5> >
       selectLargeSubAssignKernel( MT3& C, const MT4& A, const MT5& B )
    {
+      BLAZE_KERNEL_TRACE( "default large sub assign", DTensDTensMultExpr, C, 1UL );
+
       selectDefaultSubAssignKernel( C, A, B );
    }
    /*! \endcond */
@@ -3562,6 +3589,8 @@ class DTensDTensMultExpr
    static inline EnableIf_t< UseVectorizedDefaultKernel_v<MT3,MT4,MT5> >
       selectLargeSubAssignKernel( MT3& C, const MT4& A, const MT5& B )
    {
+      BLAZE_KERNEL_TRACE( "vectorized large sub assign", DTensDTensMultExpr, C, 1UL );
+
       if( LOW )
          lmmm( C, A, B, ElementType(-1), ElementType(1) );
       else if( UPP )
@@ -3618,6 +3647,8 @@ class DTensDTensMultExpr
    static inline EnableIf_t< UseBlasKernel_v<MT3,MT4,MT5> >
       selectBlasSubAssignKernel( MT3& C, const MT4& A, const MT5& B )
    {
+      BLAZE_KERNEL_TRACE( "blas sub assign", DTensDTensMultExpr, C, 1UL );
+
       using ET = ElementType_t<MT3>;
 
       if( IsTriangular_v<MT4> ) {
@@ -4515,6 +4546,8 @@ class DTensScalarMultExpr< DTensDTensMultExpr<MT1,MT2>, ST >
    static inline EnableIf_t< !UseVectorizedDefaultKernel_v<MT3,MT4,MT5,ST2> >
       selectSmallAssignKernel( MT3& C, const MT4& A, const MT5& B, ST2 scalar )
    {
+      BLAZE_KERNEL_TRACE( "default small assign", DTensScalarMultExpr, C, 1UL );
+
       selectDefaultAssignKernel( C, A, B, scalar );
    }
    //**********************************************************************************************
@@ -4541,6 +4574,8 @@ class DTensScalarMultExpr< DTensDTensMultExpr<MT1,MT2>, ST >
    static inline EnableIf_t< UseVectorizedDefaultKernel_v<MT3,MT4,MT5,ST2> >
       selectSmallAssignKernel( DenseTensor<MT3>& C, const MT4& A, const MT5& B, ST2 scalar )
    {
+      BLAZE_KERNEL_TRACE( "vectorized small assign", DTensScalarMultExpr, *C, 1UL );
+
       constexpr bool remainder( !IsPadded_v<MT3> || !IsPadded_v<MT5> );
 
       const size_t M( A.rows()    );
@@ -5223,6 +5258,8 @@ class DTensScalarMultExpr< DTensDTensMultExpr<MT1,MT2>, ST >
    static inline EnableIf_t< !UseVectorizedDefaultKernel_v<MT3,MT4,MT5,ST2> >
       selectLargeAssignKernel( MT3& C, const MT4& A, const MT5& B, ST2 scalar )
    {
+      BLAZE_KERNEL_TRACE( "default large assign", DTensScalarMultExpr, C, 1UL );
+
       selectDefaultAssignKernel( C, A, B, scalar );
    }
    //**********************************************************************************************
@@ -5249,6 +5286,8 @@ class DTensScalarMultExpr< DTensDTensMultExpr<MT1,MT2>, ST >
    static inline EnableIf_t< UseVectorizedDefaultKernel_v<MT3,MT4,MT5,ST2> >
       selectLargeAssignKernel( MT3& C, const MT4& A, const MT5& B, ST2 scalar )
    {
+      BLAZE_KERNEL_TRACE( "vectorized large assign", DTensScalarMultExpr, C, 1UL );
+
       if( SYM )
          smmm( C, A, B, scalar );
       else if( HERM )
@@ -5309,6 +5348,8 @@ class DTensScalarMultExpr< DTensDTensMultExpr<MT1,MT2>, ST >
    static inline EnableIf_t< UseBlasKernel_v<MT3,MT4,MT5,ST2> >
       selectBlasAssignKernel( MT3& C, const MT4& A, const MT5& B, ST2 scalar )
    {
+      BLAZE_KERNEL_TRACE( "blas assign", DTensScalarMultExpr, C, 1UL );
+
       using ET = ElementType_t<MT3>;
 
       if( IsTriangular_v<MT4> ) {
@@ -5571,6 +5612,8 @@ class DTensScalarMultExpr< DTensDTensMultExpr<MT1,MT2>, ST >
    static inline EnableIf_t< !UseVectorizedDefaultKernel_v<MT3,MT4,MT5,ST2> >
       selectSmallAddAssignKernel( MT3& C, const MT4& A, const MT5& B, ST2 scalar )
    {
+      BLAZE_KERNEL_TRACE( "default small add assign", DTensScalarMultExpr, C, 1UL );
+
       selectDefaultAddAssignKernel( C, A, B, scalar );
    }
    //**********************************************************************************************
@@ -5597,6 +5640,8 @@ class DTensScalarMultExpr< DTensDTensMultExpr<MT1,MT2>, ST >
    static inline EnableIf_t< UseVectorizedDefaultKernel_v<MT3,MT4,MT5,ST2> >
       selectSmallAddAssignKernel( DenseTensor<MT3>& C, const MT4& A, const MT5& B, ST2 scalar )
    {
+      BLAZE_KERNEL_TRACE( "vectorized small add assign", DTensScalarMultExpr, *C, 1UL );
+
       constexpr bool remainder( !IsPadded_v<MT3> || !IsPadded_v<MT5> );
 
       const size_t M( A.rows()    );
@@ -6247,6 +6292,8 @@ class DTensScalarMultExpr< DTensDTensMultExpr<MT1,MT2>, ST >
    static inline EnableIf_t< !UseVectorizedDefaultKernel_v<MT3,MT4,MT5,ST2> >
       selectLargeAddAssignKernel( MT3& C, const MT4& A, const MT5& B, ST2 scalar )
    {
+      BLAZE_KERNEL_TRACE( "default large add assign", DTensScalarMultExpr, C, 1UL );
+
       selectDefaultAddAssignKernel( C, A, B, scalar );
    }
    //**********************************************************************************************
@@ -6273,6 +6320,8 @@ class DTensScalarMultExpr< DTensDTensMultExpr<MT1,MT2>, ST >
    static inline EnableIf_t< UseVectorizedDefaultKernel_v<MT3,MT4,MT5,ST2> >
       selectLargeAddAssignKernel( MT3& C, const MT4& A, const MT5& B, ST2 scalar )
    {
+      BLAZE_KERNEL_TRACE( "vectorized large add assign", DTensScalarMultExpr, C, 1UL );
+
       if( LOW )
          lmmm( C, A, B, scalar, ST2(1) );
       else if( UPP )
@@ -6329,6 +6378,8 @@ class DTensScalarMultExpr< DTensDTensMultExpr<MT1,MT2>, ST >
    static inline EnableIf_t< UseBlasKernel_v<MT3,MT4,MT5,ST2> >
       selectBlasAddAssignKernel( MT3& C, const MT4& A, const MT5& B, ST2 scalar )
    {
+      BLAZE_KERNEL_TRACE( "blas add assign", DTensScalarMultExpr, C, 1UL );
+
       using ET = ElementType_t<MT3>;
 
       if( IsTriangular_v<MT4> ) {
@@ -6593,6 +6644,8 @@ class DTensScalarMultExpr< DTensDTensMultExpr<MT1,MT2>, ST >
    static inline EnableIf_t< !UseVectorizedDefaultKernel_v<MT3,MT4,MT5,ST2> >
       selectSmallSubAssignKernel( MT3& C, const MT4& A, const MT5& B, ST2 scalar )
    {
+      BLAZE_KERNEL_TRACE( "default small sub assign", DTensScalarMultExpr, C, 1UL );
+
       selectDefaultSubAssignKernel( C, A, B, scalar );
    }
    //**********************************************************************************************
@@ -6619,6 +6672,8 @@ class DTensScalarMultExpr< DTensDTensMultExpr<MT1,MT2>, ST >
    static inline EnableIf_t< UseVectorizedDefaultKernel_v<MT3,MT4,MT5,ST2> >
       selectSmallSubAssignKernel( DenseTensor<MT3>& C, const MT4& A, const MT5& B, ST2 scalar )
    {
+      BLAZE_KERNEL_TRACE( "vectorized small sub assign", DTensScalarMultExpr, *C, 1UL );
+
       constexpr bool remainder( !IsPadded_v<MT3> || !IsPadded_v<MT5> );
 
       const size_t M( A.rows()    );
@@ -7269,6 +7324,8 @@ class DTensScalarMultExpr< DTensDTensMultExpr<MT1,MT2>, ST >
    static inline EnableIf_t< !UseVectorizedDefaultKernel_v<MT3,MT4,MT5,ST2> >
       selectLargeSubAssignKernel( MT3& C, const MT4& A, const MT5& B, ST2 scalar )
    {
+      BLAZE_KERNEL_TRACE( "default large sub assign", DTensScalarMultExpr, C, 1UL );
+
       selectDefaultSubAssignKernel( C, A, B, scalar );
    }
    //**********************************************************************************************
@@ -7295,6 +7352,8 @@ class DTensScalarMultExpr< DTensDTensMultExpr<MT1,MT2>, ST >
    static inline EnableIf_t< UseVectorizedDefaultKernel_v<MT3,MT4,MT5,ST2> >
       selectLargeSubAssignKernel( MT3& C, const MT4& A, const MT5& B, ST2 scalar )
    {
+      BLAZE_KERNEL_TRACE( "vectorized large sub assign", DTensScalarMultExpr, C, 1UL );
+
       if( LOW )
          lmmm( C, A, B, -scalar, ST2(1) );
       else if( UPP )
@@ -7351,6 +7410,8 @@ class DTensScalarMultExpr< DTensDTensMultExpr<MT1,MT2>, ST >
    static inline EnableIf_t< UseBlasKernel_v<MT3,MT4,MT5,ST2> >
       selectBlasSubAssignKernel( MT3& C, const MT4& A, const MT5& B, ST2 scalar )
    {
+      BLAZE_KERNEL_TRACE( "blas sub assign", DTensScalarMultExpr, C, 1UL );
+
       using ET = ElementType_t<MT3>;
 
       if( IsTriangular_v<MT4> ) {
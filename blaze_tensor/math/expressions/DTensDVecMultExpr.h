@@ -105,6 +105,7 @@
 #include <blaze_tensor/math/views/RowSlice.h>
 #include <blaze_tensor/math/views/Subtensor.h>
 #include <blaze_tensor/system/Thresholds.h>
+#include <blaze_tensor/util/KernelTrace.h>
 
 namespace blaze {
 
@@ -373,8 +374,8 @@ class DTensDVecMultExpr
                !BLAZE_USE_BLAS_TENSOR_VECTOR_MULTIPLICATION ||
                !BLAZE_BLAS_IS_PARALLEL ||
                ( IsComputation_v<TT> && !evaluateTensor ) ||
-               ( tens_.pages() * tens_.rows() * tens_.columns() < DTENSDVECMULT_THRESHOLD ) ) &&
-               ( rows() * columns() > SMP_DTENSDVECMULT_THRESHOLD );
+               ( tens_.pages() * tens_.rows() * tens_.columns() < dtensDVecMultThreshold() ) ) &&
+               ( rows() * columns() > smpDTensDVecMultThreshold() );
    }
    //**********************************************************************************************
 
@@ -443,7 +444,7 @@ class DTensDVecMultExpr
            , typename VT1 >  // Type of the right-hand side vector operand
    static inline void selectAssignKernel( MT1& y, const TT1& A, const VT1& x )
    {
-      if( A.pages() * A.rows() * A.columns() < DTENSDVECMULT_THRESHOLD )
+      if( A.pages() * A.rows() * A.columns() < dtensDVecMultThreshold() )
          selectSmallAssignKernel( y, A, x );
       else
          selectLargeAssignKernel( y, A, x );
@@ -495,6 +496,8 @@ class DTensDVecMultExpr
    static inline auto selectSmallAssignKernel( MT1& y, const TT1& A, const VT1& x )
       -> EnableIf_t< !UseVectorizedDefaultKernel_v<MT1,TT1,VT1> >
    {
+      BLAZE_KERNEL_TRACE( "default small assign", DTensDVecMultExpr, y, 1UL );
+
       selectDefaultAssignKernel( y, A, x );
    }
    /*! \endcond */
@@ -520,6 +523,8 @@ class DTensDVecMultExpr
    static inline auto selectSmallAssignKernel( MT1& y, const TT1& A, const VT1& x )
       -> EnableIf_t< UseVectorizedDefaultKernel_v<MT1,TT1,VT1> >
    {
+      BLAZE_KERNEL_TRACE( "vectorized small assign", DTensDVecMultExpr, y, 1UL );
+
       constexpr bool remainder( !IsPadded_v<TT1> || !IsPadded_v<VT1> );
 
       const size_t M( A.rows()    );
@@ -712,6 +717,8 @@ class DTensDVecMultExpr
    static inline auto selectLargeAssignKernel( MT1& y, const TT1& A, const VT1& x )
       -> EnableIf_t< !UseVectorizedDefaultKernel_v<MT1,TT1,VT1> >
    {
+      BLAZE_KERNEL_TRACE( "default large assign", DTensDVecMultExpr, y, 1UL );
+
       selectDefaultAssignKernel( y, A, x );
    }
    /*! \endcond */
@@ -737,6 +744,8 @@ class DTensDVecMultExpr
    static inline auto selectLargeAssignKernel( MT1& y, const TT1& A, const VT1& x )
       -> EnableIf_t< UseVectorizedDefaultKernel_v<MT1,TT1,VT1> >
    {
+      BLAZE_KERNEL_TRACE( "vectorized large assign", DTensDVecMultExpr, y, 1UL );
+
       constexpr bool remainder( !IsPadded_v<TT1> || !IsPadded_v<VT1> );
 
       const size_t M( A.rows()    );
@@ -1042,7 +1051,7 @@ class DTensDVecMultExpr
            , typename VT1 >  // Type of the right-hand side vector operand
    static inline void selectAddAssignKernel( MT1& y, const TT1& A, const VT1& x )
    {
-      if ( A.pages() * A.rows() * A.columns() < DTENSDVECMULT_THRESHOLD )
+      if ( A.pages() * A.rows() * A.columns() < dtensDVecMultThreshold() )
          selectSmallAddAssignKernel( y, A, x );
       else
          selectLargeAddAssignKernel( y, A, x );
@@ -1094,6 +1103,8 @@ class DTensDVecMultExpr
    static inline auto selectSmallAddAssignKernel( MT1& y, const TT1& A, const VT1& x )
       -> EnableIf_t< !UseVectorizedDefaultKernel_v<MT1,TT1,VT1> >
    {
+      BLAZE_KERNEL_TRACE( "default small add assign", DTensDVecMultExpr, y, 1UL );
+
       selectDefaultAddAssignKernel( y, A, x );
    }
    /*! \endcond */
@@ -1119,6 +1130,8 @@ class DTensDVecMultExpr
    static inline auto selectSmallAddAssignKernel( MT1& y, const TT1& A, const VT1& x )
       -> EnableIf_t< UseVectorizedDefaultKernel_v<MT1,TT1,VT1> >
    {
+      BLAZE_KERNEL_TRACE( "vectorized small add assign", DTensDVecMultExpr, y, 1UL );
+
       constexpr bool remainder( !IsPadded_v<TT1> || !IsPadded_v<VT1> );
 
       const size_t M( A.rows()    );
@@ -1311,6 +1324,8 @@ class DTensDVecMultExpr
    static inline auto selectLargeAddAssignKernel( MT1& y, const TT1& A, const VT1& x )
       -> EnableIf_t< !UseVectorizedDefaultKernel_v<MT1,TT1,VT1> >
    {
+      BLAZE_KERNEL_TRACE( "default large add assign", DTensDVecMultExpr, y, 1UL );
+
       selectDefaultAddAssignKernel( y, A, x );
    }
    /*! \endcond */
@@ -1336,6 +1351,8 @@ class DTensDVecMultExpr
    static inline auto selectLargeAddAssignKernel( MT1& y, const TT1& A, const VT1& x )
       -> EnableIf_t< UseVectorizedDefaultKernel_v<MT1,TT1,VT1> >
    {
+      BLAZE_KERNEL_TRACE( "vectorized large add assign", DTensDVecMultExpr, y, 1UL );
+
       constexpr bool remainder( !IsPadded_v<TT1> || !IsPadded_v<VT1> );
 
       const size_t M( A.rows()    );
@@ -1609,7 +1626,7 @@ class DTensDVecMultExpr
            , typename VT1 >  // Type of the right-hand side vector operand
    static inline void selectSubAssignKernel( MT1& y, const TT1& A, const VT1& x )
    {
-      if( A.pages() * A.rows() * A.columns() < DTENSDVECMULT_THRESHOLD )
+      if( A.pages() * A.rows() * A.columns() < dtensDVecMultThreshold() )
          selectSmallSubAssignKernel( y, A, x );
       else
          selectLargeSubAssignKernel( y, A, x );
@@ -1661,6 +1678,8 @@ class DTensDVecMultExpr
    static inline auto selectSmallSubAssignKernel( MT1& y, const TT1& A, const VT1& x )
       -> EnableIf_t< !UseVectorizedDefaultKernel_v<MT1,TT1,VT1> >
    {
+      BLAZE_KERNEL_TRACE( "default small sub assign", DTensDVecMultExpr, y, 1UL );
+
       selectDefaultSubAssignKernel( y, A, x );
    }
    /*! \endcond */
@@ -1686,6 +1705,8 @@ class DTensDVecMultExpr
    static inline auto selectSmallSubAssignKernel( MT1& y, const TT1& A, const VT1& x )
       -> EnableIf_t< UseVectorizedDefaultKernel_v<MT1,TT1,VT1> >
    {
+      BLAZE_KERNEL_TRACE( "vectorized small sub assign", DTensDVecMultExpr, y, 1UL );
+
       constexpr bool remainder( !IsPadded_v<TT1> || !IsPadded_v<VT1> );
 
       const size_t M( A.rows()    );
@@ -1878,6 +1899,8 @@ class DTensDVecMultExpr
    static inline auto selectLargeSubAssignKernel( MT1& y, const TT1& A, const VT1& x )
       -> EnableIf_t< !UseVectorizedDefaultKernel_v<MT1,TT1,VT1> >
    {
+      BLAZE_KERNEL_TRACE( "default large sub assign", DTensDVecMultExpr, y, 1UL );
+
       selectDefaultSubAssignKernel( y, A, x );
    }
    /*! \endcond */
@@ -1903,6 +1926,8 @@ class DTensDVecMultExpr
    static inline auto selectLargeSubAssignKernel( MT1& y, const TT1& A, const VT1& x )
       -> EnableIf_t< UseVectorizedDefaultKernel_v<MT1,TT1,VT1> >
    {
+      BLAZE_KERNEL_TRACE( "vectorized large sub assign", DTensDVecMultExpr, y, 1UL );
+
       constexpr bool remainder( !IsPadded_v<TT1> || !IsPadded_v<VT1> );
 
       const size_t M( A.rows()    );
@@ -2639,8 +2664,8 @@ class DMatScalarMultExpr< DTensDVecMultExpr<TT,VT>, ST, false >
                !BLAZE_USE_BLAS_TENSOR_VECTOR_MULTIPLICATION ||
                !BLAZE_BLAS_IS_PARALLEL ||
                ( IsComputation_v<TT> && !evaluateTensor ) ||
-               ( A.pages() * A.rows() * A.columns() < DTENSDVECMULT_THRESHOLD ) ) &&
-               ( rows() * columns() > SMP_DTENSDVECMULT_THRESHOLD );
+               ( A.pages() * A.rows() * A.columns() < dtensDVecMultThreshold() ) ) &&
+               ( rows() * columns() > smpDTensDVecMultThreshold() );
    }
    //**********************************************************************************************
 
@@ -2711,7 +2736,7 @@ class DMatScalarMultExpr< DTensDVecMultExpr<TT,VT>, ST, false >
            , typename ST1 >  // Type of the scalar value
    static inline void selectAssignKernel( MT1& y, const TT1& A, const VT1& x, ST1 scalar )
    {
-      if( A.pages() * A.rows() * A.columns() < DTENSDVECMULT_THRESHOLD )
+      if( A.pages() * A.rows() * A.columns() < dtensDVecMultThreshold() )
          selectSmallAssignKernel( y, A, x, scalar );
       else
          selectLargeAssignKernel( y, A, x, scalar );
@@ -2764,6 +2789,8 @@ class DMatScalarMultExpr< DTensDVecMultExpr<TT,VT>, ST, false >
    static inline auto selectSmallAssignKernel( MT1& y, const TT1& A, const VT1& x, ST2 scalar )
       -> EnableIf_t< !UseVectorizedDefaultKernel_v<MT1,TT1,VT1,ST2> >
    {
+      BLAZE_KERNEL_TRACE( "default small assign", DMatScalarMultExpr, y, 1UL );
+
       selectDefaultAssignKernel( y, A, x, scalar );
    }
    //**********************************************************************************************
@@ -2789,6 +2816,8 @@ class DMatScalarMultExpr< DTensDVecMultExpr<TT,VT>, ST, false >
    static inline auto selectSmallAssignKernel( VT1& y, const TT1& A, const VT2& x, ST2 scalar )
       -> EnableIf_t< UseVectorizedDefaultKernel_v<VT1,TT1,VT2,ST2> >
    {
+      BLAZE_KERNEL_TRACE( "vectorized small assign", DMatScalarMultExpr, y, 1UL );
+
       constexpr bool remainder( !IsPadded_v<TT1> || !IsPadded_v<VT2> );
 
       const size_t M( A.rows()    );
@@ -2981,6 +3010,8 @@ class DMatScalarMultExpr< DTensDVecMultExpr<TT,VT>, ST, false >
    static inline auto selectLargeAssignKernel( MT1& y, const TT1& A, const VT1& x, ST2 scalar )
       -> EnableIf_t< !UseVectorizedDefaultKernel_v<MT1,TT1,VT1,ST2> >
    {
+      BLAZE_KERNEL_TRACE( "default large assign", DMatScalarMultExpr, y, 1UL );
+
       selectDefaultAssignKernel( y, A, x, scalar );
    }
    //**********************************************************************************************
@@ -3006,6 +3037,8 @@ class DMatScalarMultExpr< DTensDVecMultExpr<TT,VT>, ST, false >
    static inline auto selectLargeAssignKernel( VT1& y, const TT1& A, const VT2& x, ST2 scalar )
       -> EnableIf_t< UseVectorizedDefaultKernel_v<VT1,TT1,VT2,ST2> >
    {
+      BLAZE_KERNEL_TRACE( "vectorized large assign", DMatScalarMultExpr, y, 1UL );
+
       constexpr bool remainder( !IsPadded_v<TT1> || !IsPadded_v<VT2> );
 
       const size_t M( A.rows()    );
@@ -3325,7 +3358,7 @@ class DMatScalarMultExpr< DTensDVecMultExpr<TT,VT>, ST, false >
            , typename ST2 >  // Type of the scalar value
    static inline void selectAddAssignKernel( MT1& y, const TT1& A, const VT1& x, ST2 scalar )
    {
-      if( A.pages() * A.rows() * A.columns() < DTENSDVECMULT_THRESHOLD )
+      if( A.pages() * A.rows() * A.columns() < dtensDVecMultThreshold() )
          selectSmallAddAssignKernel( y, A, x, scalar );
       else
          selectLargeAddAssignKernel( y, A, x, scalar );
@@ -3377,6 +3410,8 @@ class DMatScalarMultExpr< DTensDVecMultExpr<TT,VT>, ST, false >
    static inline auto selectSmallAddAssignKernel( MT1& y, const TT1& A, const VT1& x, ST2 scalar )
       -> EnableIf_t< !UseVectorizedDefaultKernel_v<MT1,TT1,VT1,ST2> >
    {
+      BLAZE_KERNEL_TRACE( "default small add assign", DMatScalarMultExpr, y, 1UL );
+
       selectDefaultAddAssignKernel( y, A, x, scalar );
    }
    //**********************************************************************************************
@@ -3402,6 +3437,8 @@ class DMatScalarMultExpr< DTensDVecMultExpr<TT,VT>, ST, false >
    static inline auto selectSmallAddAssignKernel( VT1& y, const TT1& A, const VT2& x, ST2 scalar )
       -> EnableIf_t< UseVectorizedDefaultKernel_v<VT1,TT1,VT2,ST2> >
    {
+      BLAZE_KERNEL_TRACE( "vectorized small add assign", DMatScalarMultExpr, y, 1UL );
+
       constexpr bool remainder( !IsPadded_v<TT1> || !IsPadded_v<VT2> );
 
       const size_t M( A.rows()    );
@@ -3594,6 +3631,8 @@ class DMatScalarMultExpr< DTensDVecMultExpr<TT,VT>, ST, false >
    static inline auto selectLargeAddAssignKernel( MT1& y, const TT1& A, const VT1& x, ST2 scalar )
       -> EnableIf_t< !UseVectorizedDefaultKernel_v<MT1,TT1,VT1,ST2> >
    {
+      BLAZE_KERNEL_TRACE( "default large add assign", DMatScalarMultExpr, y, 1UL );
+
       selectDefaultAddAssignKernel( y, A, x, scalar );
    }
    //**********************************************************************************************
@@ -3619,6 +3658,8 @@ class DMatScalarMultExpr< DTensDVecMultExpr<TT,VT>, ST, false >
    static inline auto selectLargeAddAssignKernel( VT1& y, const TT1& A, const VT2& x, ST2 scalar )
       -> EnableIf_t< UseVectorizedDefaultKernel_v<VT1,TT1,VT2,ST2> >
    {
+      BLAZE_KERNEL_TRACE( "vectorized large add assign", DMatScalarMultExpr, y, 1UL );
+
       constexpr bool remainder( !IsPadded_v<TT1> || !IsPadded_v<VT2> );
 
       const size_t M( A.rows()    );
@@ -3909,7 +3950,7 @@ class DMatScalarMultExpr< DTensDVecMultExpr<TT,VT>, ST, false >
            , typename ST2 >  // Type of the scalar value
    static inline void selectSubAssignKernel( MT1& y, const TT1& A, const VT1& x, ST2 scalar )
    {
-      if( A.pages() * A.rows() * A.columns() < DTENSDVECMULT_THRESHOLD )
+      if( A.pages() * A.rows() * A.columns() < dtensDVecMultThreshold() )
          selectSmallSubAssignKernel( y, A, x, scalar );
       else
          selectLargeSubAssignKernel( y, A, x, scalar );
@@ -3961,6 +4002,8 @@ class DMatScalarMultExpr< DTensDVecMultExpr<TT,VT>, ST, false >
    static inline auto selectSmallSubAssignKernel( MT1& y, const TT1& A, const VT1& x, ST2 scalar )
       -> EnableIf_t< !UseVectorizedDefaultKernel_v<MT1,TT1,VT1,ST2> >
    {
+      BLAZE_KERNEL_TRACE( "default small sub assign", DMatScalarMultExpr, y, 1UL );
+
       selectDefaultSubAssignKernel( y, A, x, scalar );
    }
    //**********************************************************************************************
@@ -3986,6 +4029,8 @@ class DMatScalarMultExpr< DTensDVecMultExpr<TT,VT>, ST, false >
    static inline auto selectSmallSubAssignKernel( VT1& y, const TT1& A, const VT2& x, ST2 scalar )
       -> EnableIf_t< UseVectorizedDefaultKernel_v<VT1,TT1,VT2,ST2> >
    {
+      BLAZE_KERNEL_TRACE( "vectorized small sub assign", DMatScalarMultExpr, y, 1UL );
+
       constexpr bool remainder( !IsPadded_v<TT1> || !IsPadded_v<VT2> );
 
       const size_t M( A.rows()    );
@@ -4178,6 +4223,8 @@ class DMatScalarMultExpr< DTensDVecMultExpr<TT,VT>, ST, false >
    static inline auto selectLargeSubAssignKernel( MT1& y, const TT1& A, const VT1& x, ST2 scalar )
       -> EnableIf_t< !UseVectorizedDefaultKernel_v<MT1,TT1,VT1,ST2> >
    {
+      BLAZE_KERNEL_TRACE( "default large sub assign", DMatScalarMultExpr, y, 1UL );
+
       selectDefaultSubAssignKernel( y, A, x, scalar );
    }
    //**********************************************************************************************
@@ -4203,6 +4250,8 @@ class DMatScalarMultExpr< DTensDVecMultExpr<TT,VT>, ST, false >
    static inline auto selectLargeSubAssignKernel( VT1& y, const TT1& A, const VT2& x, ST2 scalar )
       -> EnableIf_t< UseVectorizedDefaultKernel_v<VT1,TT1,VT2,ST2> >
    {
+      BLAZE_KERNEL_TRACE( "vectorized large sub assign", DMatScalarMultExpr, y, 1UL );
+
       constexpr bool remainder( !IsPadded_v<TT1> || !IsPadded_v<VT2> );
 
       const size_t M( A.rows()    );
@@ -0,0 +1,1170 @@
+//=================================================================================================
+/*!
+//  \file blaze_tensor/math/expressions/DTensNaryMapExpr.h
+//  \brief Header file for the dense tensor n-ary map expression
+//
+//  Copyright (C) 2012-2018 Klaus Iglberger - All Rights Reserved
+//  Copyright (C) 2018 Hartmut Kaiser - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+
+#ifndef _BLAZE_TENSOR_MATH_EXPRESSIONS_DTENSNARYMAPEXPR_H_
+#define _BLAZE_TENSOR_MATH_EXPRESSIONS_DTENSNARYMAPEXPR_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <iterator>
+#include <tuple>
+#include <utility>
+#include <blaze/math/expressions/Forward.h>
+#include <blaze/math/expressions/DMatDMatMapExpr.h>
+#include <blaze/math/typetraits/IsSIMDEnabled.h>
+#include <blaze/util/StaticAssert.h>
+
+#include <blaze_tensor/math/dense/Forward.h>
+#include <blaze_tensor/math/expressions/DenseTensor.h>
+#include <blaze_tensor/math/expressions/Forward.h>
+#include <blaze_tensor/math/expressions/NaryMapExpr.h>
+#include <blaze_tensor/math/functors/Select.h>
+#include <blaze_tensor/math/typetraits/IsDenseTensor.h>
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DTENSNARYMAPEXPR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Expression object for the n-ary dense tensor map() function.
+// \ingroup dense_tensor_expression
+//
+// The DTensNaryMapExpr class represents the compile time expression for the element-wise
+// evaluation of a custom operation on the elements of three or more dense tensors via the
+// map() function. In contrast to a nesting of binary map expressions, all operands are
+// traversed in a single pass and the SIMD \a load() function of the custom operation is
+// directly applied to the SIMD elements of all operands.
+*/
+template< typename OP        // Type of the custom operation
+        , typename... MTs >  // Types of the dense tensor operands
+class DTensNaryMapExpr
+   : public NaryMapExpr< DenseTensor< DTensNaryMapExpr<OP,MTs...> > >
+   , private Computation
+{
+ private:
+   //**Type definitions****************************************************************************
+   //! Type of the first dense tensor operand.
+   using MT1 = std::tuple_element_t< 0UL, std::tuple<MTs...> >;
+
+   //! Index sequence over all dense tensor operands.
+   using Indices = std::index_sequence_for<MTs...>;
+
+   //! Composite type of a single dense tensor operand.
+   template< typename MT >
+   using Operand_t = If_t< IsExpression_v<MT>, const MT, const MT& >;
+
+   //! Type of a single dense tensor operand after an optional intermediate evaluation.
+   template< typename MT >
+   using Evaluated_t = If_t< RequiresEvaluation_v<MT>, const ResultType_t<MT>, const MT& >;
+
+   //! Operand type of the map expression over the intermediately evaluated operands.
+   template< typename MT >
+   using EvaluatedOperand_t = If_t< RequiresEvaluation_v<MT>, ResultType_t<MT>, MT >;
+
+   //! Definition of the HasSIMDEnabled type trait.
+   BLAZE_CREATE_HAS_DATA_OR_FUNCTION_MEMBER_TYPE_TRAIT( HasSIMDEnabled, simdEnabled );
+
+   //! Definition of the HasLoad type trait.
+   BLAZE_CREATE_HAS_DATA_OR_FUNCTION_MEMBER_TYPE_TRAIT( HasLoad, load );
+   //**********************************************************************************************
+
+   //**Serial evaluation strategy******************************************************************
+   //! Compilation switch for the serial evaluation strategy of the map expression.
+   /*! The \a useAssign compile time constant expression represents a compilation switch for
+       the serial evaluation strategy of the map expression. In case any of the dense tensor
+       operands requires an intermediate evaluation, \a useAssign will be set to 1 and the
+       map expression will be evaluated via the \a assign function family. Otherwise
+       \a useAssign will be set to 0 and the expression will be evaluated via the subscript
+       operator. */
+   static constexpr bool useAssign = !NaryAnd< !RequiresEvaluation_v<MTs>... >::value;
+
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper variable template for the explicit application of the SFINAE principle.
+   template< typename MT >
+   static constexpr bool UseAssign_v = useAssign;
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Parallel evaluation strategy****************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper variable template for the explicit application of the SFINAE principle.
+   /*! This variable template is a helper for the selection of the parallel evaluation strategy.
+       In case at least one of the dense tensor operands is not SMP assignable and at least one
+       of the operands requires an intermediate evaluation, the variable is set to 1 and the
+       expression specific evaluation strategy is selected. Otherwise the variable is set to 0
+       and the default strategy is chosen. */
+   template< typename MT >
+   static constexpr bool UseSMPAssign_v =
+      ( !NaryAnd< MTs::smpAssignable... >::value && useAssign );
+   /*! \endcond */
+   //**********************************************************************************************
+
+ public:
+   //**Type definitions****************************************************************************
+   using This = DTensNaryMapExpr<OP,MTs...>;  //!< Type of this DTensNaryMapExpr instance.
+
+   //! Return type for expression template evaluations.
+   using ReturnType = decltype( std::declval<OP>()( std::declval< ReturnType_t<MTs> >()... ) );
+
+   using ElementType   = RemoveCV_t< RemoveReference_t<ReturnType> >;  //!< Resulting element type.
+   using ResultType    = DynamicTensor<ElementType>;                     //!< Result type for expression template evaluations.
+   using OppositeType  = OppositeType_t<ResultType>;                     //!< Result type with opposite storage order for expression template evaluations.
+   using TransposeType = TransposeType_t<ResultType>;                    //!< Transpose type for expression template evaluations.
+
+   //! Data type for composite expression templates.
+   using CompositeType = If_t< useAssign, const ResultType, const DTensNaryMapExpr& >;
+
+   //! Composite types of all dense tensor operands.
+   using Operands = std::tuple< Operand_t<MTs>... >;
+
+   //! Data type of the custom operation.
+   using Operation = OP;
+   //**********************************************************************************************
+
+   //**ConstIterator class definition**************************************************************
+   /*!\brief Iterator over the elements of the dense tensor map expression.
+   */
+   class ConstIterator
+   {
+    public:
+      //**Type definitions*************************************************************************
+      using IteratorCategory = std::random_access_iterator_tag;  //!< The iterator category.
+      using ValueType        = ElementType;                      //!< Type of the underlying elements.
+      using PointerType      = ElementType*;                     //!< Pointer return type.
+      using ReferenceType    = ElementType&;                     //!< Reference return type.
+      using DifferenceType   = ptrdiff_t;                        //!< Difference between two iterators.
+
+      // STL iterator requirements
+      using iterator_category = IteratorCategory;  //!< The iterator category.
+      using value_type        = ValueType;         //!< Type of the underlying elements.
+      using pointer           = PointerType;       //!< Pointer return type.
+      using reference         = ReferenceType;     //!< Reference return type.
+      using difference_type   = DifferenceType;    //!< Difference between two iterators.
+
+      //! ConstIterator types of all dense tensor operands.
+      using IteratorTypes = std::tuple< ConstIterator_t<MTs>... >;
+      //*******************************************************************************************
+
+      //**Constructor******************************************************************************
+      /*!\brief Constructor for the ConstIterator class.
+      //
+      // \param its Iterators to the initial elements of all operands.
+      // \param op The custom operation.
+      */
+      explicit inline ConstIterator( IteratorTypes its, OP op )
+         : its_( its )  // Iterators to the current elements of all operands
+         , op_ ( op  )  // The custom operation
+      {}
+      //*******************************************************************************************
+
+      //**Addition assignment operator*************************************************************
+      /*!\brief Addition assignment operator.
+      //
+      // \param inc The increment of the iterator.
+      // \return The incremented iterator.
+      */
+      inline ConstIterator& operator+=( size_t inc ) {
+         increment( inc, Indices() );
+         return *this;
+      }
+      //*******************************************************************************************
+
+      //**Subtraction assignment operator**********************************************************
+      /*!\brief Subtraction assignment operator.
+      //
+      // \param dec The decrement of the iterator.
+      // \return The decremented iterator.
+      */
+      inline ConstIterator& operator-=( size_t dec ) {
+         decrement( dec, Indices() );
+         return *this;
+      }
+      //*******************************************************************************************
+
+      //**Prefix increment operator****************************************************************
+      /*!\brief Pre-increment operator.
+      //
+      // \return Reference to the incremented iterator.
+      */
+      inline ConstIterator& operator++() {
+         increment( 1UL, Indices() );
+         return *this;
+      }
+      //*******************************************************************************************
+
+      //**Postfix increment operator***************************************************************
+      /*!\brief Post-increment operator.
+      //
+      // \return The previous position of the iterator.
+      */
+      inline const ConstIterator operator++( int ) {
+         const ConstIterator tmp( *this );
+         increment( 1UL, Indices() );
+         return tmp;
+      }
+      //*******************************************************************************************
+
+      //**Prefix decrement operator****************************************************************
+      /*!\brief Pre-decrement operator.
+      //
+      // \return Reference to the decremented iterator.
+      */
+      inline ConstIterator& operator--() {
+         decrement( 1UL, Indices() );
+         return *this;
+      }
+      //*******************************************************************************************
+
+      //**Postfix decrement operator***************************************************************
+      /*!\brief Post-decrement operator.
+      //
+      // \return The previous position of the iterator.
+      */
+      inline const ConstIterator operator--( int ) {
+         const ConstIterator tmp( *this );
+         decrement( 1UL, Indices() );
+         return tmp;
+      }
+      //*******************************************************************************************
+
+      //**Element access operator******************************************************************
+      /*!\brief Direct access to the element at the current iterator position.
+      //
+      // \return The resulting value.
+      */
+      inline ReturnType operator*() const {
+         return dereference( Indices() );
+      }
+      //*******************************************************************************************
+
+      //**Load function****************************************************************************
+      /*!\brief Access to the SIMD elements of the tensor.
+      //
+      // \return The resulting SIMD element.
+      */
+      inline auto load() const noexcept {
+         return loadAll( Indices() );
+      }
+      //*******************************************************************************************
+
+      //**Equality operator************************************************************************
+      /*!\brief Equality comparison between two ConstIterator objects.
+      //
+      // \param rhs The right-hand side iterator.
+      // \return \a true if the iterators refer to the same element, \a false if not.
+      */
+      inline bool operator==( const ConstIterator& rhs ) const {
+         return std::get<0UL>( its_ ) == std::get<0UL>( rhs.its_ );
+      }
+      //*******************************************************************************************
+
+      //**Inequality operator**********************************************************************
+      /*!\brief Inequality comparison between two ConstIterator objects.
+      //
+      // \param rhs The right-hand side iterator.
+      // \return \a true if the iterators don't refer to the same element, \a false if they do.
+      */
+      inline bool operator!=( const ConstIterator& rhs ) const {
+         return std::get<0UL>( its_ ) != std::get<0UL>( rhs.its_ );
+      }
+      //*******************************************************************************************
+
+      //**Less-than operator***********************************************************************
+      /*!\brief Less-than comparison between two ConstIterator objects.
+      //
+      // \param rhs The right-hand side iterator.
+      // \return \a true if the left-hand side iterator is smaller, \a false if not.
+      */
+      inline bool operator<( const ConstIterator& rhs ) const {
+         return std::get<0UL>( its_ ) < std::get<0UL>( rhs.its_ );
+      }
+      //*******************************************************************************************
+
+      //**Greater-than operator********************************************************************
+      /*!\brief Greater-than comparison between two ConstIterator objects.
+      //
+      // \param rhs The right-hand side iterator.
+      // \return \a true if the left-hand side iterator is greater, \a false if not.
+      */
+      inline bool operator>( const ConstIterator& rhs ) const {
+         return std::get<0UL>( its_ ) > std::get<0UL>( rhs.its_ );
+      }
+      //*******************************************************************************************
+
+      //**Less-or-equal-than operator**************************************************************
+      /*!\brief Less-than comparison between two ConstIterator objects.
+      //
+      // \param rhs The right-hand side iterator.
+      // \return \a true if the left-hand side iterator is smaller or equal, \a false if not.
+      */
+      inline bool operator<=( const ConstIterator& rhs ) const {
+         return std::get<0UL>( its_ ) <= std::get<0UL>( rhs.its_ );
+      }
+      //*******************************************************************************************
+
+      //**Greater-or-equal-than operator***********************************************************
+      /*!\brief Greater-than comparison between two ConstIterator objects.
+      //
+      // \param rhs The right-hand side iterator.
+      // \return \a true if the left-hand side iterator is greater or equal, \a false if not.
+      */
+      inline bool operator>=( const ConstIterator& rhs ) const {
+         return std::get<0UL>( its_ ) >= std::get<0UL>( rhs.its_ );
+      }
+      //*******************************************************************************************
+
+      //**Subtraction operator*********************************************************************
+      /*!\brief Calculating the number of elements between two iterators.
+      //
+      // \param rhs The right-hand side iterator.
+      // \return The number of elements between the two iterators.
+      */
+      inline DifferenceType operator-( const ConstIterator& rhs ) const {
+         return std::get<0UL>( its_ ) - std::get<0UL>( rhs.its_ );
+      }
+      //*******************************************************************************************
+
+      //**Addition operator************************************************************************
+      /*!\brief Addition between a ConstIterator and an integral value.
+      //
+      // \param it The iterator to be incremented.
+      // \param inc The number of elements the iterator is incremented.
+      // \return The incremented iterator.
+      */
+      friend inline const ConstIterator operator+( const ConstIterator& it, size_t inc ) {
+         ConstIterator tmp( it );
+         return tmp += inc;
+      }
+      //*******************************************************************************************
+
+      //**Addition operator************************************************************************
+      /*!\brief Addition between an integral value and a ConstIterator.
+      //
+      // \param inc The number of elements the iterator is incremented.
+      // \param it The iterator to be incremented.
+      // \return The incremented iterator.
+      */
+      friend inline const ConstIterator operator+( size_t inc, const ConstIterator& it ) {
+         ConstIterator tmp( it );
+         return tmp += inc;
+      }
+      //*******************************************************************************************
+
+      //**Subtraction operator*********************************************************************
+      /*!\brief Subtraction between a ConstIterator and an integral value.
+      //
+      // \param it The iterator to be decremented.
+      // \param dec The number of elements the iterator is decremented.
+      // \return The decremented iterator.
+      */
+      friend inline const ConstIterator operator-( const ConstIterator& it, size_t dec ) {
+         ConstIterator tmp( it );
+         return tmp -= dec;
+      }
+      //*******************************************************************************************
+
+    private:
+      //**Iterator helpers*************************************************************************
+      /*! \cond BLAZE_INTERNAL */
+      template< size_t... I >
+      inline void increment( size_t inc, std::index_sequence<I...> ) {
+         using Swallow = int[];
+         (void)Swallow{ 0, ( std::get<I>( its_ ) += inc, 0 )... };
+      }
+
+      template< size_t... I >
+      inline void decrement( size_t dec, std::index_sequence<I...> ) {
+         using Swallow = int[];
+         (void)Swallow{ 0, ( std::get<I>( its_ ) -= dec, 0 )... };
+      }
+
+      template< size_t... I >
+      inline ReturnType dereference( std::index_sequence<I...> ) const {
+         return op_( *std::get<I>( its_ )... );
+      }
+
+      template< size_t... I >
+      inline auto loadAll( std::index_sequence<I...> ) const noexcept {
+         return op_.load( std::get<I>( its_ ).load()... );
+      }
+      /*! \endcond */
+      //*******************************************************************************************
+
+      //**Member variables*************************************************************************
+      IteratorTypes its_;  //!< Iterators to the current elements of all operands.
+      OP            op_;   //!< The custom operation.
+      //*******************************************************************************************
+   };
+   //**********************************************************************************************
+
+   //**Compilation flags***************************************************************************
+   //! Compilation switch for the expression template evaluation strategy.
+   static constexpr bool simdEnabled =
+      ( NaryAnd< MTs::simdEnabled... >::value &&
+        If_t< HasSIMDEnabled_v<OP>, GetNarySIMDEnabled< OP, ElementType_t<MTs>... >, HasLoad<OP> >::value );
+
+   //! Compilation switch for the expression template assignment strategy.
+   static constexpr bool smpAssignable = NaryAnd< MTs::smpAssignable... >::value;
+   //**********************************************************************************************
+
+   //**SIMD properties*****************************************************************************
+   //! The number of elements packed within a single SIMD element.
+   static constexpr size_t SIMDSIZE = SIMDTrait<ElementType>::size;
+   //**********************************************************************************************
+
+   //**Constructor*********************************************************************************
+   /*!\brief Constructor for the DTensNaryMapExpr class.
+   //
+   // \param operands The dense tensor operands of the map expression.
+   // \param op The custom operation.
+   */
+   explicit inline DTensNaryMapExpr( const MTs&... operands, OP op ) noexcept
+      : operands_( operands... )  // Dense tensor operands of the map expression
+      , op_      ( op          )  // The custom operation
+   {}
+   //**********************************************************************************************
+
+   //**Access operator*****************************************************************************
+   /*!\brief 3D-access to the tensor elements.
+   //
+   // \param k Access index for the page. The index has to be in the range \f$[0..O-1]\f$.
+   // \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+   // \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+   // \return The resulting value.
+   */
+   inline ReturnType operator()( size_t k, size_t i, size_t j ) const {
+      BLAZE_INTERNAL_ASSERT( i < rows()   , "Invalid row access index"    );
+      BLAZE_INTERNAL_ASSERT( j < columns(), "Invalid column access index" );
+      BLAZE_INTERNAL_ASSERT( k < pages()  , "Invalid page access index"   );
+      return evaluate( k, i, j, Indices() );
+   }
+   //**********************************************************************************************
+
+   //**At function*********************************************************************************
+   /*!\brief Checked access to the tensor elements.
+   //
+   // \param k Access index for the page. The index has to be in the range \f$[0..O-1]\f$.
+   // \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+   // \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+   // \return The resulting value.
+   // \exception std::out_of_range Invalid tensor access index.
+   */
+   inline ReturnType at( size_t k, size_t i, size_t j ) const {
+      if( i >= rows() ) {
+         BLAZE_THROW_OUT_OF_RANGE( "Invalid row access index" );
+      }
+      if( j >= columns() ) {
+         BLAZE_THROW_OUT_OF_RANGE( "Invalid column access index" );
+      }
+      if( k >= pages() ) {
+         BLAZE_THROW_OUT_OF_RANGE( "Invalid page access index" );
+      }
+      return (*this)(k,i,j);
+   }
+   //**********************************************************************************************
+
+   //**Load function*******************************************************************************
+   /*!\brief Access to the SIMD elements of the tensor.
+   //
+   // \param k Access index for the page. The index has to be in the range \f$[0..O-1]\f$.
+   // \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+   // \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+   // \return Reference to the accessed values.
+   */
+   BLAZE_ALWAYS_INLINE auto load( size_t k, size_t i, size_t j ) const noexcept {
+      BLAZE_INTERNAL_ASSERT( i < rows()   , "Invalid row access index"    );
+      BLAZE_INTERNAL_ASSERT( j < columns(), "Invalid column access index" );
+      BLAZE_INTERNAL_ASSERT( k < pages()  , "Invalid page access index"   );
+      BLAZE_INTERNAL_ASSERT( j % SIMDSIZE == 0UL, "Invalid column access index" );
+      return loadAll( k, i, j, Indices() );
+   }
+   //**********************************************************************************************
+
+   //**Begin function******************************************************************************
+   /*!\brief Returns an iterator to the first non-zero element of row \a i.
+   //
+   // \param i The row index.
+   // \param k The page index.
+   // \return Iterator to the first non-zero element of row \a i.
+   */
+   inline ConstIterator begin( size_t i, size_t k ) const {
+      return beginAll( i, k, Indices() );
+   }
+   //**********************************************************************************************
+
+   //**End function********************************************************************************
+   /*!\brief Returns an iterator just past the last non-zero element of row \a i.
+   //
+   // \param i The row index.
+   // \param k The page index.
+   // \return Iterator just past the last non-zero element of row \a i.
+   */
+   inline ConstIterator end( size_t i, size_t k ) const {
+      return endAll( i, k, Indices() );
+   }
+   //**********************************************************************************************
+
+   //**Rows function*******************************************************************************
+   /*!\brief Returns the current number of rows of the tensor.
+   //
+   // \return The number of rows of the tensor.
+   */
+   inline size_t rows() const noexcept {
+      return std::get<0UL>( operands_ ).rows();
+   }
+   //**********************************************************************************************
+
+   //**Columns function****************************************************************************
+   /*!\brief Returns the current number of columns of the tensor.
+   //
+   // \return The number of columns of the tensor.
+   */
+   inline size_t columns() const noexcept {
+      return std::get<0UL>( operands_ ).columns();
+   }
+   //**********************************************************************************************
+
+   //**Pages function******************************************************************************
+   /*!\brief Returns the current number of pages of the tensor.
+   //
+   // \return The number of pages of the tensor.
+   */
+   inline size_t pages() const noexcept {
+      return std::get<0UL>( operands_ ).pages();
+   }
+   //**********************************************************************************************
+
+   //**Operand access******************************************************************************
+   /*!\brief Returns the \a I-th dense tensor operand.
+   //
+   // \return The \a I-th dense tensor operand.
+   */
+   template< size_t I >
+   inline std::tuple_element_t<I,Operands> operand() const noexcept {
+      return std::get<I>( operands_ );
+   }
+   //**********************************************************************************************
+
+   //**Operation access****************************************************************************
+   /*!\brief Returns a copy of the custom operation.
+   //
+   // \return A copy of the custom operation.
+   */
+   inline Operation operation() const {
+      return op_;
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Returns whether the expression can alias with the given address \a alias.
+   //
+   // \param alias The alias to be checked.
+   // \return \a true in case the expression can alias, \a false otherwise.
+   */
+   template< typename T >
+   inline bool canAlias( const T* alias ) const noexcept {
+      return canAliasAny( alias, Indices() );
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Returns whether the expression is aliased with the given address \a alias.
+   //
+   // \param alias The alias to be checked.
+   // \return \a true in case an alias effect is detected, \a false otherwise.
+   */
+   template< typename T >
+   inline bool isAliased( const T* alias ) const noexcept {
+      return isAliasedAny( alias, Indices() );
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Returns whether the operands of the expression are properly aligned in memory.
+   //
+   // \return \a true in case the operands are aligned, \a false if not.
+   */
+   inline bool isAligned() const noexcept {
+      return isAlignedAll( Indices() );
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Returns whether the expression can be used in SMP assignments.
+   //
+   // \return \a true in case the expression can be used in SMP assignments, \a false if not.
+   */
+   inline bool canSMPAssign() const noexcept {
+      return canSMPAssignAll( Indices() );
+   }
+   //**********************************************************************************************
+
+ private:
+   //**Operand helpers*****************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   template< size_t... I >
+   BLAZE_ALWAYS_INLINE ReturnType evaluate( size_t k, size_t i, size_t j, std::index_sequence<I...> ) const {
+      return op_( std::get<I>( operands_ )(k,i,j)... );
+   }
+
+   template< size_t... I >
+   BLAZE_ALWAYS_INLINE auto loadAll( size_t k, size_t i, size_t j, std::index_sequence<I...> ) const noexcept {
+      return op_.load( std::get<I>( operands_ ).load(k,i,j)... );
+   }
+
+   template< size_t... I >
+   inline ConstIterator beginAll( size_t i, size_t k, std::index_sequence<I...> ) const {
+      using IteratorTypes = typename ConstIterator::IteratorTypes;
+      return ConstIterator( IteratorTypes( std::get<I>( operands_ ).begin(i,k)... ), op_ );
+   }
+
+   template< size_t... I >
+   inline ConstIterator endAll( size_t i, size_t k, std::index_sequence<I...> ) const {
+      using IteratorTypes = typename ConstIterator::IteratorTypes;
+      return ConstIterator( IteratorTypes( std::get<I>( operands_ ).end(i,k)... ), op_ );
+   }
+
+   template< typename T, size_t... I >
+   inline bool canAliasAny( const T* alias, std::index_sequence<I...> ) const noexcept {
+      return naryAny( { ( IsExpression_v<MTs> && std::get<I>( operands_ ).canAlias( alias ) )... } );
+   }
+
+   template< typename T, size_t... I >
+   inline bool isAliasedAny( const T* alias, std::index_sequence<I...> ) const noexcept {
+      return naryAny( { std::get<I>( operands_ ).isAliased( alias )... } );
+   }
+
+   template< size_t... I >
+   inline bool isAlignedAll( std::index_sequence<I...> ) const noexcept {
+      return naryAll( { std::get<I>( operands_ ).isAligned()... } );
+   }
+
+   template< size_t... I >
+   inline bool canSMPAssignAll( std::index_sequence<I...> ) const noexcept {
+      return naryAll( { std::get<I>( operands_ ).canSMPAssign()... } );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Intermediate evaluation*********************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Serial evaluation of an operand that requires an intermediate evaluation.
+   */
+   template< typename MT >
+   static inline EnableIf_t< RequiresEvaluation_v<MT>, ResultType_t<MT> >
+      evaluateOperand( const MT& operand, TrueType )
+   {
+      return ResultType_t<MT>( serial( operand ) );
+   }
+
+   /*!\brief Parallel evaluation of an operand that requires an intermediate evaluation.
+   */
+   template< typename MT >
+   static inline EnableIf_t< RequiresEvaluation_v<MT>, ResultType_t<MT> >
+      evaluateOperand( const MT& operand, FalseType )
+   {
+      return ResultType_t<MT>( operand );
+   }
+
+   /*!\brief Pass-through of an operand that does not require an intermediate evaluation.
+   */
+   template< typename MT, typename Tag >
+   static inline EnableIf_t< !RequiresEvaluation_v<MT>, const MT& >
+      evaluateOperand( const MT& operand, Tag )
+   {
+      return operand;
+   }
+
+   /*!\brief Evaluates all operands requiring an intermediate evaluation and passes the map
+   //        expression over the evaluated operands to the given assignment function.
+   //
+   // \param assignment The assignment function to be applied to the resulting map expression.
+   // \param serialEvaluation Whether the operands are evaluated serially.
+   // \return void
+   */
+   template< typename F, typename Tag, size_t... I >
+   inline void evaluateOperands( F&& assignment, Tag serialEvaluation, std::index_sequence<I...> ) const
+   {
+      using Evaluated = DTensNaryMapExpr< OP, EvaluatedOperand_t<MTs>... >;
+
+      const std::tuple< Evaluated_t<MTs>... > evaluated(
+         evaluateOperand<MTs>( std::get<I>( operands_ ), serialEvaluation )... );
+
+      assignment( Evaluated( std::get<I>( evaluated )..., op_ ) );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   Operands  operands_;  //!< Dense tensor operands of the map expression.
+   Operation op_;        //!< The custom operation.
+   //**********************************************************************************************
+
+   //**Assignment to dense tensors*****************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Assignment of an n-ary dense tensor map expression to a dense tensor.
+   // \ingroup dense_tensor
+   //
+   // \param lhs The target left-hand side dense tensor.
+   // \param rhs The right-hand side map expression to be assigned.
+   // \return void
+   //
+   // This function implements the performance optimized assignment of an n-ary dense tensor
+   // map expression to a dense tensor. Due to the explicit application of the SFINAE principle,
+   // this function can only be selected by the compiler in case any of the operands requires
+   // an intermediate evaluation.
+   */
+   template< typename MT > // Type of the target dense tensor
+   friend inline EnableIf_t< UseAssign_v<MT> >
+      assign( DenseTensor<MT>& lhs, const DTensNaryMapExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (*lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (*lhs).columns() == rhs.columns(), "Invalid number of columns" );
+      BLAZE_INTERNAL_ASSERT( (*lhs).pages()   == rhs.pages()  , "Invalid number of pages"   );
+
+      rhs.evaluateOperands( [&lhs]( const auto& expr ){ assign( *lhs, expr ); }, TrueType(), Indices() );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Addition assignment to dense tensors********************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Addition assignment of an n-ary dense tensor map expression to a dense tensor.
+   // \ingroup dense_tensor
+   //
+   // \param lhs The target left-hand side dense tensor.
+   // \param rhs The right-hand side map expression to be added.
+   // \return void
+   //
+   // This function implements the performance optimized addition assignment of an n-ary dense
+   // tensor map expression to a dense tensor. Due to the explicit application of the SFINAE
+   // principle, this function can only be selected by the compiler in case any of the operands
+   // requires an intermediate evaluation.
+   */
+   template< typename MT > // Type of the target dense tensor
+   friend inline EnableIf_t< UseAssign_v<MT> >
+      addAssign( DenseTensor<MT>& lhs, const DTensNaryMapExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (*lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (*lhs).columns() == rhs.columns(), "Invalid number of columns" );
+      BLAZE_INTERNAL_ASSERT( (*lhs).pages()   == rhs.pages()  , "Invalid number of pages"   );
+
+      rhs.evaluateOperands( [&lhs]( const auto& expr ){ addAssign( *lhs, expr ); }, TrueType(), Indices() );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Subtraction assignment to dense tensors*****************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Subtraction assignment of an n-ary dense tensor map expression to a dense tensor.
+   // \ingroup dense_tensor
+   //
+   // \param lhs The target left-hand side dense tensor.
+   // \param rhs The right-hand side map expression to be subtracted.
+   // \return void
+   //
+   // This function implements the performance optimized subtraction assignment of an n-ary
+   // dense tensor map expression to a dense tensor. Due to the explicit application of the
+   // SFINAE principle, this function can only be selected by the compiler in case any of the
+   // operands requires an intermediate evaluation.
+   */
+   template< typename MT > // Type of the target dense tensor
+   friend inline EnableIf_t< UseAssign_v<MT> >
+      subAssign( DenseTensor<MT>& lhs, const DTensNaryMapExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (*lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (*lhs).columns() == rhs.columns(), "Invalid number of columns" );
+      BLAZE_INTERNAL_ASSERT( (*lhs).pages()   == rhs.pages()  , "Invalid number of pages"   );
+
+      rhs.evaluateOperands( [&lhs]( const auto& expr ){ subAssign( *lhs, expr ); }, TrueType(), Indices() );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Schur product assignment to dense tensors***************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Schur product assignment of an n-ary dense tensor map expression to a dense tensor.
+   // \ingroup dense_tensor
+   //
+   // \param lhs The target left-hand side dense tensor.
+   // \param rhs The right-hand side map expression for the Schur product.
+   // \return void
+   //
+   // This function implements the performance optimized Schur product assignment of an n-ary
+   // dense tensor map expression to a dense tensor. Due to the explicit application of the
+   // SFINAE principle, this function can only be selected by the compiler in case any of the
+   // operands requires an intermediate evaluation.
+   */
+   template< typename MT > // Type of the target dense tensor
+   friend inline EnableIf_t< UseAssign_v<MT> >
+      schurAssign( DenseTensor<MT>& lhs, const DTensNaryMapExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (*lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (*lhs).columns() == rhs.columns(), "Invalid number of columns" );
+      BLAZE_INTERNAL_ASSERT( (*lhs).pages()   == rhs.pages()  , "Invalid number of pages"   );
+
+      rhs.evaluateOperands( [&lhs]( const auto& expr ){ schurAssign( *lhs, expr ); }, TrueType(), Indices() );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**SMP assignment to dense tensors*************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMP assignment of an n-ary dense tensor map expression to a dense tensor.
+   // \ingroup dense_tensor
+   //
+   // \param lhs The target left-hand side dense tensor.
+   // \param rhs The right-hand side map expression to be assigned.
+   // \return void
+   //
+   // This function implements the performance optimized SMP assignment of an n-ary dense
+   // tensor map expression to a dense tensor. Due to the explicit application of the SFINAE
+   // principle, this function can only be selected by the compiler in case the expression
+   // specific parallel evaluation strategy is selected.
+   */
+   template< typename MT > // Type of the target dense tensor
+   friend inline EnableIf_t< UseSMPAssign_v<MT> >
+      smpAssign( DenseTensor<MT>& lhs, const DTensNaryMapExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (*lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (*lhs).columns() == rhs.columns(), "Invalid number of columns" );
+      BLAZE_INTERNAL_ASSERT( (*lhs).pages()   == rhs.pages()  , "Invalid number of pages"   );
+
+      rhs.evaluateOperands( [&lhs]( const auto& expr ){ smpAssign( *lhs, expr ); }, FalseType(), Indices() );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**SMP addition assignment to dense tensors****************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMP addition assignment of an n-ary dense tensor map expression to a dense tensor.
+   // \ingroup dense_tensor
+   //
+   // \param lhs The target left-hand side dense tensor.
+   // \param rhs The right-hand side map expression to be added.
+   // \return void
+   //
+   // This function implements the performance optimized SMP addition assignment of an n-ary
+   // dense tensor map expression to a dense tensor. Due to the explicit application of the
+   // SFINAE principle, this function can only be selected by the compiler in case the
+   // expression specific parallel evaluation strategy is selected.
+   */
+   template< typename MT > // Type of the target dense tensor
+   friend inline EnableIf_t< UseSMPAssign_v<MT> >
+      smpAddAssign( DenseTensor<MT>& lhs, const DTensNaryMapExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (*lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (*lhs).columns() == rhs.columns(), "Invalid number of columns" );
+      BLAZE_INTERNAL_ASSERT( (*lhs).pages()   == rhs.pages()  , "Invalid number of pages"   );
+
+      rhs.evaluateOperands( [&lhs]( const auto& expr ){ smpAddAssign( *lhs, expr ); }, FalseType(), Indices() );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**SMP subtraction assignment to dense tensors*************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMP subtraction assignment of an n-ary dense tensor map expression to a dense tensor.
+   // \ingroup dense_tensor
+   //
+   // \param lhs The target left-hand side dense tensor.
+   // \param rhs The right-hand side map expression to be subtracted.
+   // \return void
+   //
+   // This function implements the performance optimized SMP subtraction assignment of an
+   // n-ary dense tensor map expression to a dense tensor. Due to the explicit application of
+   // the SFINAE principle, this function can only be selected by the compiler in case the
+   // expression specific parallel evaluation strategy is selected.
+   */
+   template< typename MT > // Type of the target dense tensor
+   friend inline EnableIf_t< UseSMPAssign_v<MT> >
+      smpSubAssign( DenseTensor<MT>& lhs, const DTensNaryMapExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (*lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (*lhs).columns() == rhs.columns(), "Invalid number of columns" );
+      BLAZE_INTERNAL_ASSERT( (*lhs).pages()   == rhs.pages()  , "Invalid number of pages"   );
+
+      rhs.evaluateOperands( [&lhs]( const auto& expr ){ smpSubAssign( *lhs, expr ); }, FalseType(), Indices() );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**SMP Schur product assignment to dense tensors***********************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMP Schur product assignment of an n-ary dense tensor map expression to a dense
+   //        tensor.
+   // \ingroup dense_tensor
+   //
+   // \param lhs The target left-hand side dense tensor.
+   // \param rhs The right-hand side map expression for the Schur product.
+   // \return void
+   //
+   // This function implements the performance optimized SMP Schur product assignment of an
+   // n-ary dense tensor map expression to a dense tensor. Due to the explicit application of
+   // the SFINAE principle, this function can only be selected by the compiler in case the
+   // expression specific parallel evaluation strategy is selected.
+   */
+   template< typename MT > // Type of the target dense tensor
+   friend inline EnableIf_t< UseSMPAssign_v<MT> >
+      smpSchurAssign( DenseTensor<MT>& lhs, const DTensNaryMapExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (*lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (*lhs).columns() == rhs.columns(), "Invalid number of columns" );
+      BLAZE_INTERNAL_ASSERT( (*lhs).pages()   == rhs.pages()  , "Invalid number of pages"   );
+
+      rhs.evaluateOperands( [&lhs]( const auto& expr ){ smpSchurAssign( *lhs, expr ); }, FalseType(), Indices() );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_STATIC_ASSERT( sizeof...( MTs ) > 2UL );
+   BLAZE_STATIC_ASSERT( NaryAnd< IsDenseTensor_v<MTs>... >::value );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend implementation of the n-ary map() function for dense tensors.
+// \ingroup dense_tensor
+//
+// \param op The custom operation.
+// \param first The first dense tensor operand.
+// \param rest The remaining dense tensor operands.
+// \return The custom operation applied to each single element of the given operands.
+// \exception std::invalid_argument Tensor sizes do not match.
+*/
+template< typename OP        // Type of the custom operation
+        , typename MT1       // Type of the first dense tensor
+        , typename... MTs >  // Types of the remaining dense tensors
+inline decltype(auto)
+   nmap_backend( OP op, const DenseTensor<MT1>& first, const DenseTensor<MTs>&... rest )
+{
+   if( !naryAll( { ( (*rest).rows()    == (*first).rows()    &&
+                     (*rest).columns() == (*first).columns() &&
+                     (*rest).pages()   == (*first).pages() )... } ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Tensor sizes do not match" );
+   }
+
+   using ReturnType = const DTensNaryMapExpr<OP,MT1,MTs...>;
+   return ReturnType( *first, *rest..., op );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Evaluates the given custom operation on each single element of three or more dense
+//        tensors.
+// \ingroup dense_tensor
+//
+// \param t1 The first dense tensor operand.
+// \param t2 The second dense tensor operand.
+// \param t3 The third dense tensor operand.
+// \param args Any further dense tensor operands, followed by the custom operation.
+// \return The custom operation applied to each single element of the given operands.
+// \exception std::invalid_argument Tensor sizes do not match.
+//
+// The \a map() function evaluates the given custom operation on each element of the given
+// input tensors. All operands are traversed in a single pass, i.e. each tensor is read exactly
+// once, and in case the custom operation provides a \a load() function and all operands are
+// SIMD enabled, the evaluation is vectorized across all operands. The following example
+// demonstrates the fused update \f$ Y = aX + bY + cZ \f$:
+
+   \code
+   struct Axpbypcz
+   {
+      double a, b, c;
+
+      template< typename T >
+      T operator()( const T& x, const T& y, const T& z ) const { return a*x + b*y + c*z; }
+
+      template< typename T >
+      T load( const T& x, const T& y, const T& z ) const { return set(a)*x + set(b)*y + set(c)*z; }
+   };
+
+   blaze::DynamicTensor<double> X, Y, Z;
+   // ... Resizing and initialization
+   Y = map( X, Y, Z, Axpbypcz{ 2.0, 3.0, 4.0 } );
+   \endcode
+*/
+template< typename MT1       // Type of the first dense tensor
+        , typename MT2       // Type of the second dense tensor
+        , typename MT3       // Type of the third dense tensor
+        , typename... Args > // Types of the further operands and the custom operation
+inline decltype(auto)
+   map( const DenseTensor<MT1>& t1, const DenseTensor<MT2>& t2, const DenseTensor<MT3>& t3,
+        const Args&... args )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return nmap_backend( std::forward_as_tuple( t1, t2, t3, args... ),
+                        std::make_index_sequence< 2UL + sizeof...( Args ) >() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Element-wise selection between the elements of two dense tensors.
+// \ingroup dense_tensor
+//
+// \param mask The dense tensor mask.
+// \param lhs The dense tensor providing the elements for non-zero mask elements.
+// \param rhs The dense tensor providing the elements for zero mask elements.
+// \return The element-wise selection between \a lhs and \a rhs.
+// \exception std::invalid_argument Tensor sizes do not match.
+//
+// The \a select() function returns an expression representing the element-wise selection
+// between the two dense tensors \a lhs and \a rhs, i.e. each element of the result is the
+// corresponding element of \a lhs in case the corresponding element of \a mask is non-zero
+// and the element of \a rhs otherwise. The three tensors are traversed in a single pass:
+
+   \code
+   blaze::DynamicTensor<bool> M;
+   blaze::DynamicTensor<double> A, B, C;
+   // ... Resizing and initialization
+   C = select( M, A, B );
+   \endcode
+*/
+template< typename MT1  // Type of the dense tensor mask
+        , typename MT2  // Type of the left-hand side dense tensor
+        , typename MT3 > // Type of the right-hand side dense tensor
+inline decltype(auto)
+   select( const DenseTensor<MT1>& mask, const DenseTensor<MT2>& lhs, const DenseTensor<MT3>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return nmap_backend( Select(), *mask, *lhs, *rhs );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Element-wise selection between the elements of two dense tensors.
+// \ingroup dense_tensor
+//
+// \param mask The dense tensor mask.
+// \param lhs The dense tensor providing the elements for non-zero mask elements.
+// \param rhs The dense tensor providing the elements for zero mask elements.
+// \return The element-wise selection between \a lhs and \a rhs.
+// \exception std::invalid_argument Tensor sizes do not match.
+//
+// This function is a synonym for the select() function.
+*/
+template< typename MT1  // Type of the dense tensor mask
+        , typename MT2  // Type of the left-hand side dense tensor
+        , typename MT3 > // Type of the right-hand side dense tensor
+inline decltype(auto)
+   where( const DenseTensor<MT1>& mask, const DenseTensor<MT2>& lhs, const DenseTensor<MT3>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return select( *mask, *lhs, *rhs );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ISALIGNED SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename OP, typename... MTs >
+struct IsAligned< DTensNaryMapExpr<OP,MTs...> >
+   : public BoolConstant< NaryAnd< IsAligned_v<MTs>... >::value >
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ISPADDED SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename OP, typename... MTs >
+struct IsPadded< DTensNaryMapExpr<OP,MTs...> >
+   : public BoolConstant< NaryAnd< IsPadded_v<MTs>... >::value >
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -42,8 +42,11 @@
 //*************************************************************************************************
 
 #include <utility>
+#include <vector>
 #include <blaze/math/Aliases.h>
+#include <blaze/math/dense/DynamicMatrix.h>
 #include <blaze/math/functors/Abs.h>
+#include <blaze/math/functors/Add.h>
 #include <blaze/math/functors/Bind2nd.h>
 #include <blaze/math/functors/Cbrt.h>
 #include <blaze/math/functors/L1Norm.h>
@@ -51,6 +54,7 @@
 #include <blaze/math/functors/L3Norm.h>
 #include <blaze/math/functors/L4Norm.h>
 #include <blaze/math/functors/LpNorm.h>
+#include <blaze/math/functors/Max.h>
 #include <blaze/math/functors/Noop.h>
 #include <blaze/math/functors/Pow.h>
 #include <blaze/math/functors/Pow2.h>
@@ -62,9 +66,12 @@
 #include <blaze/math/shims/Invert.h>
 #include <blaze/math/shims/IsZero.h>
 #include <blaze/math/SIMD.h>
+#include <blaze/math/smp/Functions.h>
+#include <blaze/math/smp/SerialSection.h>
 #include <blaze/math/traits/MultTrait.h>
 #include <blaze/math/typetraits/HasLoad.h>
 #include <blaze/math/typetraits/HasSIMDAdd.h>
+#include <blaze/math/typetraits/HasSIMDMax.h>
 #include <blaze/math/typetraits/IsPadded.h>
 #include <blaze/math/typetraits/IsSIMDEnabled.h>
 #include <blaze/math/typetraits/UnderlyingBuiltin.h>
@@ -72,15 +79,22 @@
 #include <blaze/util/Assert.h>
 #include <blaze/util/IntegralConstant.h>
 #include <blaze/util/FunctionTrace.h>
+#include <blaze/util/algorithms/Min.h>
 #include <blaze/util/mpl/And.h>
 #include <blaze/util/mpl/If.h>
 #include <blaze/util/StaticAssert.h>
 #include <blaze/util/TypeList.h>
 #include <blaze/util/Types.h>
 #include <blaze/util/typetraits/HasMember.h>
+#include <blaze/util/typetraits/IsBuiltin.h>
+#include <blaze/util/typetraits/IsSame.h>
+#include <blaze/util/typetraits/RemoveCV.h>
 #include <blaze/util/typetraits/RemoveReference.h>
 
+#include <blaze_tensor/math/ReductionFlag.h>
 #include <blaze_tensor/math/expressions/DenseTensor.h>
+#include <blaze_tensor/math/smp/ParallelFor.h>
+#include <blaze_tensor/system/Thresholds.h>
 
 namespace blaze {
 
@@ -95,9 +109,10 @@ namespace blaze {
 /*!\brief Auxiliary helper struct for the dense tensor norms.
 // \ingroup dense_tensor
 */
-template< typename MT       // Type of the dense tensor
-        , typename Abs      // Type of the abs operation
-        , typename Power >  // Type of the power operation
+template< typename MT          // Type of the dense tensor
+        , typename Abs         // Type of the abs operation
+        , typename Power       // Type of the power operation
+        , typename Acc = Add > // Type of the accumulation operation
 struct DTensNormHelper
 {
    //**Type definitions****************************************************************************
@@ -115,7 +130,8 @@ struct DTensNormHelper
         If_t< HasSIMDEnabled_v<Abs> && HasSIMDEnabled_v<Power>
             , And_t< GetSIMDEnabled<Abs,ET>, GetSIMDEnabled<Power,ET> >
             , And_t< HasLoad<Abs>, HasLoad<Power> > >::value &&
-        HasSIMDAdd_v< ElementType_t<CT>, ElementType_t<CT> > );
+        HasSIMDAdd_v< ElementType_t<CT>, ElementType_t<CT> > &&
+        ( !IsSame_v<Acc,Max> || HasSIMDMax_v< ElementType_t<CT>, ElementType_t<CT> > ) );
    //**********************************************************************************************
 };
 /*! \endcond */
@@ -132,91 +148,56 @@ struct DTensNormHelper
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-/*!\brief Default backend implementation of the norm of a row-major dense tensor.
+/*!\brief Default kernel for the accumulation of a range of rows of a dense tensor.
 // \ingroup dense_tensor
 //
-// \param dm The given row-major dense tensor for the norm computation.
+// \param tmp The given (evaluated) dense tensor.
 // \param abs The functor for the abs operation.
 // \param power The functor for the power operation.
-// \param root The functor for the root operation.
-// \return The norm of the given tensor.
-//
-// This function implements the performance optimized norm of a row-major dense tensor. Due to
-// the explicit application of the SFINAE principle, this function can only be selected by the
-// compiler in case vectorization cannot be applied.
+// \param acc The functor for the accumulation (blaze::Add or blaze::Max).
+// \param begin The first row of the range, counted over all pages.
+// \param end The row after the last row of the range, counted over all pages.
+// \return The accumulated partial result of the given range of rows.
+//
+// This function accumulates the elements of the rows \a begin to \a end of the given tensor,
+// where row \f$ r \f$ refers to row \f$ r \bmod M \f$ of page \f$ r / M \f$. Due to the explicit
+// application of the SFINAE principle, this function can only be selected by the compiler in
+// case vectorization cannot be applied.
 */
-template< typename MT      // Type of the dense tensor
-        , typename Abs     // Type of the abs operation
-        , typename Power   // Type of the power operation
-        , typename Root >  // Type of the root operation
-inline decltype(auto) norm_backend( const DenseTensor<MT>& dm, Abs abs, Power power, Root root, FalseType )
+template< typename TT     // Type of the dense tensor
+        , typename Abs    // Type of the abs operation
+        , typename Power  // Type of the power operation
+        , typename Acc >  // Type of the accumulation operation
+inline ElementType_t<TT>
+   normRows( const DenseTensor<TT>& tmp, Abs abs, Power power, Acc acc,
+             size_t begin, size_t end, FalseType )
 {
-   using CT = CompositeType_t<MT>;
-   using ET = ElementType_t<MT>;
-   using RT = decltype( evaluate( root( std::declval<ET>() ) ) );
+   using ET = ElementType_t<TT>;
 
-   if( (*dm).pages() == 0UL || (*dm).rows() == 0UL || (*dm).columns() == 0UL ) return RT();
+   const size_t M( (*tmp).rows()    );
+   const size_t N( (*tmp).columns() );
 
-   CT tmp( *dm );
+   ET norm{};
 
-   const size_t O( tmp.pages()   );
-   const size_t M( tmp.rows()    );
-   const size_t N( tmp.columns() );
+   for( size_t r=begin; r<end; ++r )
+   {
+      const size_t k( r / M );
+      const size_t i( r % M );
 
-   ET norm( power( abs( tmp(0UL,0UL,0UL) ) ) );
+      size_t j( 0UL );
 
-   {
-      size_t j( 1UL );
-
-      for( size_t k = 0; k < O; ++k ) {
-
-         for( ; ( j + 4UL ) <= N; j += 4UL )
-         {
-            norm += power( abs( tmp( k, 0UL, j ) ) ) +
-               power( abs( tmp( k, 0UL, j + 1UL ) ) ) +
-               power( abs( tmp( k, 0UL, j + 2UL ) ) ) +
-               power( abs( tmp( k, 0UL, j + 3UL ) ) );
-         }
-         for( ; ( j + 2UL ) <= N; j += 2UL )
-         {
-            norm += power( abs( tmp( k, 0UL, j ) ) ) +
-               power( abs( tmp( k, 0UL, j + 1UL ) ) );
-         }
-         for( ; j < N; ++j )
-         {
-            norm += power( abs( tmp( k, 0UL, j ) ) );
-         }
-
-         j = 0UL;
+      for( ; ( j + 4UL ) <= N; j += 4UL ) {
+         norm = acc( norm, acc( acc( power( abs( (*tmp)( k, i, j       ) ) ),
+                                     power( abs( (*tmp)( k, i, j + 1UL ) ) ) ),
+                                acc( power( abs( (*tmp)( k, i, j + 2UL ) ) ),
+                                     power( abs( (*tmp)( k, i, j + 3UL ) ) ) ) ) );
       }
-   }
-
-   for( size_t k = 0; k < O; ++k )
-   {
-      for( size_t i = 1UL; i < M; ++i )
-      {
-         size_t j( 0UL );
-
-         for( ; ( j + 4UL ) <= N; j += 4UL )
-         {
-            norm += power( abs( tmp( k, i, j ) ) ) +
-               power( abs( tmp( k, i, j + 1UL ) ) ) +
-               power( abs( tmp( k, i, j + 2UL ) ) ) +
-               power( abs( tmp( k, i, j + 3UL ) ) );
-         }
-         for( ; ( j + 2UL ) <= N; j += 2UL )
-         {
-            norm +=
-               power( abs( tmp( k, i, j ) ) ) + power( abs( tmp( k, i, j + 1UL ) ) );
-         }
-         for( ; j < N; ++j )
-         {
-            norm += power( abs( tmp( k, i, j ) ) );
-         }
+      for( ; j < N; ++j ) {
+         norm = acc( norm, power( abs( (*tmp)( k, i, j ) ) ) );
       }
    }
 
-   return evaluate( root( norm ) );
+   return norm;
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -224,40 +205,38 @@ inline decltype(auto) norm_backend( const DenseTensor<MT>& dm, Abs abs, Power po
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-/*!\brief SIMD optimized backend implementation of the norm of a row-major dense tensor.
+/*!\brief SIMD optimized kernel for the accumulation of a range of rows of a dense tensor.
 // \ingroup dense_tensor
 //
-// \param dm The given row-major dense tensor for the norm computation.
+// \param tmp The given (evaluated) dense tensor.
 // \param abs The functor for the abs operation.
 // \param power The functor for the power operation.
-// \param root The functor for the root operation.
-// \return The norm of the given tensor.
-//
-// This function implements the performance optimized norm of a row-major dense tensor. Due to
-// the explicit application of the SFINAE principle, this function can only be selected by the
-// compiler in case vectorization can be applied.
+// \param acc The functor for the accumulation (blaze::Add or blaze::Max).
+// \param begin The first row of the range, counted over all pages.
+// \param end The row after the last row of the range, counted over all pages.
+// \return The accumulated partial result of the given range of rows.
+//
+// This function accumulates the elements of the rows \a begin to \a end of the given tensor,
+// where row \f$ r \f$ refers to row \f$ r \bmod M \f$ of page \f$ r / M \f$. Due to the explicit
+// application of the SFINAE principle, this function can only be selected by the compiler in
+// case vectorization can be applied.
 */
-template< typename MT      // Type of the dense tensor
-        , typename Abs     // Type of the abs operation
-        , typename Power   // Type of the power operation
-        , typename Root >  // Type of the root operation
-inline decltype(auto) norm_backend( const DenseTensor<MT>& dm, Abs abs, Power power, Root root, TrueType )
+template< typename TT     // Type of the dense tensor
+        , typename Abs    // Type of the abs operation
+        , typename Power  // Type of the power operation
+        , typename Acc >  // Type of the accumulation operation
+inline ElementType_t<TT>
+   normRows( const DenseTensor<TT>& tmp, Abs abs, Power power, Acc acc,
+             size_t begin, size_t end, TrueType )
 {
-   using CT = CompositeType_t<MT>;
-   using ET = ElementType_t<MT>;
-   using RT = decltype( evaluate( root( std::declval<ET>() ) ) );
+   using ET = ElementType_t<TT>;
 
    static constexpr size_t SIMDSIZE = SIMDTrait<ET>::size;
 
-   if( (*dm).pages() == 0UL || (*dm).rows() == 0UL || (*dm).columns() == 0UL ) return RT();
+   const size_t M( (*tmp).rows()    );
+   const size_t N( (*tmp).columns() );
 
-   CT tmp( *dm );
-
-   const size_t O( tmp.pages()   );
-   const size_t M( tmp.rows()    );
-   const size_t N( tmp.columns() );
-
-   constexpr bool remainder( !IsPadded_v< RemoveReference_t<CT> > );
+   constexpr bool remainder( !IsPadded_v<TT> );
 
    const size_t jpos( ( remainder )?( N & size_t(-SIMDSIZE) ):( N ) );
    BLAZE_INTERNAL_ASSERT( !remainder || ( N - ( N % SIMDSIZE ) ) == jpos, "Invalid end calculation" );
@@ -265,38 +244,91 @@ inline decltype(auto) norm_backend( const DenseTensor<MT>& dm, Abs abs, Power po
    SIMDTrait_t<ET> xmm1, xmm2, xmm3, xmm4;
    ET norm{};
 
-   for( size_t k = 0; k < O; ++k )
+   for( size_t r=begin; r<end; ++r )
    {
-      for( size_t i = 0UL; i < M; ++i )
+      const size_t k( r / M );
+      const size_t i( r % M );
+
+      size_t j( 0UL );
+
+      for( ; ( j + SIMDSIZE * 3UL ) < jpos; j += SIMDSIZE * 4UL )
       {
-         size_t j( 0UL );
-
-         for( ; ( j + SIMDSIZE * 3UL ) < jpos; j += SIMDSIZE * 4UL )
-         {
-            xmm1 += power( abs( tmp.load( k, i, j ) ) );
-            xmm2 += power( abs( tmp.load( k, i, j + SIMDSIZE ) ) );
-            xmm3 += power( abs( tmp.load( k, i, j + SIMDSIZE * 2UL ) ) );
-            xmm4 += power( abs( tmp.load( k, i, j + SIMDSIZE * 3UL ) ) );
-         }
-         for( ; ( j + SIMDSIZE ) < jpos; j += SIMDSIZE * 2UL )
-         {
-            xmm1 += power( abs( tmp.load( k, i, j ) ) );
-            xmm2 += power( abs( tmp.load( k, i, j + SIMDSIZE ) ) );
-         }
-         for( ; j < jpos; j += SIMDSIZE )
-         {
-            xmm1 += power( abs( tmp.load( k, i, j ) ) );
-         }
-         for( ; remainder && j < N; ++j )
-         {
-            norm += power( abs( tmp( k, i, j ) ) );
-         }
+         xmm1 = acc( xmm1, power( abs( (*tmp).load( k, i, j ) ) ) );
+         xmm2 = acc( xmm2, power( abs( (*tmp).load( k, i, j + SIMDSIZE ) ) ) );
+         xmm3 = acc( xmm3, power( abs( (*tmp).load( k, i, j + SIMDSIZE * 2UL ) ) ) );
+         xmm4 = acc( xmm4, power( abs( (*tmp).load( k, i, j + SIMDSIZE * 3UL ) ) ) );
+      }
+      for( ; ( j + SIMDSIZE ) < jpos; j += SIMDSIZE * 2UL )
+      {
+         xmm1 = acc( xmm1, power( abs( (*tmp).load( k, i, j ) ) ) );
+         xmm2 = acc( xmm2, power( abs( (*tmp).load( k, i, j + SIMDSIZE ) ) ) );
+      }
+      for( ; j < jpos; j += SIMDSIZE )
+      {
+         xmm1 = acc( xmm1, power( abs( (*tmp).load( k, i, j ) ) ) );
+      }
+      for( ; remainder && j < N; ++j )
+      {
+         norm = acc( norm, power( abs( (*tmp)( k, i, j ) ) ) );
       }
    }
 
-   norm += sum( xmm1 + xmm2 + xmm3 + xmm4 );
+   return acc( norm, reduce( acc( acc( xmm1, xmm2 ), acc( xmm3, xmm4 ) ), acc ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
 
-   return evaluate( root( norm ) );
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Accumulates all elements of a dense tensor for the norm computation.
+// \ingroup dense_tensor
+//
+// \param dm The given dense tensor.
+// \param abs The functor for the abs operation.
+// \param power The functor for the power operation.
+// \param acc The functor for the accumulation (blaze::Add or blaze::Max).
+// \return The accumulated result, i.e. the norm before the application of the root operation.
+//
+// In case the tensor is large enough and no serial section is active, the rows of the tensor
+// are split into several contiguous chunks that are accumulated in parallel (see blaze::smpFor()).
+// Each chunk is accumulated by the (SIMD) row kernel into a partial result of its own, and the
+// partial results are combined in chunk order afterwards.
+*/
+template< typename MT     // Type of the dense tensor
+        , typename Abs    // Type of the abs operation
+        , typename Power  // Type of the power operation
+        , typename Acc >  // Type of the accumulation operation
+ElementType_t<MT> normAccumulate( const DenseTensor<MT>& dm, Abs abs, Power power, Acc acc )
+{
+   using CT = CompositeType_t<MT>;
+   using ET = ElementType_t<MT>;
+   using Vectorized = Bool_t< DTensNormHelper<MT,Abs,Power,Acc>::value >;
+
+   CT tmp( *dm );
+
+   const size_t rows( tmp.pages() * tmp.rows() );
+   const bool parallel( !isSerialSectionActive() && rows > 1UL &&
+                        rows*tmp.columns() >= smpDTensAssignThreshold() );
+
+   if( !parallel ) {
+      return normRows( tmp, abs, power, acc, 0UL, rows, Vectorized() );
+   }
+
+   const size_t chunks( min( rows, getNumThreads()*4UL ) );
+   std::vector<ET> partials( chunks );
+
+   smpFor( 0UL, chunks, [&]( size_t chunk ) {
+      partials[chunk] = normRows( tmp, abs, power, acc, ( rows*chunk ) / chunks,
+                                  ( rows*(chunk+1UL) ) / chunks, Vectorized() );
+   } );
+
+   ET norm( partials[0UL] );
+   for( size_t chunk=1UL; chunk<chunks; ++chunk ) {
+      norm = acc( norm, partials[chunk] );
+   }
+
+   return norm;
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -329,7 +361,180 @@ template< typename MT      // Type of the dense tensor
         , typename Root >  // Type of the root operation
 decltype(auto) norm_backend( const DenseTensor<MT>& dm, Abs abs, Power power, Root root )
 {
-   return norm_backend( *dm, abs, power, root, Bool_t< DTensNormHelper<MT,Abs,Power>::value >() );
+   using ET = ElementType_t<MT>;
+   using RT = decltype( evaluate( root( std::declval<ET>() ) ) );
+
+   if( (*dm).pages() == 0UL || (*dm).rows() == 0UL || (*dm).columns() == 0UL ) return RT();
+
+   return evaluate( root( normAccumulate( *dm, abs, power, Add() ) ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default kernel for the accumulation of a single tensor row into a row of a matrix.
+// \ingroup dense_tensor
+//
+// \param tmp The given (evaluated) dense tensor.
+// \param abs The functor for the abs operation.
+// \param power The functor for the power operation.
+// \param acc The functor for the accumulation (blaze::Add or blaze::Max).
+// \param k The page index of the tensor row.
+// \param i The row index of the tensor row.
+// \param sums The matrix holding the partial results.
+// \param s The row of \a sums the tensor row is accumulated into.
+// \return void
+*/
+template< typename TT     // Type of the dense tensor
+        , typename Abs    // Type of the abs operation
+        , typename Power  // Type of the power operation
+        , typename Acc    // Type of the accumulation operation
+        , typename MT >   // Type of the matrix of partial results
+inline void normAccumulateRow( const DenseTensor<TT>& tmp, Abs abs, Power power, Acc acc,
+                               size_t k, size_t i, MT& sums, size_t s, FalseType )
+{
+   const size_t N( (*tmp).columns() );
+
+   for( size_t j=0UL; j<N; ++j ) {
+      sums(s,j) = acc( sums(s,j), power( abs( (*tmp)( k, i, j ) ) ) );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief SIMD optimized kernel for the accumulation of a single tensor row into a row of a matrix.
+// \ingroup dense_tensor
+//
+// \param tmp The given (evaluated) dense tensor.
+// \param abs The functor for the abs operation.
+// \param power The functor for the power operation.
+// \param acc The functor for the accumulation (blaze::Add or blaze::Max).
+// \param k The page index of the tensor row.
+// \param i The row index of the tensor row.
+// \param sums The matrix holding the partial results.
+// \param s The row of \a sums the tensor row is accumulated into.
+// \return void
+*/
+template< typename TT     // Type of the dense tensor
+        , typename Abs    // Type of the abs operation
+        , typename Power  // Type of the power operation
+        , typename Acc    // Type of the accumulation operation
+        , typename MT >   // Type of the matrix of partial results
+inline void normAccumulateRow( const DenseTensor<TT>& tmp, Abs abs, Power power, Acc acc,
+                               size_t k, size_t i, MT& sums, size_t s, TrueType )
+{
+   using ET = ElementType_t<TT>;
+
+   static constexpr size_t SIMDSIZE = SIMDTrait<ET>::size;
+
+   const size_t N( (*tmp).columns() );
+   const size_t jpos( N & size_t(-SIMDSIZE) );
+
+   size_t j( 0UL );
+
+   for( ; j<jpos; j+=SIMDSIZE ) {
+      sums.store( s, j, acc( sums.load( s, j ), power( abs( (*tmp).load( k, i, j ) ) ) ) );
+   }
+   for( ; j<N; ++j ) {
+      sums(s,j) = acc( sums(s,j), power( abs( (*tmp)( k, i, j ) ) ) );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Computes a custom axis-wise norm for the given dense tensor.
+// \ingroup dense_tensor
+//
+// \param dm The given dense tensor for the norm computation.
+// \param abs The functor for the abs operation.
+// \param power The functor for the power operation.
+// \param root The functor for the root operation.
+// \param acc The functor for the accumulation (blaze::Add or blaze::Max).
+// \return The matrix of norms.
+//
+// This function computes the norms of all fibers of the given \f$ O \times M \times N \f$ tensor
+// along the axis selected by \a RF:
+//
+//  - \a columnwise: norm over the rows of each page, resulting in an \f$ O \times N \f$ matrix
+//  - \a rowwise: norm over the columns of each row, resulting in an \f$ O \times M \f$ matrix
+//  - \a pagewise: norm over the pages of each element, resulting in an \f$ M \times N \f$ matrix
+//
+// The result is evaluated directly into a row-major blaze::DynamicMatrix. In case the tensor is
+// large enough and no serial section is active, the independent rows of the result are computed
+// in parallel.
+*/
+template< size_t RF        // Reduction flag
+        , typename MT      // Type of the dense tensor
+        , typename Abs     // Type of the abs operation
+        , typename Power   // Type of the power operation
+        , typename Root    // Type of the root operation
+        , typename Acc >   // Type of the accumulation operation
+decltype(auto) norm_backend( const DenseTensor<MT>& dm, Abs abs, Power power, Root root, Acc acc )
+{
+   BLAZE_STATIC_ASSERT_MSG( RF < 3UL, "Invalid reduction flag" );
+
+   using CT = CompositeType_t<MT>;
+   using ET = ElementType_t<MT>;
+   using RT = RemoveCV_t< decltype( evaluate( root( std::declval<ET>() ) ) ) >;
+   using Vectorized = Bool_t< DTensNormHelper<MT,Abs,Power,Acc>::value >;
+
+   CT tmp( *dm );
+
+   const size_t O( tmp.pages()   );
+   const size_t M( tmp.rows()    );
+   const size_t N( tmp.columns() );
+
+   const bool parallel( !isSerialSectionActive() && O*M*N >= smpDTensAssignThreshold() );
+
+   auto loop = [parallel]( size_t end, const auto& kernel ) {
+      if( parallel && end > 1UL ) smpFor( 0UL, end, kernel );
+      else for( size_t index=0UL; index<end; ++index ) kernel( index );
+   };
+
+   if( RF == rowwise )
+   {
+      DynamicMatrix<RT> result( O, M );
+
+      loop( O*M, [&]( size_t r ) {
+         result( r / M, r % M ) =
+            evaluate( root( normRows( tmp, abs, power, acc, r, r+1UL, Vectorized() ) ) );
+      } );
+
+      return result;
+   }
+
+   DynamicMatrix<ET> sums( ( RF == columnwise )?( O ):( M ), N, ET{} );
+
+   if( RF == columnwise ) {
+      loop( O, [&]( size_t k ) {
+         for( size_t i=0UL; i<M; ++i )
+            normAccumulateRow( tmp, abs, power, acc, k, i, sums, k, Vectorized() );
+      } );
+   }
+   else {
+      loop( M, [&]( size_t i ) {
+         for( size_t k=0UL; k<O; ++k )
+            normAccumulateRow( tmp, abs, power, acc, k, i, sums, i, Vectorized() );
+      } );
+   }
+
+   DynamicMatrix<RT> result( sums.rows(), N );
+
+   for( size_t i=0UL; i<sums.rows(); ++i ) {
+      for( size_t j=0UL; j<N; ++j ) {
+         result(i,j) = evaluate( root( sums(i,j) ) );
+      }
+   }
+
+   return result;
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -553,6 +758,38 @@ inline decltype(auto) lpNorm( const DenseTensor<MT>& dm )
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend implementation of the maximum norm for tensors with built-in element type.
+// \ingroup dense_tensor
+*/
+template< typename MT > // Type of the dense tensor
+inline decltype(auto) maxNorm_backend( const DenseTensor<MT>& dm, TrueType )
+{
+   using ET = ElementType_t<MT>;
+
+   if( (*dm).pages() == 0UL || (*dm).rows() == 0UL || (*dm).columns() == 0UL ) return ET();
+
+   return normAccumulate( *dm, Abs(), Noop(), Max() );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend implementation of the maximum norm for tensors with non-built-in element type.
+// \ingroup dense_tensor
+*/
+template< typename MT > // Type of the dense tensor
+inline decltype(auto) maxNorm_backend( const DenseTensor<MT>& dm, FalseType )
+{
+   return max( abs( *dm ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief Computes the maximum norm for the given dense tensor.
 // \ingroup dense_tensor
@@ -573,7 +810,206 @@ decltype(auto) maxNorm( const DenseTensor<MT>& dm )
 {
    BLAZE_FUNCTION_TRACE;
 
-   return max( abs( *dm ) );
+   return maxNorm_backend( *dm, Bool_t< IsBuiltin_v< ElementType_t<MT> > >() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the axis-wise L2 norms of the given dense tensor.
+// \ingroup dense_tensor
+//
+// \param dm The given dense tensor for the norm computation.
+// \return The matrix of L2 norms.
+//
+// This function computes the L2 norms of the given \f$ O \times M \times N \f$ tensor along the
+// axis selected by the reduction flag \a RF and evaluates them into a row-major matrix:
+
+   \code
+   blaze::DynamicTensor<double> A( 8UL, 3UL, 5UL );
+   // ... Initialization
+
+   blaze::DynamicMatrix<double> C, R, P;
+   C = norm<columnwise>( A );  // 8x5 matrix, C(k,j) is the norm of column j of page k
+   R = norm<rowwise>( A );     // 8x3 matrix, R(k,i) is the norm of row i of page k
+   P = norm<pagewise>( A );    // 3x5 matrix, P(i,j) is the norm of A(:,i,j)
+   \endcode
+*/
+template< size_t RF      // Reduction flag
+        , typename MT >  // Type of the dense tensor
+decltype(auto) norm( const DenseTensor<MT>& dm )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return norm_backend<RF>( *dm, SqrAbs(), Noop(), Sqrt(), Add() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the axis-wise squared L2 norms of the given dense tensor.
+// \ingroup dense_tensor
+//
+// \param dm The given dense tensor for the norm computation.
+// \return The matrix of squared L2 norms.
+//
+// This function computes the squared L2 norms of the given dense tensor along the axis selected
+// by the reduction flag \a RF (see the axis-wise blaze::norm() for the resulting shapes).
+*/
+template< size_t RF      // Reduction flag
+        , typename MT >  // Type of the dense tensor
+decltype(auto) sqrNorm( const DenseTensor<MT>& dm )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return norm_backend<RF>( *dm, SqrAbs(), Noop(), Noop(), Add() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the axis-wise L1 norms of the given dense tensor.
+// \ingroup dense_tensor
+//
+// \param dm The given dense tensor for the norm computation.
+// \return The matrix of L1 norms.
+//
+// This function computes the L1 norms of the given dense tensor along the axis selected by the
+// reduction flag \a RF (see the axis-wise blaze::norm() for the resulting shapes).
+*/
+template< size_t RF      // Reduction flag
+        , typename MT >  // Type of the dense tensor
+decltype(auto) l1Norm( const DenseTensor<MT>& dm )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return norm_backend<RF>( *dm, Abs(), Noop(), Noop(), Add() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the axis-wise L2 norms of the given dense tensor.
+// \ingroup dense_tensor
+//
+// \param dm The given dense tensor for the norm computation.
+// \return The matrix of L2 norms.
+//
+// This function computes the L2 norms of the given dense tensor along the axis selected by the
+// reduction flag \a RF (see the axis-wise blaze::norm() for the resulting shapes). For instance,
+// for a batch of samples stored as the pages of a tensor, the per-sample row norms are computed
+// in a single call:
+
+   \code
+   blaze::DynamicTensor<double> A( 32UL, 16UL, 64UL );
+   // ... Initialization
+
+   const blaze::DynamicMatrix<double> R( l2Norm<rowwise>( A ) );  // 32x16 matrix
+   \endcode
+*/
+template< size_t RF      // Reduction flag
+        , typename MT >  // Type of the dense tensor
+decltype(auto) l2Norm( const DenseTensor<MT>& dm )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return norm_backend<RF>( *dm, SqrAbs(), Noop(), Sqrt(), Add() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the axis-wise L3 norms of the given dense tensor.
+// \ingroup dense_tensor
+//
+// \param dm The given dense tensor for the norm computation.
+// \return The matrix of L3 norms.
+//
+// This function computes the L3 norms of the given dense tensor along the axis selected by the
+// reduction flag \a RF (see the axis-wise blaze::norm() for the resulting shapes).
+*/
+template< size_t RF      // Reduction flag
+        , typename MT >  // Type of the dense tensor
+decltype(auto) l3Norm( const DenseTensor<MT>& dm )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return norm_backend<RF>( *dm, Abs(), Pow3(), Cbrt(), Add() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the axis-wise L4 norms of the given dense tensor.
+// \ingroup dense_tensor
+//
+// \param dm The given dense tensor for the norm computation.
+// \return The matrix of L4 norms.
+//
+// This function computes the L4 norms of the given dense tensor along the axis selected by the
+// reduction flag \a RF (see the axis-wise blaze::norm() for the resulting shapes).
+*/
+template< size_t RF      // Reduction flag
+        , typename MT >  // Type of the dense tensor
+decltype(auto) l4Norm( const DenseTensor<MT>& dm )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return norm_backend<RF>( *dm, SqrAbs(), Pow2(), Qdrt(), Add() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the axis-wise Lp norms of the given dense tensor.
+// \ingroup dense_tensor
+//
+// \param dm The given dense tensor for the norm computation.
+// \param p The norm parameter (p > 0).
+// \return The matrix of Lp norms.
+//
+// This function computes the Lp norms of the given dense tensor along the axis selected by the
+// reduction flag \a RF (see the axis-wise blaze::norm() for the resulting shapes).
+//
+// \note The norm parameter \a p is expected to be larger than 0. This precondition is only checked
+// by a user assertion.
+*/
+template< size_t RF      // Reduction flag
+        , typename MT    // Type of the dense tensor
+        , typename ST >  // Type of the norm parameter
+decltype(auto) lpNorm( const DenseTensor<MT>& dm, ST p )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_USER_ASSERT( !isZero( p ), "Invalid p for Lp norm detected" );
+
+   using ScalarType = MultTrait_t< UnderlyingBuiltin_t<MT>, decltype( inv( p ) ) >;
+   using UnaryPow = Bind2nd<Pow,ScalarType>;
+   return norm_backend<RF>( *dm, Abs(), UnaryPow( Pow(), p ), UnaryPow( Pow(), inv( p ) ), Add() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the axis-wise maximum norms of the given dense tensor.
+// \ingroup dense_tensor
+//
+// \param dm The given dense tensor for the norm computation.
+// \return The matrix of maximum norms.
+//
+// This function computes the maximum norms of the given dense tensor along the axis selected by
+// the reduction flag \a RF (see the axis-wise blaze::norm() for the resulting shapes). The
+// element type of the tensor is required to be a built-in data type.
+*/
+template< size_t RF      // Reduction flag
+        , typename MT >  // Type of the dense tensor
+decltype(auto) maxNorm( const DenseTensor<MT>& dm )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_STATIC_ASSERT_MSG( IsBuiltin_v< ElementType_t<MT> >, "Invalid element type detected" );
+
+   return norm_backend<RF>( *dm, Abs(), Noop(), Noop(), Max() );
 }
 //*************************************************************************************************
 
@@ -68,6 +68,7 @@ template< typename > class DTensRavelExpr;
 template< typename, typename > class DTensScalarMultExpr;
 template< typename, typename > class DTensScalarDivExpr;
 template< typename, typename, typename > class DTensDTensMapExpr;
+template< typename, typename... > class DTensNaryMapExpr;
 template< typename, size_t... > class DTensTransExpr;
 template< typename, size_t... > class DQuatTransExpr;
 
@@ -76,6 +77,7 @@ template< typename > class DMatRavelExpr;
 
 template< typename, typename > class DArrMapExpr;
 template< typename, typename, typename > class DArrDArrMapExpr;
+template< typename, typename... > class DArrNaryMapExpr;
 template< typename, typename > class DArrScalarMultExpr;
 template< typename, typename > class DArrScalarDivExpr;
 
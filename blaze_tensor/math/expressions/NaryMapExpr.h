@@ -0,0 +1,162 @@
+//=================================================================================================
+/*!
+//  \file blaze_tensor/math/expressions/NaryMapExpr.h
+//  \brief Header file for the NaryMapExpr base class
+//
+//  Copyright (C) 2012-2018 Klaus Iglberger - All Rights Reserved
+//  Copyright (C) 2018 Hartmut Kaiser - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+
+#ifndef _BLAZE_TENSOR_MATH_EXPRESSIONS_NARYMAPEXPR_H_
+#define _BLAZE_TENSOR_MATH_EXPRESSIONS_NARYMAPEXPR_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <initializer_list>
+#include <tuple>
+#include <utility>
+#include <blaze/math/expressions/Expression.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/IntegralConstant.h>
+#include <blaze/util/typetraits/IsSame.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Base class for all n-ary map expression templates.
+// \ingroup math
+//
+// The NaryMapExpr class serves as a tag for all expression templates that implement a map
+// operation on three or more tensor or array operands. All classes, that represent such an
+// operation and that are used within the expression template environment of the Blaze library
+// have to derive publicly from this class in order to qualify as n-ary map expression template.
+*/
+template< typename MT >  // Base type of the expression
+struct NaryMapExpr
+   : public Expression<MT>
+{};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  AUXILIARY FUNCTIONALITY
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Auxiliary helper for the compile time conjunction of a pack of boolean values.
+// \ingroup math
+*/
+template< bool... Bs >
+struct NaryAnd
+   : public BoolConstant< IsSame_v< BoolConstant<true> (*)( BoolConstant<Bs>... )
+                                  , BoolConstant<true> (*)( BoolConstant<Bs||true>... ) > >
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Auxiliary helper for the query of the SIMD capability of an n-ary custom operation.
+// \ingroup math
+*/
+template< typename OP, typename... ETs >
+struct GetNarySIMDEnabled
+   : public BoolConstant< OP::template simdEnabled<ETs...>() >
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Runtime conjunction of a list of boolean values.
+// \ingroup math
+*/
+inline bool naryAll( std::initializer_list<bool> flags ) noexcept
+{
+   return std::all_of( flags.begin(), flags.end(), []( bool f ){ return f; } );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Runtime disjunction of a list of boolean values.
+// \ingroup math
+*/
+inline bool naryAny( std::initializer_list<bool> flags ) noexcept
+{
+   return std::any_of( flags.begin(), flags.end(), []( bool f ){ return f; } );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Splits the arguments of the n-ary map() function into the operands and the trailing
+//        custom operation.
+// \ingroup math
+//
+// The n-ary map() functions take the custom operation as last argument. This function forwards
+// the arguments to the matching nmap_backend() overload with the operation moved to the front.
+//
+// \param args The arguments of the map() function.
+// \return The custom operation applied to each single element of the given operands.
+*/
+template< typename... Args  // Types of the arguments of the map() function
+        , size_t... I >     // Indices of the operands
+inline decltype(auto)
+   nmap_backend( const std::tuple<Args...>& args, std::index_sequence<I...> )
+{
+   return nmap_backend( std::get<sizeof...(I)>( args ), std::get<I>( args )... );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,86 @@
+//=================================================================================================
+/*!
+//  \file blaze_tensor/math/functors/Select.h
+//  \brief Header file for the Select functor
+//
+//  Copyright (C) 2012-2018 Klaus Iglberger - All Rights Reserved
+//  Copyright (C) 2018 Hartmut Kaiser - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+
+#ifndef _BLAZE_TENSOR_MATH_FUNCTORS_SELECT_H_
+#define _BLAZE_TENSOR_MATH_FUNCTORS_SELECT_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/system/Inline.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Generic wrapper for the element-wise selection between two values.
+// \ingroup functors
+//
+// The Select functor returns its second argument in case the given mask value evaluates to
+// \a true and its third argument otherwise. The selection is formulated without branches on
+// the element values, which allows the compiler to turn the element-wise evaluation loops of
+// the select() and where() functions into blend instructions. Since the SIMD abstraction of
+// the Blaze library does not provide a blend operation, the functor deliberately does not
+// provide a \a load() function.
+*/
+struct Select
+{
+   //**********************************************************************************************
+   /*!\brief Returns either \a a or \a b, depending on the given mask value.
+   //
+   // \param mask The mask value.
+   // \param a The value selected for a non-zero mask value.
+   // \param b The value selected for a zero mask value.
+   // \return The selected value.
+   */
+   template< typename T1, typename T2, typename T3 >
+   BLAZE_ALWAYS_INLINE constexpr auto operator()( const T1& mask, const T2& a, const T3& b ) const
+   {
+      return ( mask ? a : b );
+   }
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,821 @@
+//=================================================================================================
+/*!
+//  \file blaze_tensor/math/serialization/ArraySerializer.h
+//  \brief Serialization of dense arrays
+//
+//  Copyright (C) 2012-2018 Klaus Iglberger - All Rights Reserved
+//  Copyright (C) 2018 Hartmut Kaiser - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+
+#ifndef _BLAZE_TENSOR_MATH_SERIALIZATION_ARRAYSERIALIZER_H_
+#define _BLAZE_TENSOR_MATH_SERIALIZATION_ARRAYSERIALIZER_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <array>
+#include <memory>
+#include <vector>
+
+#include <blaze/math/Exception.h>
+#include <blaze/math/serialization/TypeValueMapping.h>
+#include <blaze/math/typetraits/HasConstDataAccess.h>
+#include <blaze/math/typetraits/HasMutableDataAccess.h>
+#include <blaze/math/typetraits/IsResizable.h>
+#include <blaze/util/Complex.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/FunctionTrace.h>
+#include <blaze/util/MaybeUnused.h>
+#include <blaze/util/TypeList.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsConstructible.h>
+#include <blaze/util/typetraits/IsNumeric.h>
+
+#include <blaze_tensor/math/expressions/DenseArray.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Serializer for dense N-dimensional arrays.
+// \ingroup array_serialization
+//
+// The ArraySerializer implements the necessary logic to serialize dense arrays, i.e. to convert
+// them into a portable, binary representation. The following example demonstrates the
+// (de-)serialization process of arrays:
+
+   \code
+   // Serialization of an array
+   {
+      blaze::DynamicArray<4,double> A( 2UL, 3UL, 4UL, 5UL );
+
+      // ... Initialization
+
+      // Creating an archive that writes into the file "array.blaze"
+      blaze::Archive<std::ofstream> archive( "array.blaze" );
+
+      archive << A;
+   }
+
+   // Reconstitution of the array
+   {
+      blaze::DynamicArray<4,float> A1;
+
+      // Creating an archive that reads from the file "array.blaze"
+      blaze::Archive<std::ifstream> archive( "array.blaze" );
+
+      // Reconstituting the former A array into A1, converting the elements to float
+      archive >> A1;
+   }
+   \endcode
+
+// The header of a serialized array contains the number of dimensions followed by the extents
+// of all dimensions, starting with the innermost (column) dimension. The elements follow
+// without any padding in row-major order. For arrays with low-level data access the payload
+// is written and read in bulk, i.e. with one archive operation per contiguous block of rows,
+// and read directly into the (padded) storage of the target. Resizable arrays are resized to
+// the size of the serialized array, all other arrays must already have the correct size. In
+// case the element type of the serialized array differs from the element type of the target,
+// the elements are converted on load, provided the target element type can be constructed from
+// the stored one.
+*/
+class ArraySerializer
+{
+ public:
+   //**Constructor*********************************************************************************
+   // No explicitly declared copy constructor.
+   explicit inline ArraySerializer();
+   //**********************************************************************************************
+
+   //**Serialization functions*********************************************************************
+   /*!\name Serialization functions */
+   //@{
+   template< typename Archive, typename AT >
+   void serialize( Archive& archive, const DenseArray<AT>& arr );
+
+   template< typename Archive, typename AT >
+   void deserialize( Archive& archive, DenseArray<AT>& arr );
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   template< typename Archive, typename AT >
+   void serializeHeader( Archive& archive, const AT& arr );
+
+   template< typename Archive, typename AT >
+   EnableIf_t< HasConstDataAccess_v<AT> && IsNumeric_v< ElementType_t<AT> > >
+      serializeArray( Archive& archive, const AT& arr );
+
+   template< typename Archive, typename AT >
+   EnableIf_t< HasConstDataAccess_v<AT> && !IsNumeric_v< ElementType_t<AT> > >
+      serializeArray( Archive& archive, const AT& arr );
+
+   template< typename Archive, typename AT >
+   DisableIf_t< HasConstDataAccess_v<AT> >
+      serializeArray( Archive& archive, const AT& arr );
+
+   template< typename Archive >
+   void deserializeHeader( Archive& archive, size_t N );
+
+   template< typename AT >
+   DisableIf_t< IsResizable_v<AT> > prepareArray( AT& arr );
+
+   template< typename AT >
+   EnableIf_t< IsResizable_v<AT> > prepareArray( AT& arr );
+
+   template< typename Archive, typename AT >
+   EnableIf_t< HasMutableDataAccess_v<AT> > deserializeArray( Archive& archive, AT& arr );
+
+   template< typename Archive, typename AT >
+   DisableIf_t< HasMutableDataAccess_v<AT> > deserializeArray( Archive& archive, AT& arr );
+
+   template< typename Archive, typename AT >
+   EnableIf_t< IsNumeric_v< ElementType_t<AT> > >
+      deserializeDenseArray( Archive& archive, AT& arr );
+
+   template< typename Archive, typename AT >
+   DisableIf_t< IsNumeric_v< ElementType_t<AT> > >
+      deserializeDenseArray( Archive& archive, AT& arr );
+
+   template< typename Archive, typename AT >
+   bool convertArray( Archive& archive, AT& arr, TypeList<> );
+
+   template< typename Archive, typename AT, typename T, typename... Ts >
+   bool convertArray( Archive& archive, AT& arr, TypeList<T,Ts...> );
+
+   template< typename T, typename Archive, typename AT >
+   EnableIf_t< IsNumeric_v< ElementType_t<AT> > && IsConstructible_v< ElementType_t<AT>, T >, bool >
+      convertDenseArray( Archive& archive, AT& arr );
+
+   template< typename T, typename Archive, typename AT >
+   DisableIf_t< IsNumeric_v< ElementType_t<AT> > && IsConstructible_v< ElementType_t<AT>, T >, bool >
+      convertDenseArray( Archive& archive, AT& arr );
+
+   template< typename AT >
+   static size_t rowCount( const AT& arr ) noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Type definitions****************************************************************************
+   //! Element types that can be converted into the element type of the target array on load.
+   using ConvertibleTypes = TypeList< int8_t, int16_t, int32_t, int64_t
+                                    , uint8_t, uint16_t, uint32_t, uint64_t
+                                    , float, double, long double
+                                    , complex<float>, complex<double>, complex<long double> >;
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   uint8_t  version_;      //!< The version of the archive.
+   uint8_t  type_;         //!< The type of the array.
+   uint8_t  elementType_;  //!< The type of an element.
+   uint8_t  elementSize_;  //!< The size in bytes of a single element of the array.
+   std::vector<uint64_t> dims_;  //!< The extents of the array, starting with the innermost dimension.
+   uint64_t number_;       //!< The total number of elements contained in the array.
+   //@}
+   //**********************************************************************************************
+
+   //**Constants***********************************************************************************
+   //! The type identifier of dense arrays within an archive.
+   static constexpr uint8_t denseArray = 33U;
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The default constructor of the ArraySerializer class.
+*/
+ArraySerializer::ArraySerializer()
+   : version_    ( 0U  )  // The version of the archive
+   , type_       ( 0U  )  // The type of the array
+   , elementType_( 0U  )  // The type of an element
+   , elementSize_( 0U  )  // The size in bytes of a single element of the array
+   , dims_       (     )  // The extents of the array
+   , number_     ( 0UL )  // The total number of elements contained in the array
+{}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SERIALIZATION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Serializes the given dense array and writes it to the archive.
+//
+// \param archive The archive to be written.
+// \param arr The array to be serialized.
+// \return void
+// \exception std::runtime_error Error during serialization.
+//
+// This function serializes the given dense array and writes it to the given archive. In case
+// any error is detected during the serialization, a \a std::runtime_error is thrown.
+*/
+template< typename Archive  // Type of the archive
+        , typename AT >     // Type of the array
+void ArraySerializer::serialize( Archive& archive, const DenseArray<AT>& arr )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   if( !archive ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Faulty archive detected" );
+   }
+
+   serializeHeader( archive, *arr );
+   serializeArray( archive, *arr );
+
+   if( !archive ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Dense array could not be serialized" );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Serializes all meta information about the given array.
+//
+// \param archive The archive to be written.
+// \param arr The array to be serialized.
+// \return void
+// \exception std::runtime_error File header could not be serialized.
+*/
+template< typename Archive  // Type of the archive
+        , typename AT >     // Type of the array
+void ArraySerializer::serializeHeader( Archive& archive, const AT& arr )
+{
+   using ET = ElementType_t<AT>;
+
+   constexpr size_t N( AT::num_dimensions );
+
+   archive << uint8_t ( 1U );
+   archive << uint8_t ( denseArray );
+   archive << uint8_t ( TypeValueMapping<ET>::value );
+   archive << uint8_t ( sizeof( ET ) );
+   archive << uint64_t( N );
+
+   size_t number( 1UL );
+   for( size_t d=0UL; d<N; ++d ) {
+      archive << uint64_t( arr.dimensions()[d] );
+      number *= arr.dimensions()[d];
+   }
+
+   archive << uint64_t( number );
+
+   if( !archive ) {
+      BLAZE_THROW_RUNTIME_ERROR( "File header could not be serialized" );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Serializes the numeric elements of a dense array with low-level data access.
+//
+// \param archive The archive to be written.
+// \param arr The array to be serialized.
+// \return void
+//
+// The elements are written without padding. Unpadded arrays are written with a single bulk
+// write, padded arrays with one bulk write per row.
+*/
+template< typename Archive  // Type of the archive
+        , typename AT >     // Type of the array
+EnableIf_t< HasConstDataAccess_v<AT> && IsNumeric_v< ElementType_t<AT> > >
+   ArraySerializer::serializeArray( Archive& archive, const AT& arr )
+{
+   const size_t n( arr.dimensions()[0] );
+   const size_t rows( rowCount( arr ) );
+
+   if( rows == 0UL || n == 0UL ) return;
+
+   if( arr.spacing() == n ) {
+      archive.write( arr.data(), rows * n );
+   }
+   else for( size_t r=0UL; r<rows; ++r ) {
+      archive.write( arr.data() + r * arr.spacing(), n );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Serializes the non-numeric elements of a dense array with low-level data access.
+//
+// \param archive The archive to be written.
+// \param arr The array to be serialized.
+// \return void
+*/
+template< typename Archive  // Type of the archive
+        , typename AT >     // Type of the array
+EnableIf_t< HasConstDataAccess_v<AT> && !IsNumeric_v< ElementType_t<AT> > >
+   ArraySerializer::serializeArray( Archive& archive, const AT& arr )
+{
+   const size_t n( arr.dimensions()[0] );
+   const size_t rows( rowCount( arr ) );
+
+   for( size_t r=0UL; r<rows; ++r ) {
+      for( size_t j=0UL; j<n; ++j ) {
+         archive << arr.data()[r * arr.spacing() + j];
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Serializes the elements of a dense array without low-level data access.
+//
+// \param archive The archive to be written.
+// \param arr The array to be serialized.
+// \return void
+//
+// The array (e.g. an array expression) is evaluated into a temporary, which is serialized.
+*/
+template< typename Archive  // Type of the archive
+        , typename AT >     // Type of the array
+DisableIf_t< HasConstDataAccess_v<AT> >
+   ArraySerializer::serializeArray( Archive& archive, const AT& arr )
+{
+   const ResultType_t<AT> tmp( arr );
+   serializeArray( archive, tmp );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DESERIALIZATION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Deserializes a dense array from the given archive.
+//
+// \param archive The archive to be read from.
+// \param arr The array to be deserialized.
+// \return void
+// \exception std::runtime_error Error during deserialization.
+// \exception std::invalid_argument Invalid array size detected.
+//
+// This function deserializes a dense array from the given archive. The target array is resized
+// to the size of the serialized array if possible, otherwise its size has to match the
+// serialized size. In case the stored element type differs from the element type of the target
+// array, the elements are converted on load. In case any error is detected during the
+// deserialization process, a \a std::runtime_error is thrown.
+*/
+template< typename Archive  // Type of the archive
+        , typename AT >     // Type of the array
+void ArraySerializer::deserialize( Archive& archive, DenseArray<AT>& arr )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   if( !archive ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Faulty archive detected" );
+   }
+
+   deserializeHeader( archive, AT::num_dimensions );
+   deserializeArray( archive, *arr );
+
+   if( !archive ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Dense array could not be deserialized" );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Deserializes all meta information about the given array.
+//
+// \param archive The archive to be read from.
+// \param N The number of dimensions of the target array.
+// \return void
+// \exception std::runtime_error Error during deserialization.
+*/
+template< typename Archive >  // Type of the archive
+void ArraySerializer::deserializeHeader( Archive& archive, size_t N )
+{
+   uint64_t dimensions( 0UL );
+
+   if( !( archive >> version_ >> type_ >> elementType_ >> elementSize_ >> dimensions ) ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Corrupt archive detected" );
+   }
+   else if( version_ != 1U ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Invalid version detected" );
+   }
+   else if( type_ != denseArray ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Invalid array type detected" );
+   }
+   else if( dimensions != N ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Invalid number of dimensions detected" );
+   }
+
+   dims_.resize( N );
+
+   uint64_t number( 1UL );
+   for( size_t d=0UL; d<N; ++d ) {
+      archive >> dims_[d];
+      number *= dims_[d];
+   }
+
+   if( !( archive >> number_ ) ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Corrupt archive detected" );
+   }
+   else if( number_ != number ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Invalid number of elements detected" );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Prepares the given non-resizable array for the deserialization process.
+//
+// \param arr The array to be prepared.
+// \return void
+// \exception std::invalid_argument Invalid array size detected.
+*/
+template< typename AT >  // Type of the array
+DisableIf_t< IsResizable_v<AT> > ArraySerializer::prepareArray( AT& arr )
+{
+   for( size_t d=0UL; d<AT::num_dimensions; ++d ) {
+      if( arr.dimensions()[d] != dims_[d] ) {
+         BLAZE_THROW_INVALID_ARGUMENT( "Invalid array size detected" );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Prepares the given resizable array for the deserialization process.
+//
+// \param arr The array to be prepared.
+// \return void
+*/
+template< typename AT >  // Type of the array
+EnableIf_t< IsResizable_v<AT> > ArraySerializer::prepareArray( AT& arr )
+{
+   std::array< size_t, AT::num_dimensions > dims;
+
+   for( size_t d=0UL; d<AT::num_dimensions; ++d ) {
+      dims[d] = dims_[d];
+   }
+
+   arr.resize( dims, false );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Deserializes the elements of an array with low-level data access.
+//
+// \param archive The archive to be read from.
+// \param arr The array to be reconstituted.
+// \return void
+// \exception std::runtime_error Invalid element type detected.
+//
+// In case the stored element type matches the element type of the target array the elements
+// are read directly into the target. Otherwise the elements are converted on load.
+*/
+template< typename Archive  // Type of the archive
+        , typename AT >     // Type of the array
+EnableIf_t< HasMutableDataAccess_v<AT> >
+   ArraySerializer::deserializeArray( Archive& archive, AT& arr )
+{
+   using ET = ElementType_t<AT>;
+
+   prepareArray( arr );
+
+   if( elementType_ == TypeValueMapping<ET>::value && elementSize_ == sizeof( ET ) ) {
+      deserializeDenseArray( archive, arr );
+   }
+   else if( !convertArray( archive, arr, ConvertibleTypes() ) ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Invalid element type detected" );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Deserializes the elements of an array without low-level data access.
+//
+// \param archive The archive to be read from.
+// \param arr The array to be reconstituted.
+// \return void
+//
+// The elements are deserialized into a temporary array, which is assigned to the target.
+*/
+template< typename Archive  // Type of the archive
+        , typename AT >     // Type of the array
+DisableIf_t< HasMutableDataAccess_v<AT> >
+   ArraySerializer::deserializeArray( Archive& archive, AT& arr )
+{
+   prepareArray( arr );
+
+   ResultType_t<AT> tmp( arr );
+   deserializeArray( archive, tmp );
+   arr = tmp;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reads the numeric elements of a dense array in bulk.
+//
+// \param archive The archive to be read from.
+// \param arr The array to be reconstituted.
+// \return void
+//
+// The elements are read directly into the (padded) storage of the array. Unpadded arrays are
+// read with a single bulk read, padded arrays with one bulk read per row.
+*/
+template< typename Archive  // Type of the archive
+        , typename AT >     // Type of the array
+EnableIf_t< IsNumeric_v< ElementType_t<AT> > >
+   ArraySerializer::deserializeDenseArray( Archive& archive, AT& arr )
+{
+   const size_t n( arr.dimensions()[0] );
+   const size_t rows( rowCount( arr ) );
+
+   if( rows == 0UL || n == 0UL ) return;
+
+   if( arr.spacing() == n ) {
+      archive.read( arr.data(), rows * n );
+   }
+   else for( size_t r=0UL; r<rows; ++r ) {
+      archive.read( arr.data() + r * arr.spacing(), n );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reads the non-numeric elements of a dense array element by element.
+//
+// \param archive The archive to be read from.
+// \param arr The array to be reconstituted.
+// \return void
+*/
+template< typename Archive  // Type of the archive
+        , typename AT >     // Type of the array
+DisableIf_t< IsNumeric_v< ElementType_t<AT> > >
+   ArraySerializer::deserializeDenseArray( Archive& archive, AT& arr )
+{
+   const size_t n( arr.dimensions()[0] );
+   const size_t rows( rowCount( arr ) );
+
+   for( size_t r=0UL; r<rows; ++r ) {
+      for( size_t j=0UL; j<n; ++j ) {
+         if( !( archive >> arr.data()[r * arr.spacing() + j] ) ) return;
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief End of the recursion over the convertible element types.
+//
+// \return \a false since the stored element type cannot be converted.
+*/
+template< typename Archive  // Type of the archive
+        , typename AT >     // Type of the array
+bool ArraySerializer::convertArray( Archive& archive, AT& arr, TypeList<> )
+{
+   MAYBE_UNUSED( archive, arr );
+
+   return false;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Deserializes an array with converted element type.
+//
+// \param archive The archive to be read from.
+// \param arr The array to be reconstituted.
+// \return \a true in case the stored element type could be converted, \a false if not.
+*/
+template< typename Archive   // Type of the archive
+        , typename AT        // Type of the array
+        , typename T         // First candidate element type
+        , typename... Ts >   // Remaining candidate element types
+bool ArraySerializer::convertArray( Archive& archive, AT& arr, TypeList<T,Ts...> )
+{
+   if( elementType_ == TypeValueMapping<T>::value && elementSize_ == sizeof( T ) ) {
+      return convertDenseArray<T>( archive, arr );
+   }
+
+   return convertArray( archive, arr, TypeList<Ts...>() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Deserializes and converts the elements of a dense array.
+//
+// \param archive The archive to be read from.
+// \param arr The array to be reconstituted.
+// \return \a true.
+//
+// The stored elements are read row by row into a buffer and converted into the target row.
+*/
+template< typename T         // Stored element type
+        , typename Archive   // Type of the archive
+        , typename AT >      // Type of the array
+EnableIf_t< IsNumeric_v< ElementType_t<AT> > && IsConstructible_v< ElementType_t<AT>, T >, bool >
+   ArraySerializer::convertDenseArray( Archive& archive, AT& arr )
+{
+   using ET = ElementType_t<AT>;
+
+   const size_t n( arr.dimensions()[0] );
+   const size_t rows( rowCount( arr ) );
+
+   if( rows == 0UL || n == 0UL ) return true;
+
+   const std::unique_ptr<T[]> buffer( new T[n] );
+
+   for( size_t r=0UL; r<rows; ++r )
+   {
+      if( !archive.read( buffer.get(), n ) ) return true;
+
+      ET* row( arr.data() + r * arr.spacing() );
+      for( size_t j=0UL; j<n; ++j ) {
+         row[j] = ET( buffer[j] );
+      }
+   }
+
+   return true;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Rejects the conversion of a stored element type into the target element type.
+//
+// \param archive The archive to be read from.
+// \param arr The array to be reconstituted.
+// \return \a false since the element types are not convertible.
+*/
+template< typename T         // Stored element type
+        , typename Archive   // Type of the archive
+        , typename AT >      // Type of the array
+DisableIf_t< IsNumeric_v< ElementType_t<AT> > && IsConstructible_v< ElementType_t<AT>, T >, bool >
+   ArraySerializer::convertDenseArray( Archive& archive, AT& arr )
+{
+   MAYBE_UNUSED( archive, arr );
+
+   return false;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the total number of rows of the given array.
+//
+// \param arr The given array.
+// \return The product of the extents of all but the innermost dimension.
+*/
+template< typename AT >  // Type of the array
+size_t ArraySerializer::rowCount( const AT& arr ) noexcept
+{
+   size_t rows( 1UL );
+
+   for( size_t d=1UL; d<AT::num_dimensions; ++d ) {
+      rows *= arr.dimensions()[d];
+   }
+
+   return rows;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Serializes the given dense array and writes it to the archive.
+// \ingroup array_serialization
+//
+// \param archive The archive to be written.
+// \param arr The array to be serialized.
+// \return void
+// \exception std::runtime_error Error during serialization.
+//
+// The serialize() function converts the given dense array into a portable, binary
+// representation. The following example demonstrates the (de-)serialization process of
+// arrays:
+
+   \code
+   // Serialization of an array
+   {
+      blaze::DynamicArray<4,double> A;
+
+      // ... Resizing and initialization
+
+      blaze::Archive<std::ofstream> archive( "array.blaze" );
+      serialize( archive, A );
+   }
+
+   // Deserialization of an array
+   {
+      blaze::DynamicArray<4,double> B;
+
+      blaze::Archive<std::ifstream> archive( "array.blaze" );
+      deserialize( archive, B );
+   }
+   \endcode
+
+// In case an error is encountered during (de-)serialization, a \a std::runtime_exception is
+// thrown.
+*/
+template< typename Archive  // Type of the archive
+        , typename AT >     // Type of the array
+void serialize( Archive& archive, const DenseArray<AT>& arr )
+{
+   ArraySerializer().serialize( archive, *arr );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Deserializes a dense array.
+// \ingroup array_serialization
+//
+// \param archive The archive to be read from.
+// \param arr The array to be deserialized.
+// \return void
+// \exception std::runtime_error Array could not be deserialized.
+// \exception std::invalid_argument Invalid array size detected.
+//
+// The deserialize() function restores the given dense array from the archive. For more details
+// on the deserialization process, see the documentation of the serialize() function.
+*/
+template< typename Archive  // Type of the archive
+        , typename AT >     // Type of the array
+void deserialize( Archive& archive, DenseArray<AT>& arr )
+{
+   ArraySerializer().deserialize( archive, *arr );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
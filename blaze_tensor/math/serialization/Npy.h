@@ -0,0 +1,956 @@
+//=================================================================================================
+/*!
+//  \file blaze_tensor/math/serialization/Npy.h
+//  \brief Header file for reading and writing NumPy .npy files
+//
+//  Copyright (C) 2012-2018 Klaus Iglberger - All Rights Reserved
+//  Copyright (C) 2018 Hartmut Kaiser - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+
+#ifndef _BLAZE_TENSOR_MATH_SERIALIZATION_NPY_H_
+#define _BLAZE_TENSOR_MATH_SERIALIZATION_NPY_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <array>
+#include <fstream>
+#include <istream>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include <blaze/math/Exception.h>
+#include <blaze/math/typetraits/HasConstDataAccess.h>
+#include <blaze/math/typetraits/HasMutableDataAccess.h>
+#include <blaze/math/typetraits/IsResizable.h>
+#include <blaze/util/Complex.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/FunctionTrace.h>
+#include <blaze/util/IntegralConstant.h>
+#include <blaze/util/StaticAssert.h>
+#include <blaze/util/TypeList.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsComplex.h>
+#include <blaze/util/typetraits/IsConstructible.h>
+#include <blaze/util/typetraits/IsNumeric.h>
+
+#include <blaze_tensor/math/expressions/DenseArray.h>
+#include <blaze_tensor/math/expressions/DenseTensor.h>
+#include <blaze_tensor/math/serialization/NpyFormat.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  ROW-WISE TRANSFER OF .NPY DATA
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Output channel for .npy data, optionally computing the CRC-32 of the written bytes.
+// \ingroup npy
+*/
+struct NpyOutput
+{
+   //**********************************************************************************************
+   /*!\brief Writes the given bytes to the output stream.
+   //
+   // \param data The first byte to be written.
+   // \param size The number of bytes.
+   // \return void
+   */
+   inline void write( const char* data, size_t size ) {
+      os.write( data, static_cast<std::streamsize>( size ) );
+      if( checksum ) crc = npzCrc32( crc, data, size );
+   }
+   //**********************************************************************************************
+
+   std::ostream& os;        //!< The output stream.
+   bool          checksum;  //!< \a true if the CRC-32 of the written bytes is required.
+   uint32_t      crc;       //!< The CRC-32 of the written bytes.
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Element types that can be converted on load.
+// \ingroup npy
+*/
+using NpyTypes = TypeList< bool, int8_t, int16_t, int32_t, int64_t
+                         , uint8_t, uint16_t, uint32_t, uint64_t
+                         , float, double, complex<float>, complex<double> >;
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Writes rows of elements in blocks of contiguous rows.
+// \ingroup npy
+//
+// \param out The output channel.
+// \param rows The total number of rows.
+// \param n The number of elements per row.
+// \param block The number of rows per contiguous block of memory.
+// \param rowOf Functor returning a pointer to the first element of a row.
+// \return void
+*/
+template< typename ET       // Type of the elements
+        , typename RowOf >  // Type of the row access functor
+void writeNpyRows( NpyOutput& out, size_t rows, size_t n, size_t block, RowOf rowOf )
+{
+   if( n == 0UL ) return;
+
+   for( size_t r=0UL; r<rows; r+=block ) {
+      out.write( reinterpret_cast<const char*>( rowOf( r ) ), block * n * sizeof( ET ) );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Reads rows of elements stored as \a T and converts them to \a ET.
+// \ingroup npy
+//
+// \param is The input stream.
+// \param header The header of the .npy data.
+// \param rows The total number of rows.
+// \param n The number of elements per row.
+// \param rowOf Functor returning a pointer to the first element of a row.
+// \return \a true.
+*/
+template< typename ET       // Target element type
+        , typename T        // Stored element type
+        , typename RowOf >  // Type of the row access functor
+bool readNpyAs( std::istream& is, const NpyHeader& header, size_t rows, size_t n, RowOf rowOf, TrueType )
+{
+   const size_t scalars( IsComplex_v<T> ? 2UL : 1UL );
+   const bool   swapped( npySwapped( header ) );
+
+   std::vector<T> buffer( n );
+
+   for( size_t r=0UL; r<rows; ++r )
+   {
+      if( !is.read( reinterpret_cast<char*>( buffer.data() ), static_cast<std::streamsize>( n * sizeof( T ) ) ) ) {
+         BLAZE_THROW_RUNTIME_ERROR( "Truncated npy data" );
+      }
+
+      if( swapped ) {
+         npySwap( reinterpret_cast<char*>( buffer.data() ), n * scalars, sizeof( T ) / scalars );
+      }
+
+      ET* row( rowOf( r ) );
+      for( size_t j=0UL; j<n; ++j ) {
+         row[j] = ET( buffer[j] );
+      }
+   }
+
+   return true;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Rejects the conversion of a stored element type into the target element type.
+// \ingroup npy
+//
+// \return \a false.
+*/
+template< typename ET       // Target element type
+        , typename T        // Stored element type
+        , typename RowOf >  // Type of the row access functor
+bool readNpyAs( std::istream&, const NpyHeader&, size_t, size_t, RowOf, FalseType )
+{
+   return false;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief End of the recursion over the convertible element types.
+// \ingroup npy
+//
+// \return \a false.
+*/
+template< typename ET       // Target element type
+        , typename RowOf >  // Type of the row access functor
+bool readNpyConverted( std::istream&, const NpyHeader&, size_t, size_t, RowOf, TypeList<> )
+{
+   return false;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Identifies the stored element type and reads the rows with conversion.
+// \ingroup npy
+//
+// \return \a true in case the stored elements could be converted, \a false if not.
+*/
+template< typename ET       // Target element type
+        , typename RowOf    // Type of the row access functor
+        , typename T        // First candidate element type
+        , typename... Ts >  // Remaining candidate element types
+bool readNpyConverted( std::istream& is, const NpyHeader& header, size_t rows, size_t n,
+                       RowOf rowOf, TypeList<T,Ts...> )
+{
+   if( npyMatches<T>( header ) ) {
+      return readNpyAs<ET,T>( is, header, rows, n, rowOf, BoolConstant< IsConstructible_v<ET,T> >() );
+   }
+
+   return readNpyConverted<ET>( is, header, rows, n, rowOf, TypeList<Ts...>() );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Reads rows of elements from a .npy stream.
+// \ingroup npy
+//
+// \param is The input stream positioned at the first element.
+// \param header The header of the .npy data.
+// \param rows The total number of rows.
+// \param n The number of elements per row.
+// \param block The number of rows per contiguous block of the target memory.
+// \param rowOf Functor returning a pointer to the first element of a row.
+// \return void
+// \exception std::invalid_argument Unsupported element type.
+// \exception std::runtime_error Truncated data.
+//
+// In case the stored elements match the target element type, the data is read directly into
+// the target rows, with one read per contiguous block of rows. Otherwise the rows are read into
+// a buffer and converted.
+*/
+template< typename ET       // Target element type
+        , typename RowOf >  // Type of the row access functor
+void readNpyRows( std::istream& is, const NpyHeader& header, size_t rows, size_t n, size_t block, RowOf rowOf )
+{
+   if( header.fortran ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Fortran ordered npy data is not supported" );
+   }
+
+   if( rows == 0UL || n == 0UL ) return;
+
+   if( npyMatches<ET>( header ) && !npySwapped( header ) ) {
+      for( size_t r=0UL; r<rows; r+=block ) {
+         if( !is.read( reinterpret_cast<char*>( rowOf( r ) ), static_cast<std::streamsize>( block * n * sizeof( ET ) ) ) ) {
+            BLAZE_THROW_RUNTIME_ERROR( "Truncated npy data" );
+         }
+      }
+   }
+   else if( !readNpyConverted<ET>( is, header, rows, n, rowOf, NpyTypes() ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Unsupported npy element type" );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the extents of the .npy data as a tensor shape.
+// \ingroup npy
+//
+// \param header The header of the .npy data.
+// \return The number of pages, rows and columns.
+// \exception std::invalid_argument Invalid number of dimensions.
+//
+// Data with less than three dimensions is treated as tensor with leading extents of one.
+*/
+inline std::array< size_t, 3UL > npyTensorShape( const NpyHeader& header )
+{
+   const size_t ndim( header.shape.size() );
+
+   if( ndim > 3UL ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid number of dimensions of npy data" );
+   }
+
+   std::array< size_t, 3UL > shape{ { 1UL, 1UL, 1UL } };
+   for( size_t d=0UL; d<ndim; ++d ) {
+      shape[3UL-ndim+d] = header.shape[d];
+   }
+
+   return shape;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the extents of the .npy data as array dimensions.
+// \ingroup npy
+//
+// \param header The header of the .npy data.
+// \return The dimensions, starting with the innermost dimension.
+// \exception std::invalid_argument Invalid number of dimensions.
+//
+// Data with less than \a N dimensions is treated as array with leading extents of one.
+*/
+template< size_t N >  // Number of dimensions
+std::array< size_t, N > npyArrayDims( const NpyHeader& header )
+{
+   const size_t ndim( header.shape.size() );
+
+   if( ndim > N ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid number of dimensions of npy data" );
+   }
+
+   std::array< size_t, N > dims;
+   for( size_t d=0UL; d<N; ++d ) {
+      dims[d] = ( d < ndim ) ? header.shape[ndim-1UL-d] : 1UL;
+   }
+
+   return dims;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TENSOR BACKEND FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the number of rows of a tensor that form one contiguous block of memory.
+// \ingroup npy
+*/
+template< typename TT >  // Type of the tensor
+size_t npyBlockRows( const TT& tens ) noexcept
+{
+   const size_t m( tens.rows() );
+
+   if( tens.spacing() != tens.columns() || m == 0UL ) {
+      return 1UL;
+   }
+   else if( tens.pages() > 1UL && tens.data( 0UL, 1UL ) != tens.data( 0UL, 0UL ) + m * tens.spacing() ) {
+      return m;
+   }
+   else {
+      return tens.pages() * m;
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the size in bytes of the .npy representation of the given tensor.
+// \ingroup npy
+*/
+template< typename TT >  // Type of the tensor
+size_t npyDataSize( const DenseTensor<TT>& tens )
+{
+   const size_t shape[3] = { (*tens).pages(), (*tens).rows(), (*tens).columns() };
+
+   return makeNpyHeader( npyDescr< ElementType_t<TT> >(), shape, 3UL ).size() +
+          shape[0] * shape[1] * shape[2] * sizeof( ElementType_t<TT> );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Writes the elements of a tensor with low-level data access.
+// \ingroup npy
+*/
+template< typename TT >  // Type of the tensor
+EnableIf_t< HasConstDataAccess_v<TT> > writeNpyTensorElements( NpyOutput& out, const TT& tens )
+{
+   const size_t m( tens.rows() );
+
+   writeNpyRows< ElementType_t<TT> >( out, tens.pages() * m, tens.columns(), npyBlockRows( tens ),
+                                      [&tens,m]( size_t r ) { return tens.data( r % m, r / m ); } );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Writes the elements of a tensor without low-level data access.
+// \ingroup npy
+//
+// The tensor is evaluated row by row into a buffer of a single row.
+*/
+template< typename TT >  // Type of the tensor
+DisableIf_t< HasConstDataAccess_v<TT> > writeNpyTensorElements( NpyOutput& out, const TT& tens )
+{
+   using ET = ElementType_t<TT>;
+
+   std::vector<ET> row( tens.columns() );
+
+   for( size_t k=0UL; k<tens.pages(); ++k ) {
+      for( size_t i=0UL; i<tens.rows(); ++i ) {
+         for( size_t j=0UL; j<tens.columns(); ++j ) {
+            row[j] = tens(k,i,j);
+         }
+         out.write( reinterpret_cast<const char*>( row.data() ), row.size() * sizeof( ET ) );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Writes the .npy representation of the given tensor.
+// \ingroup npy
+*/
+template< typename TT >  // Type of the tensor
+void writeNpyData( NpyOutput& out, const DenseTensor<TT>& tens )
+{
+   using ET = ElementType_t<TT>;
+
+   BLAZE_STATIC_ASSERT_MSG( IsNumeric_v<ET>, "Npy files require numeric element types" );
+
+   const size_t shape[3] = { (*tens).pages(), (*tens).rows(), (*tens).columns() };
+   const std::string header( makeNpyHeader( npyDescr<ET>(), shape, 3UL ) );
+
+   out.write( header.data(), header.size() );
+   writeNpyTensorElements( out, *tens );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Resizes a resizable tensor to the given shape.
+// \ingroup npy
+*/
+template< typename TT >  // Type of the tensor
+EnableIf_t< IsResizable_v<TT> > prepareNpyTensor( TT& tens, const std::array< size_t, 3UL >& shape )
+{
+   tens.resize( shape[0], shape[1], shape[2], false );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Checks the size of a non-resizable tensor against the given shape.
+// \ingroup npy
+*/
+template< typename TT >  // Type of the tensor
+DisableIf_t< IsResizable_v<TT> > prepareNpyTensor( TT& tens, const std::array< size_t, 3UL >& shape )
+{
+   if( tens.pages() != shape[0] || tens.rows() != shape[1] || tens.columns() != shape[2] ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid tensor size detected" );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Reads .npy data into a tensor with low-level data access.
+// \ingroup npy
+*/
+template< typename TT >  // Type of the tensor
+EnableIf_t< HasMutableDataAccess_v<TT> > readNpyTensorElements( std::istream& is, const NpyHeader& header, TT& tens )
+{
+   prepareNpyTensor( tens, npyTensorShape( header ) );
+
+   const size_t m( tens.rows() );
+
+   readNpyRows< ElementType_t<TT> >( is, header, tens.pages() * m, tens.columns(), npyBlockRows( tens ),
+                                     [&tens,m]( size_t r ) { return tens.data( r % m, r / m ); } );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Reads .npy data into a tensor without low-level data access.
+// \ingroup npy
+//
+// The data is read into a temporary tensor, which is assigned to the target.
+*/
+template< typename TT >  // Type of the tensor
+DisableIf_t< HasMutableDataAccess_v<TT> > readNpyTensorElements( std::istream& is, const NpyHeader& header, TT& tens )
+{
+   prepareNpyTensor( tens, npyTensorShape( header ) );
+
+   ResultType_t<TT> tmp;
+   readNpyTensorElements( is, header, tmp );
+   tens = tmp;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Reads .npy data into the given tensor.
+// \ingroup npy
+*/
+template< typename TT >  // Type of the tensor
+void readNpyData( std::istream& is, DenseTensor<TT>& tens )
+{
+   BLAZE_STATIC_ASSERT_MSG( IsNumeric_v< ElementType_t<TT> >, "Npy files require numeric element types" );
+
+   const NpyHeader header( readNpyHeader( is ) );
+   readNpyTensorElements( is, header, *tens );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ARRAY BACKEND FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the number of rows of the given array.
+// \ingroup npy
+*/
+template< typename AT >  // Type of the array
+size_t npyRowCount( const AT& arr ) noexcept
+{
+   size_t rows( 1UL );
+   for( size_t d=1UL; d<AT::num_dimensions; ++d ) {
+      rows *= arr.dimensions()[d];
+   }
+   return rows;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the size in bytes of the .npy representation of the given array.
+// \ingroup npy
+*/
+template< typename AT >  // Type of the array
+size_t npyDataSize( const DenseArray<AT>& arr )
+{
+   constexpr size_t N( AT::num_dimensions );
+
+   size_t shape[N];
+   size_t number( 1UL );
+   for( size_t d=0UL; d<N; ++d ) {
+      shape[d] = (*arr).dimensions()[N-1UL-d];
+      number *= shape[d];
+   }
+
+   return makeNpyHeader( npyDescr< ElementType_t<AT> >(), shape, N ).size() +
+          number * sizeof( ElementType_t<AT> );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Writes the elements of an array with low-level data access.
+// \ingroup npy
+*/
+template< typename AT >  // Type of the array
+EnableIf_t< HasConstDataAccess_v<AT> > writeNpyArrayElements( NpyOutput& out, const AT& arr )
+{
+   const size_t n( arr.dimensions()[0] );
+   const size_t rows( npyRowCount( arr ) );
+
+   writeNpyRows< ElementType_t<AT> >( out, rows, n, ( arr.spacing() == n ? rows : 1UL ),
+                                      [&arr]( size_t r ) { return arr.data() + r * arr.spacing(); } );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Writes the elements of an array without low-level data access.
+// \ingroup npy
+//
+// The array (e.g. an array expression) is evaluated into a temporary, which is written.
+*/
+template< typename AT >  // Type of the array
+DisableIf_t< HasConstDataAccess_v<AT> > writeNpyArrayElements( NpyOutput& out, const AT& arr )
+{
+   const ResultType_t<AT> tmp( arr );
+   writeNpyArrayElements( out, tmp );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Writes the .npy representation of the given array.
+// \ingroup npy
+*/
+template< typename AT >  // Type of the array
+void writeNpyData( NpyOutput& out, const DenseArray<AT>& arr )
+{
+   using ET = ElementType_t<AT>;
+
+   BLAZE_STATIC_ASSERT_MSG( IsNumeric_v<ET>, "Npy files require numeric element types" );
+
+   constexpr size_t N( AT::num_dimensions );
+
+   size_t shape[N];
+   for( size_t d=0UL; d<N; ++d ) {
+      shape[d] = (*arr).dimensions()[N-1UL-d];
+   }
+
+   const std::string header( makeNpyHeader( npyDescr<ET>(), shape, N ) );
+
+   out.write( header.data(), header.size() );
+   writeNpyArrayElements( out, *arr );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Resizes a resizable array to the given dimensions.
+// \ingroup npy
+*/
+template< typename AT  // Type of the array
+        , size_t N >   // Number of dimensions
+EnableIf_t< IsResizable_v<AT> > prepareNpyArray( AT& arr, const std::array< size_t, N >& dims )
+{
+   arr.resize( dims, false );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Checks the size of a non-resizable array against the given dimensions.
+// \ingroup npy
+*/
+template< typename AT  // Type of the array
+        , size_t N >   // Number of dimensions
+DisableIf_t< IsResizable_v<AT> > prepareNpyArray( AT& arr, const std::array< size_t, N >& dims )
+{
+   if( arr.dimensions() != dims ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid array size detected" );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Reads .npy data into an array with low-level data access.
+// \ingroup npy
+*/
+template< typename AT >  // Type of the array
+EnableIf_t< HasMutableDataAccess_v<AT> > readNpyArrayElements( std::istream& is, const NpyHeader& header, AT& arr )
+{
+   prepareNpyArray( arr, npyArrayDims<AT::num_dimensions>( header ) );
+
+   const size_t n( arr.dimensions()[0] );
+   const size_t rows( npyRowCount( arr ) );
+
+   readNpyRows< ElementType_t<AT> >( is, header, rows, n, ( arr.spacing() == n ? rows : 1UL ),
+                                     [&arr]( size_t r ) { return arr.data() + r * arr.spacing(); } );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Reads .npy data into the given array.
+// \ingroup npy
+*/
+template< typename AT >  // Type of the array
+void readNpyData( std::istream& is, DenseArray<AT>& arr )
+{
+   BLAZE_STATIC_ASSERT_MSG( IsNumeric_v< ElementType_t<AT> >, "Npy files require numeric element types" );
+   BLAZE_STATIC_ASSERT_MSG( HasMutableDataAccess_v<AT>, "Npy files can only be read into arrays with data access" );
+
+   const NpyHeader header( readNpyHeader( is ) );
+   readNpyArrayElements( is, header, *arr );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Writes the given dense tensor to an output stream in the NumPy .npy format.
+// \ingroup npy
+//
+// \param os The output stream.
+// \param tens The tensor to be written.
+// \return void
+// \exception std::runtime_error Output error.
+//
+// The tensor is written as three-dimensional C-ordered array (pages, rows, columns) in native
+// byte order. The rows are streamed directly from the tensor, i.e. without creating a
+// contiguous copy: unpadded tensors are written with a single write, padded tensors with
+// one write per row.
+*/
+template< typename TT >  // Type of the tensor
+void writeNpy( std::ostream& os, const DenseTensor<TT>& tens )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   NpyOutput out{ os, false, 0U };
+   writeNpyData( out, *tens );
+
+   if( !os ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Unable to write npy data" );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Writes the given dense tensor to a NumPy .npy file.
+// \ingroup npy
+//
+// \param path The path of the .npy file.
+// \param tens The tensor to be written.
+// \return void
+// \exception std::runtime_error Output error.
+
+   \code
+   blaze::DynamicTensor<float> A( 10UL, 64UL, 64UL );
+   // ... Initialization
+   blaze::writeNpy( "A.npy", A );  // numpy.load( "A.npy" ).shape == (10, 64, 64)
+   \endcode
+*/
+template< typename TT >  // Type of the tensor
+void writeNpy( const std::string& path, const DenseTensor<TT>& tens )
+{
+   std::ofstream os( path, std::ios::binary );
+
+   if( !os ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Unable to open npy file" );
+   }
+
+   writeNpy( os, *tens );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Writes the given dense array to an output stream in the NumPy .npy format.
+// \ingroup npy
+//
+// \param os The output stream.
+// \param arr The array to be written.
+// \return void
+// \exception std::runtime_error Output error.
+//
+// The array is written as C-ordered array in native byte order. The shape starts with the
+// outermost dimension of the array.
+*/
+template< typename AT >  // Type of the array
+void writeNpy( std::ostream& os, const DenseArray<AT>& arr )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   NpyOutput out{ os, false, 0U };
+   writeNpyData( out, *arr );
+
+   if( !os ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Unable to write npy data" );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Writes the given dense array to a NumPy .npy file.
+// \ingroup npy
+//
+// \param path The path of the .npy file.
+// \param arr The array to be written.
+// \return void
+// \exception std::runtime_error Output error.
+*/
+template< typename AT >  // Type of the array
+void writeNpy( const std::string& path, const DenseArray<AT>& arr )
+{
+   std::ofstream os( path, std::ios::binary );
+
+   if( !os ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Unable to open npy file" );
+   }
+
+   writeNpy( os, *arr );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reads a dense tensor from an input stream in the NumPy .npy format.
+// \ingroup npy
+//
+// \param is The input stream.
+// \param tens The target tensor.
+// \return void
+// \exception std::invalid_argument Invalid or unsupported .npy data.
+// \exception std::runtime_error Truncated data.
+//
+// Data with up to three dimensions can be read into a tensor (missing leading dimensions are
+// treated as one). Resizable tensors are resized, all other tensors must have the correct size.
+// In case the stored element type matches the element type of the tensor, the data is read
+// directly into the (padded) rows of the tensor. Otherwise the elements are converted, which
+// includes the conversion of the byte order. Fortran ordered data is not supported.
+*/
+template< typename TT >  // Type of the tensor
+void readNpy( std::istream& is, DenseTensor<TT>& tens )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   readNpyData( is, *tens );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reads a dense tensor from a NumPy .npy file.
+// \ingroup npy
+//
+// \param path The path of the .npy file.
+// \param tens The target tensor.
+// \return void
+// \exception std::invalid_argument Invalid or unsupported .npy data.
+// \exception std::runtime_error File could not be read.
+
+   \code
+   blaze::DynamicTensor<double> A;
+   blaze::readNpy( "A.npy", A );  // e.g. written by numpy.save( "A.npy", a )
+   \endcode
+*/
+template< typename TT >  // Type of the tensor
+void readNpy( const std::string& path, DenseTensor<TT>& tens )
+{
+   std::ifstream is( path, std::ios::binary );
+
+   if( !is ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Unable to open npy file" );
+   }
+
+   readNpy( is, *tens );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reads a dense array from an input stream in the NumPy .npy format.
+// \ingroup npy
+//
+// \param is The input stream.
+// \param arr The target array.
+// \return void
+// \exception std::invalid_argument Invalid or unsupported .npy data.
+// \exception std::runtime_error Truncated data.
+//
+// Data with up to \a N dimensions can be read into an \a N-dimensional array (missing leading
+// dimensions are treated as one). Resizable arrays are resized, all other arrays must have the
+// correct size.
+*/
+template< typename AT >  // Type of the array
+void readNpy( std::istream& is, DenseArray<AT>& arr )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   readNpyData( is, *arr );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reads a dense array from a NumPy .npy file.
+// \ingroup npy
+//
+// \param path The path of the .npy file.
+// \param arr The target array.
+// \return void
+// \exception std::invalid_argument Invalid or unsupported .npy data.
+// \exception std::runtime_error File could not be read.
+*/
+template< typename AT >  // Type of the array
+void readNpy( const std::string& path, DenseArray<AT>& arr )
+{
+   std::ifstream is( path, std::ios::binary );
+
+   if( !is ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Unable to open npy file" );
+   }
+
+   readNpy( is, *arr );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
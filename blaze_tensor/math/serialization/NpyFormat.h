@@ -0,0 +1,493 @@
+//=================================================================================================
+/*!
+//  \file blaze_tensor/math/serialization/NpyFormat.h
+//  \brief Header file for the NumPy .npy/.npz format utilities
+//
+//  Copyright (C) 2012-2018 Klaus Iglberger - All Rights Reserved
+//  Copyright (C) 2018 Hartmut Kaiser - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+
+#ifndef _BLAZE_TENSOR_MATH_SERIALIZATION_NPYFORMAT_H_
+#define _BLAZE_TENSOR_MATH_SERIALIZATION_NPYFORMAT_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstring>
+#include <istream>
+#include <ostream>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include <blaze/math/Exception.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsComplex.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  NPY HEADER
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Description of the data stored in a NumPy .npy file.
+// \ingroup npy
+*/
+struct NpyHeader
+{
+   char   order;     //!< The byte order ('<' little endian, '>' big endian, '|' not applicable).
+   char   kind;      //!< The kind of the elements ('b', 'i', 'u', 'f' or 'c').
+   size_t size;      //!< The size of a single element in bytes.
+   bool   fortran;   //!< \a true in case the data is stored in column-major (Fortran) order.
+   size_t offset;    //!< The size of the complete .npy preamble (the offset of the first element).
+   std::vector<size_t> shape;  //!< The extents of the data, starting with the outermost dimension.
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns whether the byte order of the platform is little endian.
+// \ingroup npy
+//
+// \return \a true on little endian platforms, \a false otherwise.
+*/
+inline bool npyLittleEndian() noexcept
+{
+   const uint16_t value( 1U );
+   unsigned char byte;
+   std::memcpy( &byte, &value, 1UL );
+   return byte == 1U;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the NumPy kind character of the given element type.
+// \ingroup npy
+//
+// \return The kind character ('b', 'i', 'u', 'f' or 'c').
+*/
+template< typename T >  // Element type
+constexpr char npyKind() noexcept
+{
+   return ( IsComplex_v<T> )                  ? 'c'
+        : ( std::is_same<T,bool>::value )     ? 'b'
+        : ( std::is_floating_point<T>::value ) ? 'f'
+        : ( std::is_signed<T>::value )         ? 'i'
+        :                                        'u';
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the NumPy type descriptor of the given element type (e.g. \c "<f8").
+// \ingroup npy
+//
+// \return The type descriptor in native byte order.
+*/
+template< typename T >  // Element type
+std::string npyDescr()
+{
+   const size_t scalar( IsComplex_v<T> ? sizeof( T ) / 2UL : sizeof( T ) );
+   const char   order ( scalar == 1UL ? '|' : ( npyLittleEndian() ? '<' : '>' ) );
+
+   return std::string( 1UL, order ) + npyKind<T>() + std::to_string( sizeof( T ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns whether the elements described by the header match the given element type.
+// \ingroup npy
+//
+// \param header The header of the .npy data.
+// \return \a true if the elements can be used as \a T without conversion, \a false if not.
+*/
+template< typename T >  // Element type
+bool npyMatches( const NpyHeader& header ) noexcept
+{
+   return header.kind == npyKind<T>() && header.size == sizeof( T );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns whether the elements described by the header have to be byte swapped.
+// \ingroup npy
+//
+// \param header The header of the .npy data.
+// \return \a true if the byte order differs from the platform byte order.
+*/
+inline bool npySwapped( const NpyHeader& header ) noexcept
+{
+   return ( header.order == '<' && !npyLittleEndian() ) ||
+          ( header.order == '>' &&  npyLittleEndian() );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Reverses the byte order of the given elements.
+// \ingroup npy
+//
+// \param data The first byte of the elements.
+// \param count The number of scalar values.
+// \param size The size of a single scalar value in bytes.
+// \return void
+*/
+inline void npySwap( char* data, size_t count, size_t size ) noexcept
+{
+   for( size_t i=0UL; i<count; ++i, data+=size ) {
+      for( size_t b=0UL; b<size/2UL; ++b ) {
+         const char tmp( data[b] );
+         data[b] = data[size-b-1UL];
+         data[size-b-1UL] = tmp;
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Parses the Python dictionary literal of a .npy header.
+// \ingroup npy
+//
+// \param dict The header dictionary, e.g. "{'descr': '<f8', 'fortran_order': False, 'shape': (3, 4), }".
+// \param offset The size of the complete .npy preamble.
+// \return The parsed header.
+// \exception std::invalid_argument Invalid .npy header.
+*/
+inline NpyHeader parseNpyDict( const std::string& dict, size_t offset )
+{
+   NpyHeader header;
+   header.offset = offset;
+
+   const auto value = [&dict]( const char* key ) {
+      const size_t pos( dict.find( key ) );
+      if( pos == std::string::npos ) {
+         BLAZE_THROW_INVALID_ARGUMENT( "Invalid npy header" );
+      }
+      const size_t colon( dict.find( ':', pos ) );
+      if( colon == std::string::npos ) {
+         BLAZE_THROW_INVALID_ARGUMENT( "Invalid npy header" );
+      }
+      const size_t begin( dict.find_first_not_of( " \t", colon+1UL ) );
+      if( begin == std::string::npos ) {
+         BLAZE_THROW_INVALID_ARGUMENT( "Invalid npy header" );
+      }
+      return begin;
+   };
+
+   // Element type
+   {
+      const size_t begin( value( "'descr'" ) );
+      if( dict[begin] != '\'' && dict[begin] != '"' ) {
+         BLAZE_THROW_INVALID_ARGUMENT( "Unsupported npy element type" );
+      }
+      const size_t end( dict.find( dict[begin], begin+1UL ) );
+      if( end == std::string::npos || end - begin < 4UL ) {
+         BLAZE_THROW_INVALID_ARGUMENT( "Unsupported npy element type" );
+      }
+      header.order = dict[begin+1UL] == '=' ? ( npyLittleEndian() ? '<' : '>' ) : dict[begin+1UL];
+      header.kind  = dict[begin+2UL];
+      header.size  = std::stoul( dict.substr( begin+3UL, end-begin-3UL ) );
+
+      if( ( header.order != '<' && header.order != '>' && header.order != '|' ) ||
+          std::string( "biufc" ).find( header.kind ) == std::string::npos ) {
+         BLAZE_THROW_INVALID_ARGUMENT( "Unsupported npy element type" );
+      }
+   }
+
+   // Storage order
+   {
+      const size_t begin( value( "'fortran_order'" ) );
+      header.fortran = ( dict.compare( begin, 4UL, "True" ) == 0 );
+   }
+
+   // Shape
+   {
+      const size_t begin( value( "'shape'" ) );
+      const size_t end  ( dict.find( ')', begin ) );
+      if( dict[begin] != '(' || end == std::string::npos ) {
+         BLAZE_THROW_INVALID_ARGUMENT( "Invalid npy shape" );
+      }
+      size_t pos( begin+1UL );
+      while( pos < end ) {
+         pos = dict.find_first_of( "0123456789)", pos );
+         if( pos >= end ) break;
+         size_t len( 0UL );
+         header.shape.push_back( std::stoul( dict.substr( pos ), &len ) );
+         pos += len;
+      }
+   }
+
+   return header;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Parses the .npy preamble at the beginning of the given memory.
+// \ingroup npy
+//
+// \param data The first byte of the .npy data.
+// \param size The number of available bytes.
+// \return The parsed header.
+// \exception std::invalid_argument Invalid .npy data.
+*/
+inline NpyHeader readNpyHeader( const char* data, size_t size )
+{
+   if( size < 10UL || std::memcmp( data, "\x93NUMPY", 6UL ) != 0 ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid npy magic string" );
+   }
+
+   const unsigned char* bytes( reinterpret_cast<const unsigned char*>( data ) );
+   const unsigned major( bytes[6] );
+
+   size_t length( 0UL ), preamble( 0UL );
+
+   if( major == 1U ) {
+      length   = size_t( bytes[8] ) | ( size_t( bytes[9] ) << 8 );
+      preamble = 10UL;
+   }
+   else if( ( major == 2U || major == 3U ) && size >= 12UL ) {
+      length   = size_t( bytes[8] ) | ( size_t( bytes[9] ) << 8 ) |
+                 ( size_t( bytes[10] ) << 16 ) | ( size_t( bytes[11] ) << 24 );
+      preamble = 12UL;
+   }
+   else {
+      BLAZE_THROW_INVALID_ARGUMENT( "Unsupported npy version" );
+   }
+
+   if( size < preamble + length ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Truncated npy header" );
+   }
+
+   return parseNpyDict( std::string( data + preamble, length ), preamble + length );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Reads the .npy preamble from the given stream.
+// \ingroup npy
+//
+// \param is The input stream positioned at the beginning of the .npy data.
+// \return The parsed header.
+// \exception std::invalid_argument Invalid .npy data.
+//
+// After the call the stream is positioned at the first element.
+*/
+inline NpyHeader readNpyHeader( std::istream& is )
+{
+   char preamble[12];
+
+   if( !is.read( preamble, 10L ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid npy magic string" );
+   }
+
+   size_t available( 10UL );
+
+   if( preamble[6] == 2 || preamble[6] == 3 ) {
+      if( !is.read( preamble + 10, 2L ) ) {
+         BLAZE_THROW_INVALID_ARGUMENT( "Truncated npy header" );
+      }
+      available = 12UL;
+   }
+
+   const unsigned char* bytes( reinterpret_cast<const unsigned char*>( preamble ) );
+   const size_t length( available == 10UL
+                        ? ( size_t( bytes[8] ) | ( size_t( bytes[9] ) << 8 ) )
+                        : ( size_t( bytes[8] ) | ( size_t( bytes[9] ) << 8 ) |
+                            ( size_t( bytes[10] ) << 16 ) | ( size_t( bytes[11] ) << 24 ) ) );
+
+   std::string data( preamble, available );
+   data.resize( available + length );
+
+   if( !is.read( &data[available], static_cast<std::streamsize>( length ) ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Truncated npy header" );
+   }
+
+   return readNpyHeader( data.data(), data.size() );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Creates the .npy preamble for the given element type and shape.
+// \ingroup npy
+//
+// \param descr The NumPy type descriptor.
+// \param shape The extents, starting with the outermost dimension.
+// \param ndim The number of dimensions.
+// \return The complete preamble, padded such that the first element is 64-byte aligned.
+*/
+inline std::string makeNpyHeader( const std::string& descr, const size_t* shape, size_t ndim )
+{
+   std::string dict( "{'descr': '" + descr + "', 'fortran_order': False, 'shape': (" );
+
+   for( size_t d=0UL; d<ndim; ++d ) {
+      dict += std::to_string( shape[d] ) + ( ndim == 1UL ? "," : ( d+1UL < ndim ? ", " : "" ) );
+   }
+
+   dict += "), }";
+
+   const size_t total( ( 10UL + dict.size() + 1UL + 63UL ) / 64UL * 64UL );
+   dict.append( total - 10UL - dict.size() - 1UL, ' ' );
+   dict += '\n';
+
+   if( dict.size() > 65535UL ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid npy header size" );
+   }
+
+   std::string header( "\x93NUMPY\x01\x00", 8UL );
+   header += char( dict.size() & 0xFFUL );
+   header += char( dict.size() >> 8 );
+   header += dict;
+
+   return header;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  NPZ (ZIP) UTILITIES
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Updates a CRC-32 checksum (as used by the zip format) with the given bytes.
+// \ingroup npy
+//
+// \param crc The current checksum (0 for the first call).
+// \param data The bytes to be added.
+// \param size The number of bytes.
+// \return The updated checksum.
+*/
+inline uint32_t npzCrc32( uint32_t crc, const char* data, size_t size ) noexcept
+{
+   struct Table {
+      uint32_t values[256];
+      Table() noexcept {
+         for( uint32_t i=0U; i<256U; ++i ) {
+            uint32_t c( i );
+            for( int k=0; k<8; ++k ) {
+               c = ( c & 1U ) ? ( 0xEDB88320U ^ ( c >> 1 ) ) : ( c >> 1 );
+            }
+            values[i] = c;
+         }
+      }
+   };
+
+   static const Table table;
+
+   crc = ~crc;
+   for( size_t i=0UL; i<size; ++i ) {
+      crc = table.values[( crc ^ static_cast<unsigned char>( data[i] ) ) & 0xFFU] ^ ( crc >> 8 );
+   }
+   return ~crc;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Writes an unsigned integer of \a bytes bytes in little endian byte order.
+// \ingroup npy
+//
+// \param os The output stream.
+// \param value The value to be written.
+// \param bytes The number of bytes (2 or 4).
+// \return void
+*/
+inline void npzPut( std::ostream& os, uint32_t value, size_t bytes )
+{
+   for( size_t b=0UL; b<bytes; ++b ) {
+      os.put( static_cast<char>( ( value >> ( 8UL*b ) ) & 0xFFU ) );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Reads an unsigned little endian integer of \a bytes bytes from the given memory.
+// \ingroup npy
+//
+// \param data The first byte of the value.
+// \param bytes The number of bytes (2 or 4).
+// \return The value.
+*/
+inline uint32_t npzGet( const char* data, size_t bytes ) noexcept
+{
+   uint32_t value( 0U );
+   for( size_t b=0UL; b<bytes; ++b ) {
+      value |= uint32_t( static_cast<unsigned char>( data[b] ) ) << ( 8UL*b );
+   }
+   return value;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
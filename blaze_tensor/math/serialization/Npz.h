@@ -0,0 +1,651 @@
+//=================================================================================================
+/*!
+//  \file blaze_tensor/math/serialization/Npz.h
+//  \brief Header file for reading and writing uncompressed NumPy .npz archives
+//
+//  Copyright (C) 2012-2018 Klaus Iglberger - All Rights Reserved
+//  Copyright (C) 2018 Hartmut Kaiser - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+
+#ifndef _BLAZE_TENSOR_MATH_SERIALIZATION_NPZ_H_
+#define _BLAZE_TENSOR_MATH_SERIALIZATION_NPZ_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include <blaze/math/Exception.h>
+#include <blaze/util/FunctionTrace.h>
+#include <blaze/util/Types.h>
+
+#include <blaze_tensor/math/expressions/DenseArray.h>
+#include <blaze_tensor/math/expressions/DenseTensor.h>
+#include <blaze_tensor/math/serialization/Npy.h>
+#include <blaze_tensor/math/serialization/NpyFormat.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS NPZWRITER
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Writer for uncompressed NumPy .npz archives.
+// \ingroup npy
+//
+// The NpzWriter class creates a zip archive of .npy entries, as written by \c numpy.savez().
+// The entries are stored without compression and with the .npy data aligned to a 64-byte
+// boundary, such that they can be loaded by \c numpy.load() and can be mapped in place by the
+// NpyTensorView and NpyArrayView class templates. The data
+// of each entry is streamed directly from the tensor or array, the CRC-32 checksum is computed
+// on the fly and patched into the local file header afterwards. The archive is finalized by
+// close() or on destruction.
+
+   \code
+   blaze::DynamicTensor<float> A( 4UL, 16UL, 16UL );
+   blaze::DynamicArray<4UL,double> B( 2UL, 3UL, 4UL, 5UL );
+   // ... Initialization
+
+   blaze::NpzWriter npz( "data.npz" );
+   npz.write( "A", A );
+   npz.write( "B", B );
+   npz.close();  // numpy.load( "data.npz" )["A"].shape == (4, 16, 16)
+   \endcode
+
+// \note Entries larger than 4 GiB (zip64) are not supported.
+*/
+class NpzWriter
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit inline NpzWriter( const std::string& path );
+
+   NpzWriter( const NpzWriter& ) = delete;
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   /*!\name Destructor */
+   //@{
+   inline ~NpzWriter();
+   //@}
+   //**********************************************************************************************
+
+   //**Assignment operators************************************************************************
+   /*!\name Assignment operators */
+   //@{
+   NpzWriter& operator=( const NpzWriter& ) = delete;
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   template< typename TT > void write( const std::string& name, const DenseTensor<TT>& tens );
+   template< typename AT > void write( const std::string& name, const DenseArray<AT>& arr );
+
+   inline void close();
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Type definitions****************************************************************************
+   /*!\brief Description of a single archive entry. */
+   struct Entry {
+      std::string name;    //!< The name of the entry (including the .npy suffix).
+      uint32_t    offset;  //!< The offset of the local file header.
+      uint32_t    crc;     //!< The CRC-32 checksum of the data.
+      uint32_t    size;    //!< The size of the data in bytes.
+   };
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   template< typename MT > void writeEntry( const std::string& name, const MT& data, size_t size );
+
+   inline void writeRecord( const Entry& entry, bool central, uint32_t padding = 0U );
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::ofstream      os_;       //!< The output stream of the archive.
+   std::vector<Entry> entries_;  //!< The entries written so far.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Creates a new .npz archive.
+//
+// \param path The path of the archive.
+// \exception std::runtime_error Archive could not be created.
+*/
+inline NpzWriter::NpzWriter( const std::string& path )
+   : os_( path, std::ios::binary )  // The output stream of the archive
+   , entries_()                     // The entries written so far
+{
+   if( !os_ ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Unable to create npz file" );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief The destructor for NpzWriter.
+//
+// The destructor finalizes the archive in case close() has not been called. Errors during the
+// finalization are silently ignored; call close() explicitly to detect them.
+*/
+inline NpzWriter::~NpzWriter()
+{
+   try {
+      close();
+   }
+   catch( ... ) {}
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Adds the given dense tensor to the archive.
+//
+// \param name The name of the entry (without the .npy suffix).
+// \param tens The tensor to be written.
+// \return void
+// \exception std::invalid_argument Entry too large.
+// \exception std::runtime_error Output error.
+*/
+template< typename TT >  // Type of the tensor
+void NpzWriter::write( const std::string& name, const DenseTensor<TT>& tens )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   writeEntry( name, *tens, npyDataSize( *tens ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Adds the given dense array to the archive.
+//
+// \param name The name of the entry (without the .npy suffix).
+// \param arr The array to be written.
+// \return void
+// \exception std::invalid_argument Entry too large.
+// \exception std::runtime_error Output error.
+*/
+template< typename AT >  // Type of the array
+void NpzWriter::write( const std::string& name, const DenseArray<AT>& arr )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   writeEntry( name, *arr, npyDataSize( *arr ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Finalizes the archive by writing the central directory.
+//
+// \return void
+// \exception std::runtime_error Output error.
+//
+// After calling close() no further entries can be added.
+*/
+inline void NpzWriter::close()
+{
+   if( !os_.is_open() ) return;
+
+   const uint32_t start( static_cast<uint32_t>( os_.tellp() ) );
+
+   for( const Entry& entry : entries_ ) {
+      writeRecord( entry, true );
+   }
+
+   const uint32_t end( static_cast<uint32_t>( os_.tellp() ) );
+
+   npzPut( os_, 0x06054b50U, 4UL );
+   npzPut( os_, 0U, 2UL );
+   npzPut( os_, 0U, 2UL );
+   npzPut( os_, static_cast<uint32_t>( entries_.size() ), 2UL );
+   npzPut( os_, static_cast<uint32_t>( entries_.size() ), 2UL );
+   npzPut( os_, end - start, 4UL );
+   npzPut( os_, start, 4UL );
+   npzPut( os_, 0U, 2UL );
+
+   const bool good( os_.good() );
+   os_.close();
+
+   if( !good ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Unable to write npz file" );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Writes a single .npy entry into the archive.
+//
+// \param name The name of the entry (without the .npy suffix).
+// \param data The tensor or array to be written.
+// \param size The size of the .npy representation in bytes.
+// \return void
+// \exception std::invalid_argument Entry too large.
+// \exception std::runtime_error Output error.
+*/
+template< typename MT >  // Type of the tensor or array
+void NpzWriter::writeEntry( const std::string& name, const MT& data, size_t size )
+{
+   if( !os_.is_open() ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Npz file has already been closed" );
+   }
+
+   const size_t offset( static_cast<size_t>( os_.tellp() ) );
+
+   if( size > 0xFFFFFFFFUL || offset + name.size() + size + 128UL > 0xFFFFFFFFUL || entries_.size() == 0xFFFFUL ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Npz entry too large" );
+   }
+
+   Entry entry{ name + ".npy", static_cast<uint32_t>( offset ), 0U, static_cast<uint32_t>( size ) };
+
+   const size_t start( offset + 30UL + entry.name.size() + 4UL );
+   writeRecord( entry, false, static_cast<uint32_t>( ( 64UL - start % 64UL ) % 64UL ) );
+
+   NpyOutput out{ os_, true, 0U };
+   writeNpyData( out, data );
+
+   entry.crc = out.crc;
+
+   const auto end( os_.tellp() );
+   os_.seekp( static_cast<std::streamoff>( offset + 14UL ) );
+   npzPut( os_, entry.crc, 4UL );
+   os_.seekp( end );
+
+   if( !os_ ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Unable to write npz file" );
+   }
+
+   entries_.push_back( entry );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Writes the local file header or the central directory record of an entry.
+//
+// \param entry The archive entry.
+// \param central \a true for the central directory record, \a false for the local header.
+// \param padding The number of padding bytes in the extra field of the local header.
+// \return void
+//
+// The local header carries an extra field of \a padding zero bytes, which aligns the .npy data
+// of the entry to a 64-byte boundary within the archive.
+*/
+inline void NpzWriter::writeRecord( const Entry& entry, bool central, uint32_t padding )
+{
+   npzPut( os_, central ? 0x02014b50U : 0x04034b50U, 4UL );
+   if( central ) {
+      npzPut( os_, 20U, 2UL );  // Version made by
+   }
+   npzPut( os_, 20U, 2UL );     // Version needed to extract
+   npzPut( os_, 0U, 2UL );      // General purpose flags
+   npzPut( os_, 0U, 2UL );      // Compression method (stored)
+   npzPut( os_, 0U, 2UL );      // Modification time
+   npzPut( os_, 0x21U, 2UL );   // Modification date (1980-01-01)
+   npzPut( os_, entry.crc, 4UL );
+   npzPut( os_, entry.size, 4UL );
+   npzPut( os_, entry.size, 4UL );
+   npzPut( os_, static_cast<uint32_t>( entry.name.size() ), 2UL );
+   npzPut( os_, central ? 0U : 4U + padding, 2UL );  // Extra field length
+   if( central ) {
+      npzPut( os_, 0U, 2UL );   // File comment length
+      npzPut( os_, 0U, 2UL );   // Disk number
+      npzPut( os_, 0U, 2UL );   // Internal attributes
+      npzPut( os_, 0U, 4UL );   // External attributes
+      npzPut( os_, entry.offset, 4UL );
+   }
+   os_.write( entry.name.data(), static_cast<std::streamsize>( entry.name.size() ) );
+   if( !central ) {
+      npzPut( os_, 0xD935U, 2UL );  // Alignment extra field
+      npzPut( os_, padding, 2UL );
+      for( uint32_t i=0U; i<padding; ++i ) {
+         os_.put( '\0' );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CLASS NPZREADER
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Reader for uncompressed NumPy .npz archives.
+// \ingroup npy
+//
+// The NpzReader class reads the central directory of a .npz archive (as written by
+// \c numpy.savez() or by the NpzWriter class) and provides access to the contained entries.
+// The entries are read with the same rules as readNpy(), i.e. with direct reads into the
+// target rows in case the element types match and with conversion otherwise.
+
+   \code
+   blaze::NpzReader npz( "data.npz" );
+
+   blaze::DynamicTensor<float> A;
+   blaze::DynamicArray<4UL,double> B;
+   npz.read( "A", A );
+   npz.read( "B", B );
+   \endcode
+
+// \note Compressed archives (\c numpy.savez_compressed()) and zip64 archives are not supported.
+*/
+class NpzReader
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit inline NpzReader( const std::string& path );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline std::vector<std::string> names() const;
+   inline bool                     contains( const std::string& name ) const;
+   inline size_t                   entryOffset( const std::string& name );
+
+   template< typename TT > void read( const std::string& name, DenseTensor<TT>& tens );
+   template< typename AT > void read( const std::string& name, DenseArray<AT>& arr );
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Type definitions****************************************************************************
+   /*!\brief Description of a single archive entry. */
+   struct Entry {
+      std::string name;    //!< The name of the entry (without the .npy suffix).
+      uint32_t    offset;  //!< The offset of the local file header.
+      uint32_t    method;  //!< The compression method.
+   };
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline const Entry& find( const std::string& name ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::ifstream      is_;       //!< The input stream of the archive.
+   std::vector<Entry> entries_;  //!< The entries of the archive.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Opens a .npz archive and reads its central directory.
+//
+// \param path The path of the archive.
+// \exception std::runtime_error Archive could not be read.
+// \exception std::invalid_argument Invalid archive.
+*/
+inline NpzReader::NpzReader( const std::string& path )
+   : is_( path, std::ios::binary )  // The input stream of the archive
+   , entries_()                     // The entries of the archive
+{
+   if( !is_ ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Unable to open npz file" );
+   }
+
+   is_.seekg( 0, std::ios::end );
+   const size_t size( static_cast<size_t>( is_.tellg() ) );
+   const size_t tail( std::min( size, size_t( 22UL + 65535UL ) ) );
+
+   std::vector<char> buffer( tail );
+   is_.seekg( static_cast<std::streamoff>( size - tail ) );
+   if( !is_.read( buffer.data(), static_cast<std::streamsize>( tail ) ) ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Unable to read npz file" );
+   }
+
+   size_t eocd( tail );
+   for( size_t pos=tail; pos >= 22UL; --pos ) {
+      if( npzGet( buffer.data()+pos-22UL, 4UL ) == 0x06054b50U ) {
+         eocd = pos - 22UL;
+         break;
+      }
+   }
+
+   if( eocd == tail ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid npz file" );
+   }
+
+   const size_t count ( npzGet( buffer.data()+eocd+10UL, 2UL ) );
+   const size_t length( npzGet( buffer.data()+eocd+12UL, 4UL ) );
+   const size_t start ( npzGet( buffer.data()+eocd+16UL, 4UL ) );
+
+   if( start + length > size ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid npz file" );
+   }
+
+   std::vector<char> directory( length );
+   is_.seekg( static_cast<std::streamoff>( start ) );
+   if( !is_.read( directory.data(), static_cast<std::streamsize>( length ) ) ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Unable to read npz file" );
+   }
+
+   size_t pos( 0UL );
+   for( size_t e=0UL; e<count; ++e )
+   {
+      if( pos + 46UL > length || npzGet( directory.data()+pos, 4UL ) != 0x02014b50U ) {
+         BLAZE_THROW_INVALID_ARGUMENT( "Invalid npz file" );
+      }
+
+      const size_t nameLength   ( npzGet( directory.data()+pos+28UL, 2UL ) );
+      const size_t extraLength  ( npzGet( directory.data()+pos+30UL, 2UL ) );
+      const size_t commentLength( npzGet( directory.data()+pos+32UL, 2UL ) );
+
+      if( pos + 46UL + nameLength > length ) {
+         BLAZE_THROW_INVALID_ARGUMENT( "Invalid npz file" );
+      }
+
+      std::string name( directory.data()+pos+46UL, nameLength );
+      if( name.size() > 4UL && name.compare( name.size()-4UL, 4UL, ".npy" ) == 0 ) {
+         name.resize( name.size()-4UL );
+      }
+
+      entries_.push_back( Entry{ name, npzGet( directory.data()+pos+42UL, 4UL ),
+                                 npzGet( directory.data()+pos+10UL, 2UL ) } );
+
+      pos += 46UL + nameLength + extraLength + commentLength;
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the names of all entries of the archive (without the .npy suffix).
+//
+// \return The names of the entries in archive order.
+*/
+inline std::vector<std::string> NpzReader::names() const
+{
+   std::vector<std::string> result;
+   result.reserve( entries_.size() );
+
+   for( const Entry& entry : entries_ ) {
+      result.push_back( entry.name );
+   }
+
+   return result;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the archive contains an entry of the given name.
+//
+// \param name The name of the entry (without the .npy suffix).
+// \return \a true if the entry exists, \a false if not.
+*/
+inline bool NpzReader::contains( const std::string& name ) const
+{
+   return std::any_of( entries_.begin(), entries_.end(),
+                       [&name]( const Entry& entry ) { return entry.name == name; } );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the offset of the .npy data of the given entry within the archive file.
+//
+// \param name The name of the entry (without the .npy suffix).
+// \return The offset of the first byte of the .npy data (i.e. the .npy magic string).
+// \exception std::invalid_argument Unknown or compressed entry.
+// \exception std::runtime_error Archive could not be read.
+//
+// Since the entries are stored without compression, the .npy data can be accessed in place,
+// e.g. by mapping the archive into memory.
+*/
+inline size_t NpzReader::entryOffset( const std::string& name )
+{
+   const Entry& entry( find( name ) );
+
+   if( entry.method != 0U ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Compressed npz entries are not supported" );
+   }
+
+   char local[30];
+   is_.clear();
+   is_.seekg( static_cast<std::streamoff>( entry.offset ) );
+   if( !is_.read( local, 30 ) || npzGet( local, 4UL ) != 0x04034b50U ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Unable to read npz entry" );
+   }
+
+   return entry.offset + 30UL + npzGet( local+26, 2UL ) + npzGet( local+28, 2UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reads the given entry into a dense tensor.
+//
+// \param name The name of the entry (without the .npy suffix).
+// \param tens The target tensor.
+// \return void
+// \exception std::invalid_argument Unknown, compressed or invalid entry.
+// \exception std::runtime_error Archive could not be read.
+*/
+template< typename TT >  // Type of the tensor
+void NpzReader::read( const std::string& name, DenseTensor<TT>& tens )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   is_.seekg( static_cast<std::streamoff>( entryOffset( name ) ) );
+   readNpyData( is_, *tens );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reads the given entry into a dense array.
+//
+// \param name The name of the entry (without the .npy suffix).
+// \param arr The target array.
+// \return void
+// \exception std::invalid_argument Unknown, compressed or invalid entry.
+// \exception std::runtime_error Archive could not be read.
+*/
+template< typename AT >  // Type of the array
+void NpzReader::read( const std::string& name, DenseArray<AT>& arr )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   is_.seekg( static_cast<std::streamoff>( entryOffset( name ) ) );
+   readNpyData( is_, *arr );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the entry of the given name.
+//
+// \param name The name of the entry (without the .npy suffix).
+// \return Reference to the entry.
+// \exception std::invalid_argument Unknown entry.
+*/
+inline const NpzReader::Entry& NpzReader::find( const std::string& name ) const
+{
+   const auto pos( std::find_if( entries_.begin(), entries_.end(),
+                                 [&name]( const Entry& entry ) { return entry.name == name; } ) );
+
+   if( pos == entries_.end() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Unknown npz entry" );
+   }
+
+   return *pos;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
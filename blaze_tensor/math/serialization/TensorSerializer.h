@@ -0,0 +1,816 @@
+//=================================================================================================
+/*!
+//  \file blaze_tensor/math/serialization/TensorSerializer.h
+//  \brief Serialization of dense tensors
+//
+//  Copyright (C) 2012-2018 Klaus Iglberger - All Rights Reserved
+//  Copyright (C) 2018 Hartmut Kaiser - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+
+#ifndef _BLAZE_TENSOR_MATH_SERIALIZATION_TENSORSERIALIZER_H_
+#define _BLAZE_TENSOR_MATH_SERIALIZATION_TENSORSERIALIZER_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <memory>
+
+#include <blaze/math/Exception.h>
+#include <blaze/math/serialization/TypeValueMapping.h>
+#include <blaze/math/typetraits/HasConstDataAccess.h>
+#include <blaze/math/typetraits/HasMutableDataAccess.h>
+#include <blaze/math/typetraits/IsResizable.h>
+#include <blaze/util/Complex.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/FunctionTrace.h>
+#include <blaze/util/MaybeUnused.h>
+#include <blaze/util/TypeList.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsConstructible.h>
+#include <blaze/util/typetraits/IsNumeric.h>
+
+#include <blaze_tensor/math/expressions/DenseTensor.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Serializer for dense tensors.
+// \ingroup tensor_serialization
+//
+// The TensorSerializer implements the necessary logic to serialize dense tensors, i.e. to convert
+// them into a portable, binary representation. The following example demonstrates the
+// (de-)serialization process of tensors:
+
+   \code
+   // Serialization of both tensors
+   {
+      blaze::StaticTensor<double,2UL,3UL,5UL> A;
+      blaze::DynamicTensor<int> B;
+
+      // ... Resizing and initialization
+
+      // Creating an archive that writes into the file "tensors.blaze"
+      blaze::Archive<std::ofstream> archive( "tensors.blaze" );
+
+      // Serialization of both tensors into the same archive. Note that A lies before B!
+      archive << A << B;
+   }
+
+   // Reconstitution of both tensors
+   {
+      blaze::DynamicTensor<double> A1;
+      blaze::DynamicTensor<double> B1;
+
+      // ... Resizing and initialization
+
+      // Creating an archive that reads from the file "tensors.blaze"
+      blaze::Archive<std::ifstream> archive( "tensors.blaze" );
+
+      // Reconstituting the former A tensor into A1 and the former B tensor into B1. Note that
+      // B was stored with \c int elements, which are converted to \c double during the load.
+      archive >> A1 >> B1;
+   }
+   \endcode
+
+// The archive uses the same binary layout as the vector and matrix serializers of the Blaze
+// library: a small header describing the tensor is followed by the elements of the tensor. The
+// elements are written without any padding in row-major order. For all tensors providing low-
+// level data access the payload is written and read in bulk, i.e. with one archive operation
+// per contiguous block of rows, and read directly into the (padded) storage of the target.
+//
+// The target of a deserialization can be any dense tensor. Resizable tensors are resized to
+// the size of the serialized tensor, all other tensors must already have the correct size. In
+// case the element type of the serialized tensor differs from the element type of the target,
+// the elements are converted on load, provided the target element type can be constructed from
+// the stored one.
+//
+// \note The serialization of tensors makes use of the serialization of the tensor elements.
+// Therefore the element type of the tensor must either be a built-in data type or a type that
+// provides its own serialization functionality.
+*/
+class TensorSerializer
+{
+ public:
+   //**Constructor*********************************************************************************
+   // No explicitly declared copy constructor.
+   explicit inline TensorSerializer();
+   //**********************************************************************************************
+
+   //**Serialization functions*********************************************************************
+   /*!\name Serialization functions */
+   //@{
+   template< typename Archive, typename TT >
+   void serialize( Archive& archive, const DenseTensor<TT>& tens );
+
+   template< typename Archive, typename TT >
+   void deserialize( Archive& archive, DenseTensor<TT>& tens );
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   template< typename Archive, typename TT >
+   void serializeHeader( Archive& archive, const TT& tens );
+
+   template< typename Archive, typename TT >
+   EnableIf_t< HasConstDataAccess_v<TT> && IsNumeric_v< ElementType_t<TT> > >
+      serializeTensor( Archive& archive, const TT& tens );
+
+   template< typename Archive, typename TT >
+   DisableIf_t< HasConstDataAccess_v<TT> && IsNumeric_v< ElementType_t<TT> > >
+      serializeTensor( Archive& archive, const TT& tens );
+
+   template< typename Archive >
+   void deserializeHeader( Archive& archive );
+
+   template< typename TT >
+   DisableIf_t< IsResizable_v<TT> > prepareTensor( TT& tens );
+
+   template< typename TT >
+   EnableIf_t< IsResizable_v<TT> > prepareTensor( TT& tens );
+
+   template< typename Archive, typename TT >
+   void deserializeTensor( Archive& archive, TT& tens );
+
+   template< typename Archive, typename TT >
+   EnableIf_t< HasMutableDataAccess_v<TT> && IsNumeric_v< ElementType_t<TT> > >
+      deserializeDenseTensor( Archive& archive, TT& tens );
+
+   template< typename Archive, typename TT >
+   DisableIf_t< HasMutableDataAccess_v<TT> && IsNumeric_v< ElementType_t<TT> > >
+      deserializeDenseTensor( Archive& archive, TT& tens );
+
+   template< typename Archive, typename TT >
+   bool convertTensor( Archive& archive, TT& tens, TypeList<> );
+
+   template< typename Archive, typename TT, typename T, typename... Ts >
+   bool convertTensor( Archive& archive, TT& tens, TypeList<T,Ts...> );
+
+   template< typename T, typename Archive, typename TT >
+   EnableIf_t< IsNumeric_v< ElementType_t<TT> > && IsConstructible_v< ElementType_t<TT>, T > &&
+               HasMutableDataAccess_v<TT>, bool >
+      convertDenseTensor( Archive& archive, TT& tens );
+
+   template< typename T, typename Archive, typename TT >
+   EnableIf_t< IsNumeric_v< ElementType_t<TT> > && IsConstructible_v< ElementType_t<TT>, T > &&
+               !HasMutableDataAccess_v<TT>, bool >
+      convertDenseTensor( Archive& archive, TT& tens );
+
+   template< typename T, typename Archive, typename TT >
+   DisableIf_t< IsNumeric_v< ElementType_t<TT> > && IsConstructible_v< ElementType_t<TT>, T >, bool >
+      convertDenseTensor( Archive& archive, TT& tens );
+
+   template< typename TT >
+   static size_t blockRows( const TT& tens ) noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Type definitions****************************************************************************
+   //! Element types that can be converted into the element type of the target tensor on load.
+   using ConvertibleTypes = TypeList< int8_t, int16_t, int32_t, int64_t
+                                    , uint8_t, uint16_t, uint32_t, uint64_t
+                                    , float, double, long double
+                                    , complex<float>, complex<double>, complex<long double> >;
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   uint8_t  version_;      //!< The version of the archive.
+   uint8_t  type_;         //!< The type of the tensor.
+   uint8_t  elementType_;  //!< The type of an element.
+   uint8_t  elementSize_;  //!< The size in bytes of a single element of the tensor.
+   uint64_t pages_;        //!< The number of pages of the tensor.
+   uint64_t rows_;         //!< The number of rows of the tensor.
+   uint64_t columns_;      //!< The number of columns of the tensor.
+   uint64_t number_;       //!< The total number of elements contained in the tensor.
+   //@}
+   //**********************************************************************************************
+
+   //**Constants***********************************************************************************
+   //! The type identifier of dense tensors within an archive.
+   static constexpr uint8_t denseTensor = 17U;
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The default constructor of the TensorSerializer class.
+*/
+TensorSerializer::TensorSerializer()
+   : version_    ( 0U  )  // The version of the archive
+   , type_       ( 0U  )  // The type of the tensor
+   , elementType_( 0U  )  // The type of an element
+   , elementSize_( 0U  )  // The size in bytes of a single element of the tensor
+   , pages_      ( 0UL )  // The number of pages of the tensor
+   , rows_       ( 0UL )  // The number of rows of the tensor
+   , columns_    ( 0UL )  // The number of columns of the tensor
+   , number_     ( 0UL )  // The total number of elements contained in the tensor
+{}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SERIALIZATION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Serializes the given dense tensor and writes it to the archive.
+//
+// \param archive The archive to be written.
+// \param tens The tensor to be serialized.
+// \return void
+// \exception std::runtime_error Error during serialization.
+//
+// This function serializes the given dense tensor and writes it to the given archive. In case
+// any error is detected during the serialization, a \a std::runtime_error is thrown.
+*/
+template< typename Archive  // Type of the archive
+        , typename TT >     // Type of the tensor
+void TensorSerializer::serialize( Archive& archive, const DenseTensor<TT>& tens )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   if( !archive ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Faulty archive detected" );
+   }
+
+   serializeHeader( archive, *tens );
+   serializeTensor( archive, *tens );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Serializes all meta information about the given tensor.
+//
+// \param archive The archive to be written.
+// \param tens The tensor to be serialized.
+// \return void
+// \exception std::runtime_error File header could not be serialized.
+*/
+template< typename Archive  // Type of the archive
+        , typename TT >     // Type of the tensor
+void TensorSerializer::serializeHeader( Archive& archive, const TT& tens )
+{
+   using ET = ElementType_t<TT>;
+
+   archive << uint8_t ( 1U );
+   archive << uint8_t ( denseTensor );
+   archive << uint8_t ( TypeValueMapping<ET>::value );
+   archive << uint8_t ( sizeof( ET ) );
+   archive << uint64_t( tens.pages() );
+   archive << uint64_t( tens.rows() );
+   archive << uint64_t( tens.columns() );
+   archive << uint64_t( tens.pages() * tens.rows() * tens.columns() );
+
+   if( !archive ) {
+      BLAZE_THROW_RUNTIME_ERROR( "File header could not be serialized" );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Serializes the elements of a dense tensor with low-level data access.
+//
+// \param archive The archive to be written.
+// \param tens The tensor to be serialized.
+// \return void
+// \exception std::runtime_error Dense tensor could not be serialized.
+//
+// The elements are written without padding by means of one bulk write per contiguous block
+// of rows.
+*/
+template< typename Archive  // Type of the archive
+        , typename TT >     // Type of the tensor
+EnableIf_t< HasConstDataAccess_v<TT> && IsNumeric_v< ElementType_t<TT> > >
+   TensorSerializer::serializeTensor( Archive& archive, const TT& tens )
+{
+   const size_t m( tens.rows() );
+   const size_t n( tens.columns() );
+   const size_t total( tens.pages() * m );
+
+   if( total == 0UL || n == 0UL ) return;
+
+   const size_t block( blockRows( tens ) );
+
+   for( size_t r=0UL; r<total; r+=block ) {
+      archive.write( tens.data( r % m, r / m ), block * n );
+   }
+
+   if( !archive ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Dense tensor could not be serialized" );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Serializes the elements of a dense tensor without low-level data access.
+//
+// \param archive The archive to be written.
+// \param tens The tensor to be serialized.
+// \return void
+// \exception std::runtime_error Dense tensor could not be serialized.
+*/
+template< typename Archive  // Type of the archive
+        , typename TT >     // Type of the tensor
+DisableIf_t< HasConstDataAccess_v<TT> && IsNumeric_v< ElementType_t<TT> > >
+   TensorSerializer::serializeTensor( Archive& archive, const TT& tens )
+{
+   for( size_t k=0UL; k<tens.pages(); ++k ) {
+      for( size_t i=0UL; i<tens.rows(); ++i ) {
+         for( size_t j=0UL; j<tens.columns(); ++j ) {
+            archive << tens(k,i,j);
+         }
+      }
+   }
+
+   if( !archive ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Dense tensor could not be serialized" );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DESERIALIZATION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Deserializes a dense tensor from the given archive.
+//
+// \param archive The archive to be read from.
+// \param tens The tensor to be deserialized.
+// \return void
+// \exception std::runtime_error Error during deserialization.
+// \exception std::invalid_argument Invalid tensor size detected.
+//
+// This function deserializes a dense tensor from the given archive. The target tensor is
+// resized to the size of the serialized tensor if possible, otherwise its size has to match
+// the serialized size. In case the stored element type differs from the element type of the
+// target tensor, the elements are converted on load. In case any error is detected during the
+// deserialization process, a \a std::runtime_error is thrown.
+*/
+template< typename Archive  // Type of the archive
+        , typename TT >     // Type of the tensor
+void TensorSerializer::deserialize( Archive& archive, DenseTensor<TT>& tens )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   if( !archive ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Faulty archive detected" );
+   }
+
+   deserializeHeader( archive );
+   prepareTensor( *tens );
+   deserializeTensor( archive, *tens );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Deserializes all meta information about the given tensor.
+//
+// \param archive The archive to be read from.
+// \return void
+// \exception std::runtime_error Error during deserialization.
+*/
+template< typename Archive >  // Type of the archive
+void TensorSerializer::deserializeHeader( Archive& archive )
+{
+   if( !( archive >> version_ >> type_ >> elementType_ >> elementSize_ >> pages_ >> rows_ >> columns_ >> number_ ) ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Corrupt archive detected" );
+   }
+   else if( version_ != 1U ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Invalid version detected" );
+   }
+   else if( type_ != denseTensor ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Invalid tensor type detected" );
+   }
+   else if( number_ != pages_ * rows_ * columns_ ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Invalid number of elements detected" );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Prepares the given non-resizable tensor for the deserialization process.
+//
+// \param tens The tensor to be prepared.
+// \return void
+// \exception std::invalid_argument Invalid tensor size detected.
+*/
+template< typename TT >  // Type of the tensor
+DisableIf_t< IsResizable_v<TT> > TensorSerializer::prepareTensor( TT& tens )
+{
+   if( tens.pages() != pages_ || tens.rows() != rows_ || tens.columns() != columns_ ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid tensor size detected" );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Prepares the given resizable tensor for the deserialization process.
+//
+// \param tens The tensor to be prepared.
+// \return void
+*/
+template< typename TT >  // Type of the tensor
+EnableIf_t< IsResizable_v<TT> > TensorSerializer::prepareTensor( TT& tens )
+{
+   tens.resize( pages_, rows_, columns_, false );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Deserializes the elements of a tensor from the archive.
+//
+// \param archive The archive to be read from.
+// \param tens The tensor to be reconstituted.
+// \return void
+// \exception std::runtime_error Error during deserialization.
+//
+// In case the stored element type matches the element type of the target tensor the elements
+// are read directly into the target. Otherwise the elements are converted on load.
+*/
+template< typename Archive  // Type of the archive
+        , typename TT >     // Type of the tensor
+void TensorSerializer::deserializeTensor( Archive& archive, TT& tens )
+{
+   using ET = ElementType_t<TT>;
+
+   if( elementType_ == TypeValueMapping<ET>::value && elementSize_ == sizeof( ET ) ) {
+      deserializeDenseTensor( archive, tens );
+   }
+   else if( !convertTensor( archive, tens, ConvertibleTypes() ) ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Invalid element type detected" );
+   }
+
+   if( !archive ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Dense tensor could not be deserialized" );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Deserializes a dense tensor with low-level data access and numeric elements.
+//
+// \param archive The archive to be read from.
+// \param tens The tensor to be reconstituted.
+// \return void
+//
+// The elements are read directly into the (padded) storage of the tensor by means of one bulk
+// read per contiguous block of rows.
+*/
+template< typename Archive  // Type of the archive
+        , typename TT >     // Type of the tensor
+EnableIf_t< HasMutableDataAccess_v<TT> && IsNumeric_v< ElementType_t<TT> > >
+   TensorSerializer::deserializeDenseTensor( Archive& archive, TT& tens )
+{
+   const size_t m( tens.rows() );
+   const size_t n( tens.columns() );
+   const size_t total( tens.pages() * m );
+
+   if( total == 0UL || n == 0UL ) return;
+
+   const size_t block( blockRows( tens ) );
+
+   for( size_t r=0UL; r<total; r+=block ) {
+      archive.read( tens.data( r % m, r / m ), block * n );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Deserializes a dense tensor element by element.
+//
+// \param archive The archive to be read from.
+// \param tens The tensor to be reconstituted.
+// \return void
+*/
+template< typename Archive  // Type of the archive
+        , typename TT >     // Type of the tensor
+DisableIf_t< HasMutableDataAccess_v<TT> && IsNumeric_v< ElementType_t<TT> > >
+   TensorSerializer::deserializeDenseTensor( Archive& archive, TT& tens )
+{
+   using ET = ElementType_t<TT>;
+
+   ET value{};
+
+   for( size_t k=0UL; k<tens.pages(); ++k ) {
+      for( size_t i=0UL; i<tens.rows(); ++i ) {
+         for( size_t j=0UL; j<tens.columns(); ++j ) {
+            if( !( archive >> value ) ) return;
+            tens(k,i,j) = value;
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief End of the recursion over the convertible element types.
+//
+// \return \a false since the stored element type cannot be converted.
+*/
+template< typename Archive  // Type of the archive
+        , typename TT >     // Type of the tensor
+bool TensorSerializer::convertTensor( Archive& archive, TT& tens, TypeList<> )
+{
+   MAYBE_UNUSED( archive, tens );
+
+   return false;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Deserializes a tensor with converted element type.
+//
+// \param archive The archive to be read from.
+// \param tens The tensor to be reconstituted.
+// \return \a true in case the stored element type could be converted, \a false if not.
+//
+// This function identifies the stored element type among the given list of types and, if
+// found, reads the elements as that type and converts them to the element type of the target.
+*/
+template< typename Archive   // Type of the archive
+        , typename TT        // Type of the tensor
+        , typename T         // First candidate element type
+        , typename... Ts >   // Remaining candidate element types
+bool TensorSerializer::convertTensor( Archive& archive, TT& tens, TypeList<T,Ts...> )
+{
+   if( elementType_ == TypeValueMapping<T>::value && elementSize_ == sizeof( T ) ) {
+      return convertDenseTensor<T>( archive, tens );
+   }
+
+   return convertTensor( archive, tens, TypeList<Ts...>() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Deserializes and converts the elements of a dense tensor with low-level data access.
+//
+// \param archive The archive to be read from.
+// \param tens The tensor to be reconstituted.
+// \return \a true.
+//
+// The stored elements are read row by row into a buffer and converted into the target row.
+*/
+template< typename T         // Stored element type
+        , typename Archive   // Type of the archive
+        , typename TT >      // Type of the tensor
+EnableIf_t< IsNumeric_v< ElementType_t<TT> > && IsConstructible_v< ElementType_t<TT>, T > &&
+            HasMutableDataAccess_v<TT>, bool >
+   TensorSerializer::convertDenseTensor( Archive& archive, TT& tens )
+{
+   using ET = ElementType_t<TT>;
+
+   const size_t n( tens.columns() );
+
+   if( n == 0UL ) return true;
+
+   const std::unique_ptr<T[]> buffer( new T[n] );
+
+   for( size_t k=0UL; k<tens.pages(); ++k ) {
+      for( size_t i=0UL; i<tens.rows(); ++i )
+      {
+         if( !archive.read( buffer.get(), n ) ) return true;
+
+         ET* row( tens.data( i, k ) );
+         for( size_t j=0UL; j<n; ++j ) {
+            row[j] = ET( buffer[j] );
+         }
+      }
+   }
+
+   return true;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Deserializes and converts the elements of a dense tensor element by element.
+//
+// \param archive The archive to be read from.
+// \param tens The tensor to be reconstituted.
+// \return \a true.
+*/
+template< typename T         // Stored element type
+        , typename Archive   // Type of the archive
+        , typename TT >      // Type of the tensor
+EnableIf_t< IsNumeric_v< ElementType_t<TT> > && IsConstructible_v< ElementType_t<TT>, T > &&
+            !HasMutableDataAccess_v<TT>, bool >
+   TensorSerializer::convertDenseTensor( Archive& archive, TT& tens )
+{
+   using ET = ElementType_t<TT>;
+
+   T value{};
+
+   for( size_t k=0UL; k<tens.pages(); ++k ) {
+      for( size_t i=0UL; i<tens.rows(); ++i ) {
+         for( size_t j=0UL; j<tens.columns(); ++j ) {
+            if( !( archive >> value ) ) return true;
+            tens(k,i,j) = ET( value );
+         }
+      }
+   }
+
+   return true;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Rejects the conversion of a stored element type into the target element type.
+//
+// \param archive The archive to be read from.
+// \param tens The tensor to be reconstituted.
+// \return \a false since the element types are not convertible.
+*/
+template< typename T         // Stored element type
+        , typename Archive   // Type of the archive
+        , typename TT >      // Type of the tensor
+DisableIf_t< IsNumeric_v< ElementType_t<TT> > && IsConstructible_v< ElementType_t<TT>, T >, bool >
+   TensorSerializer::convertDenseTensor( Archive& archive, TT& tens )
+{
+   MAYBE_UNUSED( archive, tens );
+
+   return false;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of rows that form one contiguous block of memory.
+//
+// \param tens The given tensor.
+// \return The number of rows per contiguous block.
+//
+// In case the rows of the tensor are not padded, all rows of a page are contiguous. In case
+// additionally the pages immediately follow each other, the complete tensor is a single block.
+*/
+template< typename TT >  // Type of the tensor
+size_t TensorSerializer::blockRows( const TT& tens ) noexcept
+{
+   const size_t m( tens.rows() );
+
+   if( tens.spacing() != tens.columns() ) {
+      return 1UL;
+   }
+   else if( tens.pages() > 1UL && tens.data( 0UL, 1UL ) != tens.data( 0UL, 0UL ) + m * tens.spacing() ) {
+      return m;
+   }
+   else {
+      return tens.pages() * m;
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Serializes the given dense tensor and writes it to the archive.
+// \ingroup tensor_serialization
+//
+// \param archive The archive to be written.
+// \param tens The tensor to be serialized.
+// \return void
+// \exception std::runtime_error Error during serialization.
+//
+// The serialize() function converts the given dense tensor into a portable, binary
+// representation. The following example demonstrates the (de-)serialization process of
+// tensors:
+
+   \code
+   // Serialization of a tensor
+   {
+      blaze::DynamicTensor<double> A;
+
+      // ... Resizing and initialization
+
+      blaze::Archive<std::ofstream> archive( "tensor.blaze" );
+      serialize( archive, A );
+   }
+
+   // Deserialization of a tensor
+   {
+      blaze::DynamicTensor<float> B;
+
+      blaze::Archive<std::ifstream> archive( "tensor.blaze" );
+      deserialize( archive, B );  // Converts the stored double values to float
+   }
+   \endcode
+
+// As the example demonstrates, the tensor serialization offers an enormous flexibility. However,
+// several actions result in errors:
+//
+//  - restoring tensors from the wrong archive
+//  - trying to restore a tensor of a size that does not match a non-resizable target
+//  - trying to restore a tensor whose elements cannot be converted to the target element type
+//
+// In case an error is encountered during (de-)serialization, a \a std::runtime_exception is
+// thrown.
+*/
+template< typename Archive  // Type of the archive
+        , typename TT >     // Type of the tensor
+void serialize( Archive& archive, const DenseTensor<TT>& tens )
+{
+   TensorSerializer().serialize( archive, *tens );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Deserializes a dense tensor.
+// \ingroup tensor_serialization
+//
+// \param archive The archive to be read from.
+// \param tens The tensor to be deserialized.
+// \return void
+// \exception std::runtime_error Tensor could not be deserialized.
+// \exception std::invalid_argument Invalid tensor size detected.
+//
+// The deserialize() function restores the given dense tensor from the archive. For more
+// details on the deserialization process, see the documentation of the serialize() function.
+*/
+template< typename Archive  // Type of the archive
+        , typename TT >     // Type of the tensor
+void deserialize( Archive& archive, DenseTensor<TT>& tens )
+{
+   TensorSerializer().deserialize( archive, *tens );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
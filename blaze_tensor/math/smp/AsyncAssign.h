@@ -0,0 +1,354 @@
+//=================================================================================================
+/*!
+//  \file blaze_tensor/math/smp/AsyncAssign.h
+//  \brief Header file for the asynchronous, future-returning tensor assignments
+//
+//  Copyright (C) 2012-2018 Klaus Iglberger - All Rights Reserved
+//  Copyright (C) 2018 Hartmut Kaiser - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+
+#ifndef _BLAZE_TENSOR_MATH_SMP_ASYNCASSIGN_H_
+#define _BLAZE_TENSOR_MATH_SMP_ASYNCASSIGN_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <utility>
+#include <vector>
+
+#include <blaze/math/typetraits/IsExpression.h>
+#include <blaze/system/SMP.h>
+#include <blaze/util/FunctionTrace.h>
+#include <blaze/util/typetraits/If.h>
+
+#include <blaze_tensor/math/expressions/DenseTensor.h>
+#include <blaze_tensor/math/expressions/DTensSerialExpr.h>
+
+#if BLAZE_HPX_PARALLEL_MODE
+#include <hpx/include/async.hpp>
+#include <hpx/include/lcos.hpp>
+#else
+#include <future>
+#endif
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  TYPE DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Handle on the completion of an asynchronous tensor assignment.
+// \ingroup smp
+//
+// An AsyncFuture becomes ready as soon as the corresponding asynchronous assignment has been
+// completed. Its \c get() function blocks until then and rethrows any exception thrown by the
+// assignment. In case HPX is selected as parallelization backend, AsyncFuture is an alias for
+// \c hpx::shared_future<void>, in all other cases it is an alias for \c std::shared_future<void>.
+// Since the future is shared, it can be waited for several times and can be handed as dependency
+// to any number of subsequent asynchronous assignments.
+*/
+#if BLAZE_HPX_PARALLEL_MODE
+using AsyncFuture = hpx::shared_future<void>;
+#else
+using AsyncFuture = std::shared_future<void>;
+#endif
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CLASS ASYNCTENSORASSIGNMENT
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Task of an asynchronous (compound) assignment to a dense tensor.
+// \ingroup smp
+//
+// This function object waits for all dependencies of the assignment, rethrowing the first
+// exception encountered, and afterwards performs the (compound) assignment \a OP of the serially
+// evaluated right-hand side operand to the target tensor. Whereas expression operands are stored
+// by value, plain tensor operands are stored by reference.
+*/
+template< typename TT1   // Type of the left-hand side dense tensor
+        , typename TT2   // Type of the right-hand side dense tensor
+        , typename OP >  // Type of the assignment operation
+class AsyncTensorAssignment
+{
+ private:
+   //**Type definitions****************************************************************************
+   //! Composite type of the right-hand side operand.
+   using Operand = If_t< IsExpression_v<TT2>, const TT2, const TT2& >;
+   //**********************************************************************************************
+
+ public:
+   //**Constructor*********************************************************************************
+   /*!\brief Constructor for the AsyncTensorAssignment class.
+   //
+   // \param lhs The target left-hand side dense tensor.
+   // \param rhs The right-hand side dense tensor.
+   // \param op The (compound) assignment operation.
+   // \param dependencies The assignments that have to be completed beforehand.
+   */
+   inline AsyncTensorAssignment( TT1& lhs, const TT2& rhs, OP op,
+                                 std::vector<AsyncFuture>&& dependencies )
+      : lhs_         ( lhs )                         // The target left-hand side dense tensor
+      , rhs_         ( rhs )                         // The right-hand side dense tensor
+      , op_          ( op )                          // The (compound) assignment operation
+      , dependencies_( std::move( dependencies ) )  // The preceding assignments
+   {}
+   //**********************************************************************************************
+
+   //**Function call operator**********************************************************************
+   /*!\brief Performs the assignment after the completion of all dependencies.
+   //
+   // \return void
+   */
+   inline void operator()() const
+   {
+      for( const AsyncFuture& dependency : dependencies_ ) {
+         dependency.get();
+      }
+
+      op_( lhs_, serial( rhs_ ) );
+   }
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   TT1&                     lhs_;           //!< The target left-hand side dense tensor.
+   Operand                  rhs_;           //!< The right-hand side dense tensor.
+   OP                       op_;            //!< The (compound) assignment operation.
+   std::vector<AsyncFuture> dependencies_;  //!< The preceding assignments.
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ASYNCHRONOUS ASSIGNMENT BACKEND
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Starts an asynchronous (compound) assignment to a dense tensor.
+// \ingroup smp
+//
+// \param lhs The target left-hand side dense tensor.
+// \param rhs The right-hand side dense tensor.
+// \param op The (compound) assignment operation.
+// \param dependencies The assignments that have to be completed beforehand.
+// \return The future of the assignment.
+//
+// This function is the backend implementation of all asynchronous tensor assignments. In case
+// HPX is selected as parallelization backend, the assignment is performed by a new HPX thread,
+// else it is performed by means of \c std::async() with the \c std::launch::async policy.
+*/
+template< typename TT1   // Type of the left-hand side dense tensor
+        , typename TT2   // Type of the right-hand side dense tensor
+        , typename OP >  // Type of the assignment operation
+inline AsyncFuture asyncTensorAssign( DenseTensor<TT1>& lhs, const DenseTensor<TT2>& rhs, OP op,
+                                      std::vector<AsyncFuture>&& dependencies )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   AsyncTensorAssignment<TT1,TT2,OP> task( *lhs, *rhs, op, std::move( dependencies ) );
+
+#if BLAZE_HPX_PARALLEL_MODE
+   return hpx::async( std::move( task ) ).share();
+#else
+   return std::async( std::launch::async, std::move( task ) ).share();
+#endif
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ASYNCHRONOUS ASSIGNMENT FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Asynchronous assignment to a dense tensor.
+// \ingroup smp
+//
+// \param lhs The target left-hand side dense tensor.
+// \param rhs The right-hand side dense tensor to be assigned.
+// \param dependencies The assignments that have to be completed before the assignment starts.
+// \return The future of the assignment.
+//
+// This function starts the assignment \f$ lhs = rhs \f$ in the background and immediately returns
+// a future on its completion. The assignment starts as soon as all given dependencies have been
+// completed. In case any of the dependencies failed, the assignment is skipped and the exception
+// of the dependency is propagated to the returned future:
+
+   \code
+   blaze::DynamicTensor<double> A, B, C, D, E;
+   // ... Resizing and initialization
+
+   blaze::AsyncFuture c( blaze::asyncAssign( C, A + B ) );            // Starts C = A + B
+   blaze::AsyncFuture d( blaze::asyncAssign( D, A % B ) );            // Runs concurrently to C
+   blaze::AsyncFuture e( blaze::asyncAssign( E, C - D, c, d ) );      // Waits for C and D
+
+   e.get();  // Waits for E and rethrows any exception of the three assignments
+   \endcode
+
+// Each assignment is evaluated serially within its own task (HPX thread or \c std::async()
+// thread), i.e. the speedup results from the concurrent execution of independent assignments.
+// The target tensor and all operands of the right-hand side expression have to outlive the
+// assignment and must not be modified by other threads until the returned future is ready. As
+// for the synchronous assignment, a resizable target is resized to the size of the right-hand
+// side tensor.
+//
+// \note Without HPX, the last copy of the returned future blocks in its destructor until the
+// assignment has been completed (as any future obtained from \c std::async()). Discarding the
+// result of asyncAssign() therefore turns it into a synchronous assignment:
+
+   \code
+   blaze::asyncAssign( C, A + B );                          // Blocks until C = A + B is done
+   blaze::AsyncFuture c( blaze::asyncAssign( C, A + B ) );  // Returns immediately
+   \endcode
+*/
+template< typename TT1        // Type of the left-hand side dense tensor
+        , typename TT2        // Type of the right-hand side dense tensor
+        , typename... Deps >  // Types of the dependencies
+inline AsyncFuture asyncAssign( DenseTensor<TT1>& lhs, const DenseTensor<TT2>& rhs,
+                                const Deps&... dependencies )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return asyncTensorAssign( *lhs, *rhs, []( auto& target, const auto& source ) {
+                                target = source;
+                             }, std::vector<AsyncFuture>{ dependencies... } );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Asynchronous addition assignment to a dense tensor.
+// \ingroup smp
+//
+// \param lhs The target left-hand side dense tensor.
+// \param rhs The right-hand side dense tensor to be added.
+// \param dependencies The assignments that have to be completed before the assignment starts.
+// \return The future of the addition assignment.
+//
+// This function starts the addition assignment \f$ lhs += rhs \f$ in the background and returns
+// a future on its completion (see asyncAssign()). In case the sizes of the two tensors don't
+// match, the returned future rethrows a \a std::invalid_argument exception.
+*/
+template< typename TT1        // Type of the left-hand side dense tensor
+        , typename TT2        // Type of the right-hand side dense tensor
+        , typename... Deps >  // Types of the dependencies
+inline AsyncFuture asyncAddAssign( DenseTensor<TT1>& lhs, const DenseTensor<TT2>& rhs,
+                                   const Deps&... dependencies )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return asyncTensorAssign( *lhs, *rhs, []( auto& target, const auto& source ) {
+                                target += source;
+                             }, std::vector<AsyncFuture>{ dependencies... } );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Asynchronous subtraction assignment to a dense tensor.
+// \ingroup smp
+//
+// \param lhs The target left-hand side dense tensor.
+// \param rhs The right-hand side dense tensor to be subtracted.
+// \param dependencies The assignments that have to be completed before the assignment starts.
+// \return The future of the subtraction assignment.
+//
+// This function starts the subtraction assignment \f$ lhs -= rhs \f$ in the background and
+// returns a future on its completion (see asyncAssign()). In case the sizes of the two tensors
+// don't match, the returned future rethrows a \a std::invalid_argument exception.
+*/
+template< typename TT1        // Type of the left-hand side dense tensor
+        , typename TT2        // Type of the right-hand side dense tensor
+        , typename... Deps >  // Types of the dependencies
+inline AsyncFuture asyncSubAssign( DenseTensor<TT1>& lhs, const DenseTensor<TT2>& rhs,
+                                   const Deps&... dependencies )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return asyncTensorAssign( *lhs, *rhs, []( auto& target, const auto& source ) {
+                                target -= source;
+                             }, std::vector<AsyncFuture>{ dependencies... } );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Asynchronous Schur product assignment to a dense tensor.
+// \ingroup smp
+//
+// \param lhs The target left-hand side dense tensor.
+// \param rhs The right-hand side dense tensor for the Schur product.
+// \param dependencies The assignments that have to be completed before the assignment starts.
+// \return The future of the Schur product assignment.
+//
+// This function starts the Schur product assignment \f$ lhs \circ= rhs \f$ in the background and
+// returns a future on its completion (see asyncAssign()). In case the sizes of the two tensors
+// don't match, the returned future rethrows a \a std::invalid_argument exception.
+*/
+template< typename TT1        // Type of the left-hand side dense tensor
+        , typename TT2        // Type of the right-hand side dense tensor
+        , typename... Deps >  // Types of the dependencies
+inline AsyncFuture asyncSchurAssign( DenseTensor<TT1>& lhs, const DenseTensor<TT2>& rhs,
+                                     const Deps&... dependencies )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return asyncTensorAssign( *lhs, *rhs, []( auto& target, const auto& source ) {
+                                target %= source;
+                             }, std::vector<AsyncFuture>{ dependencies... } );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,133 @@
+//=================================================================================================
+/*!
+//  \file blaze_tensor/math/smp/FirstTouch.h
+//  \brief Header file for the parallel first-touch initialization of dense tensor storage
+//
+//  Copyright (C) 2012-2018 Klaus Iglberger - All Rights Reserved
+//  Copyright (C) 2018 Hartmut Kaiser - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+
+#ifndef _BLAZE_TENSOR_MATH_SMP_FIRSTTOUCH_H_
+#define _BLAZE_TENSOR_MATH_SMP_FIRSTTOUCH_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/SIMD.h>
+#include <blaze/math/smp/Functions.h>
+#include <blaze/math/smp/ThreadMapping.h>
+#include <blaze/math/typetraits/IsVectorizable.h>
+#include <blaze/util/FunctionTrace.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/algorithms/Min.h>
+
+#include <blaze_tensor/math/smp/ParallelFor.h>
+#include <blaze_tensor/math/smp/TensorThreadMapping.h>
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  PARALLEL FIRST-TOUCH
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Parallel first-touch initialization of the storage of a dense tensor.
+// \ingroup smp
+//
+// \param v The first element of the storage.
+// \param o The number of pages.
+// \param m The number of rows per page.
+// \param n The number of columns.
+// \param nn The spacing between two rows (\f$ nn \geq n \f$).
+// \return void
+//
+// This function default initializes all \f$ o \cdot m \cdot nn \f$ elements of the given
+// row-major storage, including the padding elements. The storage is partitioned exactly like
+// the SMP assignment of a tensor of size \f$ o \times m \times n \f$ partitions it: the rows
+// and columns are split into the blocks of the 2D thread mapping and each block is initialized
+// for all pages by a single thread (the padding elements of a row belong to the block holding
+// the last columns). With the first-touch policy of the operating system each memory page is
+// thereby placed on the NUMA node of the thread that will process it.
+*/
+template< typename Type >  // Data type of the elements
+void smpFirstTouch( Type* v, size_t o, size_t m, size_t n, size_t nn )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   if( o == 0UL || m == 0UL || nn == 0UL )
+      return;
+
+   constexpr bool   simdEnabled( IsVectorizable_v<Type> );
+   constexpr size_t SIMDSIZE( SIMDTrait<Type>::size );
+
+   const size_t columns( n == 0UL ? nn : n );
+
+   const ThreadMapping threads( createThreadMapping( getNumThreads(), m, columns ) );
+
+   const size_t addon1     ( ( ( m % threads.first ) != 0UL )? 1UL : 0UL );
+   const size_t equalShare1( m / threads.first + addon1 );
+   const size_t rest1      ( equalShare1 & ( SIMDSIZE - 1UL ) );
+   const size_t rowsPerThread( ( simdEnabled && rest1 )?( equalShare1 - rest1 + SIMDSIZE ):( equalShare1 ) );
+
+   const size_t addon2     ( ( ( columns % threads.second ) != 0UL )? 1UL : 0UL );
+   const size_t equalShare2( columns / threads.second + addon2 );
+   const size_t rest2      ( equalShare2 & ( SIMDSIZE - 1UL ) );
+   const size_t colsPerThread( ( simdEnabled && rest2 )?( equalShare2 - rest2 + SIMDSIZE ):( equalShare2 ) );
+
+   smpFor( 0UL, threads.first * threads.second, [=]( size_t block )
+   {
+      const size_t row   ( ( block / threads.second ) * rowsPerThread );
+      const size_t column( ( block % threads.second ) * colsPerThread );
+
+      if( row >= m || column >= columns )
+         return;
+
+      const size_t rowEnd( min( row + rowsPerThread, m ) );
+      const size_t colEnd( column + colsPerThread >= columns ? nn : column + colsPerThread );
+
+      for( size_t k=0UL; k<o; ++k ) {
+         for( size_t i=row; i<rowEnd; ++i ) {
+            Type* const ptr( v + ( k*m + i )*nn );
+            for( size_t j=column; j<colEnd; ++j ) {
+               ptr[j] = Type();
+            }
+         }
+      }
+   } );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
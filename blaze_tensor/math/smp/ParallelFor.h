@@ -0,0 +1,204 @@
+//=================================================================================================
+/*!
+//  \file blaze_tensor/math/smp/ParallelFor.h
+//  \brief Header file for the backend-independent SMP loop
+//
+//  Copyright (C) 2012-2018 Klaus Iglberger - All Rights Reserved
+//  Copyright (C) 2018 Hartmut Kaiser - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+
+#ifndef _BLAZE_TENSOR_MATH_SMP_PARALLELFOR_H_
+#define _BLAZE_TENSOR_MATH_SMP_PARALLELFOR_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <atomic>
+
+#include <blaze/math/SMP.h>
+#include <blaze/math/smp/Functions.h>
+#include <blaze/math/smp/SerialSection.h>
+#include <blaze/system/SMP.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/FunctionTrace.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/algorithms/Min.h>
+
+#if BLAZE_HPX_PARALLEL_MODE
+#include <hpx/include/parallel_for_loop.hpp>
+#elif BLAZE_CPP_THREADS_PARALLEL_MODE || BLAZE_BOOST_THREADS_PARALLEL_MODE
+#include <blaze/util/algorithms/Max.h>
+#include <blaze_tensor/math/smp/threads/WorkStealing.h>
+#endif
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  SMP LOOP
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Serial execution of the loop body for all indices in the range \f$ [begin..end) \f$.
+// \ingroup smp
+//
+// \param begin The first index of the range.
+// \param end The index one past the last index of the range.
+// \param f The loop body.
+// \return void
+*/
+template< typename F >  // Type of the loop body
+void serialFor( size_t begin, size_t end, F& f )
+{
+   for( size_t i=begin; i<end; ++i ) {
+      f( i );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Parallel execution of the loop body for all indices in the range \f$ [begin..end) \f$.
+// \ingroup smp
+//
+// \param begin The first index of the range.
+// \param end The index one past the last index of the range.
+// \param f The loop body.
+// \return void
+//
+// This function calls \a f once for every index in the range \f$ [begin..end) \f$, distributing
+// the indices over the threads of the active SMP backend (HPX, C++11/Boost threads or OpenMP).
+// The order in which the indices are processed is unspecified and the loop body must therefore
+// not depend on it. In case no parallel backend is active, in case a serial section is active
+// or in case the range contains a single index only, the loop is executed serially by the
+// calling thread. With the C++11/Boost thread backend the indices are distributed via work
+// stealing in chunks of at least 1/16 of the per-thread share, and loops that are started from
+// within the loop body of another parallel loop are executed inline. With the other backends,
+// functions that are built on top of this loop (for instance the axis-wise reduction and scan
+// kernels) must not be called from within the loop body of another parallel loop.\n
+// This function must \b NOT be called explicitly! It is used internally for the parallelization
+// of kernels that cannot be expressed as SMP assignment of an expression.
+*/
+template< typename F >  // Type of the loop body
+void smpFor( size_t begin, size_t end, F&& f )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   if( begin >= end )
+      return;
+
+   if( isSerialSectionActive() || end - begin == 1UL ) {
+      serialFor( begin, end, f );
+      return;
+   }
+
+#if BLAZE_HPX_PARALLEL_MODE
+
+#if HPX_VERSION_FULL >= 0x010500
+   using hpx::for_loop;
+   using hpx::execution::par;
+#else
+   using hpx::parallel::for_loop;
+   using hpx::parallel::execution::par;
+#endif
+
+   for_loop( par, begin, end, [&f]( size_t i ) { f( i ); } );
+
+#elif BLAZE_CPP_THREADS_PARALLEL_MODE || BLAZE_BOOST_THREADS_PARALLEL_MODE
+
+   const size_t range( end - begin );
+   const size_t grain( max( range / ( getNumThreads() * 16UL ), 1UL ) );
+
+   TheWorkStealingScheduler::parallelFor( begin, end, grain, f );
+
+#elif BLAZE_OPENMP_PARALLEL_MODE
+
+   const long first( static_cast<long>( begin ) );
+   const long last ( static_cast<long>( end   ) );
+
+#pragma omp parallel for schedule(dynamic,1) shared(f)
+   for( long i=first; i<last; ++i ) {
+      f( static_cast<size_t>( i ) );
+   }
+
+#else
+
+   serialFor( begin, end, f );
+
+#endif
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Parallel check whether the predicate is satisfied for any index in the range
+//        \f$ [begin..end) \f$.
+// \ingroup smp
+//
+// \param begin The first index of the range.
+// \param end The index one past the last index of the range.
+// \param f The predicate.
+// \return \a true if \a f returns \a true for at least one index, \a false if not.
+//
+// This function distributes the indices over the threads of the active SMP backend (see
+// blaze::smpFor()). The predicate is called as \c f(i,found), where \a found is a cancellation
+// flag of type \c const \c std::atomic<bool>& that is shared by all threads. As soon as one
+// call of the predicate returns \a true the flag is set, all indices that have not been started
+// yet are skipped and long running predicates may poll the flag to stop early. Therefore the
+// predicate is not guaranteed to be called for every index.\n
+// This function must \b NOT be called explicitly! It is used internally for the parallelization
+// of the early-exit comparison kernels.
+*/
+template< typename F >  // Type of the predicate
+bool smpAnyOf( size_t begin, size_t end, F&& f )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   std::atomic<bool> found( false );
+
+   smpFor( begin, end, [&]( size_t i ) {
+      if( !found.load( std::memory_order_relaxed ) && f( i, found ) )
+         found.store( true, std::memory_order_relaxed );
+   } );
+
+   return found.load();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
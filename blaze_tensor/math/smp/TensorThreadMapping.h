@@ -61,23 +61,19 @@ namespace blaze {
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-/*!\brief Creates a 3D mapping of threads.
+/*!\brief Creates a 2D mapping of threads for the rows and columns of a tensor.
 // \ingroup smp
 //
 // \param threads The total number of threads to be mapped.
-// \param A The tensor the mapping is created for.
+// \param M The number of rows of the tensor.
+// \param N The number of columns of the tensor.
 // \return 2D mapping of the given number of threads.
 //
-// This function creates a 2D mapping of the given number of threads for the given tensor \a A.
-// The mapping will depend on the ratio between rows and columns of the tensor and its storage
-// order.
+// This function creates a 2D mapping of the given number of threads for a tensor with \a M
+// rows and \a N columns. The mapping will depend on the ratio between rows and columns.
 */
-template< typename MT >// Type of the tensor
-ThreadMapping createThreadMapping( size_t threads, const Tensor<MT>& A )
+inline ThreadMapping createThreadMapping( size_t threads, size_t M, size_t N )
 {
-   const size_t M( (*A).rows() );
-   const size_t N( (*A).columns() );
-
    if( M > N )
    {
       const double ratio( double(M)/double(N) );
@@ -108,6 +104,28 @@ ThreadMapping createThreadMapping( size_t threads, const Tensor<MT>& A )
 /*! \endcond */
 //*************************************************************************************************
 
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Creates a 3D mapping of threads.
+// \ingroup smp
+//
+// \param threads The total number of threads to be mapped.
+// \param A The tensor the mapping is created for.
+// \return 2D mapping of the given number of threads.
+//
+// This function creates a 2D mapping of the given number of threads for the given tensor \a A.
+// The mapping will depend on the ratio between rows and columns of the tensor and its storage
+// order.
+*/
+template< typename MT >// Type of the tensor
+ThreadMapping createThreadMapping( size_t threads, const Tensor<MT>& A )
+{
+   return createThreadMapping( threads, (*A).rows(), (*A).columns() );
+}
+/*! \endcond */
+//*************************************************************************************************
+
 } // namespace blaze
 
 #endif
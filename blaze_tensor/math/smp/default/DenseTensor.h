@@ -49,6 +49,7 @@
 
 #include <blaze_tensor/math/expressions/Tensor.h>
 #include <blaze_tensor/math/typetraits/IsDenseTensor.h>
+#include <blaze_tensor/util/KernelTrace.h>
 
 namespace blaze {
 
@@ -105,6 +106,8 @@ inline EnableIf_t< IsDenseTensor_v<TT1> >
    BLAZE_INTERNAL_ASSERT( (*lhs).columns() == (*rhs).columns(), "Invalid number of columns" );
    BLAZE_INTERNAL_ASSERT( (*lhs).pages()   == (*rhs).pages(),   "Invalid number of pages"   );
 
+   BLAZE_KERNEL_TRACE( "serial assign", TT2, *lhs, 1UL );
+
    assign( *lhs, *rhs );
 }
 //*************************************************************************************************
@@ -135,6 +138,8 @@ inline EnableIf_t< IsDenseTensor_v<TT1> >
    BLAZE_INTERNAL_ASSERT( (*lhs).columns() == (*rhs).columns(), "Invalid number of columns" );
    BLAZE_INTERNAL_ASSERT( (*lhs).pages()   == (*rhs).pages(),   "Invalid number of pages"   );
 
+   BLAZE_KERNEL_TRACE( "serial add assign", TT2, *lhs, 1UL );
+
    addAssign( *lhs, *rhs );
 }
 //*************************************************************************************************
@@ -165,6 +170,8 @@ inline EnableIf_t< IsDenseTensor_v<TT1> >
    BLAZE_INTERNAL_ASSERT( (*lhs).columns() == (*rhs).columns(), "Invalid number of columns" );
    BLAZE_INTERNAL_ASSERT( (*lhs).pages()   == (*rhs).pages(),   "Invalid number of pages"   );
 
+   BLAZE_KERNEL_TRACE( "serial sub assign", TT2, *lhs, 1UL );
+
    subAssign( *lhs, *rhs );
 }
 //*************************************************************************************************
@@ -196,6 +203,8 @@ inline EnableIf_t< IsDenseTensor_v<TT1> >
    BLAZE_INTERNAL_ASSERT( (*lhs).columns() == (*rhs).columns(), "Invalid number of columns" );
    BLAZE_INTERNAL_ASSERT( (*lhs).pages()   == (*rhs).pages(),   "Invalid number of pages"   );
 
+   BLAZE_KERNEL_TRACE( "serial schur assign", TT2, *lhs, 1UL );
+
    schurAssign( *lhs, *rhs );
 }
 //*************************************************************************************************
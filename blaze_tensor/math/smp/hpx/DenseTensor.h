@@ -67,6 +67,7 @@
 #include <blaze_tensor/math/smp/TensorThreadMapping.h>
 #include <blaze_tensor/math/typetraits/IsDenseTensor.h>
 #include <blaze_tensor/math/views/PageSlice.h>
+#include <blaze_tensor/util/KernelTrace.h>
 
 namespace blaze {
 
@@ -253,9 +254,11 @@ inline EnableIf_t< IsDenseTensor_v<TT1> && IsSMPAssignable_v<TT1> && IsSMPAssign
    BLAZE_INTERNAL_ASSERT( (*lhs).pages()   == (*rhs).pages(),   "Invalid number of pages"   );
 
    if( isSerialSectionActive() || !(*rhs).canSMPAssign() ) {
+      BLAZE_KERNEL_TRACE( "serial assign", TT2, *lhs, 1UL );
       assign( *lhs, *rhs );
    }
    else {
+      BLAZE_KERNEL_TRACE( "smp assign", TT2, *lhs, getNumThreads() );
       hpxAssign( *lhs, *rhs, []( auto& a, const auto& b ){ assign( a, b ); } );
    }
 }
@@ -339,9 +342,11 @@ inline EnableIf_t< IsDenseTensor_v<TT1> && IsSMPAssignable_v<TT1> && IsSMPAssign
    BLAZE_INTERNAL_ASSERT( (*lhs).pages()   == (*rhs).pages()  , "Invalid pages of columns" );
 
    if( isSerialSectionActive() || !(*rhs).canSMPAssign() ) {
+      BLAZE_KERNEL_TRACE( "serial add assign", TT2, *lhs, 1UL );
       addAssign( *lhs, *rhs );
    }
    else {
+      BLAZE_KERNEL_TRACE( "smp add assign", TT2, *lhs, getNumThreads() );
       hpxAssign( *lhs, *rhs, []( auto& a, const auto& b ){ addAssign( a, b ); } );
    }
 }
@@ -425,9 +430,11 @@ inline EnableIf_t< IsDenseTensor_v<TT1> && IsSMPAssignable_v<TT1> && IsSMPAssign
    BLAZE_INTERNAL_ASSERT( (*lhs).pages()   == (*rhs).pages()  , "Invalid pages of columns" );
 
    if( isSerialSectionActive() || !(*rhs).canSMPAssign() ) {
+      BLAZE_KERNEL_TRACE( "serial sub assign", TT2, *lhs, 1UL );
       subAssign( *lhs, *rhs );
    }
    else {
+      BLAZE_KERNEL_TRACE( "smp sub assign", TT2, *lhs, getNumThreads() );
       hpxAssign( *lhs, *rhs, []( auto& a, const auto& b ){ subAssign( a, b ); } );
    }
 }
@@ -511,9 +518,11 @@ inline EnableIf_t< IsDenseTensor_v<TT1> && IsSMPAssignable_v<TT1> && IsSMPAssign
    BLAZE_INTERNAL_ASSERT( (*lhs).pages()   == (*rhs).pages()  , "Invalid pages of columns" );
 
    if( isSerialSectionActive() || !(*rhs).canSMPAssign() ) {
+      BLAZE_KERNEL_TRACE( "serial schur assign", TT2, *lhs, 1UL );
       schurAssign( *lhs, *rhs );
    }
    else {
+      BLAZE_KERNEL_TRACE( "smp schur assign", TT2, *lhs, getNumThreads() );
       hpxAssign( *lhs, *rhs, []( auto& a, const auto& b ){ schurAssign( a, b ); } );
    }
 }
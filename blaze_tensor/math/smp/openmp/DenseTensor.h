@@ -65,6 +65,7 @@
 #include <blaze_tensor/math/smp/TensorThreadMapping.h>
 #include <blaze_tensor/math/typetraits/IsDenseTensor.h>
 #include <blaze_tensor/math/views/PageSlice.h>
+#include <blaze_tensor/util/KernelTrace.h>
 
 namespace blaze {
 
@@ -242,9 +243,11 @@ inline EnableIf_t< IsDenseTensor_v<MT1> && IsSMPAssignable_v<MT1> && IsSMPAssign
    BLAZE_PARALLEL_SECTION
    {
       if( isSerialSectionActive() || !(*rhs).canSMPAssign() ) {
+         BLAZE_KERNEL_TRACE( "serial assign", MT2, *lhs, 1UL );
          assign( *lhs, *rhs );
       }
       else {
+         BLAZE_KERNEL_TRACE( "smp assign", MT2, *lhs, static_cast<size_t>( omp_get_max_threads() ) );
 #pragma omp parallel shared( lhs, rhs )
          openmpAssign( *lhs, *rhs, []( auto& a, const auto& b ){ assign( a, b ); } );
       }
@@ -332,9 +335,11 @@ inline EnableIf_t< IsDenseTensor_v<MT1> && IsSMPAssignable_v<MT1> && IsSMPAssign
    BLAZE_PARALLEL_SECTION
    {
       if( isSerialSectionActive() || !(*rhs).canSMPAssign() ) {
+         BLAZE_KERNEL_TRACE( "serial add assign", MT2, *lhs, 1UL );
          addAssign( *lhs, *rhs );
       }
       else {
+         BLAZE_KERNEL_TRACE( "smp add assign", MT2, *lhs, static_cast<size_t>( omp_get_max_threads() ) );
 #pragma omp parallel shared( lhs, rhs )
          openmpAssign( *lhs, *rhs, []( auto& a, const auto& b ){ addAssign( a, b ); } );
       }
@@ -422,9 +427,11 @@ inline EnableIf_t< IsDenseTensor_v<MT1> && IsSMPAssignable_v<MT1> && IsSMPAssign
    BLAZE_PARALLEL_SECTION
    {
       if( isSerialSectionActive() || !(*rhs).canSMPAssign() ) {
+         BLAZE_KERNEL_TRACE( "serial sub assign", MT2, *lhs, 1UL );
          subAssign( *lhs, *rhs );
       }
       else {
+         BLAZE_KERNEL_TRACE( "smp sub assign", MT2, *lhs, static_cast<size_t>( omp_get_max_threads() ) );
 #pragma omp parallel shared( lhs, rhs )
          openmpAssign( *lhs, *rhs, []( auto& a, const auto& b ){ subAssign( a, b ); } );
       }
@@ -512,9 +519,11 @@ inline EnableIf_t< IsDenseTensor_v<MT1> && IsSMPAssignable_v<MT1> && IsSMPAssign
    BLAZE_PARALLEL_SECTION
    {
       if( isSerialSectionActive() || !(*rhs).canSMPAssign() ) {
+         BLAZE_KERNEL_TRACE( "serial schur assign", MT2, *lhs, 1UL );
          schurAssign( *lhs, *rhs );
       }
       else {
+         BLAZE_KERNEL_TRACE( "smp schur assign", MT2, *lhs, static_cast<size_t>( omp_get_max_threads() ) );
 #pragma omp parallel shared( lhs, rhs )
          openmpAssign( *lhs, *rhs, []( auto& a, const auto& b ){ schurAssign( a, b ); } );
       }
@@ -62,8 +62,10 @@
 
 #include <blaze_tensor/math/expressions/DenseTensor.h>
 #include <blaze_tensor/math/smp/TensorThreadMapping.h>
+#include <blaze_tensor/math/smp/threads/WorkStealing.h>
 #include <blaze_tensor/math/typetraits/IsDenseTensor.h>
 #include <blaze_tensor/math/views/PageSlice.h>
+#include <blaze_tensor/util/KernelTrace.h>
 
 namespace blaze {
 
@@ -84,7 +86,9 @@ namespace blaze {
 // \return void
 //
 // This function is the backend implementation of the C++11/Boost thread-based SMP assignment
-// of a dense tensor to a dense tensor.\n
+// of a dense tensor to a dense tensor. The tensor is partitioned into blocks of rows and columns
+// per page (at least four blocks per thread), which are distributed via work stealing. Thus a
+// page or block that is more expensive to compute does not stall the remaining threads.\n
 // This function must \b NOT be called explicitly! It is used internally for the performance
 // optimized evaluation of expression templates. Calling this function explicitly might result
 // in erroneous results and/or in compilation errors. Instead of using this function use the
@@ -108,10 +112,19 @@ void threadAssign( DenseTensor<MT1>& lhs, const DenseTensor<MT2>& rhs, OP op )
    const bool lhsAligned( (*lhs).isAligned() );
    const bool rhsAligned( (*rhs).isAligned() );
 
-   const ThreadMapping threads( createThreadMapping( TheThreadBackend::size(), *rhs ) );
+   const size_t pages( (*rhs).pages() );
 
-   const size_t addon1     ( ( ( (*rhs).rows() % threads.first ) != 0UL )? 1UL : 0UL );
-   const size_t equalShare1( (*rhs).rows() / threads.first + addon1 );
+   if( pages == 0UL || (*rhs).rows() == 0UL || (*rhs).columns() == 0UL )
+      return;
+
+   const ThreadMapping threads( createThreadMapping( TheWorkStealingScheduler::size(), *rhs ) );
+
+   const size_t blocks   ( pages * threads.first * threads.second );
+   const size_t minBlocks( 4UL * TheWorkStealingScheduler::size() );
+   const size_t split    ( ( blocks < minBlocks )?( ( minBlocks + blocks - 1UL ) / blocks ):( 1UL ) );
+
+   const size_t addon1     ( ( ( (*rhs).rows() % ( threads.first*split ) ) != 0UL )? 1UL : 0UL );
+   const size_t equalShare1( (*rhs).rows() / ( threads.first*split ) + addon1 );
    const size_t rest1      ( equalShare1 & ( SIMDSIZE - 1UL ) );
    const size_t rowsPerThread( ( simdEnabled && rest1 )?( equalShare1 - rest1 + SIMDSIZE ):( equalShare1 ) );
 
@@ -120,53 +133,42 @@ void threadAssign( DenseTensor<MT1>& lhs, const DenseTensor<MT2>& rhs, OP op )
    const size_t rest2      ( equalShare2 & ( SIMDSIZE - 1UL ) );
    const size_t colsPerThread( ( simdEnabled && rest2 )?( equalShare2 - rest2 + SIMDSIZE ):( equalShare2 ) );
 
-   for( size_t i=0UL; i<threads.first; ++i )
+   const size_t rowBlocks( ( (*rhs).rows()    + rowsPerThread - 1UL ) / rowsPerThread );
+   const size_t colBlocks( ( (*rhs).columns() + colsPerThread - 1UL ) / colsPerThread );
+
+   TheWorkStealingScheduler::parallelFor( 0UL, pages*rowBlocks*colBlocks, 1UL, [&]( size_t index )
    {
-      const size_t row( i*rowsPerThread );
-
-      if( row >= (*lhs).rows() )
-         continue;
-
-      for( size_t j=0UL; j<threads.second; ++j )
-      {
-         const size_t column( j*colsPerThread );
-
-         if( column >= (*rhs).columns() )
-            continue;
-
-         for (size_t k = 0; k != (*rhs).pages(); ++k)
-         {
-            const size_t m( min( rowsPerThread, (*lhs).rows()    - row    ) );
-            const size_t n( min( colsPerThread, (*rhs).columns() - column ) );
-
-            auto lhs_slice = pageslice( *lhs, k );
-            auto rhs_slice = pageslice( *rhs, k );
-
-            if( simdEnabled && lhsAligned && rhsAligned ) {
-               auto       target( submatrix<aligned>( *lhs_slice, row, column, m, n, unchecked ) );
-               const auto source( submatrix<aligned>( *rhs_slice, row, column, m, n, unchecked ) );
-               TheThreadBackend::schedule( target, source, op );
-            }
-            else if( simdEnabled && lhsAligned ) {
-               auto       target( submatrix<aligned>  ( *lhs_slice, row, column, m, n, unchecked ) );
-               const auto source( submatrix<unaligned>( *rhs_slice, row, column, m, n, unchecked ) );
-               TheThreadBackend::schedule( target, source, op );
-            }
-            else if( simdEnabled && rhsAligned ) {
-               auto       target( submatrix<unaligned>( *lhs_slice, row, column, m, n, unchecked ) );
-               const auto source( submatrix<aligned>  ( *rhs_slice, row, column, m, n, unchecked ) );
-               TheThreadBackend::schedule( target, source, op );
-            }
-            else {
-               auto       target( submatrix<unaligned>( *lhs_slice, row, column, m, n, unchecked ) );
-               const auto source( submatrix<unaligned>( *rhs_slice, row, column, m, n, unchecked ) );
-               TheThreadBackend::schedule( target, source, op );
-            }
-         }
-      }
-   }
+      const size_t k     ( index / ( rowBlocks*colBlocks ) );
+      const size_t row   ( ( ( index / colBlocks ) % rowBlocks ) * rowsPerThread );
+      const size_t column( ( index % colBlocks ) * colsPerThread );
+
+      const size_t m( min( rowsPerThread, (*lhs).rows()    - row    ) );
+      const size_t n( min( colsPerThread, (*rhs).columns() - column ) );
 
-   TheThreadBackend::wait();
+      auto lhs_slice = pageslice( *lhs, k );
+      auto rhs_slice = pageslice( *rhs, k );
+
+      if( simdEnabled && lhsAligned && rhsAligned ) {
+         auto       target( submatrix<aligned>( *lhs_slice, row, column, m, n, unchecked ) );
+         const auto source( submatrix<aligned>( *rhs_slice, row, column, m, n, unchecked ) );
+         op( target, source );
+      }
+      else if( simdEnabled && lhsAligned ) {
+         auto       target( submatrix<aligned>  ( *lhs_slice, row, column, m, n, unchecked ) );
+         const auto source( submatrix<unaligned>( *rhs_slice, row, column, m, n, unchecked ) );
+         op( target, source );
+      }
+      else if( simdEnabled && rhsAligned ) {
+         auto       target( submatrix<unaligned>( *lhs_slice, row, column, m, n, unchecked ) );
+         const auto source( submatrix<aligned>  ( *rhs_slice, row, column, m, n, unchecked ) );
+         op( target, source );
+      }
+      else {
+         auto       target( submatrix<unaligned>( *lhs_slice, row, column, m, n, unchecked ) );
+         const auto source( submatrix<unaligned>( *rhs_slice, row, column, m, n, unchecked ) );
+         op( target, source );
+      }
+   } );
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -248,9 +250,11 @@ inline EnableIf_t< IsDenseTensor_v<MT1> && IsSMPAssignable_v<MT1> && IsSMPAssign
    BLAZE_PARALLEL_SECTION
    {
       if( isSerialSectionActive() || !(*rhs).canSMPAssign() ) {
+         BLAZE_KERNEL_TRACE( "serial assign", MT2, *lhs, 1UL );
          assign( *lhs, *rhs );
       }
       else {
+         BLAZE_KERNEL_TRACE( "smp assign", MT2, *lhs, TheThreadBackend::size() );
          threadAssign( *lhs, *rhs, []( auto& a, const auto& b ){ assign( a, b ); } );
       }
    }
@@ -338,9 +342,11 @@ inline EnableIf_t< IsDenseTensor_v<MT1> && IsSMPAssignable_v<MT1> && IsSMPAssign
    BLAZE_PARALLEL_SECTION
    {
       if( isSerialSectionActive() || !(*rhs).canSMPAssign() ) {
+         BLAZE_KERNEL_TRACE( "serial add assign", MT2, *lhs, 1UL );
          addAssign( *lhs, *rhs );
       }
       else {
+         BLAZE_KERNEL_TRACE( "smp add assign", MT2, *lhs, TheThreadBackend::size() );
          threadAssign( *lhs, *rhs, []( auto& a, const auto& b ){ addAssign( a, b ); } );
       }
    }
@@ -429,9 +435,11 @@ inline EnableIf_t< IsDenseTensor_v<MT1> && IsSMPAssignable_v<MT1> && IsSMPAssign
    BLAZE_PARALLEL_SECTION
    {
       if( isSerialSectionActive() || !(*rhs).canSMPAssign() ) {
+         BLAZE_KERNEL_TRACE( "serial sub assign", MT2, *lhs, 1UL );
          subAssign( *lhs, *rhs );
       }
       else {
+         BLAZE_KERNEL_TRACE( "smp sub assign", MT2, *lhs, TheThreadBackend::size() );
          threadAssign( *lhs, *rhs, []( auto& a, const auto& b ){ subAssign( a, b ); } );
       }
    }
@@ -520,9 +528,11 @@ inline EnableIf_t< IsDenseTensor_v<MT1> && IsSMPAssignable_v<MT1> && IsSMPAssign
    BLAZE_PARALLEL_SECTION
    {
       if( isSerialSectionActive() || !(*rhs).canSMPAssign() ) {
+         BLAZE_KERNEL_TRACE( "serial schur assign", MT2, *lhs, 1UL );
          schurAssign( *lhs, *rhs );
       }
       else {
+         BLAZE_KERNEL_TRACE( "smp schur assign", MT2, *lhs, TheThreadBackend::size() );
          threadAssign( *lhs, *rhs, []( auto& a, const auto& b ){ schurAssign( a, b ); } );
       }
    }
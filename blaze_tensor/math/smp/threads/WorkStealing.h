@@ -0,0 +1,791 @@
+//=================================================================================================
+/*!
+//  \file blaze_tensor/math/smp/threads/WorkStealing.h
+//  \brief Header file for the work-stealing scheduler of the C++11/Boost thread-based SMP backend
+//
+//  Copyright (C) 2012-2018 Klaus Iglberger - All Rights Reserved
+//  Copyright (C) 2018 Hartmut Kaiser - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+
+#ifndef _BLAZE_TENSOR_MATH_SMP_THREADS_WORKSTEALING_H_
+#define _BLAZE_TENSOR_MATH_SMP_THREADS_WORKSTEALING_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#if BLAZE_CPP_THREADS_PARALLEL_MODE
+#  include <condition_variable>
+#  include <mutex>
+#  include <thread>
+#elif BLAZE_BOOST_THREADS_PARALLEL_MODE
+#  include <boost/thread/condition.hpp>
+#  include <boost/thread/mutex.hpp>
+#  include <boost/thread/thread.hpp>
+#endif
+
+#include <atomic>
+#include <deque>
+#include <exception>
+#include <memory>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <blaze/math/smp/threads/ThreadBackend.h>
+#include <blaze/system/SMP.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/StaticAssert.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/algorithms/Min.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Work-stealing scheduler for the C++11 and Boost thread-based parallelization.
+// \ingroup smp
+//
+// The WorkStealingScheduler class template executes parallel loops over an index range with a
+// pool of worker threads. In contrast to the static pre-scheduling of the ThreadBackend, every
+// participating thread (the calling thread and the workers) owns a deque of index ranges. A
+// thread recursively halves its current range down to the grain size, pushing the upper halves
+// to the back of its deque, and continues with the most recently pushed range. A thread with an
+// empty deque steals the oldest (and therefore largest) range from the front of the deque of
+// another thread and splits it again. Thus a few expensive indices (for instance pages with a
+// variable cost \c map() operation) do not stall the remaining threads.\n
+// Parallel loops that are started from within a loop body (nested parallelism) are executed
+// inline by the calling thread. Parallel loops that are started concurrently by several user
+// threads are executed one after another. Exceptions thrown by the loop body are rethrown by
+// the thread that started the loop.\n
+// The number of threads follows the size of the ThreadBackend (i.e. the \c BLAZE_NUM_THREADS
+// environment variable and the blaze::setNumThreads() function).\n
+// This class must \b NOT be used explicitly! It is reserved for internal use only. Using
+// this class explicitly might result in erroneous results and/or in undefined behavior.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+class WorkStealingScheduler
+{
+ public:
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   static inline size_t size();
+   static inline bool   isNested() noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Thread execution functions******************************************************************
+   /*!\name Thread execution functions */
+   //@{
+   template< typename F >
+   static void parallelFor( size_t begin, size_t end, size_t grain, F&& f );
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Private struct Range************************************************************************
+   /*!\brief Index range \f$ [begin..end) \f$ of a parallel loop.
+   */
+   struct Range
+   {
+      size_t begin;  //!< The first index of the range.
+      size_t end;    //!< The index one past the last index of the range.
+   };
+   //**********************************************************************************************
+
+   //**Private struct Slot*************************************************************************
+   /*!\brief The deque of index ranges of a single participating thread.
+   */
+   struct Slot
+   {
+      MT                mutex;  //!< Synchronization of the deque accesses.
+      std::deque<Range> tasks;  //!< The index ranges owned by the thread.
+   };
+   //**********************************************************************************************
+
+   //**Private struct Job**************************************************************************
+   /*!\brief A single parallel loop.
+   */
+   struct Job
+   {
+      void (*invoke)( void*, size_t, size_t );  //!< Execution of the loop body for a range.
+      void*               body;                  //!< The type-erased loop body.
+      size_t              grain;                 //!< The minimum number of indices per chunk.
+      std::atomic<size_t> remaining;             //!< The number of unprocessed indices.
+      std::atomic<bool>   failed;                //!< Flag for an exception in the loop body.
+      std::exception_ptr  error;                 //!< The first exception of the loop body.
+   };
+   //**********************************************************************************************
+
+   //**Private class Pool**************************************************************************
+   /*!\brief The pool of worker threads and their deques.
+   */
+   class Pool
+   {
+    public:
+      //**Constructor and destructor***************************************************************
+      explicit inline Pool();
+      inline ~Pool();
+      //*******************************************************************************************
+
+      //**Utility functions************************************************************************
+      inline size_t size() const noexcept { return slots_.size(); }
+      inline void   resize( size_t n );
+      //*******************************************************************************************
+
+      //**Execution functions**********************************************************************
+      inline void run( Job& job, size_t begin, size_t end );
+      //*******************************************************************************************
+
+      //**Member variables*************************************************************************
+      MT runMutex_;  //!< Serialization of the loops of different user threads.
+      //*******************************************************************************************
+
+    private:
+      //**Execution functions**********************************************************************
+      inline void workerMain( size_t slot );
+      inline void work      ( size_t slot, Job& job );
+      inline void execute   ( size_t slot, Job& job, Range range );
+      inline bool pop       ( size_t slot, Range& range );
+      inline bool steal     ( size_t slot, Range& range );
+      inline void push      ( size_t slot, const Range& range );
+      inline void start     ( size_t n );
+      inline void stop      ();
+      //*******************************************************************************************
+
+      //**Member variables*************************************************************************
+      std::vector< std::unique_ptr<Slot> > slots_;      //!< The deques of all threads.
+      std::vector< std::unique_ptr<TT> >   threads_;    //!< The worker threads.
+      MT                                   mutex_;      //!< Synchronization of the job handover.
+      CT                                   wakeup_;     //!< Wakeup of the worker threads.
+      CT                                   done_;       //!< Notification about finished workers.
+      Job*                                 job_;        //!< The currently active job.
+      size_t                               generation_; //!< The number of started jobs.
+      size_t                               active_;     //!< The number of busy worker threads.
+      bool                                 shutdown_;   //!< Termination flag of the worker threads.
+      //*******************************************************************************************
+   };
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   static inline Pool& pool();
+   static inline bool& nested() noexcept;
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the number of threads participating in a parallel loop.
+//
+// \return The number of threads (including the calling thread).
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+inline size_t WorkStealingScheduler<TT,MT,LT,CT>::size()
+{
+   return ThreadBackend<TT,MT,LT,CT>::size();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns whether the calling thread currently executes the body of a parallel loop.
+//
+// \return \a true in case the calling thread is executing a loop body, \a false if not.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+inline bool WorkStealingScheduler<TT,MT,LT,CT>::isNested() noexcept
+{
+   return nested();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the nesting flag of the calling thread.
+//
+// \return Reference to the nesting flag of the calling thread.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+inline bool& WorkStealingScheduler<TT,MT,LT,CT>::nested() noexcept
+{
+   static thread_local bool flag( false );
+   return flag;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the pool of worker threads.
+//
+// \return Reference to the pool of worker threads.
+//
+// The pool is created on first use. The worker threads are terminated at program exit.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+inline typename WorkStealingScheduler<TT,MT,LT,CT>::Pool& WorkStealingScheduler<TT,MT,LT,CT>::pool()
+{
+   static Pool instance;
+   return instance;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  THREAD EXECUTION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Parallel execution of the loop body for all indices in the range \f$ [begin..end) \f$.
+//
+// \param begin The first index of the range.
+// \param end The index one past the last index of the range.
+// \param grain The minimum number of indices that are processed as one chunk.
+// \param f The loop body, which is called once for every index.
+// \return void
+//
+// This function calls \a f once for every index in the range \f$ [begin..end) \f$ and blocks
+// until all indices have been processed. In case the function is called from within a loop
+// body or in case only a single thread is available, the loop is executed inline by the
+// calling thread. An exception thrown by the loop body is rethrown after the remaining chunks
+// have been skipped.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+template< typename F >   // Type of the loop body
+void WorkStealingScheduler<TT,MT,LT,CT>::parallelFor( size_t begin, size_t end, size_t grain,
+                                                     F&& f )
+{
+   using Body = std::remove_reference_t<F>;
+
+   if( begin >= end )
+      return;
+
+   const size_t threads( min( size(), end - begin ) );
+
+   if( nested() || threads <= 1UL ) {
+      for( size_t i=begin; i<end; ++i ) {
+         f( i );
+      }
+      return;
+   }
+
+   Job job;
+   job.invoke = []( void* body, size_t first, size_t last ) {
+      Body& func( *static_cast<Body*>( body ) );
+      for( size_t i=first; i<last; ++i ) {
+         func( i );
+      }
+   };
+   job.body  = const_cast<void*>( static_cast<const void*>( std::addressof( f ) ) );
+   job.grain = ( grain > 0UL )?( grain ):( 1UL );
+   job.remaining.store( end - begin );
+   job.failed.store( false );
+
+   Pool& p( pool() );
+
+   {
+      LT lock( p.runMutex_ );
+      p.resize( size() );
+      p.run( job, begin, end );
+   }
+
+   if( job.error ) {
+      std::rethrow_exception( job.error );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  POOL FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default constructor of the pool of worker threads.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+inline WorkStealingScheduler<TT,MT,LT,CT>::Pool::Pool()
+   : runMutex_  ()           // Serialization of the loops of different user threads
+   , slots_     ()           // The deques of all participating threads
+   , threads_   ()           // The worker threads
+   , mutex_     ()           // Synchronization of the job handover
+   , wakeup_    ()           // Wakeup of the worker threads
+   , done_      ()           // Notification about finished worker threads
+   , job_       ( nullptr )  // The currently active job
+   , generation_( 0UL )      // The number of started jobs
+   , active_    ( 0UL )      // The number of worker threads working on the active job
+   , shutdown_  ( false )    // Termination flag of the worker threads
+{}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Destructor of the pool of worker threads.
+//
+// The destructor terminates and joins all worker threads.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+inline WorkStealingScheduler<TT,MT,LT,CT>::Pool::~Pool()
+{
+   stop();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Adapts the pool to the given number of participating threads.
+//
+// \param n The number of participating threads (including the calling thread).
+// \return void
+//
+// This function must only be called while holding the run mutex.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+inline void WorkStealingScheduler<TT,MT,LT,CT>::Pool::resize( size_t n )
+{
+   if( n != slots_.size() ) {
+      stop();
+      start( n );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Starts the given number of participating threads.
+//
+// \param n The number of participating threads (including the calling thread).
+// \return void
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+inline void WorkStealingScheduler<TT,MT,LT,CT>::Pool::start( size_t n )
+{
+   BLAZE_INTERNAL_ASSERT( slots_.empty() && threads_.empty(), "Invalid pool state detected" );
+
+   shutdown_ = false;
+
+   for( size_t s=0UL; s<n; ++s ) {
+      slots_.push_back( std::make_unique<Slot>() );
+   }
+
+   for( size_t s=1UL; s<n; ++s ) {
+      threads_.push_back( std::make_unique<TT>( [this,s]() { workerMain( s ); } ) );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Terminates and joins all worker threads.
+//
+// \return void
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+inline void WorkStealingScheduler<TT,MT,LT,CT>::Pool::stop()
+{
+   {
+      LT lock( mutex_ );
+      shutdown_ = true;
+   }
+
+   wakeup_.notify_all();
+
+   for( auto& thread : threads_ ) {
+      thread->join();
+   }
+
+   threads_.clear();
+   slots_.clear();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Executes the given job with all participating threads.
+//
+// \param job The job to be executed.
+// \param begin The first index of the range.
+// \param end The index one past the last index of the range.
+// \return void
+//
+// The calling thread participates in the execution of the job via the first deque. The
+// function returns after all indices have been processed and all worker threads have
+// released the job.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+inline void WorkStealingScheduler<TT,MT,LT,CT>::Pool::run( Job& job, size_t begin, size_t end )
+{
+   push( 0UL, Range{ begin, end } );
+
+   {
+      LT lock( mutex_ );
+      job_ = &job;
+      ++generation_;
+   }
+
+   wakeup_.notify_all();
+
+   nested() = true;
+   work( 0UL, job );
+   nested() = false;
+
+   LT lock( mutex_ );
+   job_ = nullptr;
+
+   while( active_ != 0UL ) {
+      done_.wait( lock );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Main loop of a worker thread.
+//
+// \param slot The index of the deque of the worker thread.
+// \return void
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+inline void WorkStealingScheduler<TT,MT,LT,CT>::Pool::workerMain( size_t slot )
+{
+   nested() = true;
+
+   size_t seen( 0UL );
+
+   while( true )
+   {
+      Job* job( nullptr );
+
+      {
+         LT lock( mutex_ );
+
+         while( !shutdown_ && ( job_ == nullptr || generation_ == seen ) ) {
+            wakeup_.wait( lock );
+         }
+
+         if( shutdown_ )
+            return;
+
+         seen = generation_;
+         job  = job_;
+         ++active_;
+      }
+
+      work( slot, *job );
+
+      {
+         LT lock( mutex_ );
+         --active_;
+      }
+
+      done_.notify_all();
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Processes ranges of the given job until all indices have been processed.
+//
+// \param slot The index of the deque of the calling thread.
+// \param job The job to be processed.
+// \return void
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+inline void WorkStealingScheduler<TT,MT,LT,CT>::Pool::work( size_t slot, Job& job )
+{
+   Range range;
+
+   while( job.remaining.load() != 0UL )
+   {
+      if( pop( slot, range ) || steal( slot, range ) ) {
+         execute( slot, job, range );
+      }
+      else {
+         std::this_thread::yield();
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Processes the given range with recursive splitting.
+//
+// \param slot The index of the deque of the calling thread.
+// \param job The job the range belongs to.
+// \param range The range to be processed.
+// \return void
+//
+// The range is halved until it contains at most \a grain indices. The upper halves are pushed
+// to the deque of the calling thread, where idle threads can steal them (and split them again).
+// Thus the largest pieces are stolen first and the splitting adapts to the actual load of the
+// threads.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+inline void WorkStealingScheduler<TT,MT,LT,CT>::Pool::execute( size_t slot, Job& job, Range range )
+{
+   while( range.end - range.begin > job.grain ) {
+      const size_t middle( range.begin + ( range.end - range.begin )/2UL );
+      push( slot, Range{ middle, range.end } );
+      range.end = middle;
+   }
+
+   if( !job.failed.load() ) {
+      try {
+         job.invoke( job.body, range.begin, range.end );
+      }
+      catch( ... ) {
+         LT lock( mutex_ );
+         if( !job.failed.exchange( true ) ) {
+            job.error = std::current_exception();
+         }
+      }
+   }
+
+   job.remaining.fetch_sub( range.end - range.begin );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Takes the most recently pushed range from the deque of the calling thread.
+//
+// \param slot The index of the deque of the calling thread.
+// \param range The taken range.
+// \return \a true in case a range has been taken, \a false if the deque is empty.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+inline bool WorkStealingScheduler<TT,MT,LT,CT>::Pool::pop( size_t slot, Range& range )
+{
+   Slot& own( *slots_[slot] );
+   LT lock( own.mutex );
+
+   if( own.tasks.empty() )
+      return false;
+
+   range = own.tasks.back();
+   own.tasks.pop_back();
+   return true;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Steals the oldest range from the deque of another thread.
+//
+// \param slot The index of the deque of the calling thread.
+// \param range The stolen range.
+// \return \a true in case a range has been stolen, \a false if all deques are empty.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+inline bool WorkStealingScheduler<TT,MT,LT,CT>::Pool::steal( size_t slot, Range& range )
+{
+   const size_t n( slots_.size() );
+
+   for( size_t offset=1UL; offset<n; ++offset )
+   {
+      Slot& victim( *slots_[( slot + offset ) % n] );
+      LT lock( victim.mutex );
+
+      if( !victim.tasks.empty() ) {
+         range = victim.tasks.front();
+         victim.tasks.pop_front();
+         return true;
+      }
+   }
+
+   return false;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Pushes a range to the deque of the calling thread.
+//
+// \param slot The index of the deque of the calling thread.
+// \param range The range to be pushed.
+// \return void
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+inline void WorkStealingScheduler<TT,MT,LT,CT>::Pool::push( size_t slot, const Range& range )
+{
+   Slot& own( *slots_[slot] );
+   LT lock( own.mutex );
+   own.tasks.push_back( range );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TYPE DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief The type of the active work-stealing scheduler.
+// \ingroup smp
+*/
+#if BLAZE_CPP_THREADS_PARALLEL_MODE
+using TheWorkStealingScheduler = WorkStealingScheduler< std::thread
+                                                      , std::mutex
+                                                      , std::unique_lock< std::mutex >
+                                                      , std::condition_variable
+                                                      >;
+#elif BLAZE_BOOST_THREADS_PARALLEL_MODE
+using TheWorkStealingScheduler = WorkStealingScheduler< boost::thread
+                                                      , boost::mutex
+                                                      , boost::unique_lock< boost::mutex >
+                                                      , boost::condition_variable
+                                                      >;
+#endif
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
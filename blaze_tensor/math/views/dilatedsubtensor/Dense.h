@@ -2112,7 +2112,7 @@ template< typename TT       // Type of the dense tensor
         , size_t... CSAs >  // Compile time DilatedSubtensor arguments
 inline bool DilatedSubtensor<TT,true,CSAs...>::canSMPAssign() const noexcept
 {
-   return ( pages() * rows() * columns() >= SMP_DTENSASSIGN_THRESHOLD );
+   return ( pages() * rows() * columns() >= smpDTensAssignThreshold() );
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -97,6 +97,7 @@
 #include <blaze_tensor/math/traits/QuatSliceTrait.h>
 #include <blaze_tensor/math/views/quatslice/BaseTemplate.h>
 #include <blaze_tensor/math/views/quatslice/QuatSliceData.h>
+#include <blaze_tensor/system/Thresholds.h>
 
 
 namespace blaze {
@@ -1481,7 +1482,7 @@ template< typename AT       // Type of the dense quaternion
         , size_t... CRAs >  // Compile time quatslice arguments
 inline bool QuatSlice<AT,CRAs...>::canSMPAssign() const noexcept
 {
-   return ( pages() * rows() * columns() > SMP_DMATASSIGN_THRESHOLD );
+   return ( pages() * rows() * columns() > smpDTensAssignThreshold() );
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -94,6 +94,7 @@
 #include <blaze_tensor/math/traits/SubtensorTrait.h>
 #include <blaze_tensor/math/views/subtensor/BaseTemplate.h>
 #include <blaze_tensor/math/views/subtensor/SubtensorData.h>
+#include <blaze_tensor/system/Thresholds.h>
 
 namespace blaze {
 
@@ -2328,7 +2329,7 @@ template< typename MT       // Type of the dense tensor
         , size_t... CSAs >  // Compile time subtensor arguments
 inline bool Subtensor<MT,unaligned,CSAs...>::canSMPAssign() const noexcept
 {
-   return ( rows() * columns() * pages() >= SMP_DMATASSIGN_THRESHOLD );
+   return ( rows() * columns() * pages() >= smpDTensAssignThreshold() );
 }
 /*! \endcond */
 //*************************************************************************************************
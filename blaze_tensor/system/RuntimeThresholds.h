@@ -0,0 +1,350 @@
+//=================================================================================================
+/*!
+//  \file blaze_tensor/system/RuntimeThresholds.h
+//  \brief Header file for the runtime tensor thresholds
+//
+//  Copyright (C) 2012-2018 Klaus Iglberger - All Rights Reserved
+//  Copyright (C) 2018 Hartmut Kaiser - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+
+#ifndef _BLAZE_TENSOR_SYSTEM_RUNTIMETHRESHOLDS_H_
+#define _BLAZE_TENSOR_SYSTEM_RUNTIMETHRESHOLDS_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <atomic>
+#include <cstdlib>
+#include <fstream>
+#include <ostream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+#include <blaze/util/Exception.h>
+#include <blaze/util/Types.h>
+
+#include <blaze_tensor/system/Thresholds.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  TUNABLE THRESHOLDS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The set of tunable tensor thresholds.
+// \ingroup config
+//
+// The members correspond to the BLAZE_DTENSDVECMULT_THRESHOLD, BLAZE_SMP_DTENSASSIGN_THRESHOLD,
+// BLAZE_SMP_DTENSDVECMULT_THRESHOLD, BLAZE_SMP_DTENSDMATSCHUR_THRESHOLD and
+// BLAZE_SMP_DARRASSIGN_THRESHOLD settings.
+*/
+struct TensorThresholds
+{
+   size_t dtensdvecmult;      //!< Threshold between the Blaze and BLAS tensor/vector products.
+   size_t smpDTensAssign;     //!< Threshold for the parallel assignment of dense tensors.
+   size_t smpDTensDVecMult;   //!< Threshold for the parallel tensor/vector product.
+   size_t smpDTensDMatSchur;  //!< Threshold for the parallel tensor/matrix Schur product.
+   size_t smpDArrAssign;      //!< Threshold for the parallel assignment of dense arrays.
+};
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the compile time tensor thresholds.
+// \ingroup config
+//
+// \return The compile time tensor thresholds.
+*/
+inline TensorThresholds defaultTensorThresholds() noexcept
+{
+   return { DTENSDVECMULT_THRESHOLD, SMP_DTENSASSIGN_THRESHOLD,
+            SMP_DTENSDVECMULT_THRESHOLD, SMP_DTENSDMATSCHUR_THRESHOLD,
+            SMP_DARRASSIGN_THRESHOLD };
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reads tensor thresholds from a thresholds header file.
+// \ingroup config
+//
+// \param file The name of the thresholds file.
+// \param thresholds The thresholds to be updated.
+// \return \a true if the file could be read, \a false if not.
+// \exception std::invalid_argument Invalid threshold value.
+//
+// The function updates all thresholds that are defined in the given file by means of lines of
+// the form <tt>\#define BLAZE_SMP_DTENSASSIGN_THRESHOLD 65536UL</tt> (as written by
+// writeTensorThresholds() and the \c blazemark_thresholds tool). All other lines are ignored.
+*/
+inline bool readTensorThresholds( const std::string& file, TensorThresholds& thresholds )
+{
+   std::ifstream in( file );
+
+   if( !in ) return false;
+
+   std::string line;
+
+   while( std::getline( in, line ) )
+   {
+      std::istringstream iss( line );
+      std::string directive, name, value;
+
+      if( !( iss >> directive >> name >> value ) || directive != "#define" )
+         continue;
+
+      size_t* threshold( name == "BLAZE_DTENSDVECMULT_THRESHOLD"      ? &thresholds.dtensdvecmult
+                       : name == "BLAZE_SMP_DTENSASSIGN_THRESHOLD"    ? &thresholds.smpDTensAssign
+                       : name == "BLAZE_SMP_DTENSDVECMULT_THRESHOLD"  ? &thresholds.smpDTensDVecMult
+                       : name == "BLAZE_SMP_DTENSDMATSCHUR_THRESHOLD" ? &thresholds.smpDTensDMatSchur
+                       : name == "BLAZE_SMP_DARRASSIGN_THRESHOLD"     ? &thresholds.smpDArrAssign
+                       : nullptr );
+
+      if( threshold == nullptr )
+         continue;
+
+      try {
+         *threshold = std::stoul( value );
+      }
+      catch( std::exception& ) {
+         BLAZE_THROW_INVALID_ARGUMENT( "Invalid threshold value" );
+      }
+   }
+
+   return true;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Writes tensor thresholds as preprocessor definitions.
+// \ingroup config
+//
+// \param os The output stream.
+// \param thresholds The thresholds to be written.
+// \return void
+//
+// The definitions are guarded by \c \#ifndef, i.e. the written header can be included before
+// any Blaze header file and can be read by readTensorThresholds().
+*/
+inline void writeTensorThresholds( std::ostream& os, const TensorThresholds& thresholds )
+{
+   const std::pair<const char*,size_t> settings[] = {
+      { "BLAZE_DTENSDVECMULT_THRESHOLD"     , thresholds.dtensdvecmult     },
+      { "BLAZE_SMP_DTENSASSIGN_THRESHOLD"   , thresholds.smpDTensAssign    },
+      { "BLAZE_SMP_DTENSDVECMULT_THRESHOLD" , thresholds.smpDTensDVecMult  },
+      { "BLAZE_SMP_DTENSDMATSCHUR_THRESHOLD", thresholds.smpDTensDMatSchur },
+      { "BLAZE_SMP_DARRASSIGN_THRESHOLD"    , thresholds.smpDArrAssign     }
+   };
+
+   for( const auto& setting : settings ) {
+      os << "#ifndef " << setting.first << "\n"
+         << "#define " << setting.first << " " << setting.second << "UL\n"
+         << "#endif\n";
+   }
+}
+//*************************************************************************************************
+
+
+
+
+#if BLAZE_USE_RUNTIME_THRESHOLDS
+//=================================================================================================
+//
+//  RUNTIME THRESHOLDS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Storage of the runtime tensor thresholds.
+// \ingroup config
+//
+// The thresholds are initialized with the compile time values and, if the environment variable
+// \c BLAZE_TENSOR_THRESHOLDS names a readable thresholds file, with the values of this file.
+*/
+struct RuntimeThresholds
+{
+   //**Constructor*********************************************************************************
+   RuntimeThresholds() {
+      TensorThresholds thresholds( defaultTensorThresholds() );
+      const char* file( std::getenv( "BLAZE_TENSOR_THRESHOLDS" ) );
+      if( file != nullptr ) {
+         try {
+            readTensorThresholds( file, thresholds );
+         }
+         catch( std::exception& ) {
+            thresholds = defaultTensorThresholds();
+         }
+      }
+      store( thresholds );
+   }
+   //**********************************************************************************************
+
+   //**Store function******************************************************************************
+   void store( const TensorThresholds& thresholds ) noexcept {
+      dtensdvecmult    .store( thresholds.dtensdvecmult    , std::memory_order_relaxed );
+      smpDTensAssign   .store( thresholds.smpDTensAssign   , std::memory_order_relaxed );
+      smpDTensDVecMult .store( thresholds.smpDTensDVecMult , std::memory_order_relaxed );
+      smpDTensDMatSchur.store( thresholds.smpDTensDMatSchur, std::memory_order_relaxed );
+      smpDArrAssign    .store( thresholds.smpDArrAssign    , std::memory_order_relaxed );
+   }
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   std::atomic<size_t> dtensdvecmult;      //!< Threshold between the Blaze and BLAS tensor/vector products.
+   std::atomic<size_t> smpDTensAssign;     //!< Threshold for the parallel assignment of dense tensors.
+   std::atomic<size_t> smpDTensDVecMult;   //!< Threshold for the parallel tensor/vector product.
+   std::atomic<size_t> smpDTensDMatSchur;  //!< Threshold for the parallel tensor/matrix Schur product.
+   std::atomic<size_t> smpDArrAssign;      //!< Threshold for the parallel assignment of dense arrays.
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the storage of the runtime tensor thresholds.
+// \ingroup config
+*/
+inline RuntimeThresholds& runtimeThresholds()
+{
+   static RuntimeThresholds thresholds;
+   return thresholds;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the active runtime tensor thresholds.
+// \ingroup config
+//
+// \return The active tensor thresholds.
+*/
+inline TensorThresholds tensorThresholds()
+{
+   const RuntimeThresholds& thresholds( runtimeThresholds() );
+
+   return { thresholds.dtensdvecmult    .load( std::memory_order_relaxed ),
+            thresholds.smpDTensAssign   .load( std::memory_order_relaxed ),
+            thresholds.smpDTensDVecMult .load( std::memory_order_relaxed ),
+            thresholds.smpDTensDMatSchur.load( std::memory_order_relaxed ),
+            thresholds.smpDArrAssign    .load( std::memory_order_relaxed ) };
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Sets the runtime tensor thresholds.
+// \ingroup config
+//
+// \param thresholds The new tensor thresholds.
+// \return void
+//
+// The thresholds should be set before any parallel computation is started; computations that
+// are already running may still use the previous values.
+*/
+inline void setTensorThresholds( const TensorThresholds& thresholds )
+{
+   runtimeThresholds().store( thresholds );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Loads the runtime tensor thresholds from a thresholds header file.
+// \ingroup config
+//
+// \param file The name of the thresholds file.
+// \return void
+// \exception std::invalid_argument Cannot read thresholds file.
+// \exception std::invalid_argument Invalid threshold value.
+//
+// Thresholds that are not defined in the file keep their current value.
+
+   \code
+   // Startup of an application compiled with BLAZE_USE_RUNTIME_THRESHOLDS=1
+   blaze::loadTensorThresholds( "Thresholds.h" );  // As written by blazemark_thresholds
+   \endcode
+*/
+inline void loadTensorThresholds( const std::string& file )
+{
+   TensorThresholds thresholds( tensorThresholds() );
+
+   if( !readTensorThresholds( file, thresholds ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Cannot read thresholds file" );
+   }
+
+   setTensorThresholds( thresholds );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the active tensor thresholds.
+// \ingroup config
+//
+// Runtime counterparts of the compile time accessors in <blaze_tensor/system/Thresholds.h>.
+*/
+inline size_t dtensDVecMultThreshold() noexcept {
+   return runtimeThresholds().dtensdvecmult.load( std::memory_order_relaxed );
+}
+
+inline size_t smpDTensAssignThreshold() noexcept {
+   return runtimeThresholds().smpDTensAssign.load( std::memory_order_relaxed );
+}
+
+inline size_t smpDTensDVecMultThreshold() noexcept {
+   return runtimeThresholds().smpDTensDVecMult.load( std::memory_order_relaxed );
+}
+
+inline size_t smpDTensDMatSchurThreshold() noexcept {
+   return runtimeThresholds().smpDTensDMatSchur.load( std::memory_order_relaxed );
+}
+
+inline size_t smpDArrAssignThreshold() noexcept {
+   return runtimeThresholds().smpDArrAssign.load( std::memory_order_relaxed );
+}
+/*! \endcond */
+//*************************************************************************************************
+#endif
+
+} // namespace blaze
+
+#endif
@@ -112,6 +112,20 @@ constexpr size_t SMP_DTENSASSIGN_DEBUG_THRESHOLD = 256UL;
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief SMP dense array assignment threshold.
+// \ingroup config
+//
+// This debug value is used instead of the BLAZE_SMP_DARRASSIGN_THRESHOLD while the Blaze
+// debug mode is active. It specifies when an assignment with a simple dense array can be executed
+// in parallel. In case the number of elements of the target array is larger or equal to this
+// threshold, the operation is executed in parallel. If the number of elements is below this
+// threshold the operation is executed single-threaded.
+*/
+constexpr size_t SMP_DARRASSIGN_DEBUG_THRESHOLD = 256UL;
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief SMP row-major dense matrix/dense vector multiplication threshold.
 // \ingroup config
@@ -144,11 +158,69 @@ constexpr size_t SMP_DTENSDMATSCHUR_DEBUG_THRESHOLD = 256UL;
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
 constexpr size_t SMP_DTENSASSIGN_THRESHOLD    = ( BLAZE_DEBUG_MODE ? SMP_DTENSASSIGN_DEBUG_THRESHOLD    : BLAZE_SMP_DTENSASSIGN_THRESHOLD     );
+constexpr size_t SMP_DARRASSIGN_THRESHOLD     = ( BLAZE_DEBUG_MODE ? SMP_DARRASSIGN_DEBUG_THRESHOLD     : BLAZE_SMP_DARRASSIGN_THRESHOLD      );
 constexpr size_t SMP_DTENSDMATSCHUR_THRESHOLD = ( BLAZE_DEBUG_MODE ? SMP_DTENSDMATSCHUR_DEBUG_THRESHOLD : BLAZE_SMP_DTENSDMATSCHUR_THRESHOLD  );
 constexpr size_t SMP_DTENSDVECMULT_THRESHOLD  = ( BLAZE_DEBUG_MODE ? SMP_DTENSDVECMULT_DEBUG_THRESHOLD  : BLAZE_SMP_DTENSDVECMULT_THRESHOLD  );
 /*! \endcond */
 //*************************************************************************************************
 
+
+
+//=================================================================================================
+//
+//  BATCHED LINEAR ALGEBRA THRESHOLDS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Batched dense tensor decomposition threshold.
+// \ingroup config
+//
+// This debug value is used instead of the BLAZE_BATCHED_DECOMPOSITION_THRESHOLD while the Blaze
+// debug mode is active. It specifies the threshold between the application of the interleaved
+// Blaze kernels and the per-page LAPACK kernels for the batched decomposition, inversion and
+// solution functions of dense tensors. In case the order of the pages of the tensor is smaller
+// than this value, the interleaved Blaze kernels are used. In case the order of the pages is
+// equal or higher, the LAPACK kernels are preferred.
+*/
+constexpr size_t BATCHED_DECOMPOSITION_DEBUG_THRESHOLD = 4UL;
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+constexpr size_t BATCHED_DECOMPOSITION_THRESHOLD = ( BLAZE_DEBUG_MODE ? BATCHED_DECOMPOSITION_DEBUG_THRESHOLD : BLAZE_BATCHED_DECOMPOSITION_THRESHOLD );
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  THRESHOLD ACCESS
+//
+//=================================================================================================
+
+#if !BLAZE_USE_RUNTIME_THRESHOLDS
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the active tensor thresholds.
+// \ingroup config
+//
+// The kernels query the tunable tensor thresholds by means of these functions. Without runtime
+// thresholds (see BLAZE_USE_RUNTIME_THRESHOLDS) they return the compile time constants; with
+// runtime thresholds they are defined in <blaze_tensor/system/RuntimeThresholds.h>.
+*/
+constexpr size_t dtensDVecMultThreshold    () noexcept { return DTENSDVECMULT_THRESHOLD;      }
+constexpr size_t smpDTensAssignThreshold   () noexcept { return SMP_DTENSASSIGN_THRESHOLD;    }
+constexpr size_t smpDArrAssignThreshold    () noexcept { return SMP_DARRASSIGN_THRESHOLD;     }
+constexpr size_t smpDTensDVecMultThreshold () noexcept { return SMP_DTENSDVECMULT_THRESHOLD;  }
+constexpr size_t smpDTensDMatSchurThreshold() noexcept { return SMP_DTENSDMATSCHUR_THRESHOLD; }
+/*! \endcond */
+//*************************************************************************************************
+#endif
+
 } // namespace blaze
 
 
@@ -167,11 +239,27 @@ namespace {
 BLAZE_STATIC_ASSERT( blaze::DTENSDVECMULT_THRESHOLD  > 0UL );
 
 BLAZE_STATIC_ASSERT( blaze::SMP_DTENSASSIGN_THRESHOLD    >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_DARRASSIGN_THRESHOLD     >= 0UL );
 BLAZE_STATIC_ASSERT( blaze::SMP_DTENSDMATSCHUR_THRESHOLD >= 0UL );
 BLAZE_STATIC_ASSERT( blaze::SMP_DTENSDVECMULT_THRESHOLD  >= 0UL );
 
+BLAZE_STATIC_ASSERT( blaze::BATCHED_DECOMPOSITION_THRESHOLD > 0UL );
+
 }
 /*! \endcond */
 //*************************************************************************************************
 
+
+
+
+//=================================================================================================
+//
+//  RUNTIME THRESHOLDS
+//
+//=================================================================================================
+
+#if BLAZE_USE_RUNTIME_THRESHOLDS
+#  include <blaze_tensor/system/RuntimeThresholds.h>
+#endif
+
 #endif
@@ -0,0 +1,355 @@
+//=================================================================================================
+/*!
+//  \file blaze_tensor/util/HalfPrecision.h
+//  \brief Header file for the half-width float16 and bfloat16 storage types
+//
+//  Copyright (C) 2012-2018 Klaus Iglberger - All Rights Reserved
+//  Copyright (C) 2018 Hartmut Kaiser - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+
+#ifndef _BLAZE_TENSOR_UTIL_HALFPRECISION_H_
+#define _BLAZE_TENSOR_UTIL_HALFPRECISION_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdint>
+#include <cstring>
+#include <ostream>
+
+#include <blaze/system/Inline.h>
+#include <blaze/system/Vectorization.h>
+
+#if defined(__F16C__)
+#  include <immintrin.h>
+#endif
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  SCALAR CONVERSION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the bit pattern of the given single precision value.
+// \ingroup util
+*/
+BLAZE_ALWAYS_INLINE uint32_t floatBits( float value ) noexcept
+{
+   uint32_t bits;
+   std::memcpy( &bits, &value, sizeof( bits ) );
+   return bits;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the single precision value of the given bit pattern.
+// \ingroup util
+*/
+BLAZE_ALWAYS_INLINE float bitsFloat( uint32_t bits ) noexcept
+{
+   float value;
+   std::memcpy( &value, &bits, sizeof( value ) );
+   return value;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Rounds the given single precision value to IEEE 754 binary16 (round to nearest even).
+// \ingroup util
+//
+// \param value The single precision value.
+// \return The binary16 bit pattern.
+//
+// Overflows result in infinity, NaNs are converted to quiet NaNs and values below the smallest
+// normal binary16 number are rounded to subnormals.
+*/
+inline uint16_t toFloat16Bits( float value ) noexcept
+{
+#if defined(__F16C__)
+   return static_cast<uint16_t>( _cvtss_sh( value, _MM_FROUND_TO_NEAREST_INT ) );
+#else
+   uint32_t bits( floatBits( value ) );
+
+   const uint32_t sign( bits & 0x80000000U );
+   bits ^= sign;
+
+   uint16_t result;
+
+   if( bits >= 0x47800000U ) {        // Infinity or NaN (magnitude >= 65536)
+      result = ( bits > 0x7F800000U ) ? 0x7E00U : 0x7C00U;
+   }
+   else if( bits < 0x38800000U ) {    // Subnormal or zero (magnitude < 2^-14)
+      // Aligning the ten mantissa bits at the bottom by means of a rounding addition
+      const uint32_t magic( 0x3F000000U );  // 0.5f
+      result = static_cast<uint16_t>( floatBits( bitsFloat( bits ) + bitsFloat( magic ) ) - magic );
+   }
+   else {
+      const uint32_t odd( ( bits >> 13 ) & 1U );
+      bits += 0xC8000FFFU + odd;      // Rebiasing the exponent ((15-127) << 23) and rounding
+      result = static_cast<uint16_t>( bits >> 13 );
+   }
+
+   return static_cast<uint16_t>( result | ( sign >> 16 ) );
+#endif
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Converts the given IEEE 754 binary16 bit pattern to single precision.
+// \ingroup util
+//
+// \param bits The binary16 bit pattern.
+// \return The (exactly representable) single precision value.
+*/
+inline float fromFloat16Bits( uint16_t bits ) noexcept
+{
+#if defined(__F16C__)
+   return _cvtsh_ss( bits );
+#else
+   const uint32_t shiftedExp( 0x7C00U << 13 );
+
+   uint32_t result( ( bits & 0x7FFFU ) << 13 );
+   const uint32_t exp( result & shiftedExp );
+
+   result += ( 127U - 15U ) << 23;
+
+   if( exp == shiftedExp ) {          // Infinity or NaN
+      result += ( 128U - 16U ) << 23;
+   }
+   else if( exp == 0U ) {             // Zero or subnormal
+      result += 1U << 23;
+      result = floatBits( bitsFloat( result ) - bitsFloat( 113U << 23 ) );
+   }
+
+   return bitsFloat( result | ( uint32_t( bits & 0x8000U ) << 16 ) );
+#endif
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Rounds the given single precision value to bfloat16 (round to nearest even).
+// \ingroup util
+//
+// \param value The single precision value.
+// \return The bfloat16 bit pattern.
+*/
+inline uint16_t toBFloat16Bits( float value ) noexcept
+{
+   const uint32_t bits( floatBits( value ) );
+
+   if( ( bits & 0x7FFFFFFFU ) > 0x7F800000U ) {  // NaN
+      return static_cast<uint16_t>( ( bits >> 16 ) | 0x0040U );
+   }
+
+   return static_cast<uint16_t>( ( bits + 0x7FFFU + ( ( bits >> 16 ) & 1U ) ) >> 16 );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Converts the given bfloat16 bit pattern to single precision.
+// \ingroup util
+//
+// \param bits The bfloat16 bit pattern.
+// \return The (exactly representable) single precision value.
+*/
+BLAZE_ALWAYS_INLINE float fromBFloat16Bits( uint16_t bits ) noexcept
+{
+   return bitsFloat( uint32_t( bits ) << 16 );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CLASS TEMPLATE HALFFLOAT
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Half-width floating point storage type.
+// \ingroup util
+//
+// The HalfFloat class template stores a floating point value in 16 bits and computes in single
+// precision: it converts implicitly from and to \c float, i.e. all arithmetic is performed in
+// single precision and the result is rounded to 16 bits (round to nearest even) on assignment.
+// Two formats are available:
+//
+//  - blaze::float16: IEEE 754 binary16 (5 exponent bits, 10 mantissa bits)
+//  - blaze::bfloat16: brain floating point (8 exponent bits, 7 mantissa bits)
+//
+// Both types can be used as element types of all dense tensors and arrays. This halves memory
+// footprint and memory traffic, e.g. of stored activations:
+
+   \code
+   blaze::DynamicTensor<blaze::bfloat16> A( 64UL, 128UL, 128UL );
+   blaze::DynamicTensor<float> B( 64UL, 128UL, 128UL );
+
+   convert( A, B );                    // SIMD rounding of all elements to bfloat16
+   convert( B, A );                    // SIMD widening of all elements to single precision
+   const float x = A(0,0,0) * 2.0F;    // Scalar computations in single precision
+   \endcode
+
+// Since the SIMD types of Blaze are tied to the element type, expressions on half-width tensors
+// are not vectorized. Bandwidth-bound kernels should therefore convert blocks of pages to single
+// precision by means of the SIMD kernels of convert() (F16C, AVX-512 and AVX2 conversions).
+*/
+template< bool BF >  // Flag for the bfloat16 format
+class HalfFloat
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   constexpr HalfFloat() noexcept : bits_( 0U ) {}
+
+   HalfFloat( float value ) noexcept
+      : bits_( BF ? toBFloat16Bits( value ) : toFloat16Bits( value ) )  // The bit pattern
+   {}
+   //@}
+   //**********************************************************************************************
+
+   //**Conversion operators************************************************************************
+   /*!\name Conversion operators */
+   //@{
+   operator float() const noexcept {
+      return BF ? fromBFloat16Bits( bits_ ) : fromFloat16Bits( bits_ );
+   }
+   //@}
+   //**********************************************************************************************
+
+   //**Assignment operators************************************************************************
+   /*!\name Assignment operators */
+   //@{
+   HalfFloat& operator+=( float rhs ) noexcept { return *this = float( *this ) + rhs; }
+   HalfFloat& operator-=( float rhs ) noexcept { return *this = float( *this ) - rhs; }
+   HalfFloat& operator*=( float rhs ) noexcept { return *this = float( *this ) * rhs; }
+   HalfFloat& operator/=( float rhs ) noexcept { return *this = float( *this ) / rhs; }
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   constexpr uint16_t bits() const noexcept { return bits_; }
+
+   static constexpr HalfFloat fromBits( uint16_t bits ) noexcept {
+      return HalfFloat( bits, 0 );
+   }
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Constructors********************************************************************************
+   constexpr HalfFloat( uint16_t bits, int ) noexcept : bits_( bits ) {}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   uint16_t bits_;  //!< The bit pattern of the value.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Global output operator for half-width floating point values.
+// \ingroup util
+//
+// \param os Reference to the output stream.
+// \param value The half-width floating point value.
+// \return Reference to the output stream.
+*/
+template< bool BF >  // Flag for the bfloat16 format
+inline std::ostream& operator<<( std::ostream& os, HalfFloat<BF> value )
+{
+   return os << float( value );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TYPE DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief IEEE 754 binary16 storage type.
+// \ingroup util
+*/
+using float16 = HalfFloat<false>;
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Brain floating point (bfloat16) storage type.
+// \ingroup util
+*/
+using bfloat16 = HalfFloat<true>;
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
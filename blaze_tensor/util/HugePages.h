@@ -0,0 +1,320 @@
+//=================================================================================================
+/*!
+//  \file blaze_tensor/util/HugePages.h
+//  \brief Header file for the huge page backed storage of dense tensors and arrays
+//
+//  Copyright (C) 2012-2018 Klaus Iglberger - All Rights Reserved
+//  Copyright (C) 2018 Hartmut Kaiser - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+
+#ifndef _BLAZE_TENSOR_UTIL_HUGEPAGES_H_
+#define _BLAZE_TENSOR_UTIL_HUGEPAGES_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/util/Types.h>
+
+#if defined(__linux__)
+#  include <sys/mman.h>
+#  include <unistd.h>
+#endif
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  HUGE PAGE CONFIGURATION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The size of a huge page in bytes (2 MiB).
+// \ingroup util
+*/
+constexpr size_t hugePageSize = 2UL*1024UL*1024UL;
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns whether huge page backed storage is requested on the calling thread.
+// \ingroup util
+//
+// \return Reference to the huge page setting of the calling thread.
+*/
+inline bool& activeHugePages() noexcept
+{
+   static thread_local bool enabled( false );
+   return enabled;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CLASS HUGEPAGESCOPE
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief RAII activation of huge page backed storage on the calling thread.
+// \ingroup util
+//
+// While a HugePageScope is active, the storage of all dynamic tensors and arrays of at least
+// 2 MiB that are allocated on the calling thread (including expression temporaries) is mapped
+// on 2 MiB boundaries and backed by huge pages. Explicitly reserved huge pages (\c MAP_HUGETLB)
+// are used if available, otherwise transparent huge pages are requested via \c madvise(). This
+// reduces the number of TLB misses of strided kernels (e.g. column slices, transpositions and
+// pagewise reductions) on large tensors:
+
+   \code
+   blaze::DynamicTensor<double> A;
+
+   {
+      blaze::HugePageScope scope;
+      A.resize( 256UL, 1024UL, 1024UL );  // 2 GiB backed by 1024 huge pages
+   }
+
+   const blaze::DynamicMatrix<double> S( sum<blaze::pagewise>( A ) );
+   \endcode
+
+// Scopes can be nested; the previous setting is restored when a scope ends. Storage taken from
+// an active TensorArena is not affected. On non-Linux systems and in case the mapping fails,
+// the storage is allocated on the heap as usual.
+*/
+class HugePageScope
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit inline HugePageScope( bool enable = true ) noexcept;
+
+   HugePageScope( const HugePageScope& ) = delete;
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   /*!\name Destructor */
+   //@{
+   inline ~HugePageScope();
+   //@}
+   //**********************************************************************************************
+
+   //**Assignment operators************************************************************************
+   /*!\name Assignment operators */
+   //@{
+   HugePageScope& operator=( const HugePageScope& ) = delete;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   bool previous_;  //!< The previous huge page setting.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Activates (or deactivates) huge page backed storage on the calling thread.
+//
+// \param enable \a true to request huge page backed storage, \a false to disable it.
+*/
+inline HugePageScope::HugePageScope( bool enable ) noexcept
+   : previous_( activeHugePages() )  // The previous huge page setting
+{
+   activeHugePages() = enable;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief The destructor for HugePageScope.
+//
+// The destructor restores the previous huge page setting.
+*/
+inline HugePageScope::~HugePageScope()
+{
+   activeHugePages() = previous_;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  HUGE PAGE MAPPING FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the size of an ordinary memory page in bytes.
+// \ingroup util
+//
+// \return The size of an ordinary memory page.
+*/
+inline size_t smallPageSize() noexcept
+{
+#if defined(__linux__)
+   static const size_t size( static_cast<size_t>( ::sysconf( _SC_PAGESIZE ) ) );
+   return size;
+#else
+   return 4096UL;
+#endif
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Maps a huge page backed, 2 MiB aligned memory block.
+// \ingroup util
+//
+// \param bytes The minimum size of the block in bytes.
+// \param mapped The size of the block in bytes (output parameter).
+// \return The first byte of the block (\c nullptr in case the mapping failed).
+//
+// The block is preceded by one ordinary memory page, which is mapped along with the block and
+// can be used for bookkeeping information. This function first cuts out a 2 MiB aligned range
+// of an anonymous mapping. It then tries to replace the range by explicitly reserved huge pages
+// (\c MAP_HUGETLB). In case no such pages are available, the range is marked for transparent
+// huge pages (\c MADV_HUGEPAGE). The block has to be released by means of hugePageUnmap().
+*/
+inline void* hugePageMap( size_t bytes, size_t& mapped ) noexcept
+{
+   mapped = 0UL;
+
+#if defined(__linux__)
+   const size_t page ( smallPageSize() );
+   const size_t size ( ( bytes + hugePageSize - 1UL ) & ~( hugePageSize - 1UL ) );
+   const size_t total( page + size + hugePageSize );
+
+   // Over-allocating by one huge page in order to cut out an aligned range
+   char* const raw( static_cast<char*>( ::mmap( nullptr, total, PROT_READ | PROT_WRITE,
+                                                MAP_PRIVATE | MAP_ANONYMOUS, -1, 0 ) ) );
+
+   if( raw == MAP_FAILED )
+      return nullptr;
+
+   const size_t address( reinterpret_cast<size_t>( raw ) + page );
+   const size_t shift  ( ( hugePageSize - ( address & ( hugePageSize - 1UL ) ) ) & ( hugePageSize - 1UL ) );
+   char* const  aligned( raw + page + shift );
+
+   if( aligned - page != raw ) {
+      ::munmap( raw, ( aligned - page ) - raw );
+   }
+   if( aligned + size != raw + total ) {
+      ::munmap( aligned + size, ( raw + total ) - ( aligned + size ) );
+   }
+
+   bool reserved( false );
+
+#if defined(MAP_HUGETLB)
+   // Replacing the aligned range by explicitly reserved huge pages (if available)
+   ::munmap( aligned, size );
+
+   void* block( ::mmap( aligned, size, PROT_READ | PROT_WRITE,
+                        MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0 ) );
+   reserved = ( block == aligned );
+
+   if( !reserved )
+   {
+      if( block != MAP_FAILED ) {
+         ::munmap( block, size );
+      }
+
+      block = ::mmap( aligned, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0 );
+
+      if( block != aligned ) {
+         if( block != MAP_FAILED ) {
+            ::munmap( block, size );
+         }
+         ::munmap( aligned - page, page );
+         return nullptr;
+      }
+   }
+#endif
+
+#if defined(MADV_HUGEPAGE)
+   if( !reserved ) {
+      ::madvise( aligned, size, MADV_HUGEPAGE );
+   }
+#endif
+
+   mapped = size;
+   return aligned;
+#else
+   static_cast<void>( bytes );
+   return nullptr;
+#endif
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Releases a block mapped by hugePageMap().
+// \ingroup util
+//
+// \param block The first byte of the block.
+// \param mapped The size of the block in bytes.
+// \return void
+//
+// Both the block and the preceding ordinary memory page are unmapped.
+*/
+inline void hugePageUnmap( void* block, size_t mapped ) noexcept
+{
+#if defined(__linux__)
+   const size_t page( smallPageSize() );
+   ::munmap( static_cast<char*>( block ) - page, page + mapped );
+#else
+   static_cast<void>( block );
+   static_cast<void>( mapped );
+#endif
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,586 @@
+//=================================================================================================
+/*!
+//  \file blaze_tensor/util/KernelTrace.h
+//  \brief Header file for the kernel tracing and the per-expression performance counters
+//
+//  Copyright (C) 2012-2018 Klaus Iglberger - All Rights Reserved
+//  Copyright (C) 2018 Hartmut Kaiser - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+
+#ifndef _BLAZE_TENSOR_UTIL_KERNELTRACE_H_
+#define _BLAZE_TENSOR_UTIL_KERNELTRACE_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/util/Types.h>
+
+#include <blaze_tensor/config/Tracing.h>
+
+#include <ostream>
+#include <string>
+#include <vector>
+
+#if BLAZE_USE_KERNEL_TRACING
+#include <blaze/math/Aliases.h>
+#include <blaze/math/expressions/Matrix.h>
+#include <blaze/math/expressions/Vector.h>
+
+#include <blaze_tensor/math/expressions/Tensor.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <map>
+#include <mutex>
+#include <sstream>
+#include <typeindex>
+#include <typeinfo>
+#include <utility>
+
+#if defined(__GNUG__)
+#  include <cxxabi.h>
+#endif
+#endif
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Performance counters of a single kernel of a single expression type.
+// \ingroup util
+//
+// A KernelTraceRecord accumulates all calls of one assignment kernel (e.g. \c "vectorized assign"
+// or \c "smp assign") for one expression type. The shape of the target of the most recent call
+// is recorded as (pages, rows, columns); matrix targets have a single page and vector targets
+// a single page and row. The number of bytes is the number of bytes written to the target.
+*/
+struct KernelTraceRecord
+{
+   std::string expression;   //!< The (demangled) type of the assigned expression.
+   std::string kernel;       //!< The name of the selected kernel.
+   size_t calls;             //!< The number of calls of the kernel.
+   size_t elements;          //!< The total number of target elements.
+   size_t minElements;       //!< The smallest number of target elements of a single call.
+   size_t maxElements;       //!< The largest number of target elements of a single call.
+   size_t bytes;             //!< The total number of bytes written to the target.
+   double seconds;           //!< The total elapsed time in seconds.
+   size_t threads;           //!< The maximum number of threads of a single call.
+   size_t pages;             //!< The number of pages of the target of the last call.
+   size_t rows;              //!< The number of rows of the target of the last call.
+   size_t columns;           //!< The number of columns of the target of the last call.
+};
+//*************************************************************************************************
+
+
+
+
+#if BLAZE_USE_KERNEL_TRACING
+//=================================================================================================
+//
+//  CLASS KERNELTRACEREGISTRY
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Thread-safe registry of all kernel trace records.
+// \ingroup util
+*/
+class KernelTraceRegistry
+{
+ public:
+   //**Utility functions***************************************************************************
+   /*!\brief Returns the registry instance.
+   //
+   // \return Reference to the registry instance.
+   */
+   static KernelTraceRegistry& instance()
+   {
+      static KernelTraceRegistry registry;
+      return registry;
+   }
+   //**********************************************************************************************
+
+   //**Record function*****************************************************************************
+   /*!\brief Records a single call of a kernel.
+   //
+   // \param expression The type of the assigned expression.
+   // \param kernel The name of the selected kernel.
+   // \param pages The number of pages of the target.
+   // \param rows The number of rows of the target.
+   // \param columns The number of columns of the target.
+   // \param bytes The number of bytes written to the target.
+   // \param seconds The elapsed time in seconds.
+   // \param threads The number of threads.
+   // \return void
+   */
+   void record( const std::type_info& expression, const char* kernel, size_t pages, size_t rows,
+                size_t columns, size_t bytes, double seconds, size_t threads )
+   {
+      const size_t elements( pages * rows * columns );
+
+      std::lock_guard<std::mutex> lock( mutex_ );
+
+      auto pos( records_.find( Key( expression, kernel ) ) );
+
+      if( pos == records_.end() ) {
+         KernelTraceRecord init{ demangle( expression ), kernel, 0UL, 0UL, elements, elements,
+                                 0UL, 0.0, 0UL, 0UL, 0UL, 0UL };
+         pos = records_.emplace( Key( expression, kernel ), std::move( init ) ).first;
+      }
+
+      KernelTraceRecord& rec( pos->second );
+      ++rec.calls;
+      rec.elements   += elements;
+      rec.minElements = std::min( rec.minElements, elements );
+      rec.maxElements = std::max( rec.maxElements, elements );
+      rec.bytes      += bytes;
+      rec.seconds    += seconds;
+      rec.threads     = std::max( rec.threads, threads );
+      rec.pages       = pages;
+      rec.rows        = rows;
+      rec.columns     = columns;
+   }
+   //**********************************************************************************************
+
+   //**Records function****************************************************************************
+   /*!\brief Returns a copy of all records, sorted by expression type and kernel.
+   //
+   // \return The current kernel trace records.
+   */
+   std::vector<KernelTraceRecord> records() const
+   {
+      std::vector<KernelTraceRecord> result;
+
+      {
+         std::lock_guard<std::mutex> lock( mutex_ );
+         result.reserve( records_.size() );
+         for( const auto& rec : records_ )
+            result.push_back( rec.second );
+      }
+
+      std::sort( result.begin(), result.end(),
+                 []( const KernelTraceRecord& a, const KernelTraceRecord& b ) {
+                    return a.expression < b.expression ||
+                           ( a.expression == b.expression && a.kernel < b.kernel );
+                 } );
+
+      return result;
+   }
+   //**********************************************************************************************
+
+   //**Reset function******************************************************************************
+   /*!\brief Removes all records.
+   //
+   // \return void
+   */
+   void reset()
+   {
+      std::lock_guard<std::mutex> lock( mutex_ );
+      records_.clear();
+   }
+   //**********************************************************************************************
+
+ private:
+   //**Type definitions****************************************************************************
+   using Key = std::pair<std::type_index,std::string>;  //!< Key of a record.
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\brief Returns the demangled name of the given type.
+   //
+   // \param type The type to be named.
+   // \return The demangled name (or the implementation-defined name if demangling fails).
+   */
+   static std::string demangle( const std::type_info& type )
+   {
+#if defined(__GNUG__)
+      int status( 0 );
+      char* name( abi::__cxa_demangle( type.name(), nullptr, nullptr, &status ) );
+      if( status == 0 && name != nullptr ) {
+         std::string result( name );
+         std::free( name );
+         return result;
+      }
+      std::free( name );
+#endif
+      return type.name();
+   }
+   //**********************************************************************************************
+
+   //**Constructor*********************************************************************************
+   KernelTraceRegistry() = default;
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   std::map<Key,KernelTraceRecord> records_;  //!< The records per expression type and kernel.
+   mutable std::mutex mutex_;                 //!< Synchronization of the record accesses.
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CLASS KERNELTRACE
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Extraction of the shape of a tensor target.
+// \ingroup util
+*/
+template< typename TT >  // Type of the target tensor
+inline void kernelTraceShape( const Tensor<TT>& tens, size_t& pages, size_t& rows,
+                              size_t& columns, size_t& size ) noexcept
+{
+   pages   = (*tens).pages();
+   rows    = (*tens).rows();
+   columns = (*tens).columns();
+   size    = sizeof( ElementType_t<TT> );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Extraction of the shape of a matrix target.
+// \ingroup util
+*/
+template< typename MT  // Type of the target matrix
+        , bool SO >    // Storage order of the target matrix
+inline void kernelTraceShape( const Matrix<MT,SO>& mat, size_t& pages, size_t& rows,
+                              size_t& columns, size_t& size ) noexcept
+{
+   pages   = 1UL;
+   rows    = (*mat).rows();
+   columns = (*mat).columns();
+   size    = sizeof( ElementType_t<MT> );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Extraction of the shape of a vector target.
+// \ingroup util
+*/
+template< typename VT  // Type of the target vector
+        , bool TF >    // Transpose flag of the target vector
+inline void kernelTraceShape( const Vector<VT,TF>& vec, size_t& pages, size_t& rows,
+                              size_t& columns, size_t& size ) noexcept
+{
+   pages   = 1UL;
+   rows    = 1UL;
+   columns = (*vec).size();
+   size    = sizeof( ElementType_t<VT> );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief RAII measurement of a single kernel call.
+// \ingroup util
+//
+// A KernelTrace object measures the time between its construction and its destruction and
+// records it, together with the shape of the target and the number of threads, for the given
+// expression type and kernel name in the kernel trace registry. Usually it is not used directly,
+// but via the BLAZE_KERNEL_TRACE macro. The class is only available in case the kernel tracing
+// is activated (see the BLAZE_USE_KERNEL_TRACING switch).
+*/
+class KernelTrace
+{
+ private:
+   //**Type definitions****************************************************************************
+   using Clock = std::chrono::steady_clock;  //!< Clock used for the time measurement.
+   //**********************************************************************************************
+
+ public:
+   //**Constructor*********************************************************************************
+   /*!\brief Starts the measurement of a kernel call.
+   //
+   // \param kernel The name of the selected kernel (a string literal).
+   // \param expression The type of the assigned expression.
+   // \param target The target of the assignment.
+   // \param threads The number of threads executing the kernel.
+   */
+   template< typename T >  // Type of the target
+   KernelTrace( const char* kernel, const std::type_info& expression, const T& target, size_t threads )
+      : kernel_    ( kernel )       // The name of the selected kernel
+      , expression_( expression )   // The type of the assigned expression
+      , threads_   ( threads )      // The number of threads
+      , pages_     ( 0UL )          // The number of pages of the target
+      , rows_      ( 0UL )          // The number of rows of the target
+      , columns_   ( 0UL )          // The number of columns of the target
+      , size_      ( 0UL )          // The size of a single target element
+      , start_     ( Clock::now() ) // The start of the measurement
+   {
+      kernelTraceShape( target, pages_, rows_, columns_, size_ );
+   }
+   //**********************************************************************************************
+
+   KernelTrace( const KernelTrace& ) = delete;
+   KernelTrace& operator=( const KernelTrace& ) = delete;
+
+   //**Destructor**********************************************************************************
+   /*!\brief Stops the measurement and records the kernel call.
+   */
+   ~KernelTrace()
+   {
+      const double seconds( std::chrono::duration<double>( Clock::now() - start_ ).count() );
+      KernelTraceRegistry::instance().record( expression_, kernel_, pages_, rows_, columns_,
+                                              pages_*rows_*columns_*size_, seconds, threads_ );
+   }
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   const char*           kernel_;      //!< The name of the selected kernel.
+   const std::type_info& expression_;  //!< The type of the assigned expression.
+   size_t                threads_;     //!< The number of threads.
+   size_t                pages_;       //!< The number of pages of the target.
+   size_t                rows_;        //!< The number of rows of the target.
+   size_t                columns_;     //!< The number of columns of the target.
+   size_t                size_;        //!< The size of a single target element.
+   Clock::time_point     start_;       //!< The start of the measurement.
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+#endif
+
+
+
+
+//=================================================================================================
+//
+//  KERNEL TRACE MACRO
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+#define BLAZE_KERNEL_TRACE_NAME_IMPL( NAME, LINE ) NAME##LINE
+#define BLAZE_KERNEL_TRACE_NAME( NAME, LINE ) BLAZE_KERNEL_TRACE_NAME_IMPL( NAME, LINE )
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Kernel trace macro.
+// \ingroup util
+//
+// \param KERNEL The name of the selected kernel (a string literal).
+// \param EXPR The type of the assigned expression.
+// \param TARGET The target of the assignment.
+// \param THREADS The number of threads executing the kernel.
+//
+// In case the kernel tracing is activated (see the BLAZE_USE_KERNEL_TRACING switch), this macro
+// records the call of the surrounding kernel until the end of the current scope. Otherwise the
+// macro expands to nothing and all arguments are ignored:
+
+   \code
+   template< typename MT >
+   inline auto DynamicTensor<Type>::assign( const DenseTensor<MT>& rhs )
+      -> EnableIf_t< VectorizedAssign_v<MT> >
+   {
+      BLAZE_KERNEL_TRACE( "vectorized assign", MT, *this, 1UL );
+      // ...
+   }
+   \endcode
+*/
+#if BLAZE_USE_KERNEL_TRACING
+#  define BLAZE_KERNEL_TRACE( KERNEL, EXPR, TARGET, THREADS ) \
+   ::blaze::KernelTrace BLAZE_KERNEL_TRACE_NAME( blaze_kernel_trace_, __LINE__ ) \
+      ( KERNEL, typeid( EXPR ), TARGET, THREADS )
+#else
+#  define BLAZE_KERNEL_TRACE( KERNEL, EXPR, TARGET, THREADS )
+#endif
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  KERNEL TRACE FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name Kernel trace functions */
+//@{
+inline std::vector<KernelTraceRecord> kernelTraces();
+inline void resetKernelTraces();
+inline void dumpKernelTraces( std::ostream& os );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the performance counters of all traced kernels.
+// \ingroup util
+//
+// \return The records of all traced kernels, sorted by expression type and kernel name.
+//
+// In case the kernel tracing is deactivated, the returned vector is always empty.
+*/
+inline std::vector<KernelTraceRecord> kernelTraces()
+{
+#if BLAZE_USE_KERNEL_TRACING
+   return KernelTraceRegistry::instance().records();
+#else
+   return std::vector<KernelTraceRecord>();
+#endif
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Resets the performance counters of all traced kernels.
+// \ingroup util
+//
+// \return void
+*/
+inline void resetKernelTraces()
+{
+#if BLAZE_USE_KERNEL_TRACING
+   KernelTraceRegistry::instance().reset();
+#endif
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Prints the performance counters of all traced kernels as per-expression histogram.
+// \ingroup util
+//
+// \param os Reference to the output stream.
+// \return void
+//
+// This function prints one block per expression type. Each block lists the kernels that have
+// been selected for the expression, the number and share of the calls (including a histogram
+// bar), the total number of target elements, the smallest and largest target, the elapsed time,
+// the resulting bandwidth with respect to the written bytes, the maximum number of threads and
+// the shape of the last target:
+
+   \code
+   blaze::DTensDTensAddExpr<blaze::DynamicTensor<double>, blaze::DynamicTensor<double> >
+      kernel                   calls  share                            elements  ...
+      smp assign                  10 100.0% ####################        4915200  ...
+   \endcode
+*/
+inline void dumpKernelTraces( std::ostream& os )
+{
+#if BLAZE_USE_KERNEL_TRACING
+   const std::vector<KernelTraceRecord> records( kernelTraces() );
+
+   if( records.empty() ) {
+      os << "No kernel traces\n";
+      return;
+   }
+
+   const std::ios::fmtflags flags( os.flags() );
+   const std::streamsize precision( os.precision() );
+
+   auto first( records.begin() );
+
+   while( first != records.end() )
+   {
+      const auto last( std::find_if( first, records.end(), [&]( const KernelTraceRecord& rec ) {
+         return rec.expression != first->expression;
+      } ) );
+
+      size_t calls( 0UL );
+      for( auto rec=first; rec!=last; ++rec )
+         calls += rec->calls;
+
+      os << first->expression << "\n"
+         << "   " << std::left << std::setw( 24 ) << "kernel" << std::right
+         << std::setw( 10 ) << "calls" << "  share" << std::setw( 21 ) << ""
+         << std::setw( 14 ) << "elements"
+         << std::setw( 12 ) << "min"
+         << std::setw( 12 ) << "max"
+         << std::setw( 12 ) << "time[ms]"
+         << std::setw( 10 ) << "GB/s"
+         << std::setw( 9 )  << "threads"
+         << "  last shape\n";
+
+      for( auto rec=first; rec!=last; ++rec )
+      {
+         const double share( 100.0 * double( rec->calls ) / double( calls ) );
+         const size_t bar( static_cast<size_t>( share / 5.0 + 0.5 ) );
+         const double bandwidth( rec->seconds > 0.0 ? 1E-9 * double( rec->bytes ) / rec->seconds : 0.0 );
+
+         std::ostringstream shape;
+         shape << rec->pages << "x" << rec->rows << "x" << rec->columns;
+
+         os << "   " << std::left << std::setw( 24 ) << rec->kernel << std::right
+            << std::setw( 10 ) << rec->calls
+            << std::fixed << std::setprecision( 1 ) << std::setw( 6 ) << share << "% "
+            << std::left << std::setw( 20 ) << std::string( bar, '#' ) << std::right
+            << std::setw( 14 ) << rec->elements
+            << std::setw( 12 ) << rec->minElements
+            << std::setw( 12 ) << rec->maxElements
+            << std::setprecision( 3 ) << std::setw( 12 ) << 1E3 * rec->seconds
+            << std::setprecision( 2 ) << std::setw( 10 ) << bandwidth
+            << std::setw( 9 ) << rec->threads
+            << "  " << shape.str() << "\n";
+      }
+
+      os << "\n";
+      first = last;
+   }
+
+   os.flags( flags );
+   os.precision( precision );
+#else
+   os << "No kernel traces (kernel tracing is deactivated, see BLAZE_USE_KERNEL_TRACING)\n";
+#endif
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
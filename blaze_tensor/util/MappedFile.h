@@ -0,0 +1,495 @@
+//=================================================================================================
+/*!
+//  \file blaze_tensor/util/MappedFile.h
+//  \brief Header file for the MappedFile class
+//
+//  Copyright (C) 2012-2018 Klaus Iglberger - All Rights Reserved
+//  Copyright (C) 2018 Hartmut Kaiser - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+
+#ifndef _BLAZE_TENSOR_UTIL_MAPPEDFILE_H_
+#define _BLAZE_TENSOR_UTIL_MAPPEDFILE_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <string>
+
+#include <blaze/util/Exception.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  MAPPING MODES AND ACCESS HINTS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Access mode of a memory mapped file.
+// \ingroup util
+*/
+enum class MapMode
+{
+   readOnly,     //!< The mapping is read-only; writing to the mapped memory is undefined behavior.
+   copyOnWrite,  //!< The mapping is writable, but modifications are private and never written back.
+   readWrite     //!< The mapping is writable and modifications are written back to the file.
+};
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Access pattern hint for a memory mapped file.
+// \ingroup util
+*/
+enum class MapAdvice
+{
+   normal,      //!< No special treatment.
+   sequential,  //!< The memory is scanned sequentially; aggressive read-ahead.
+   random,      //!< The memory is accessed randomly; read-ahead is disabled.
+   willNeed,    //!< The memory will be accessed soon and should be prefetched.
+   dontNeed     //!< The memory will not be accessed soon and can be released.
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief RAII wrapper for a memory mapped file.
+// \ingroup util
+//
+// The MappedFile class maps a complete file into the address space of the process. The mapping
+// is released on destruction. The class is movable, but not copyable. It serves as the backend
+// of the MappedTensor and MappedArray class templates.
+//
+// \note The MappedFile class requires a POSIX system (mmap(), madvise() and msync()).
+*/
+class MappedFile
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   inline MappedFile() noexcept;
+   explicit inline MappedFile( const std::string& path, MapMode mode );
+   explicit inline MappedFile( const std::string& path, size_t size );
+
+   MappedFile( const MappedFile& ) = delete;
+   inline MappedFile( MappedFile&& file ) noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   /*!\name Destructor */
+   //@{
+   inline ~MappedFile();
+   //@}
+   //**********************************************************************************************
+
+   //**Assignment operators************************************************************************
+   /*!\name Assignment operators */
+   //@{
+   MappedFile& operator=( const MappedFile& ) = delete;
+   inline MappedFile& operator=( MappedFile&& file ) noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline char*   data() const noexcept;
+   inline size_t  size() const noexcept;
+   inline MapMode mode() const noexcept;
+   inline void    advise( MapAdvice advice ) const;
+   inline void    advise( MapAdvice advice, size_t offset, size_t length ) const;
+   inline void    flush( bool async = false ) const;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline void map( int fd, size_t size, MapMode mode );
+   inline void unmap() noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   char*   data_;  //!< The begin of the mapped memory.
+   size_t  size_;  //!< The size of the mapped memory in bytes.
+   MapMode mode_;  //!< The access mode of the mapping.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The default constructor for MappedFile.
+//
+// The default constructor creates an empty mapping.
+*/
+inline MappedFile::MappedFile() noexcept
+   : data_( nullptr )            // The begin of the mapped memory
+   , size_( 0UL )                // The size of the mapped memory in bytes
+   , mode_( MapMode::readOnly )  // The access mode of the mapping
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Maps an existing file.
+//
+// \param path The path of the file to be mapped.
+// \param mode The access mode of the mapping.
+// \exception std::runtime_error File could not be mapped.
+*/
+inline MappedFile::MappedFile( const std::string& path, MapMode mode )
+   : MappedFile()
+{
+   const int fd( ::open( path.c_str(), mode == MapMode::readWrite ? O_RDWR : O_RDONLY ) );
+
+   if( fd < 0 ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Unable to open file for mapping" );
+   }
+
+   struct stat info;
+
+   if( ::fstat( fd, &info ) != 0 ) {
+      ::close( fd );
+      BLAZE_THROW_RUNTIME_ERROR( "Unable to determine the size of the file" );
+   }
+
+   try {
+      map( fd, static_cast<size_t>( info.st_size ), mode );
+   }
+   catch( ... ) {
+      ::close( fd );
+      throw;
+   }
+
+   ::close( fd );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Creates a new file of the given size and maps it for reading and writing.
+//
+// \param path The path of the file to be created.
+// \param size The size of the file in bytes.
+// \exception std::runtime_error File could not be created or mapped.
+//
+// An existing file of the same name is truncated. All bytes of the new file are zero.
+*/
+inline MappedFile::MappedFile( const std::string& path, size_t size )
+   : MappedFile()
+{
+   const int fd( ::open( path.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644 ) );
+
+   if( fd < 0 ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Unable to create file for mapping" );
+   }
+
+   if( ::ftruncate( fd, static_cast<off_t>( size ) ) != 0 ) {
+      ::close( fd );
+      BLAZE_THROW_RUNTIME_ERROR( "Unable to resize file for mapping" );
+   }
+
+   try {
+      map( fd, size, MapMode::readWrite );
+   }
+   catch( ... ) {
+      ::close( fd );
+      throw;
+   }
+
+   ::close( fd );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief The move constructor for MappedFile.
+//
+// \param file The mapping to be moved into this instance.
+*/
+inline MappedFile::MappedFile( MappedFile&& file ) noexcept
+   : data_( file.data_ )  // The begin of the mapped memory
+   , size_( file.size_ )  // The size of the mapped memory in bytes
+   , mode_( file.mode_ )  // The access mode of the mapping
+{
+   file.data_ = nullptr;
+   file.size_ = 0UL;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DESTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The destructor for MappedFile.
+//
+// The destructor releases the mapping. Modifications of a \a readWrite mapping are written back
+// to the file by the operating system.
+*/
+inline MappedFile::~MappedFile()
+{
+   unmap();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ASSIGNMENT OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Move assignment operator for MappedFile.
+//
+// \param file The mapping to be moved into this instance.
+// \return Reference to the assigned mapping.
+*/
+inline MappedFile& MappedFile::operator=( MappedFile&& file ) noexcept
+{
+   if( &file != this ) {
+      unmap();
+      data_ = file.data_;
+      size_ = file.size_;
+      mode_ = file.mode_;
+      file.data_ = nullptr;
+      file.size_ = 0UL;
+   }
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns a pointer to the begin of the mapped memory.
+//
+// \return Pointer to the begin of the mapped memory.
+*/
+inline char* MappedFile::data() const noexcept
+{
+   return data_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the size of the mapped memory.
+//
+// \return The size of the mapped memory in bytes.
+*/
+inline size_t MappedFile::size() const noexcept
+{
+   return size_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the access mode of the mapping.
+//
+// \return The access mode of the mapping.
+*/
+inline MapMode MappedFile::mode() const noexcept
+{
+   return mode_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Passes an access pattern hint for the complete mapping to the operating system.
+//
+// \param advice The access pattern hint.
+// \return void
+*/
+inline void MappedFile::advise( MapAdvice advice ) const
+{
+   advise( advice, 0UL, size_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Passes an access pattern hint for a part of the mapping to the operating system.
+//
+// \param advice The access pattern hint.
+// \param offset The offset of the first byte the hint applies to.
+// \param length The number of bytes the hint applies to.
+// \return void
+//
+// The given range is extended to full memory pages. Hints are not binding; in case the
+// operating system rejects the hint, the function has no effect.
+*/
+inline void MappedFile::advise( MapAdvice advice, size_t offset, size_t length ) const
+{
+   if( data_ == nullptr || offset >= size_ || length == 0UL )
+      return;
+
+   if( length > size_ - offset ) {
+      length = size_ - offset;
+   }
+
+   const size_t page ( static_cast<size_t>( ::sysconf( _SC_PAGESIZE ) ) );
+   const size_t begin( offset - offset % page );
+
+   int flag( MADV_NORMAL );
+
+   switch( advice ) {
+      case MapAdvice::normal:     flag = MADV_NORMAL;     break;
+      case MapAdvice::sequential: flag = MADV_SEQUENTIAL; break;
+      case MapAdvice::random:     flag = MADV_RANDOM;     break;
+      case MapAdvice::willNeed:   flag = MADV_WILLNEED;   break;
+      case MapAdvice::dontNeed:   flag = MADV_DONTNEED;   break;
+   }
+
+   ::madvise( data_ + begin, offset + length - begin, flag );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Writes all modifications of a \a readWrite mapping back to the file.
+//
+// \param async \a true to only schedule the write-back, \a false to wait for its completion.
+// \return void
+// \exception std::runtime_error Mapping could not be flushed.
+//
+// For \a readOnly and \a copyOnWrite mappings this function has no effect.
+*/
+inline void MappedFile::flush( bool async ) const
+{
+   if( data_ == nullptr || mode_ != MapMode::readWrite )
+      return;
+
+   if( ::msync( data_, size_, async ? MS_ASYNC : MS_SYNC ) != 0 ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Unable to flush mapped file" );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Maps the given file descriptor.
+//
+// \param fd The file descriptor to be mapped.
+// \param size The size of the file in bytes.
+// \param mode The access mode of the mapping.
+// \return void
+// \exception std::runtime_error File could not be mapped.
+*/
+inline void MappedFile::map( int fd, size_t size, MapMode mode )
+{
+   if( size == 0UL ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Unable to map empty file" );
+   }
+
+   const int protection( mode == MapMode::readOnly ? PROT_READ : PROT_READ | PROT_WRITE );
+   const int flags     ( mode == MapMode::copyOnWrite ? MAP_PRIVATE : MAP_SHARED );
+
+   void* const ptr( ::mmap( nullptr, size, protection, flags, fd, 0 ) );
+
+   if( ptr == MAP_FAILED ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Unable to map file" );
+   }
+
+   data_ = static_cast<char*>( ptr );
+   size_ = size;
+   mode_ = mode;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Releases the mapping.
+//
+// \return void
+*/
+inline void MappedFile::unmap() noexcept
+{
+   if( data_ != nullptr ) {
+      ::munmap( data_, size_ );
+      data_ = nullptr;
+      size_ = 0UL;
+   }
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,373 @@
+//=================================================================================================
+/*!
+//  \file blaze_tensor/util/NumaPlacement.h
+//  \brief Header file for the NUMA placement of dense tensor and array storage
+//
+//  Copyright (C) 2012-2018 Klaus Iglberger - All Rights Reserved
+//  Copyright (C) 2018 Hartmut Kaiser - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+
+#ifndef _BLAZE_TENSOR_UTIL_NUMAPLACEMENT_H_
+#define _BLAZE_TENSOR_UTIL_NUMAPLACEMENT_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <array>
+#include <fstream>
+#include <string>
+
+#include <blaze/util/Types.h>
+
+#if defined(__linux__)
+#  include <sys/syscall.h>
+#  include <unistd.h>
+#endif
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  NUMA POLICIES
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Placement policies for the storage of dynamic tensors and arrays.
+// \ingroup util
+//
+// The NUMA policy active on a thread (see NumaScope) determines where the memory pages of newly
+// allocated DynamicTensor and DynamicArray storage are placed on machines with several NUMA
+// nodes:
+//
+//  - \a numa_local: The default policy. The storage is initialized by the allocating thread and
+//    therefore, with the first-touch policy of the operating system, placed on its node.
+//  - \a numa_first_touch: The storage is initialized in parallel, following the same page/row
+//    partition as the SMP assignment of the tensor or array. Each memory page is thereby placed
+//    on the node of the thread that will process it during subsequent SMP assignments.
+//  - \a numa_interleave: The memory pages are interleaved round-robin across all NUMA nodes
+//    (Linux only). This policy is the better choice for storage that is not consistently
+//    accessed with the same partition, e.g. for the operands of tensor contractions.
+//
+// The policies only affect memory pages that have not been touched yet, i.e. fresh heap memory.
+// Storage recycled by a TensorArena keeps its placement. On systems with a single NUMA node and
+// on non-Linux systems \a numa_interleave falls back to \a numa_local.
+*/
+enum NumaPolicy : int
+{
+   numa_local       = 0,  //!< Placement on the node of the allocating thread.
+   numa_first_touch = 1,  //!< Parallel first-touch following the SMP partition.
+   numa_interleave  = 2   //!< Round-robin interleaving across all NUMA nodes.
+};
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the NUMA policy that is active on the calling thread.
+// \ingroup util
+//
+// \return Reference to the active NUMA policy.
+*/
+inline NumaPolicy& activeNumaPolicy() noexcept
+{
+   static thread_local NumaPolicy policy( numa_local );
+   return policy;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CLASS NUMASCOPE
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief RAII activation of a NUMA placement policy on the calling thread.
+// \ingroup util
+//
+// A NumaScope activates the given NUMA policy for all dynamic tensors and arrays that are
+// allocated on the calling thread during its lifetime. Scopes can be nested; the previously
+// active policy is reactivated when a scope ends:
+
+   \code
+   blaze::DynamicTensor<double> A, B;
+
+   {
+      blaze::NumaScope scope( blaze::numa_first_touch );
+
+      A.resize( 64UL, 4096UL, 4096UL );  // Pages placed according to the SMP partition
+      B.resize( 64UL, 4096UL, 4096UL );
+   }
+
+   A = B * 2.0;  // Each thread mostly accesses memory on its own node
+   \endcode
+
+// In order for \a numa_first_touch to be effective, the threads of the SMP backend should be
+// bound to cores (e.g. via \c OMP_PROC_BIND or the HPX thread binding options).
+*/
+class NumaScope
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit inline NumaScope( NumaPolicy policy ) noexcept;
+
+   NumaScope( const NumaScope& ) = delete;
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   /*!\name Destructor */
+   //@{
+   inline ~NumaScope();
+   //@}
+   //**********************************************************************************************
+
+   //**Assignment operators************************************************************************
+   /*!\name Assignment operators */
+   //@{
+   NumaScope& operator=( const NumaScope& ) = delete;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   NumaPolicy previous_;  //!< The previously active NUMA policy.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Activates the given NUMA policy on the calling thread.
+//
+// \param policy The NUMA policy to be activated.
+*/
+inline NumaScope::NumaScope( NumaPolicy policy ) noexcept
+   : previous_( activeNumaPolicy() )  // The previously active NUMA policy
+{
+   activeNumaPolicy() = policy;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief The destructor for NumaScope.
+//
+// The destructor reactivates the previously active NUMA policy.
+*/
+inline NumaScope::~NumaScope()
+{
+   activeNumaPolicy() = previous_;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  NUMA TOPOLOGY
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief The NUMA nodes available to the process.
+// \ingroup util
+*/
+struct NumaTopology
+{
+   size_t nodes;                          //!< The number of online NUMA nodes.
+   std::array<unsigned long, 16UL> mask;  //!< The bit mask of all online NUMA nodes.
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Determines the online NUMA nodes of the system.
+// \ingroup util
+//
+// \return The NUMA topology of the system.
+//
+// On Linux the online nodes are read from \c /sys/devices/system/node/online (e.g. "0-1,4").
+// In case the topology cannot be determined, a single node is assumed.
+*/
+inline NumaTopology readNumaTopology() noexcept
+{
+   constexpr size_t bits( 8UL*sizeof( unsigned long ) );
+
+   NumaTopology topology{ 0UL, {} };
+
+#if defined(__linux__)
+   try {
+      std::ifstream file( "/sys/devices/system/node/online" );
+      std::string list;
+
+      if( file && std::getline( file, list ) )
+      {
+         size_t pos( 0UL );
+
+         while( pos < list.size() )
+         {
+            size_t end( list.find( ',', pos ) );
+            if( end == std::string::npos ) end = list.size();
+
+            const std::string range( list.substr( pos, end - pos ) );
+            const size_t dash( range.find( '-' ) );
+
+            const size_t first( std::stoul( range.substr( 0UL, dash ) ) );
+            const size_t last ( dash == std::string::npos ? first : std::stoul( range.substr( dash+1UL ) ) );
+
+            for( size_t node=first; node<=last && node<topology.mask.size()*bits; ++node ) {
+               topology.mask[node/bits] |= 1UL << ( node % bits );
+               ++topology.nodes;
+            }
+
+            pos = end + 1UL;
+         }
+      }
+   }
+   catch( ... ) {
+      topology = NumaTopology{ 0UL, {} };
+   }
+#endif
+
+   if( topology.nodes == 0UL ) {
+      topology.nodes   = 1UL;
+      topology.mask[0] = 1UL;
+   }
+
+   return topology;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the NUMA topology of the system.
+// \ingroup util
+//
+// \return Reference to the (once determined) NUMA topology.
+*/
+inline const NumaTopology& numaTopology() noexcept
+{
+   static const NumaTopology topology( readNumaTopology() );
+   return topology;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of NUMA nodes of the system.
+// \ingroup util
+//
+// \return The number of online NUMA nodes (1 on single-node and non-Linux systems).
+*/
+inline size_t numaNodes() noexcept
+{
+   return numaTopology().nodes;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  NUMA PLACEMENT FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Interleaves the memory pages of the given range across all NUMA nodes.
+// \ingroup util
+//
+// \param ptr The first byte of the range.
+// \param bytes The size of the range in bytes.
+// \return \a true if the interleave policy was applied, \a false if not.
+//
+// This function applies the \c MPOL_INTERLEAVE memory policy (via the \c mbind() system call)
+// to all memory pages completely contained in the given range. The policy determines the node
+// of each page on its first touch; pages that have already been touched are not migrated. On
+// single-node systems, on non-Linux systems and in case the range does not contain a complete
+// memory page, the function has no effect and returns \a false.
+*/
+inline bool numaInterleave( void* ptr, size_t bytes ) noexcept
+{
+#if defined(__linux__) && defined(SYS_mbind)
+   constexpr int numaMpolInterleave( 3 );  // MPOL_INTERLEAVE of <numaif.h>
+
+   const NumaTopology& topology( numaTopology() );
+
+   if( topology.nodes < 2UL || ptr == nullptr )
+      return false;
+
+   const long pageSize( ::sysconf( _SC_PAGESIZE ) );
+
+   if( pageSize <= 0L )
+      return false;
+
+   const size_t page ( static_cast<size_t>( pageSize ) );
+   const size_t first( ( reinterpret_cast<size_t>( ptr ) + page - 1UL ) & ~( page - 1UL ) );
+   const size_t last ( ( reinterpret_cast<size_t>( ptr ) + bytes ) & ~( page - 1UL ) );
+
+   if( first >= last )
+      return false;
+
+   const unsigned long maxnode( topology.mask.size() * 8UL * sizeof( unsigned long ) + 1UL );
+
+   return ::syscall( SYS_mbind, first, last - first, numaMpolInterleave,
+                     topology.mask.data(), maxnode, 0U ) == 0L;
+#else
+   static_cast<void>( ptr );
+   static_cast<void>( bytes );
+   return false;
+#endif
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,582 @@
+//=================================================================================================
+/*!
+//  \file blaze_tensor/util/TensorArena.h
+//  \brief Header file for the TensorArena and ArenaScope classes
+//
+//  Copyright (C) 2012-2018 Klaus Iglberger - All Rights Reserved
+//  Copyright (C) 2018 Hartmut Kaiser - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+
+#ifndef _BLAZE_TENSOR_UTIL_TENSORARENA_H_
+#define _BLAZE_TENSOR_UTIL_TENSORARENA_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <array>
+#include <mutex>
+#include <new>
+#include <vector>
+
+#include <blaze/util/Assert.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsBuiltin.h>
+
+#include <blaze_tensor/util/HugePages.h>
+#include <blaze_tensor/util/NumaPlacement.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS TENSORARENA
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Caching pool for the element storage of dynamic tensors and arrays.
+// \ingroup util
+//
+// The TensorArena class caches the memory of DynamicTensor and DynamicArray instances. While
+// an arena is active on a thread (see ArenaScope), all element storage allocated on that thread,
+// including the storage of expression temporaries created during evaluation, is taken from
+// the arena. Released memory is kept in per-size-class free lists and reused by subsequent
+// allocations of the same size class. Thus a loop that repeatedly creates tensors of the same
+// sizes performs heap allocations only during its first iteration:
+
+   \code
+   blaze::TensorArena arena;
+
+   for( size_t step=0UL; step<steps; ++step )
+   {
+      blaze::ArenaScope scope( arena );
+
+      blaze::DynamicTensor<float> C( A + B );   // Storage taken from the arena
+      const float total = sum( evaluate( C * C ) );  // Temporaries are taken from the arena
+      ...
+   }  // All storage is returned to the arena
+   \endcode
+
+// The size classes are powers of two, i.e. cached blocks are up to twice as large as requested.
+// Memory taken from an arena may be released on any thread and at any time, also after the
+// according ArenaScope has ended. However, the arena has to outlive all tensors and arrays
+// using its memory. The cached memory is returned to the system by release() or on destruction.
+*/
+class TensorArena
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   inline TensorArena() noexcept;
+
+   TensorArena( const TensorArena& ) = delete;
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   /*!\name Destructor */
+   //@{
+   inline ~TensorArena();
+   //@}
+   //**********************************************************************************************
+
+   //**Assignment operators************************************************************************
+   /*!\name Assignment operators */
+   //@{
+   TensorArena& operator=( const TensorArena& ) = delete;
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t allocations() const;
+   inline size_t cachedBytes() const;
+   inline void   release();
+
+   inline void*  acquire( size_t sizeClass );
+   inline void   recycle( void* block, size_t sizeClass ) noexcept;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   mutable std::mutex mutex_;  //!< Synchronization of the free lists.
+   size_t allocations_;        //!< The number of heap allocations performed by the arena.
+   size_t cached_;             //!< The number of bytes in the free lists.
+   size_t outstanding_;        //!< The number of blocks currently in use.
+   std::array< std::vector<void*>, 64UL > free_;  //!< The free lists of all size classes.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief The default constructor for TensorArena.
+*/
+inline TensorArena::TensorArena() noexcept
+   : mutex_      ()     // Synchronization of the free lists
+   , allocations_( 0UL )  // The number of heap allocations performed by the arena
+   , cached_     ( 0UL )  // The number of bytes in the free lists
+   , outstanding_( 0UL )  // The number of blocks currently in use
+   , free_       ()     // The free lists of all size classes
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief The destructor for TensorArena.
+//
+// The destructor returns all cached memory to the system. All memory taken from the arena must
+// have been released before.
+*/
+inline TensorArena::~TensorArena()
+{
+   BLAZE_USER_ASSERT( outstanding_ == 0UL, "Tensor arena destroyed while its memory is in use" );
+
+   release();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of heap allocations performed by the arena.
+//
+// \return The number of heap allocations.
+//
+// The number of heap allocations does not change as long as all requests can be served from
+// the cached memory.
+*/
+inline size_t TensorArena::allocations() const
+{
+   std::lock_guard<std::mutex> lock( mutex_ );
+   return allocations_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of bytes currently cached by the arena.
+//
+// \return The number of cached bytes.
+*/
+inline size_t TensorArena::cachedBytes() const
+{
+   std::lock_guard<std::mutex> lock( mutex_ );
+   return cached_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns all cached memory to the system.
+//
+// \return void
+//
+// Memory currently in use is not affected and is cached again once released.
+*/
+inline void TensorArena::release()
+{
+   std::lock_guard<std::mutex> lock( mutex_ );
+
+   for( std::vector<void*>& blocks : free_ ) {
+      for( void* block : blocks ) {
+         ::operator delete( block );
+      }
+      blocks.clear();
+      blocks.shrink_to_fit();
+   }
+
+   cached_ = 0UL;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Takes a block of \f$ 2^{sizeClass} \f$ bytes from the arena.
+//
+// \param sizeClass The size class of the block.
+// \return The first byte of the block.
+// \exception std::bad_alloc Allocation failed.
+*/
+inline void* TensorArena::acquire( size_t sizeClass )
+{
+   std::lock_guard<std::mutex> lock( mutex_ );
+
+   std::vector<void*>& blocks( free_[sizeClass] );
+   void* block( nullptr );
+
+   if( blocks.empty() ) {
+      block = ::operator new( size_t( 1UL ) << sizeClass );
+      ++allocations_;
+   }
+   else {
+      block = blocks.back();
+      blocks.pop_back();
+      cached_ -= size_t( 1UL ) << sizeClass;
+   }
+
+   ++outstanding_;
+   return block;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns a block of \f$ 2^{sizeClass} \f$ bytes to the arena.
+//
+// \param block The first byte of the block.
+// \param sizeClass The size class of the block.
+// \return void
+*/
+inline void TensorArena::recycle( void* block, size_t sizeClass ) noexcept
+{
+   std::lock_guard<std::mutex> lock( mutex_ );
+
+   --outstanding_;
+
+   try {
+      free_[sizeClass].push_back( block );
+      cached_ += size_t( 1UL ) << sizeClass;
+   }
+   catch( ... ) {
+      ::operator delete( block );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CLASS ARENASCOPE
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the arena that is active on the calling thread.
+// \ingroup util
+//
+// \return Reference to the pointer to the active arena (\c nullptr if no arena is active).
+*/
+inline TensorArena*& activeArena() noexcept
+{
+   static thread_local TensorArena* arena( nullptr );
+   return arena;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief RAII activation of a TensorArena on the calling thread.
+// \ingroup util
+//
+// An ArenaScope activates the given arena on the calling thread for its lifetime. Scopes can be
+// nested; the previously active arena is reactivated when a scope ends. See TensorArena for an
+// example.
+//
+// \note The arena is only active on the thread that created the scope. Storage allocated by
+// other threads, e.g. by the worker threads of an SMP assignment, is taken from the heap.
+*/
+class ArenaScope
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit inline ArenaScope( TensorArena& arena ) noexcept;
+
+   ArenaScope( const ArenaScope& ) = delete;
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   /*!\name Destructor */
+   //@{
+   inline ~ArenaScope();
+   //@}
+   //**********************************************************************************************
+
+   //**Assignment operators************************************************************************
+   /*!\name Assignment operators */
+   //@{
+   ArenaScope& operator=( const ArenaScope& ) = delete;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   TensorArena* previous_;  //!< The previously active arena.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Activates the given arena on the calling thread.
+//
+// \param arena The arena to be activated.
+*/
+inline ArenaScope::ArenaScope( TensorArena& arena ) noexcept
+   : previous_( activeArena() )  // The previously active arena
+{
+   activeArena() = &arena;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief The destructor for ArenaScope.
+//
+// The destructor reactivates the previously active arena.
+*/
+inline ArenaScope::~ArenaScope()
+{
+   activeArena() = previous_;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ALLOCATION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Bookkeeping information stored in front of each block of element storage.
+// \ingroup util
+*/
+struct ArenaHeader
+{
+   void*        block;      //!< The first byte of the underlying block.
+   TensorArena* arena;      //!< The owning arena (\c nullptr for heap blocks).
+   size_t       sizeClass;  //!< The size class of arena blocks.
+   size_t       mapped;     //!< The size of huge page mappings (0 for other blocks).
+   size_t       count;      //!< The number of elements.
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Alignment of the element storage of dynamic tensors and arrays in bytes.
+// \ingroup util
+*/
+constexpr size_t arenaAlignment = 64UL;
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Allocates aligned storage for \a n elements of type \a Type.
+// \ingroup util
+//
+// \param n The number of elements.
+// \return Pointer to the first element.
+// \exception std::bad_alloc Allocation failed.
+//
+// The storage is 64-byte aligned. In case an arena is active on the calling thread, the
+// storage is taken from the arena. Otherwise, in case a HugePageScope is active and the
+// storage comprises at least one huge page, the storage is placed in a 2 MiB aligned, huge
+// page backed mapping, else it is taken from the heap. In case the \a numa_interleave
+// policy is active on the calling thread, the memory pages of the storage are interleaved
+// across all NUMA nodes. Elements of non-builtin type are default constructed. The storage
+// has to be released via arenaDeallocate().
+*/
+template< typename Type >  // Data type of the elements
+Type* arenaAllocate( size_t n )
+{
+   const size_t bytes( n * sizeof( Type ) + 2UL*arenaAlignment );
+
+   TensorArena* const arena( activeArena() );
+
+   size_t sizeClass( 0UL );
+   size_t mapped( 0UL );
+   void*  block( nullptr );
+
+   if( arena != nullptr ) {
+      while( ( size_t( 1UL ) << sizeClass ) < bytes ) ++sizeClass;
+      block = arena->acquire( sizeClass );
+   }
+   else if( activeHugePages() && n * sizeof( Type ) >= hugePageSize ) {
+      block = hugePageMap( n * sizeof( Type ), mapped );
+   }
+
+   if( block == nullptr ) {
+      block = ::operator new( bytes );
+   }
+
+   // Huge page backed storage starts at the 2 MiB aligned block, the header is placed in the
+   // preceding ordinary memory page
+   const size_t address( reinterpret_cast<size_t>( block ) + ( mapped != 0UL ? 0UL : arenaAlignment ) );
+   char* const  data( reinterpret_cast<char*>( ( address + arenaAlignment - 1UL ) & ~( arenaAlignment - 1UL ) ) );
+
+   ::new ( data - sizeof( ArenaHeader ) ) ArenaHeader{ block, arena, sizeClass, mapped, n };
+
+   Type* const ptr( reinterpret_cast<Type*>( data ) );
+
+   if( activeNumaPolicy() == numa_interleave ) {
+      numaInterleave( data, n * sizeof( Type ) );
+   }
+
+   if( !IsBuiltin_v<Type> ) {
+      size_t i( 0UL );
+      try {
+         for( ; i<n; ++i ) {
+            ::new ( ptr+i ) Type();
+         }
+      }
+      catch( ... ) {
+         for( size_t j=0UL; j<i; ++j ) {
+            ptr[j].~Type();
+         }
+         if( arena != nullptr ) arena->recycle( block, sizeClass );
+         else if( mapped != 0UL ) hugePageUnmap( block, mapped );
+         else ::operator delete( block );
+         throw;
+      }
+   }
+
+   return ptr;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Releases storage allocated by arenaAllocate().
+// \ingroup util
+//
+// \param ptr Pointer to the first element (may be \c nullptr).
+// \return void
+//
+// Elements of non-builtin type are destroyed. Storage taken from an arena is returned to that
+// arena, independent of the arena currently active on the calling thread.
+*/
+template< typename Type >  // Data type of the elements
+void arenaDeallocate( Type* ptr ) noexcept
+{
+   if( ptr == nullptr ) return;
+
+   const ArenaHeader header( *reinterpret_cast<ArenaHeader*>(
+      reinterpret_cast<char*>( ptr ) - sizeof( ArenaHeader ) ) );
+
+   if( !IsBuiltin_v<Type> ) {
+      for( size_t i=0UL; i<header.count; ++i ) {
+         ptr[i].~Type();
+      }
+   }
+
+   if( header.arena != nullptr ) {
+      header.arena->recycle( header.block, header.sizeClass );
+   }
+   else if( header.mapped != 0UL ) {
+      hugePageUnmap( header.block, header.mapped );
+   }
+   else {
+      ::operator delete( header.block );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Deallocation policy for storage allocated by arenaAllocate() or hugePageAllocate().
+// \ingroup util
+//
+// The ArenaDeallocate policy can be used as deleter of a \c std::unique_ptr or \c std::shared_ptr
+// owning the memory of a CustomTensor or CustomArray (see hugePageAllocate()).
+*/
+struct ArenaDeallocate
+{
+   template< typename Type >  // Data type of the elements
+   void operator()( Type* ptr ) const noexcept
+   {
+      arenaDeallocate( ptr );
+   }
+};
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Allocates huge page backed storage for \a n elements of type \a Type.
+// \ingroup util
+//
+// \param n The number of elements.
+// \return Pointer to the first element.
+// \exception std::bad_alloc Allocation failed.
+//
+// This function allocates storage as if a HugePageScope was active, i.e. storage of at least
+// 2 MiB is placed in a 2 MiB aligned, huge page backed mapping. The storage can be used for
+// aligned and padded custom tensors and arrays. It has to be released via arenaDeallocate(),
+// for instance by means of the ArenaDeallocate policy:
+
+   \code
+   using blaze::aligned;
+   using blaze::padded;
+
+   const size_t nn( blaze::nextMultiple<size_t>( n, blaze::SIMDTrait<double>::size ) );
+
+   std::unique_ptr<double[],blaze::ArenaDeallocate> memory( blaze::hugePageAllocate<double>( o*m*nn ) );
+   blaze::CustomTensor<double,aligned,padded> A( memory.get(), o, m, n, nn );
+   \endcode
+
+// In case an arena is active on the calling thread, the storage is taken from the arena.
+*/
+template< typename Type >  // Data type of the elements
+Type* hugePageAllocate( size_t n )
+{
+   HugePageScope scope;
+   return arenaAllocate<Type>( n );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,232 @@
+//=================================================================================================
+/*!
+//  \file src/main/HugePages.cpp
+//  \brief Benchmark of TLB-heavy tensor kernels with and without huge pages
+//
+//  Copyright (C) 2012-2018 Klaus Iglberger - All Rights Reserved
+//  Copyright (C) 2018 Hartmut Kaiser - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/util/timing/WcTimer.h>
+#include <blaze_tensor/Math.h>
+
+
+//=================================================================================================
+//
+//  BENCHMARK FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The TLB-heavy kernels measured by the benchmark.
+*/
+const char* const kernels[] = { "columnslice sums", "trans( A, { 2, 1, 0 } )", "sum<pagewise>( A )" };
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the minimum runtime of the given kernel.
+//
+// \param repetitions The number of repetitions.
+// \param kernel The kernel to be measured.
+// \return The minimum runtime in seconds.
+*/
+template< typename Kernel >
+double measure( size_t repetitions, Kernel kernel )
+{
+   blaze::timing::WcTimer timer;
+
+   for( size_t rep=0UL; rep<repetitions; ++rep ) {
+      timer.start();
+      kernel();
+      timer.end();
+   }
+
+   return timer.min();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Measures all kernels for a tensor of the given size.
+//
+// \param o The number of pages of the tensor.
+// \param m The number of rows of the tensor.
+// \param n The number of columns of the tensor.
+// \param repetitions The number of repetitions of each kernel.
+// \param hugePages \a true to allocate all tensors with huge pages, \a false to use the heap.
+// \param times The minimum runtime of each kernel (output parameter).
+// \return void
+//
+// All tensors and matrices, including the results of the kernels, are allocated within the
+// huge page scope. Each kernel is executed once before the measurement such that the results
+// are allocated and touched before the timing starts.
+*/
+void run( size_t o, size_t m, size_t n, size_t repetitions, bool hugePages, double (&times)[3] )
+{
+   blaze::HugePageScope scope( hugePages );
+
+   blaze::DynamicTensor<double> A( o, m, n );
+   blaze::DynamicTensor<double> B;
+   blaze::DynamicMatrix<double> S;
+
+   A = 1.0;
+   for( size_t k=0UL; k<o; ++k ) {
+      for( size_t i=0UL; i<m; ++i ) {
+         A(k,i,(k+i)%n) = 2.0;
+      }
+   }
+
+   volatile double sink( 0.0 );
+
+   auto columnslices = [&]() {
+      double total( 0.0 );
+      for( size_t j=0UL; j<n; ++j ) {
+         total += blaze::sum( blaze::columnslice( A, j ) );
+      }
+      sink = total;
+   };
+
+   auto transposition = [&]() { B = blaze::trans( A, { 2UL, 1UL, 0UL } ); };
+   auto reduction     = [&]() { S = blaze::sum<blaze::pagewise>( A ); };
+
+   columnslices();
+   transposition();
+   reduction();
+
+   times[0] = measure( repetitions, columnslices );
+   times[1] = measure( repetitions, transposition );
+   times[2] = measure( repetitions, reduction );
+
+   static_cast<void>( sink );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the transparent huge page setting of the system.
+//
+// \return The active setting (e.g. "madvise") or "unavailable".
+*/
+std::string transparentHugePages()
+{
+   std::ifstream file( "/sys/kernel/mm/transparent_hugepage/enabled" );
+   std::string line;
+
+   if( !file || !std::getline( file, line ) )
+      return "unavailable";
+
+   const size_t first( line.find( '[' ) );
+   const size_t last ( line.find( ']' ) );
+
+   return ( first != std::string::npos && last != std::string::npos )
+          ? line.substr( first+1UL, last-first-1UL ) : line;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+#if defined(BLAZE_USE_HPX_THREADS)
+#include <hpx/hpx_main.hpp>
+#endif
+
+//*************************************************************************************************
+/*!\brief The main function of the huge page benchmark.
+//
+// Usage: blazemark_hugepages [pages rows columns [repetitions]]
+//
+// The default size of 128 x 512 x 2048 double precision values corresponds to a tensor of 1 GiB
+// (the benchmark requires about three times this amount of memory).
+*/
+int main( int argc, char** argv )
+{
+   size_t o( 128UL ), m( 512UL ), n( 2048UL ), repetitions( 5UL );
+
+   try
+   {
+      if( argc != 1 && argc != 4 && argc != 5 ) {
+         throw std::invalid_argument( "Usage: blazemark_hugepages [pages rows columns [repetitions]]" );
+      }
+
+      if( argc >= 4 ) {
+         o = std::stoul( argv[1] );
+         m = std::stoul( argv[2] );
+         n = std::stoul( argv[3] );
+      }
+      if( argc == 5 ) {
+         repetitions = std::stoul( argv[4] );
+      }
+
+      std::cout << "\n Huge page benchmark (" << o << " x " << m << " x " << n << ", "
+                << ( o*m*n*sizeof(double) ) / ( 1024UL*1024UL ) << " MiB per tensor)\n"
+                << " Transparent huge pages: " << transparentHugePages() << "\n\n";
+
+      double regular[3], huge[3];
+
+      run( o, m, n, repetitions, false, regular );
+      run( o, m, n, repetitions, true , huge    );
+
+      std::cout << "   " << std::left << std::setw(28) << "Kernel" << std::right
+                << std::setw(14) << "4 KiB [s]" << std::setw(14) << "2 MiB [s]" << std::setw(10) << "Speedup" << "\n";
+
+      for( size_t i=0UL; i<3UL; ++i ) {
+         std::cout << "   " << std::left << std::setw(28) << kernels[i] << std::right << std::fixed
+                   << std::setprecision(4) << std::setw(14) << regular[i] << std::setw(14) << huge[i]
+                   << std::setprecision(2) << std::setw(9) << regular[i] / huge[i] << "x\n";
+      }
+
+      std::cout << std::endl;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during the huge page benchmark:\n" << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
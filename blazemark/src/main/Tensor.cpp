@@ -0,0 +1,623 @@
+//=================================================================================================
+/*!
+//  \file src/main/Tensor.cpp
+//  \brief Benchmark suite for the dense tensor expression kernels
+//
+//  Copyright (C) 2012-2018 Klaus Iglberger - All Rights Reserved
+//  Copyright (C) 2018 Hartmut Kaiser - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/system/BLAS.h>
+#include <blaze/system/SMP.h>
+#include <blaze/util/timing/WcTimer.h>
+#include <blaze_tensor/Math.h>
+
+#if BLAZE_BLAS_MODE
+#include <blaze/math/blas/gemm.h>
+#endif
+
+
+//=================================================================================================
+//
+//  TYPE DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The shape of the benchmarked tensors.
+//
+// The number of columns is no multiple of the SIMD width such that the padded and the unpadded
+// layouts differ.
+*/
+struct Shape
+{
+   const char* name;  //!< The name of the shape.
+   size_t pages;      //!< The number of pages.
+   size_t rows;       //!< The number of rows.
+   size_t columns;    //!< The number of columns.
+};
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief The grid of benchmarked shapes (about one million elements each).
+*/
+const Shape shapes[] = {
+   { "page-heavy"  , 4096UL,   16UL,   15UL },
+   { "row-heavy"   ,   16UL, 4096UL,   15UL },
+   { "column-heavy",   16UL,   15UL, 4095UL },
+   { "cubic"       ,   96UL,   96UL,   95UL }
+};
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief The result of a single measurement.
+*/
+struct Result
+{
+   std::string kernel;   //!< The name of the kernel.
+   std::string shape;    //!< The name of the shape.
+   std::string layout;   //!< The tensor layout ("padded" or "unpadded").
+   std::string variant;  //!< The implementation ("blaze", "naive" or "blas").
+   size_t pages;         //!< The number of pages.
+   size_t rows;          //!< The number of rows.
+   size_t columns;       //!< The number of columns.
+   size_t threads;       //!< The number of threads (0 for the default of the BLAS library).
+   double seconds;       //!< The minimum runtime in seconds.
+   double mflops;        //!< The performance in MFlop/s.
+};
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief The benchmark configuration.
+*/
+struct Config
+{
+   std::vector<size_t> threads;   //!< The numbers of threads to be benchmarked.
+   size_t repetitions = 3UL;      //!< The number of repetitions of each kernel.
+   std::string format = "text";   //!< The output format ("text", "csv" or "json").
+   std::string output;            //!< The output file (empty for the standard output).
+   std::string kernel;            //!< The only kernel to be benchmarked (empty for all kernels).
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  BENCHMARK FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the minimum runtime of the given kernel.
+//
+// \param repetitions The number of repetitions.
+// \param kernel The kernel to be measured.
+// \return The minimum runtime in seconds.
+*/
+template< typename Kernel >
+double measure( size_t repetitions, Kernel& kernel )
+{
+   blaze::timing::WcTimer timer;
+
+   for( size_t rep=0UL; rep<repetitions; ++rep ) {
+      timer.start();
+      kernel();
+      timer.end();
+   }
+
+   return timer.min();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Measures a single kernel and records the result.
+//
+// \param results The recorded results.
+// \param config The benchmark configuration.
+// \param kernel The name of the kernel.
+// \param shape The shape of the operands.
+// \param layout The layout of the operands.
+// \param variant The name of the implementation.
+// \param threads The number of threads.
+// \param flops The number of floating point operations of the kernel.
+// \param f The kernel.
+// \return void
+//
+// The kernel is executed once before the measurement such that all results are allocated.
+*/
+template< typename Kernel >
+void record( std::vector<Result>& results, const Config& config, const char* kernel,
+             const Shape& shape, const char* layout, const char* variant, size_t threads,
+             double flops, Kernel f )
+{
+   if( !config.kernel.empty() && config.kernel != kernel )
+      return;
+
+   f();
+   const double seconds( measure( config.repetitions, f ) );
+
+   results.push_back( Result{ kernel, shape.name, layout, variant, shape.pages, shape.rows,
+                              shape.columns, threads, seconds, flops / seconds * 1E-6 } );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Benchmarks the Blaze kernels for the given operands.
+//
+// \param results The recorded results.
+// \param config The benchmark configuration.
+// \param shape The shape of the operands.
+// \param layout The layout of the operands.
+// \param threads The number of threads.
+// \param A The first \f$ O \times M \times N \f$ operand.
+// \param B The second \f$ O \times M \times N \f$ operand.
+// \param R The \f$ O \times N \times P \f$ right-hand side operand of the product.
+// \param C The \f$ O \times M \times N \f$ target of the addition.
+// \param P The \f$ O \times M \times P \f$ target of the product.
+// \param v The vector of size \f$ N \f$.
+// \return void
+*/
+template< typename TT >  // Type of the tensors
+void benchmarkBlaze( std::vector<Result>& results, const Config& config, const Shape& shape,
+                     const char* layout, size_t threads, const TT& A, const TT& B, const TT& R,
+                     TT& C, TT& P, const blaze::DynamicVector<double>& v )
+{
+   const double size( double( A.pages() ) * A.rows() * A.columns() );
+
+   blaze::DynamicMatrix<double> y, S;
+   volatile double sink( 0.0 );
+
+   record( results, config, "dtensdtensadd", shape, layout, "blaze", threads, size,
+           [&]() { C = A + B; } );
+   record( results, config, "dtensdtensmult", shape, layout, "blaze", threads, 2.0*size*R.columns(),
+           [&]() { P = A * R; } );
+   record( results, config, "dtensdvecmult", shape, layout, "blaze", threads, 2.0*size,
+           [&]() { y = A * v; } );
+   record( results, config, "sum", shape, layout, "blaze", threads, size,
+           [&]() { sink = blaze::sum( A ); } );
+   record( results, config, "sum<pagewise>", shape, layout, "blaze", threads, size,
+           [&]() { S = blaze::sum<blaze::pagewise>( A ); } );
+
+   static_cast<void>( sink );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Benchmarks the naive, single-threaded reference loops for the given operands.
+//
+// \param results The recorded results.
+// \param config The benchmark configuration.
+// \param shape The shape of the operands.
+// \param A The first \f$ O \times M \times N \f$ operand.
+// \param B The second \f$ O \times M \times N \f$ operand.
+// \param R The \f$ O \times N \times P \f$ right-hand side operand of the product.
+// \param C The \f$ O \times M \times N \f$ target of the addition.
+// \param P The \f$ O \times M \times P \f$ target of the product.
+// \param v The vector of size \f$ N \f$.
+// \return void
+*/
+void benchmarkNaive( std::vector<Result>& results, const Config& config, const Shape& shape,
+                     const blaze::DynamicTensor<double>& A, const blaze::DynamicTensor<double>& B,
+                     const blaze::DynamicTensor<double>& R, blaze::DynamicTensor<double>& C,
+                     blaze::DynamicTensor<double>& P, const blaze::DynamicVector<double>& v )
+{
+   const size_t o( A.pages() ), m( A.rows() ), n( A.columns() ), p( R.columns() );
+   const double size( double( o ) * m * n );
+
+   blaze::DynamicMatrix<double> y( o, m ), S( m, n );
+   volatile double sink( 0.0 );
+
+   record( results, config, "dtensdtensadd", shape, "padded", "naive", 1UL, size, [&]() {
+      for( size_t k=0UL; k<o; ++k )
+         for( size_t i=0UL; i<m; ++i )
+            for( size_t j=0UL; j<n; ++j )
+               C(k,i,j) = A(k,i,j) + B(k,i,j);
+   } );
+
+   record( results, config, "dtensdtensmult", shape, "padded", "naive", 1UL, 2.0*size*p, [&]() {
+      for( size_t k=0UL; k<o; ++k )
+         for( size_t i=0UL; i<m; ++i )
+            for( size_t l=0UL; l<p; ++l ) {
+               double s( 0.0 );
+               for( size_t j=0UL; j<n; ++j )
+                  s += A(k,i,j) * R(k,j,l);
+               P(k,i,l) = s;
+            }
+   } );
+
+   record( results, config, "dtensdvecmult", shape, "padded", "naive", 1UL, 2.0*size, [&]() {
+      for( size_t k=0UL; k<o; ++k )
+         for( size_t i=0UL; i<m; ++i ) {
+            double s( 0.0 );
+            for( size_t j=0UL; j<n; ++j )
+               s += A(k,i,j) * v[j];
+            y(k,i) = s;
+         }
+   } );
+
+   record( results, config, "sum", shape, "padded", "naive", 1UL, size, [&]() {
+      double s( 0.0 );
+      for( size_t k=0UL; k<o; ++k )
+         for( size_t i=0UL; i<m; ++i )
+            for( size_t j=0UL; j<n; ++j )
+               s += A(k,i,j);
+      sink = s;
+   } );
+
+   record( results, config, "sum<pagewise>", shape, "padded", "naive", 1UL, size, [&]() {
+      S = 0.0;
+      for( size_t k=0UL; k<o; ++k )
+         for( size_t i=0UL; i<m; ++i )
+            for( size_t j=0UL; j<n; ++j )
+               S(i,j) += A(k,i,j);
+   } );
+
+   static_cast<void>( sink );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Benchmarks the page-wise product by means of the BLAS library (if available).
+//
+// \param results The recorded results.
+// \param config The benchmark configuration.
+// \param shape The shape of the operands.
+// \param A The \f$ O \times M \times N \f$ left-hand side operand of the product.
+// \param R The \f$ O \times N \times P \f$ right-hand side operand of the product.
+// \param P The \f$ O \times M \times P \f$ target of the product.
+// \return void
+//
+// The product is computed by one gemm() call per page. The BLAS library uses its own default
+// number of threads, which is reported as 0.
+*/
+void benchmarkBLAS( std::vector<Result>& results, const Config& config, const Shape& shape,
+                    blaze::DynamicTensor<double>& A, blaze::DynamicTensor<double>& R,
+                    blaze::DynamicTensor<double>& P )
+{
+#if BLAZE_BLAS_MODE
+   const double flops( 2.0 * A.pages() * A.rows() * A.columns() * R.columns() );
+
+   record( results, config, "dtensdtensmult", shape, "padded", "blas", 0UL, flops, [&]() {
+      for( size_t k=0UL; k<A.pages(); ++k ) {
+         auto Pk( blaze::pageslice( P, k ) );
+         blaze::gemm( Pk, blaze::pageslice( A, k ), blaze::pageslice( R, k ), 1.0, 0.0 );
+      }
+   } );
+#else
+   static_cast<void>( results );
+   static_cast<void>( config );
+   static_cast<void>( shape );
+   static_cast<void>( A );
+   static_cast<void>( R );
+   static_cast<void>( P );
+#endif
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Sets the number of threads of the SMP backend.
+//
+// \param threads The number of threads.
+// \return void
+//
+// The number of threads of the HPX backend is fixed at startup (\c --hpx:threads); in this case
+// and without parallelization the function has no effect.
+*/
+void setThreads( size_t threads )
+{
+#if BLAZE_OPENMP_PARALLEL_MODE || BLAZE_CPP_THREADS_PARALLEL_MODE || BLAZE_BOOST_THREADS_PARALLEL_MODE
+   blaze::setNumThreads( threads );
+#else
+   static_cast<void>( threads );
+#endif
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the default numbers of threads (powers of two up to the number of cores).
+//
+// \return The default numbers of threads.
+*/
+std::vector<size_t> defaultThreads()
+{
+#if BLAZE_OPENMP_PARALLEL_MODE || BLAZE_CPP_THREADS_PARALLEL_MODE || BLAZE_BOOST_THREADS_PARALLEL_MODE
+   const size_t cores( std::max( 1U, std::thread::hardware_concurrency() ) );
+
+   std::vector<size_t> threads;
+   for( size_t t=1UL; t<cores; t*=2UL ) {
+      threads.push_back( t );
+   }
+   threads.push_back( cores );
+
+   return threads;
+#else
+   return { blaze::getNumThreads() };
+#endif
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  OUTPUT FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Writes the results as human readable table.
+//
+// \param os The output stream.
+// \param results The results.
+// \return void
+*/
+void writeText( std::ostream& os, const std::vector<Result>& results )
+{
+   os << "\n Dense tensor benchmark\n\n"
+      << "   " << std::left << std::setw(16) << "Kernel" << std::setw(14) << "Shape"
+      << std::setw(10) << "Layout" << std::setw(8) << "Variant" << std::right << std::setw(8) << "Threads"
+      << std::setw(14) << "Time [s]" << std::setw(14) << "MFlop/s" << "\n";
+
+   for( const Result& r : results ) {
+      os << "   " << std::left << std::setw(16) << r.kernel << std::setw(14) << r.shape
+         << std::setw(10) << r.layout << std::setw(8) << r.variant << std::right << std::setw(8) << r.threads
+         << std::scientific << std::setprecision(4) << std::setw(14) << r.seconds
+         << std::fixed << std::setprecision(1) << std::setw(14) << r.mflops << "\n";
+   }
+
+   os << std::endl;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Writes the results as comma-separated values (one line per measurement).
+//
+// \param os The output stream.
+// \param results The results.
+// \return void
+*/
+void writeCSV( std::ostream& os, const std::vector<Result>& results )
+{
+   os << "kernel,shape,layout,variant,pages,rows,columns,threads,seconds,mflops\n";
+
+   for( const Result& r : results ) {
+      os << r.kernel << "," << r.shape << "," << r.layout << "," << r.variant << ","
+         << r.pages << "," << r.rows << "," << r.columns << "," << r.threads << ","
+         << std::setprecision(9) << r.seconds << "," << r.mflops << "\n";
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Writes the results as JSON document.
+//
+// \param os The output stream.
+// \param results The results.
+// \return void
+*/
+void writeJSON( std::ostream& os, const std::vector<Result>& results )
+{
+   os << "{\n  \"benchmark\": \"blazemark_tensor\",\n  \"results\": [";
+
+   for( size_t i=0UL; i<results.size(); ++i ) {
+      const Result& r( results[i] );
+      os << ( i == 0UL ? "\n" : ",\n" )
+         << "    { \"kernel\": \"" << r.kernel << "\", \"shape\": \"" << r.shape
+         << "\", \"layout\": \"" << r.layout << "\", \"variant\": \"" << r.variant
+         << "\", \"pages\": " << r.pages << ", \"rows\": " << r.rows << ", \"columns\": " << r.columns
+         << ", \"threads\": " << r.threads << ", \"seconds\": " << std::setprecision(9) << r.seconds
+         << ", \"mflops\": " << r.mflops << " }";
+   }
+
+   os << "\n  ]\n}\n";
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Parses a comma-separated list of thread counts.
+//
+// \param list The comma-separated list.
+// \return The thread counts.
+// \exception std::invalid_argument Invalid list of threads.
+*/
+std::vector<size_t> parseThreads( const std::string& list )
+{
+   std::vector<size_t> threads;
+   std::istringstream iss( list );
+   std::string item;
+
+   while( std::getline( iss, item, ',' ) ) {
+      const size_t t( std::stoul( item ) );
+      if( t == 0UL ) {
+         throw std::invalid_argument( "Invalid number of threads" );
+      }
+      threads.push_back( t );
+   }
+
+   if( threads.empty() ) {
+      throw std::invalid_argument( "Invalid list of threads" );
+   }
+
+   return threads;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+#if defined(BLAZE_USE_HPX_THREADS)
+#include <hpx/hpx_main.hpp>
+#endif
+
+//*************************************************************************************************
+/*!\brief The main function of the dense tensor benchmark suite.
+//
+// Usage: blazemark_tensor [--format text|csv|json] [--output FILE] [--threads 1,2,4]
+//                         [--repetitions N] [--kernel NAME]
+//
+// The suite measures the addition, the page-wise tensor product, the tensor/vector product and
+// the reductions for every shape of the grid, for padded (DynamicTensor) and unpadded
+// (CustomTensor) operands and for all given numbers of threads. The naive reference loops and,
+// if Blaze is configured with BLAS support, the BLAS based product are measured once per shape.
+*/
+int main( int argc, char** argv )
+{
+   const char* const usage =
+      "Usage: blazemark_tensor [--format text|csv|json] [--output FILE] [--threads 1,2,4]\n"
+      "                        [--repetitions N] [--kernel NAME]";
+
+   Config config;
+
+   try
+   {
+      for( int i=1; i<argc; ++i )
+      {
+         const std::string arg( argv[i] );
+
+         if( arg == "--help" ) {
+            std::cout << usage << "\n";
+            return EXIT_SUCCESS;
+         }
+         if( i+1 == argc ) {
+            throw std::invalid_argument( usage );
+         }
+
+         const std::string value( argv[++i] );
+
+         if     ( arg == "--format"      ) config.format      = value;
+         else if( arg == "--output"      ) config.output      = value;
+         else if( arg == "--threads"     ) config.threads     = parseThreads( value );
+         else if( arg == "--repetitions" ) config.repetitions = std::stoul( value );
+         else if( arg == "--kernel"      ) config.kernel      = value;
+         else throw std::invalid_argument( usage );
+      }
+
+      if( config.format != "text" && config.format != "csv" && config.format != "json" ) {
+         throw std::invalid_argument( "Invalid output format '" + config.format + "'" );
+      }
+      if( config.repetitions == 0UL ) {
+         throw std::invalid_argument( "Invalid number of repetitions" );
+      }
+      if( config.threads.empty() ) {
+         config.threads = defaultThreads();
+      }
+
+      std::vector<Result> results;
+
+      for( const Shape& shape : shapes )
+      {
+         const size_t o( shape.pages ), m( shape.rows ), n( shape.columns ), p( std::min( m, n ) );
+
+         blaze::DynamicTensor<double> A( o, m, n ), B( o, m, n ), R( o, n, p ), C( o, m, n ), P( o, m, p );
+         blaze::DynamicVector<double> v( n );
+
+         blaze::randomize( A );
+         blaze::randomize( B );
+         blaze::randomize( R );
+         blaze::randomize( v );
+
+         using UnpaddedTensor = blaze::CustomTensor<double,blaze::unaligned,blaze::unpadded>;
+
+         std::vector<double> a( o*m*n ), b( o*m*n ), r( o*n*p ), c( o*m*n ), q( o*m*p );
+         UnpaddedTensor Au( a.data(), o, m, n ), Bu( b.data(), o, m, n ), Ru( r.data(), o, n, p );
+         UnpaddedTensor Cu( c.data(), o, m, n ), Pu( q.data(), o, m, p );
+
+         Au = A;
+         Bu = B;
+         Ru = R;
+
+         for( size_t threads : config.threads ) {
+            setThreads( threads );
+            benchmarkBlaze( results, config, shape, "padded"  , threads, A , B , R , C , P , v );
+            benchmarkBlaze( results, config, shape, "unpadded", threads, Au, Bu, Ru, Cu, Pu, v );
+         }
+
+         benchmarkNaive( results, config, shape, A, B, R, C, P, v );
+         benchmarkBLAS( results, config, shape, A, R, P );
+      }
+
+      std::ofstream file;
+      if( !config.output.empty() ) {
+         file.open( config.output );
+         if( !file ) {
+            throw std::runtime_error( "Unable to open '" + config.output + "'" );
+         }
+      }
+      std::ostream& os( config.output.empty() ? std::cout : file );
+
+      if     ( config.format == "csv"  ) writeCSV ( os, results );
+      else if( config.format == "json" ) writeJSON( os, results );
+      else                               writeText( os, results );
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during the dense tensor benchmark:\n" << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
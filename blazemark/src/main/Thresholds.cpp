@@ -0,0 +1,370 @@
+//=================================================================================================
+/*!
+//  \file src/main/Thresholds.cpp
+//  \brief Tuning tool for the tensor thresholds
+//
+//  Copyright (C) 2012-2018 Klaus Iglberger - All Rights Reserved
+//  Copyright (C) 2018 Hartmut Kaiser - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+// The tuning tool switches the thresholds at runtime
+#define BLAZE_USE_RUNTIME_THRESHOLDS 1
+
+#include <algorithm>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/system/BLAS.h>
+#include <blaze/system/SMP.h>
+#include <blaze/util/timing/WcTimer.h>
+#include <blaze_tensor/Math.h>
+#include <blaze_tensor/system/RuntimeThresholds.h>
+
+
+//=================================================================================================
+//
+//  TUNING FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief A single measurement of a kernel with a disabled and an enabled threshold.
+*/
+struct Sample
+{
+   size_t size;  //!< The size of the operation (in terms of the threshold).
+   double off;   //!< The runtime with the feature disabled (threshold not reached).
+   double on;    //!< The runtime with the feature enabled (threshold reached).
+};
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the minimum runtime of a single execution of the given kernel.
+//
+// \param repetitions The number of repetitions.
+// \param iterations The number of executions per repetition.
+// \param kernel The kernel to be measured.
+// \return The minimum runtime of a single execution in seconds.
+*/
+template< typename Kernel >
+double measure( size_t repetitions, size_t iterations, Kernel& kernel )
+{
+   blaze::timing::WcTimer timer;
+
+   for( size_t rep=0UL; rep<repetitions; ++rep ) {
+      timer.start();
+      for( size_t it=0UL; it<iterations; ++it ) {
+         kernel();
+      }
+      timer.end();
+   }
+
+   return timer.min() / iterations;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Measures a kernel with the given threshold disabled and enabled for a range of sizes.
+//
+// \param name The name of the threshold.
+// \param first The first (smallest) size.
+// \param last The last (largest) size.
+// \param work The number of elements per unit of size.
+// \param repetitions The number of repetitions of each measurement.
+// \param base The values of all other thresholds.
+// \param threshold The threshold to be tuned.
+// \param setup Function that creates the kernel for a given size.
+// \return The measurements for all sizes (powers of two from \a first to \a last).
+*/
+template< typename Setup >
+std::vector<Sample> sample( const char* name, size_t first, size_t last, size_t work,
+                            size_t repetitions, const blaze::TensorThresholds& base,
+                            size_t blaze::TensorThresholds::* threshold, Setup setup )
+{
+   std::cout << "\n " << name << "\n"
+             << "   " << std::setw(10) << "Size" << std::setw(14) << "Off [s]"
+             << std::setw(14) << "On [s]" << std::setw(10) << "Speedup" << "\n";
+
+   std::vector<Sample> samples;
+
+   for( size_t size=first; size<=last; size*=2UL )
+   {
+      auto kernel( setup( size ) );
+      const size_t iterations( std::max<size_t>( 1UL, ( 1UL << 22 ) / ( size * work ) ) );
+
+      blaze::TensorThresholds off( base ), on( base );
+      off.*threshold = std::numeric_limits<size_t>::max();
+      on.*threshold  = 0UL;
+
+      blaze::setTensorThresholds( off );
+      kernel();
+      const double toff( measure( repetitions, iterations, kernel ) );
+
+      blaze::setTensorThresholds( on );
+      kernel();
+      const double ton( measure( repetitions, iterations, kernel ) );
+
+      samples.push_back( Sample{ size, toff, ton } );
+
+      std::cout << "   " << std::setw(10) << size << std::scientific << std::setprecision(3)
+                << std::setw(14) << toff << std::setw(14) << ton << std::fixed << std::setprecision(2)
+                << std::setw(9) << toff / ton << "x\n";
+   }
+
+   blaze::setTensorThresholds( base );
+
+   return samples;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the crossover point of the given measurements.
+//
+// \param samples The measurements (in ascending order of size).
+// \return The smallest size from which on the enabled feature is faster for all measured sizes.
+//
+// In case the feature is not faster for the largest measured size, twice this size is returned.
+*/
+size_t crossover( const std::vector<Sample>& samples )
+{
+   size_t threshold( 2UL * samples.back().size );
+
+   for( auto it=samples.rbegin(); it!=samples.rend() && it->on < it->off; ++it ) {
+      threshold = it->size;
+   }
+
+   return threshold;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+#if defined(BLAZE_USE_HPX_THREADS)
+#include <hpx/hpx_main.hpp>
+#endif
+
+//*************************************************************************************************
+/*!\brief The main function of the threshold tuning tool.
+//
+// Usage: blazemark_thresholds [--output FILE] [--repetitions N] [--threads N]
+//
+// The tool measures the crossover points of the tensor thresholds on the current machine and
+// writes them to a thresholds header (default: Thresholds.h). The header can either be included
+// before any Blaze header file or, in applications compiled with BLAZE_USE_RUNTIME_THRESHOLDS=1,
+// be loaded at startup via the BLAZE_TENSOR_THRESHOLDS environment variable:
+//
+//  - BLAZE_SMP_DTENSASSIGN_THRESHOLD: tensor addition with 16x64 pages, serial vs. parallel
+//  - BLAZE_SMP_DARRASSIGN_THRESHOLD: scaling of a 4D array with 16x64 pages, serial vs. parallel
+//  - BLAZE_SMP_DTENSDVECMULT_THRESHOLD: tensor/vector product with 16x64 pages, serial vs. parallel
+//  - BLAZE_SMP_DTENSDMATSCHUR_THRESHOLD: tensor/matrix Schur product, serial vs. parallel
+//  - BLAZE_DTENSDVECMULT_THRESHOLD: tensor/vector product, Blaze vs. BLAS kernel (BLAS mode only)
+//
+// Thresholds that cannot be measured in the current configuration keep their default value.
+*/
+int main( int argc, char** argv )
+{
+   const char* const usage = "Usage: blazemark_thresholds [--output FILE] [--repetitions N] [--threads N]";
+
+   std::string output( "Thresholds.h" );
+   size_t repetitions( 5UL );
+
+   try
+   {
+      for( int i=1; i<argc; ++i )
+      {
+         const std::string arg( argv[i] );
+
+         if( i+1 == argc ) {
+            throw std::invalid_argument( usage );
+         }
+
+         const std::string value( argv[++i] );
+
+         if( arg == "--output" ) {
+            output = value;
+         }
+         else if( arg == "--repetitions" ) {
+            repetitions = std::max<size_t>( 1UL, std::stoul( value ) );
+         }
+         else if( arg == "--threads" ) {
+#if BLAZE_OPENMP_PARALLEL_MODE || BLAZE_CPP_THREADS_PARALLEL_MODE || BLAZE_BOOST_THREADS_PARALLEL_MODE
+            blaze::setNumThreads( std::stoul( value ) );
+#else
+            throw std::invalid_argument( "The number of threads cannot be changed in this configuration" );
+#endif
+         }
+         else {
+            throw std::invalid_argument( usage );
+         }
+      }
+
+      const blaze::TensorThresholds defaults( blaze::defaultTensorThresholds() );
+      blaze::TensorThresholds tuned( defaults );
+
+      std::cout << "\n Tuning the tensor thresholds (" << blaze::getNumThreads() << " threads)\n";
+
+#if BLAZE_OPENMP_PARALLEL_MODE || BLAZE_CPP_THREADS_PARALLEL_MODE || BLAZE_BOOST_THREADS_PARALLEL_MODE || BLAZE_HPX_PARALLEL_MODE
+      {
+         // Pages of 16x64 elements keep the matrix based thresholds of the expressions inactive
+         auto addition = []( size_t size ) {
+            blaze::DynamicTensor<double> A( size/1024UL, 16UL, 64UL ), B( size/1024UL, 16UL, 64UL ), C;
+            blaze::randomize( A );
+            blaze::randomize( B );
+            return [A,B,C]() mutable { C = A + B; };
+         };
+
+         tuned.smpDTensAssign = crossover(
+            sample( "BLAZE_SMP_DTENSASSIGN_THRESHOLD (elements of the target tensor)", 1024UL, 1UL << 22,
+                    1UL, repetitions, defaults, &blaze::TensorThresholds::smpDTensAssign, addition ) );
+      }
+
+      {
+         auto scaling = []( size_t size ) {
+            blaze::DynamicArray<4UL,double> A( 2UL, size/2048UL, 16UL, 64UL ), C;
+            blaze::randomize( A, 1.0, 2.0 );
+            return [A,C]() mutable { C = A * 2.0; };
+         };
+
+         tuned.smpDArrAssign = crossover(
+            sample( "BLAZE_SMP_DARRASSIGN_THRESHOLD (elements of the target array)", 2048UL, 1UL << 22,
+                    1UL, repetitions, defaults, &blaze::TensorThresholds::smpDArrAssign, scaling ) );
+      }
+
+      {
+         auto product = []( size_t size ) {
+            blaze::DynamicTensor<double> A( size/16UL, 16UL, 64UL );
+            blaze::DynamicVector<double> v( 64UL );
+            blaze::DynamicMatrix<double> y;
+            blaze::randomize( A );
+            blaze::randomize( v );
+            return [A,v,y]() mutable { y = A * v; };
+         };
+
+         blaze::TensorThresholds base( defaults );
+         base.dtensdvecmult = std::numeric_limits<size_t>::max();
+
+         tuned.smpDTensDVecMult = crossover(
+            sample( "BLAZE_SMP_DTENSDVECMULT_THRESHOLD (elements of the target matrix)", 16UL, 1UL << 16,
+                    64UL, repetitions, base, &blaze::TensorThresholds::smpDTensDVecMult, product ) );
+      }
+
+      {
+         auto schur = []( size_t size ) {
+            blaze::DynamicTensor<double> A( size/1024UL, 16UL, 64UL ), C;
+            blaze::DynamicMatrix<double> M( 16UL, 64UL );
+            blaze::randomize( A );
+            blaze::randomize( M );
+            return [A,M,C]() mutable { C = A % M; };
+         };
+
+         // The tensor operand must not trigger the parallel assignment by itself
+         blaze::TensorThresholds base( defaults );
+         base.smpDTensAssign = std::numeric_limits<size_t>::max();
+
+         tuned.smpDTensDMatSchur = crossover(
+            sample( "BLAZE_SMP_DTENSDMATSCHUR_THRESHOLD (elements of the target tensor)", 1024UL, 1UL << 22,
+                    1UL, repetitions, base, &blaze::TensorThresholds::smpDTensDMatSchur, schur ) );
+      }
+#else
+      std::cout << "\n Parallelization is not active, the SMP thresholds keep their default values\n";
+#endif
+
+#if BLAZE_BLAS_MODE && BLAZE_USE_BLAS_TENSOR_VECTOR_MULTIPLICATION
+      {
+         auto product = []( size_t size ) {
+            blaze::DynamicTensor<double> A( size/4096UL, 64UL, 64UL );
+            blaze::DynamicVector<double> v( 64UL );
+            blaze::DynamicMatrix<double> y;
+            blaze::randomize( A );
+            blaze::randomize( v );
+            return [A,v,y]() mutable { y = A * v; };
+         };
+
+         // Both kernels are measured single-threaded
+         blaze::TensorThresholds base( defaults );
+         base.smpDTensDVecMult = std::numeric_limits<size_t>::max();
+
+         tuned.dtensdvecmult = crossover(
+            sample( "BLAZE_DTENSDVECMULT_THRESHOLD (elements of the tensor)", 4096UL, 1UL << 24,
+                    1UL, repetitions, base, &blaze::TensorThresholds::dtensdvecmult, product ) );
+      }
+#else
+      std::cout << "\n BLAS tensor/vector multiplication is not active, BLAZE_DTENSDVECMULT_THRESHOLD keeps its default value\n";
+#endif
+
+      std::ofstream file( output );
+      if( !file ) {
+         throw std::runtime_error( "Unable to open '" + output + "'" );
+      }
+
+      file << "//=================================================================================================\n"
+           << "/*!\n"
+           << "//  \\file Thresholds.h\n"
+           << "//  \\brief Tensor thresholds tuned by blazemark_thresholds (" << blaze::getNumThreads() << " threads)\n"
+           << "//\n"
+           << "//  Include this file before any Blaze header file or, in applications compiled with\n"
+           << "//  BLAZE_USE_RUNTIME_THRESHOLDS=1, name it in the BLAZE_TENSOR_THRESHOLDS environment variable.\n"
+           << "*/\n"
+           << "//=================================================================================================\n\n";
+      blaze::writeTensorThresholds( file, tuned );
+
+      std::cout << "\n Thresholds written to '" << output << "':\n\n";
+      blaze::writeTensorThresholds( std::cout, tuned );
+      std::cout << std::endl;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during the threshold tuning:\n" << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
@@ -111,6 +111,18 @@ class GeneralTest
    void testL3Norm();
    void testL4Norm();
    void testLpNorm();
+   void testScan();
+   void testArgMinMax();
+   void testNaryMap();
+   void testNormalization();
+   void testSerialization();
+   void testMappedArray();
+   void testNumPy();
+   void testSMPAssign();
+   void testAssignAll();
+   void testParallelNorms();
+   void testAccurateSum();
+   void testParallelRandom();
 
    template< typename Type >
    void checkRows( const Type& tensor, size_t expectedRows ) const;
@@ -111,6 +111,30 @@ class GeneralTest
    void testL3Norm();
    void testL4Norm();
    void testLpNorm();
+   void testScan();
+   void testArgMinMax();
+   void testTopK();
+   void testNaryMap();
+   void testBatchedLinearAlgebra();
+   void testNormalization();
+   void testSerialization();
+   void testMappedTensor();
+   void testNumPy();
+   void testChunkedTensorReader();
+   void testTensorArena();
+   void testAppendPages();
+   void testNumaPlacement();
+   void testHugePages();
+   void testHalfPrecision();
+   void testQuantizedTensor();
+   void testRuntimeThresholds();
+   void testKernelTrace();
+   void testAsyncAssign();
+   void testAssignAll();
+   void testAxisNorms();
+   void testAccurateSum();
+   void testParallelRandom();
+   void testComparison();
 
    template< typename Type >
    void checkRows( const Type& tensor, size_t expectedRows ) const;
@@ -38,14 +38,29 @@
 // Includes
 //*************************************************************************************************
 
+#include <cmath>
+#include <cstdio>
 #include <cstdlib>
 #include <iostream>
+#include <memory>
+#include <random>
+#include <sstream>
+#include <thread>
+#include <tuple>
+#include <vector>
 #include <blaze/system/Platform.h>
+#include <blaze/system/SMP.h>
+#include <blaze/util/Serialization.h>
 #include <blazetest/mathtest/IsEqual.h>
 
 #include <blaze_tensor/math/CustomArray.h>
 #include <blaze_tensor/math/DynamicArray.h>
+#include <blaze_tensor/math/DynamicTensor.h>
+#include <blaze_tensor/math/MappedArray.h>
+#include <blaze_tensor/math/NpyView.h>
+#include <blaze_tensor/math/Serialization.h>
 #include <blaze_tensor/math/dense/DenseArray.h>
+#include <blaze_tensor/math/smp/ParallelFor.h>
 
 #include <blazetest/mathtest/densearray/GeneralTest.h>
 
@@ -90,6 +105,18 @@ GeneralTest::GeneralTest()
    testL3Norm();
    testL4Norm();
    testLpNorm();
+   testScan();
+   testArgMinMax();
+   testNaryMap();
+   testNormalization();
+   testSerialization();
+   testMappedArray();
+   testNumPy();
+   testSMPAssign();
+   testAssignAll();
+   testParallelNorms();
+   testAccurateSum();
+   testParallelRandom();
 }
 //*************************************************************************************************
 
@@ -3105,6 +3132,1224 @@ void GeneralTest::testLpNorm()
 }
 //*************************************************************************************************
 
+
+//*************************************************************************************************
+/*!\brief Test of the \c scan(), \c cumsum(), \c cumprod(), and \c cummax() functions for dense
+//        arrays.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the dimension-wise scan functions for dense arrays. In case
+// an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void GeneralTest::testScan()
+{
+   {
+      test_ = "cumsum() function";
+
+      blaze::DynamicArray<3, int> arr( 3UL, 17UL, 131UL );
+      randomize( arr, -5, 5 );
+
+      const blaze::DynamicArray<3, int> columns( blaze::cumsum<0UL>( arr ) );
+      const blaze::DynamicArray<3, int> rows   ( blaze::cumsum<1UL>( arr ) );
+      const blaze::DynamicArray<3, int> pages  ( blaze::cumsum<2UL>( arr ) );
+
+      for( size_t k=0UL; k<arr.pages(); ++k ) {
+         for( size_t i=0UL; i<arr.rows(); ++i ) {
+            for( size_t j=0UL; j<arr.columns(); ++j )
+            {
+               const int columnRef( arr(k,i,j) + ( j > 0UL ? columns(k,i,j-1UL) : 0 ) );
+               const int rowRef   ( arr(k,i,j) + ( i > 0UL ? rows   (k,i-1UL,j) : 0 ) );
+               const int pageRef  ( arr(k,i,j) + ( k > 0UL ? pages  (k-1UL,i,j) : 0 ) );
+
+               if( columns(k,i,j) != columnRef || rows(k,i,j) != rowRef || pages(k,i,j) != pageRef ) {
+                  std::ostringstream oss;
+                  oss << " Test: " << test_ << "\n"
+                      << " Error: Cumulative sum computation failed\n"
+                      << " Details:\n"
+                      << "   Element: (" << k << "," << i << "," << j << ")\n"
+                      << "   cumsum<0>(): " << columns(k,i,j) << " (expected " << columnRef << ")\n"
+                      << "   cumsum<1>(): " << rows(k,i,j) << " (expected " << rowRef << ")\n"
+                      << "   cumsum<2>(): " << pages(k,i,j) << " (expected " << pageRef << ")\n";
+                  throw std::runtime_error( oss.str() );
+               }
+            }
+         }
+      }
+   }
+
+   {
+      test_ = "cumprod() and cummax() functions";
+
+      blaze::DynamicArray<4, int> arr( 3UL, 2UL, 2UL, 3UL );
+      randomize( arr, -3, 3 );
+
+      const blaze::DynamicArray<4, int> prod( blaze::cumprod<3UL>( arr ) );
+      const blaze::DynamicArray<4, int> amax( blaze::cummax<3UL>( arr ) );
+
+      for( size_t l=0UL; l<arr.quats(); ++l ) {
+         for( size_t k=0UL; k<arr.pages(); ++k ) {
+            for( size_t i=0UL; i<arr.rows(); ++i ) {
+               for( size_t j=0UL; j<arr.columns(); ++j )
+               {
+                  const int prodRef( l > 0UL ? prod(l-1UL,k,i,j) * arr(l,k,i,j) : arr(l,k,i,j) );
+                  const int maxRef ( l > 0UL ? blaze::max( amax(l-1UL,k,i,j), arr(l,k,i,j) ) : arr(l,k,i,j) );
+
+                  if( prod(l,k,i,j) != prodRef || amax(l,k,i,j) != maxRef ) {
+                     std::ostringstream oss;
+                     oss << " Test: " << test_ << "\n"
+                         << " Error: Cumulative product/maximum computation failed\n"
+                         << " Details:\n"
+                         << "   Element: (" << l << "," << k << "," << i << "," << j << ")\n"
+                         << "   cumprod<3>(): " << prod(l,k,i,j) << " (expected " << prodRef << ")\n"
+                         << "   cummax<3>(): " << amax(l,k,i,j) << " (expected " << maxRef << ")\n";
+                     throw std::runtime_error( oss.str() );
+                  }
+               }
+            }
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c argmin(), \c argmax(), and \c topk() functions for dense arrays.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the index selecting functions for dense arrays. In case an
+// error is detected, a \a std::runtime_error exception is thrown.
+*/
+void GeneralTest::testArgMinMax()
+{
+   {
+      test_ = "argmin() and argmax() functions";
+
+      blaze::DynamicArray<3, int> arr( 3UL, 4UL, 37UL );
+      randomize( arr, -50, 50 );
+
+      const blaze::DynamicArray<2, size_t> cmax( blaze::argmax<0UL>( arr ) );
+      const blaze::DynamicArray<2, size_t> rmin( blaze::argmin<1UL>( arr ) );
+      const blaze::DynamicArray<2, size_t> pmax( blaze::argmax<2UL>( arr ) );
+
+      for( size_t k=0UL; k<arr.pages(); ++k ) {
+         for( size_t i=0UL; i<arr.rows(); ++i ) {
+            for( size_t j=0UL; j<arr.columns(); ++j )
+            {
+               if( arr(k,i,j) > arr(k,i,cmax(k,i)) || arr(k,i,j) < arr(k,rmin(k,j),j) ||
+                   arr(k,i,j) > arr(pmax(i,j),i,j) ) {
+                  std::ostringstream oss;
+                  oss << " Test: " << test_ << "\n"
+                      << " Error: Argmin/argmax computation failed\n"
+                      << " Details:\n"
+                      << "   Element (" << k << "," << i << "," << j << ") = " << arr(k,i,j) << "\n"
+                      << "   argmax<0>(): " << cmax(k,i) << "\n"
+                      << "   argmin<1>(): " << rmin(k,j) << "\n"
+                      << "   argmax<2>(): " << pmax(i,j) << "\n";
+                  throw std::runtime_error( oss.str() );
+               }
+            }
+         }
+      }
+   }
+
+   {
+      test_ = "topk() function";
+
+      blaze::DynamicArray<3, int> arr( 5UL, 2UL, 3UL );
+      randomize( arr, -50, 50 );
+
+      const blaze::DynamicArray<3, size_t> top( blaze::topk<2UL>( arr, 2UL ) );
+
+      for( size_t i=0UL; i<arr.rows(); ++i ) {
+         for( size_t j=0UL; j<arr.columns(); ++j )
+         {
+            size_t greater( 0UL );
+            for( size_t k=0UL; k<arr.pages(); ++k ) {
+               if( arr(k,i,j) > arr(top(1UL,i,j),i,j) ) ++greater;
+            }
+
+            if( top.pages() != 2UL || greater > 1UL ||
+                arr(top(0UL,i,j),i,j) < arr(top(1UL,i,j),i,j) ) {
+               std::ostringstream oss;
+               oss << " Test: " << test_ << "\n"
+                   << " Error: Top-k selection failed\n"
+                   << " Details:\n"
+                   << "   Lane (:," << i << "," << j << ")\n";
+               throw std::runtime_error( oss.str() );
+            }
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Vectorizable ternary operation for the tests of the n-ary map() function.
+*/
+struct FusedUpdate
+{
+   template< typename T >
+   T operator()( const T& x, const T& y, const T& z ) const { return x + x + y + y + y - z; }
+
+   template< typename T >
+   T load( const T& x, const T& y, const T& z ) const { return x + x + y + y + y - z; }
+};
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the n-ary \c map(), \c select() and \c where() functions for dense arrays.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the n-ary \c map(), \c select() and \c where() functions
+// for dense arrays. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void GeneralTest::testNaryMap()
+{
+   {
+      test_ = "map() function with three operands";
+
+      blaze::DynamicArray<4, double> X( 2UL, 3UL, 4UL, 13UL ), Y( 2UL, 3UL, 4UL, 13UL ), Z( 2UL, 3UL, 4UL, 13UL );
+      randomize( X );
+      randomize( Y );
+      randomize( Z );
+
+      const blaze::DynamicArray<4, double> old( Y );
+
+      Y = map( X, Y, Z, FusedUpdate() );
+
+      for( size_t l=0UL; l<2UL; ++l ) {
+         for( size_t k=0UL; k<3UL; ++k ) {
+            for( size_t i=0UL; i<4UL; ++i ) {
+               for( size_t j=0UL; j<13UL; ++j )
+               {
+                  if( Y(l,k,i,j) != FusedUpdate()( X(l,k,i,j), old(l,k,i,j), Z(l,k,i,j) ) ) {
+                     std::ostringstream oss;
+                     oss << " Test: " << test_ << "\n"
+                         << " Error: Ternary map operation failed\n"
+                         << " Details:\n"
+                         << "   Element (" << l << "," << k << "," << i << "," << j << ") = "
+                         << Y(l,k,i,j) << "\n";
+                     throw std::runtime_error( oss.str() );
+                  }
+               }
+            }
+         }
+      }
+   }
+
+   {
+      test_ = "select() and where() functions";
+
+      blaze::DynamicArray<4, int> A( 2UL, 2UL, 3UL, 9UL ), B( 2UL, 2UL, 3UL, 9UL );
+      blaze::DynamicArray<4, int> mask( 2UL, 2UL, 3UL, 9UL );
+      randomize( A, -10, 10 );
+      randomize( B, -10, 10 );
+      randomize( mask, 0, 1 );
+
+      const blaze::DynamicArray<4, int> res1( blaze::select( mask, A, B ) );
+      const blaze::DynamicArray<4, int> res2( blaze::where( mask, B, A ) );
+
+      for( size_t l=0UL; l<2UL; ++l ) {
+         for( size_t k=0UL; k<2UL; ++k ) {
+            for( size_t i=0UL; i<3UL; ++i ) {
+               for( size_t j=0UL; j<9UL; ++j )
+               {
+                  if( res1(l,k,i,j) != ( mask(l,k,i,j) ? A(l,k,i,j) : B(l,k,i,j) ) ||
+                      res2(l,k,i,j) != ( mask(l,k,i,j) ? B(l,k,i,j) : A(l,k,i,j) ) ) {
+                     std::ostringstream oss;
+                     oss << " Test: " << test_ << "\n"
+                         << " Error: Element-wise selection failed\n"
+                         << " Details:\n"
+                         << "   Element (" << l << "," << k << "," << i << "," << j << ")\n";
+                     throw std::runtime_error( oss.str() );
+                  }
+               }
+            }
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the fused \c layernorm(), \c batchnorm() and \c rmsnorm() functions.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the fused normalization functions for dense arrays. In case
+// an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void GeneralTest::testNormalization()
+{
+   const double eps( 1E-5 );
+
+   blaze::DynamicArray<4, double> A( 2UL, 3UL, 4UL, 13UL );
+   randomize( A, -4.0, 4.0 );
+
+   {
+      test_ = "layernorm() function along the third dimension";
+
+      blaze::DynamicVector<double> gamma( 3UL ), beta( 3UL );
+      randomize( gamma );
+      randomize( beta );
+
+      blaze::DynamicArray<3, double> mean, rstd;
+      const blaze::DynamicArray<4, double> B( blaze::layernorm<2>( A, gamma, beta, eps, mean, rstd ) );
+
+      for( size_t l=0UL; l<2UL; ++l ) {
+         for( size_t i=0UL; i<4UL; ++i ) {
+            for( size_t j=0UL; j<13UL; ++j )
+            {
+               double mu( 0.0 ), var( 0.0 );
+               for( size_t k=0UL; k<3UL; ++k ) {
+                  mu += A(l,k,i,j);
+               }
+               mu /= 3.0;
+               for( size_t k=0UL; k<3UL; ++k ) {
+                  var += ( A(l,k,i,j) - mu ) * ( A(l,k,i,j) - mu );
+               }
+               var /= 3.0;
+
+               const double r( 1.0 / std::sqrt( var + eps ) );
+
+               bool valid( isEqual( mean(l,i,j), mu ) && isEqual( rstd(l,i,j), r ) );
+               for( size_t k=0UL; k<3UL; ++k ) {
+                  valid = valid && isEqual( B(l,k,i,j), ( A(l,k,i,j) - mu ) * r * gamma[k] + beta[k] );
+               }
+
+               if( !valid ) {
+                  std::ostringstream oss;
+                  oss << " Test: " << test_ << "\n"
+                      << " Error: Layer normalization failed\n"
+                      << " Details:\n"
+                      << "   Fiber (" << l << ",:," << i << "," << j << ")\n"
+                      << "   Mean = " << mean(l,i,j) << ", expected " << mu << "\n";
+                  throw std::runtime_error( oss.str() );
+               }
+            }
+         }
+      }
+   }
+
+   {
+      test_ = "batchnorm() function with channels along the columns";
+
+      const blaze::DynamicArray<4, double> B( blaze::batchnorm<0>( A ) );
+
+      for( size_t j=0UL; j<13UL; ++j )
+      {
+         double mu( 0.0 ), var( 0.0 );
+         for( size_t l=0UL; l<2UL; ++l ) {
+            for( size_t k=0UL; k<3UL; ++k ) {
+               for( size_t i=0UL; i<4UL; ++i ) {
+                  mu += A(l,k,i,j);
+               }
+            }
+         }
+         mu /= 24.0;
+         for( size_t l=0UL; l<2UL; ++l ) {
+            for( size_t k=0UL; k<3UL; ++k ) {
+               for( size_t i=0UL; i<4UL; ++i ) {
+                  var += ( A(l,k,i,j) - mu ) * ( A(l,k,i,j) - mu );
+               }
+            }
+         }
+         var /= 24.0;
+
+         for( size_t l=0UL; l<2UL; ++l ) {
+            for( size_t k=0UL; k<3UL; ++k ) {
+               for( size_t i=0UL; i<4UL; ++i ) {
+                  if( !isEqual( B(l,k,i,j), ( A(l,k,i,j) - mu ) / std::sqrt( var + eps ) ) ) {
+                     std::ostringstream oss;
+                     oss << " Test: " << test_ << "\n"
+                         << " Error: Batch normalization failed\n"
+                         << " Details:\n"
+                         << "   Element (" << l << "," << k << "," << i << "," << j << ") = "
+                         << B(l,k,i,j) << "\n";
+                     throw std::runtime_error( oss.str() );
+                  }
+               }
+            }
+         }
+      }
+   }
+
+   {
+      test_ = "rmsnorm() function along the outermost dimension";
+
+      blaze::DynamicVector<double> gamma( 2UL );
+      randomize( gamma );
+
+      blaze::DynamicArray<3, double> rstd;
+      const blaze::DynamicArray<4, double> B( blaze::rmsnorm<3>( A, gamma, eps, rstd ) );
+
+      for( size_t k=0UL; k<3UL; ++k ) {
+         for( size_t i=0UL; i<4UL; ++i ) {
+            for( size_t j=0UL; j<13UL; ++j )
+            {
+               const double r( 1.0 / std::sqrt(
+                  ( A(0UL,k,i,j) * A(0UL,k,i,j) + A(1UL,k,i,j) * A(1UL,k,i,j) ) / 2.0 + eps ) );
+
+               if( !isEqual( rstd(k,i,j), r ) ||
+                   !isEqual( B(0UL,k,i,j), A(0UL,k,i,j) * r * gamma[0] ) ||
+                   !isEqual( B(1UL,k,i,j), A(1UL,k,i,j) * r * gamma[1] ) ) {
+                  std::ostringstream oss;
+                  oss << " Test: " << test_ << "\n"
+                      << " Error: RMS normalization failed\n"
+                      << " Details:\n"
+                      << "   Fiber (:," << k << "," << i << "," << j << ")\n"
+                      << "   Reciprocal root mean square = " << rstd(k,i,j) << ", expected " << r << "\n";
+                  throw std::runtime_error( oss.str() );
+               }
+            }
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the serialization of dense arrays.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c serialize() and \c deserialize() functions for dense
+// arrays. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void GeneralTest::testSerialization()
+{
+   using blaze::unaligned;
+   using blaze::unpadded;
+
+   blaze::DynamicArray<4, double> A( 2UL, 3UL, 4UL, 13UL );
+   randomize( A );
+
+   {
+      test_ = "Serialization of padded dynamic and unpadded custom arrays";
+
+      std::stringstream stream;
+      blaze::Archive<std::stringstream> archive( stream );
+
+      archive << A << A;
+
+      blaze::DynamicArray<4, double> B;
+      std::unique_ptr<double[]> memory( new double[2UL*3UL*4UL*13UL] );
+      blaze::CustomArray<4, double, unaligned, unpadded> C( memory.get(), 2UL, 3UL, 4UL, 13UL );
+
+      archive >> B >> C;
+
+      if( !( A == B ) || !( A == C ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Deserialization failed\n"
+             << " Details:\n"
+             << "   Dynamic array:\n" << B << "\n"
+             << "   Custom array:\n" << C << "\n"
+             << "   Expected result:\n" << A << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Deserialization with element type conversion";
+
+      std::stringstream stream;
+      blaze::Archive<std::stringstream> archive( stream );
+
+      archive << A;
+
+      blaze::DynamicArray<4, float> B;
+      archive >> B;
+
+      if( B.dimensions() != A.dimensions() ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid array size\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      for( size_t l=0UL; l<2UL; ++l ) {
+         for( size_t k=0UL; k<3UL; ++k ) {
+            for( size_t i=0UL; i<4UL; ++i ) {
+               for( size_t j=0UL; j<13UL; ++j ) {
+                  if( B(l,k,i,j) != float( A(l,k,i,j) ) ) {
+                     std::ostringstream oss;
+                     oss << " Test: " << test_ << "\n"
+                         << " Error: Conversion failed\n"
+                         << " Details:\n"
+                         << "   Element (" << l << "," << k << "," << i << "," << j << ") = "
+                         << B(l,k,i,j) << ", expected " << float( A(l,k,i,j) ) << "\n";
+                     throw std::runtime_error( oss.str() );
+                  }
+               }
+            }
+         }
+      }
+   }
+
+   {
+      test_ = "Deserialization into an array of wrong dimensionality";
+
+      std::stringstream stream;
+      blaze::Archive<std::stringstream> archive( stream );
+
+      archive << A;
+
+      blaze::DynamicArray<3, double> B;
+      bool failed( false );
+
+      try {
+         archive >> B;
+      }
+      catch( std::runtime_error& ) {
+         failed = true;
+      }
+
+      if( !failed ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Deserialization into an array of wrong dimensionality succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the MappedArray class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of memory mapped array files. In case an error is detected,
+// a \a std::runtime_error exception is thrown.
+*/
+void GeneralTest::testMappedArray()
+{
+   const std::string path( "blazetest_mappedarray.array" );
+
+   {
+      test_ = "Writing and mapping an array file";
+
+      blaze::DynamicArray<4, int> A( 2UL, 3UL, 4UL, 13UL );
+      randomize( A, -10, 10 );
+
+      blaze::writeMapped( path, A );
+
+      const blaze::MappedArray<4, int> mapped( path );
+
+      if( mapped.dimensions() != A.dimensions() || !( mapped.array() == A ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Mapping failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mapped.array() << "\n"
+             << "   Expected result:\n" << A << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Creating an array file";
+
+      {
+         blaze::MappedArray<3, float> mapped( path, std::array<size_t, 3>{ 7UL, 5UL, 2UL } );
+         mapped.array()( 1UL, 4UL, 6UL ) = 3.0F;
+         mapped.flush();
+      }
+
+      const blaze::MappedArray<3, float> mapped( path );
+
+      if( mapped.array()( 1UL, 4UL, 6UL ) != 3.0F || mapped.array()( 0UL, 0UL, 0UL ) != 0.0F ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Created array file has invalid content\n"
+             << " Details:\n"
+             << "   Result:\n" << mapped.array() << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Mapping an array file with wrong dimensionality";
+
+      bool failed( false );
+
+      try {
+         const blaze::MappedArray<4, float> mapped( path );
+      }
+      catch( std::invalid_argument& ) {
+         failed = true;
+      }
+
+      if( !failed ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Mapping an array file with wrong dimensionality succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   std::remove( path.c_str() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the NumPy .npy/.npz reader and writer.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of reading and writing ND arrays in the NumPy .npy and .npz
+// formats, including the zero-copy views on such files. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void GeneralTest::testNumPy()
+{
+   const std::string npyPath( "blazetest_numpy_array.npy" );
+   const std::string npzPath( "blazetest_numpy_array.npz" );
+
+   blaze::DynamicArray<4, int> A( 2UL, 3UL, 4UL, 13UL );
+   randomize( A, -10, 10 );
+
+   {
+      test_ = "Npy round trip of a padded array";
+
+      std::stringstream ss;
+      blaze::writeNpy( ss, A );
+
+      if( ss.str().find( "'shape': (2, 3, 4, 13)" ) == std::string::npos ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid npy header\n"
+             << " Details:\n"
+             << "   Header:\n" << ss.str().substr( 0UL, 128UL ) << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      blaze::DynamicArray<4, int> B;
+      blaze::readNpy( ss, B );
+
+      if( B.dimensions() != A.dimensions() || !( B == A ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Round trip failed\n"
+             << " Details:\n"
+             << "   Result:\n" << B << "\n"
+             << "   Expected result:\n" << A << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Npy file with element type conversion and fewer dimensions";
+
+      blaze::writeNpy( npyPath, A );
+
+      blaze::DynamicArray<5, double> B;
+      blaze::readNpy( npyPath, B );
+
+      const std::array<size_t, 5> dims{ 13UL, 4UL, 3UL, 2UL, 1UL };
+
+      if( B.dimensions() != dims || B( 0UL, 1UL, 2UL, 3UL, 4UL ) != double( A( 1UL, 2UL, 3UL, 4UL ) ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Conversion failed\n"
+             << " Details:\n"
+             << "   Result:\n" << B << "\n"
+             << "   Expected result:\n" << A << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Npz archive and zero-copy views";
+
+      blaze::DynamicArray<3, float> C( 3UL, 5UL, 7UL );
+      randomize( C );
+
+      {
+         blaze::NpzWriter npz( npzPath );
+         npz.write( "A", A );
+         npz.write( "C", C );
+      }
+
+      blaze::NpzReader npz( npzPath );
+
+      blaze::DynamicArray<3, float> D;
+      npz.read( "C", D );
+
+      const blaze::NpyArrayView<4, int> view( npzPath, "A" );
+      const blaze::NpyArrayView<4, int> file( npyPath );
+
+      if( !( D == C ) || !( view.array() == A ) || !( file.array() == A ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Npz round trip failed\n"
+             << " Details:\n"
+             << "   Result:\n" << D << "\n" << view.array() << "\n"
+             << "   Expected result:\n" << C << "\n" << A << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Npy file with too many dimensions";
+
+      bool failed( false );
+
+      try {
+         blaze::DynamicArray<3, int> B;
+         blaze::readNpy( npyPath, B );
+      }
+      catch( std::invalid_argument& ) {
+         failed = true;
+      }
+
+      if( !failed ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Reading into an array with too few dimensions succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   std::remove( npyPath.c_str() );
+   std::remove( npzPath.c_str() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the SMP assignment of dense arrays.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the (compound) assignment of dense arrays with uneven extents
+// below and above the SMP assignment threshold and of nested parallel loops. In case an error is
+// detected, a \a std::runtime_error exception is thrown.
+*/
+void GeneralTest::testSMPAssign()
+{
+   test_ = "SMP assignment";
+
+   const size_t threshold( blaze::smpDArrAssignThreshold() );
+   const size_t shapes[2][3] = { { 3UL, 5UL, 7UL },
+                                 { threshold/( 37UL*1031UL ) + 3UL, 37UL, 1031UL } };
+
+   for( const auto& shape : shapes )
+   {
+      const size_t o( shape[0] ), m( shape[1] ), n( shape[2] );
+
+      blaze::DynamicArray<3, double> A( o, m, n );
+      blaze::DynamicArray<3, double> B( o, m, n );
+
+      for( size_t k=0UL; k<o; ++k ) {
+         for( size_t i=0UL; i<m; ++i ) {
+            for( size_t j=0UL; j<n; ++j ) {
+               A(k,i,j) = double( ( k + 2UL*i + 3UL*j ) % 11UL ) - 4.5;
+               B(k,i,j) = double( ( 2UL*k + i + j ) % 7UL ) + 1.0;
+            }
+         }
+      }
+
+      const auto check( [&]( const blaze::DynamicArray<3, double>& C, const char* op, auto ref ) {
+         for( size_t k=0UL; k<o; ++k ) {
+            for( size_t i=0UL; i<m; ++i ) {
+               for( size_t j=0UL; j<n; ++j ) {
+                  if( C(k,i,j) != ref( k, i, j ) ) {
+                     std::ostringstream oss;
+                     oss << " Test: " << test_ << "\n"
+                         << " Error: " << op << " failed\n"
+                         << " Details:\n"
+                         << "   Size: (" << o << "," << m << "," << n << ")\n"
+                         << "   Element (" << k << "," << i << "," << j << ")\n"
+                         << "   Result: " << C(k,i,j) << "\n"
+                         << "   Expected result: " << ref( k, i, j ) << "\n";
+                     throw std::runtime_error( oss.str() );
+                  }
+               }
+            }
+         }
+      } );
+
+      blaze::DynamicArray<3, double> C( o, m, n );
+
+      C = A;
+      check( C, "Assignment", [&]( size_t k, size_t i, size_t j ) {
+         return A(k,i,j);
+      } );
+
+      C += B;
+      check( C, "Addition assignment", [&]( size_t k, size_t i, size_t j ) {
+         return A(k,i,j) + B(k,i,j);
+      } );
+
+      C -= A;
+      check( C, "Subtraction assignment", [&]( size_t k, size_t i, size_t j ) {
+         return B(k,i,j);
+      } );
+
+      C %= A;
+      check( C, "Schur product assignment", [&]( size_t k, size_t i, size_t j ) {
+         return B(k,i,j) * A(k,i,j);
+      } );
+   }
+
+#if !BLAZE_HPX_PARALLEL_MODE && !BLAZE_OPENMP_PARALLEL_MODE
+   {
+      const size_t outer( 64UL ), inner( 257UL );
+
+      std::vector<int> hits( outer*inner, 0 );
+      std::vector<int> inlined( outer, 1 );
+
+      blaze::smpFor( 0UL, outer, [&]( size_t i ) {
+         const std::thread::id id( std::this_thread::get_id() );
+         blaze::smpFor( 0UL, inner, [&]( size_t j ) {
+            ++hits[i*inner+j];
+            if( std::this_thread::get_id() != id )
+               inlined[i] = 0;
+         } );
+      } );
+
+      for( size_t i=0UL; i<outer; ++i ) {
+         for( size_t j=0UL; j<inner; ++j ) {
+            if( hits[i*inner+j] != 1 || inlined[i] != 1 ) {
+               std::ostringstream oss;
+               oss << " Test: " << test_ << "\n"
+                   << " Error: Nested parallel loop failed\n"
+                   << " Details:\n"
+                   << "   Index (" << i << "," << j << ")\n"
+                   << "   Number of calls: " << hits[i*inner+j] << "\n"
+                   << "   Executed inline: " << inlined[i] << "\n";
+               throw std::runtime_error( oss.str() );
+            }
+         }
+      }
+   }
+#endif
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the fused multi-output assignment of dense arrays.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the fused assignment of several dense array expressions and
+// reductions via the assignAll() function. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+void GeneralTest::testAssignAll()
+{
+   test_ = "Fused multi-output assignment";
+
+   const size_t dims[4] = { 3UL, 4UL, 70UL, 131UL };
+
+   blaze::DynamicArray<4, double> A( dims[0], dims[1], dims[2], dims[3] );
+   blaze::DynamicArray<4, double> B( dims[0], dims[1], dims[2], dims[3] );
+
+   for( size_t l=0UL; l<dims[0]; ++l ) {
+      for( size_t k=0UL; k<dims[1]; ++k ) {
+         for( size_t i=0UL; i<dims[2]; ++i ) {
+            for( size_t j=0UL; j<dims[3]; ++j ) {
+               A(l,k,i,j) = double( ( 7UL*l + 5UL*k + 3UL*i + j ) % 29UL );
+               B(l,k,i,j) = double( j % 13UL ) - 6.0;
+            }
+         }
+      }
+   }
+
+   {
+      blaze::DynamicArray<4, double> C, D;
+      double s( 0.0 ), m( 0.0 ), s2( 0.0 ), m2( 0.0 );
+
+      blaze::assignAll( std::tie( C, D, s, m ), A * 2.0, blaze::map( A, B, blaze::Add() ),
+                        blaze::fusedSum( A ), blaze::fusedReduce( B, blaze::Max() ) );
+
+      for( size_t l=0UL; l<dims[0]; ++l ) {
+         for( size_t k=0UL; k<dims[1]; ++k ) {
+            for( size_t i=0UL; i<dims[2]; ++i ) {
+               for( size_t j=0UL; j<dims[3]; ++j ) {
+                  s2 += A(l,k,i,j);
+                  m2  = blaze::max( m2, B(l,k,i,j) );
+
+                  if( C(l,k,i,j) != A(l,k,i,j) * 2.0 || D(l,k,i,j) != A(l,k,i,j) + B(l,k,i,j) ) {
+                     std::ostringstream oss;
+                     oss << " Test: " << test_ << "\n"
+                         << " Error: Fused assignment failed\n"
+                         << " Details:\n"
+                         << "   Element (" << l << "," << k << "," << i << "," << j << ")\n"
+                         << "   Result:   " << C(l,k,i,j) << ", " << D(l,k,i,j) << "\n"
+                         << "   Expected: " << A(l,k,i,j) * 2.0 << ", "
+                         << A(l,k,i,j) + B(l,k,i,j) << "\n";
+                     throw std::runtime_error( oss.str() );
+                  }
+               }
+            }
+         }
+      }
+
+      if( s != s2 || m != m2 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Fused reduction failed\n"
+             << " Details:\n"
+             << "   Result:   sum = " << s << ", max = " << m << "\n"
+             << "   Expected: sum = " << s2 << ", max = " << m2 << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      blaze::DynamicArray<3, int> X( 2UL, 5UL, 7UL );
+
+      for( size_t k=0UL; k<2UL; ++k ) {
+         for( size_t i=0UL; i<5UL; ++i ) {
+            for( size_t j=0UL; j<7UL; ++j ) {
+               X(k,i,j) = int( k + i + j );
+            }
+         }
+      }
+
+      blaze::DynamicArray<3, int> Y( X );
+      blaze::DynamicArray<3, int> Z;
+
+      blaze::assignAll( std::tie( Y, Z ), Y * 2, blaze::map( Y, X, blaze::Add() ) );
+
+      for( size_t k=0UL; k<2UL; ++k ) {
+         for( size_t i=0UL; i<5UL; ++i ) {
+            for( size_t j=0UL; j<7UL; ++j ) {
+               if( Y(k,i,j) != X(k,i,j) * 2 || Z(k,i,j) != X(k,i,j) * 3 ) {
+                  std::ostringstream oss;
+                  oss << " Test: " << test_ << "\n"
+                      << " Error: Fused assignment to an operand failed\n"
+                      << " Details:\n"
+                      << "   Element (" << k << "," << i << "," << j << ")\n"
+                      << "   Result:   " << Y(k,i,j) << ", " << Z(k,i,j) << "\n"
+                      << "   Expected: " << X(k,i,j) * 2 << ", " << X(k,i,j) * 3 << "\n";
+                  throw std::runtime_error( oss.str() );
+               }
+            }
+         }
+      }
+   }
+
+   try {
+      blaze::DynamicArray<4, double> C;
+      blaze::DynamicArray<4, double> D( dims[1], dims[0], dims[2], dims[3] );
+      double s( 0.0 );
+
+      blaze::assignAll( std::tie( C, s ), A * 2.0, blaze::fusedSum( D ) );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Fused assignment of differently sized arrays succeeded\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::invalid_argument& ) {}
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the parallel norms of dense arrays.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the sqrNorm(), l1Norm(), l2Norm(), l3Norm() and maxNorm()
+// functions for arrays that are large enough to be reduced in parallel. In case an error is
+// detected, a \a std::runtime_error exception is thrown.
+*/
+void GeneralTest::testParallelNorms()
+{
+   test_ = "Parallel norms";
+
+   {
+      blaze::DynamicArray<3, double> A( 6UL, 70UL, 301UL );
+
+      double sqr( 0.0 ), l1( 0.0 ), l3( 0.0 ), linf( 0.0 );
+
+      for( size_t k=0UL; k<6UL; ++k ) {
+         for( size_t i=0UL; i<70UL; ++i ) {
+            for( size_t j=0UL; j<301UL; ++j ) {
+               A(k,i,j) = double( ( k + 2UL*i + 3UL*j ) % 17UL ) - 8.0;
+               sqr  += A(k,i,j) * A(k,i,j);
+               l1   += std::abs( A(k,i,j) );
+               l3   += std::abs( A(k,i,j) * A(k,i,j) * A(k,i,j) );
+               linf  = blaze::max( linf, std::abs( A(k,i,j) ) );
+            }
+         }
+      }
+
+      if( !blaze::equal( blaze::sqrNorm( A ), sqr ) ||
+          !blaze::equal( blaze::l2Norm( A ), std::sqrt( sqr ) ) ||
+          !blaze::equal( blaze::l1Norm( A ), l1 ) ||
+          !blaze::equal( blaze::l3Norm( A ), std::cbrt( l3 ) ) || blaze::maxNorm( A ) != linf ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Norm computation failed\n"
+             << " Details:\n"
+             << "   Result:   sqrNorm = " << blaze::sqrNorm( A ) << ", l1Norm = "
+             << blaze::l1Norm( A ) << ", l3Norm = " << blaze::l3Norm( A )
+             << ", maxNorm = " << blaze::maxNorm( A ) << "\n"
+             << "   Expected: sqrNorm = " << sqr << ", l1Norm = " << l1
+             << ", l3Norm = " << std::cbrt( l3 ) << ", maxNorm = " << linf << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      blaze::DynamicArray<4, int> A( 3UL, 5UL, 41UL, 203UL );
+
+      int sqr( 0 ), l1( 0 ), linf( 0 );
+
+      for( size_t l=0UL; l<3UL; ++l ) {
+         for( size_t k=0UL; k<5UL; ++k ) {
+            for( size_t i=0UL; i<41UL; ++i ) {
+               for( size_t j=0UL; j<203UL; ++j ) {
+                  const int value( int( ( 5UL*l + k + 2UL*i + 3UL*j ) % 13UL ) - 6 );
+                  A(l,k,i,j) = value;
+                  sqr  += value * value;
+                  l1   += std::abs( value );
+                  linf  = blaze::max( linf, std::abs( value ) );
+               }
+            }
+         }
+      }
+
+      if( blaze::sqrNorm( A ) != sqr || blaze::l1Norm( A ) != l1 || blaze::maxNorm( A ) != linf ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Norm computation of a four-dimensional array failed\n"
+             << " Details:\n"
+             << "   Result:   sqrNorm = " << blaze::sqrNorm( A ) << ", l1Norm = "
+             << blaze::l1Norm( A ) << ", maxNorm = " << blaze::maxNorm( A ) << "\n"
+             << "   Expected: sqrNorm = " << sqr << ", l1Norm = " << l1
+             << ", maxNorm = " << linf << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the accurate summation modes for dense arrays.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the Kahan-compensated, the pairwise and the widened summation
+// of a single precision array and of the corresponding reduction and norm functions. In case an
+// error is detected, a \a std::runtime_error exception is thrown.
+*/
+void GeneralTest::testAccurateSum()
+{
+   test_ = "Accurate summation";
+
+   blaze::DynamicArray<3, float> A( 4UL, 60UL, 1001UL );
+
+   double ref( 0.0 ), sqr( 0.0 );
+
+   for( size_t k=0UL; k<4UL; ++k ) {
+      for( size_t i=0UL; i<60UL; ++i ) {
+         for( size_t j=0UL; j<1001UL; ++j ) {
+            A(k,i,j) = 0.1F + float( ( k + i + j ) % 7UL ) * 0.01F;
+            ref += double( A(k,i,j) );
+            sqr += double( A(k,i,j) ) * double( A(k,i,j) );
+         }
+      }
+   }
+
+   {
+      const double s1( blaze::sum( A, blaze::kahan ) );
+      const double s2( blaze::sum( A, blaze::pairwise ) );
+      const double s3( blaze::sum( A, blaze::widened<double> ) );
+
+      if( std::abs( s1 - ref ) > 1E-6 * ref || std::abs( s2 - ref ) > 1E-5 * ref ||
+          std::abs( s3 - ref ) > 1E-5 * ref ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Accurate summation failed\n"
+             << " Details:\n"
+             << "   Result:   kahan = " << s1 << ", pairwise = " << s2
+             << ", widened = " << s3 << "\n"
+             << "   Expected: " << ref << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      const double r1( blaze::reduce( A, blaze::Add(), blaze::kahan ) );
+      const double r2( blaze::reduce( A, blaze::Add(), blaze::pairwise ) );
+      const double r3( blaze::reduce( A, blaze::Add(), blaze::widened<double> ) );
+
+      if( std::abs( r1 - ref ) > 1E-6 * ref || std::abs( r2 - ref ) > 1E-5 * ref ||
+          std::abs( r3 - ref ) > 1E-5 * ref ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Accurate reduction failed\n"
+             << " Details:\n"
+             << "   Result:   kahan = " << r1 << ", pairwise = " << r2
+             << ", widened = " << r3 << "\n"
+             << "   Expected: " << ref << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      const double n1( blaze::sqrNorm( A, blaze::widened<double> ) );
+      const double n2( blaze::l2Norm( A, blaze::kahan ) );
+      const double n3( blaze::norm( A, blaze::pairwise ) );
+      const double n4( blaze::l1Norm( A, blaze::kahan ) );
+      const double n5( blaze::lpNorm( A, 2.0F, blaze::widened<double> ) );
+
+      if( std::abs( n1 - sqr ) > 1E-5 * sqr ||
+          std::abs( n2 - std::sqrt( sqr ) ) > 1E-6 * std::sqrt( sqr ) ||
+          std::abs( n3 - std::sqrt( sqr ) ) > 1E-5 * std::sqrt( sqr ) ||
+          std::abs( n4 - ref ) > 1E-6 * ref ||
+          std::abs( n5 - std::sqrt( sqr ) ) > 1E-5 * std::sqrt( sqr ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Accurate norm computation failed\n"
+             << " Details:\n"
+             << "   Result:   sqrNorm = " << n1 << ", l2Norm = " << n2 << ", norm = " << n3
+             << ", l1Norm = " << n4 << ", lpNorm = " << n5 << "\n"
+             << "   Expected: sqrNorm = " << sqr << ", l2Norm = " << std::sqrt( sqr )
+             << ", l1Norm = " << ref << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the counter-based random initialization of dense arrays.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c randomize() functions for dense arrays with and without
+// padding. The generated values are expected to depend on the seed and the element index only
+// and to lie in the range of the given distribution. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void GeneralTest::testParallelRandom()
+{
+   using blaze::unaligned;
+   using blaze::unpadded;
+
+   test_ = "Parallel random initialization";
+
+   const size_t o( 3UL ), m( 70UL ), n( 517UL );
+
+   const std::uniform_real_distribution<double> dist( -2.0, 3.0 );
+
+   blaze::DynamicArray<3, double> A( o, m, n );
+   blaze::DynamicArray<3, double> B( o, m, n );
+
+   blaze::randomize( A, dist, 42UL );
+   blaze::randomize( B, dist, 42UL );
+
+   {
+      blaze::DynamicTensor<double> T( o, m, n );
+      blaze::randomize( T, dist, 42UL );
+
+      bool equal( A == B );
+
+      for( size_t k=0UL; k<o; ++k ) {
+         for( size_t i=0UL; i<m; ++i ) {
+            for( size_t j=0UL; j<n; ++j ) {
+               equal = equal && A(k,i,j) == T(k,i,j);
+            }
+            for( size_t j=n; j<A.spacing(); ++j ) {
+               equal = equal && A.data()[( k*m + i )*A.spacing() + j] == 0.0;
+            }
+         }
+      }
+
+      if( !equal ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Random initialization is not reproducible\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      std::unique_ptr<double[]> memory( new double[o*m*n+1UL] );
+      memory[o*m*n] = -7.0;
+
+      blaze::CustomArray<3, double, unaligned, unpadded> C( memory.get(), o, m, n );
+      blaze::randomize( C, dist, 42UL );
+
+      if( !( C == A ) || memory[o*m*n] != -7.0 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Random initialization of an unpadded array failed\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   if( blaze::min( A ) < -2.0 || blaze::max( A ) >= 3.0 ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Random values out of range\n"
+          << " Details:\n"
+          << "   Result:   [" << blaze::min( A ) << "," << blaze::max( A ) << "]\n"
+          << "   Expected: [-2,3)\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   blaze::randomize( B, dist, 43UL );
+
+   if( A == B ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Different seeds produced identical values\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   {
+      blaze::DynamicArray<4, int> D( 2UL, 3UL, 10UL, 100UL );
+
+      blaze::randomize( D, std::uniform_int_distribution<int>( -3, 3 ), 1UL );
+
+      if( blaze::min( D ) != -3 || blaze::max( D ) != 3 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Integer random values out of range\n"
+             << " Details:\n"
+             << "   Result:   [" << blaze::min( D ) << "," << blaze::max( D ) << "]\n"
+             << "   Expected: [-3,3]\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
 } // namespace densearray
 
 } // namespace mathtest
@@ -38,13 +38,38 @@
 // Includes
 //*************************************************************************************************
 
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
 #include <cstdlib>
+#include <fstream>
+#include <limits>
 #include <iostream>
+#include <memory>
+#include <random>
+#include <sstream>
+#include <string>
+#include <tuple>
+#include <vector>
 #include <blaze/system/Platform.h>
+#include <blaze/util/Serialization.h>
 #include <blazetest/mathtest/IsEqual.h>
 
+#include <blaze_tensor/math/ChunkedTensorReader.h>
+#include <blaze_tensor/math/CircularTensor.h>
+#include <blaze_tensor/math/CustomTensor.h>
+#include <blaze_tensor/math/DynamicArray.h>
 #include <blaze_tensor/math/DynamicTensor.h>
+#include <blaze_tensor/math/MappedTensor.h>
+#include <blaze_tensor/math/NpyView.h>
+#include <blaze_tensor/math/PageSlice.h>
+#include <blaze_tensor/math/QuantizedTensor.h>
+#include <blaze_tensor/math/Serialization.h>
+#include <blaze_tensor/math/StaticTensor.h>
+#include <blaze_tensor/math/Subtensor.h>
 #include <blaze_tensor/math/dense/DenseTensor.h>
+#include <blaze_tensor/system/RuntimeThresholds.h>
+#include <blaze_tensor/util/KernelTrace.h>
 
 #include <blazetest/mathtest/densetensor/GeneralTest.h>
 
@@ -89,6 +114,30 @@ GeneralTest::GeneralTest()
    testL3Norm();
    testL4Norm();
    testLpNorm();
+   testScan();
+   testArgMinMax();
+   testTopK();
+   testNaryMap();
+   testBatchedLinearAlgebra();
+   testNormalization();
+   testSerialization();
+   testMappedTensor();
+   testNumPy();
+   testChunkedTensorReader();
+   testTensorArena();
+   testAppendPages();
+   testNumaPlacement();
+   testHugePages();
+   testHalfPrecision();
+   testQuantizedTensor();
+   testRuntimeThresholds();
+   testKernelTrace();
+   testAsyncAssign();
+   testAssignAll();
+   testAxisNorms();
+   testAccurateSum();
+   testParallelRandom();
+   testComparison();
 }
 //*************************************************************************************************
 
@@ -3104,6 +3153,2800 @@ void GeneralTest::testLpNorm()
 }
 //*************************************************************************************************
 
+
+//*************************************************************************************************
+/*!\brief Test of the \c scan(), \c cumsum(), \c cumprod(), and \c cummax() functions for dense
+//        tensors.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the axis-wise scan functions for dense tensors. In case an
+// error is detected, a \a std::runtime_error exception is thrown.
+*/
+void GeneralTest::testScan()
+{
+   //=====================================================================================
+   // Row-major tensor tests
+   //=====================================================================================
+
+   {
+      test_ = "cumsum() function";
+
+      blaze::DynamicTensor<int> tens{ { { 1, 2, 3 }, { 4, 5, 6 } },
+                                      { { 7, 8, 9 }, { 1, 2, 3 } } };
+
+      const blaze::DynamicTensor<int> pages  ( blaze::cumsum<blaze::pagewise>  ( tens ) );
+      const blaze::DynamicTensor<int> columns( blaze::cumsum<blaze::columnwise>( tens ) );
+      const blaze::DynamicTensor<int> rows   ( blaze::cumsum<blaze::rowwise>   ( tens ) );
+
+      const blaze::DynamicTensor<int> pagesRef{ { { 1,  2,  3 }, { 4, 5, 6 } },
+                                                { { 8, 10, 12 }, { 5, 7, 9 } } };
+      const blaze::DynamicTensor<int> columnsRef{ { { 1, 2, 3 }, {  5,  7,  9 } },
+                                                  { { 7, 8, 9 }, {  8, 10, 12 } } };
+      const blaze::DynamicTensor<int> rowsRef{ { { 1,  3,  6 }, { 4,  9, 15 } },
+                                               { { 7, 15, 24 }, { 1,  3,  6 } } };
+
+      if( pages != pagesRef || columns != columnsRef || rows != rowsRef ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Cumulative sum computation failed\n"
+             << " Details:\n"
+             << "   Page-wise result:\n" << pages << "\n"
+             << "   Expected page-wise result:\n" << pagesRef << "\n"
+             << "   Column-wise result:\n" << columns << "\n"
+             << "   Expected column-wise result:\n" << columnsRef << "\n"
+             << "   Row-wise result:\n" << rows << "\n"
+             << "   Expected row-wise result:\n" << rowsRef << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "cumprod() and cummax() functions";
+
+      blaze::DynamicTensor<int> tens{ { { 1, 3, 2 }, { 6, 4, 5 } } };
+
+      const blaze::DynamicTensor<int> prod( blaze::cumprod<blaze::rowwise>( tens ) );
+      const blaze::DynamicTensor<int> rmax( blaze::cummax<blaze::rowwise>   ( tens ) );
+      const blaze::DynamicTensor<int> cmax( blaze::cummax<blaze::columnwise>( tens ) );
+
+      const blaze::DynamicTensor<int> prodRef{ { { 1, 3, 6 }, { 6, 24, 120 } } };
+      const blaze::DynamicTensor<int> maxRef { { { 1, 3, 3 }, { 6,  6,   6 } } };
+      const blaze::DynamicTensor<int> cmaxRef{ { { 1, 3, 2 }, { 6,  4,   5 } } };
+
+      if( prod != prodRef || rmax != maxRef || cmax != cmaxRef ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Cumulative product/maximum computation failed\n"
+             << " Details:\n"
+             << "   cumprod<rowwise>():\n" << prod << "\n"
+             << "   Expected result:\n" << prodRef << "\n"
+             << "   cummax<rowwise>():\n" << rmax << "\n"
+             << "   Expected result:\n" << maxRef << "\n"
+             << "   cummax<columnwise>():\n" << cmax << "\n"
+             << "   Expected result:\n" << cmaxRef << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "scan() function (large tensor)";
+
+      blaze::DynamicTensor<int> tens( 3UL, 67UL, 523UL );
+      randomize( tens, -5, 5 );
+
+      const blaze::DynamicTensor<int> pages  ( blaze::scan<blaze::pagewise>  ( tens, blaze::Add() ) );
+      const blaze::DynamicTensor<int> columns( blaze::scan<blaze::columnwise>( tens, blaze::Add() ) );
+      const blaze::DynamicTensor<int> rows   ( blaze::scan<blaze::rowwise>   ( tens, blaze::Add() ) );
+
+      for( size_t k=0UL; k<tens.pages(); ++k ) {
+         for( size_t i=0UL; i<tens.rows(); ++i ) {
+            for( size_t j=0UL; j<tens.columns(); ++j )
+            {
+               const int pageRef  ( tens(k,i,j) + ( k > 0UL ? pages  (k-1UL,i,j) : 0 ) );
+               const int columnRef( tens(k,i,j) + ( i > 0UL ? columns(k,i-1UL,j) : 0 ) );
+               const int rowRef   ( tens(k,i,j) + ( j > 0UL ? rows   (k,i,j-1UL) : 0 ) );
+
+               if( pages(k,i,j) != pageRef || columns(k,i,j) != columnRef || rows(k,i,j) != rowRef ) {
+                  std::ostringstream oss;
+                  oss << " Test: " << test_ << "\n"
+                      << " Error: Scan computation failed\n"
+                      << " Details:\n"
+                      << "   Element: (" << k << "," << i << "," << j << ")\n"
+                      << "   Page-wise result  : " << pages(k,i,j) << " (expected " << pageRef << ")\n"
+                      << "   Column-wise result: " << columns(k,i,j) << " (expected " << columnRef << ")\n"
+                      << "   Row-wise result   : " << rows(k,i,j) << " (expected " << rowRef << ")\n";
+                  throw std::runtime_error( oss.str() );
+               }
+            }
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c argmin() and \c argmax() functions for dense tensors.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c argmin() and \c argmax() functions for dense tensors.
+// In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void GeneralTest::testArgMinMax()
+{
+   //=====================================================================================
+   // Row-major tensor tests
+   //=====================================================================================
+
+   {
+      test_ = "argmax() function";
+
+      blaze::DynamicTensor<int> tens{ { { 1, 5, 2 }, { 7, 4, 7 } },
+                                      { { 3, 5, 0 }, { 1, 9, 2 } } };
+
+      const blaze::DynamicMatrix<size_t> pages  ( blaze::argmax<blaze::pagewise>  ( tens ) );
+      const blaze::DynamicMatrix<size_t> columns( blaze::argmax<blaze::columnwise>( tens ) );
+      const blaze::DynamicMatrix<size_t> rows   ( blaze::argmax<blaze::rowwise>   ( tens ) );
+
+      const blaze::DynamicMatrix<size_t> pagesRef  { { 1, 0, 0 }, { 0, 1, 0 } };
+      const blaze::DynamicMatrix<size_t> columnsRef{ { 1, 0, 1 }, { 0, 1, 1 } };
+      const blaze::DynamicMatrix<size_t> rowsRef   { { 1, 0 }, { 1, 1 } };
+
+      if( pages != pagesRef || columns != columnsRef || rows != rowsRef ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Argmax computation failed\n"
+             << " Details:\n"
+             << "   Page-wise result:\n" << pages << "\n"
+             << "   Expected page-wise result:\n" << pagesRef << "\n"
+             << "   Column-wise result:\n" << columns << "\n"
+             << "   Expected column-wise result:\n" << columnsRef << "\n"
+             << "   Row-wise result:\n" << rows << "\n"
+             << "   Expected row-wise result:\n" << rowsRef << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "argmin() and argmax() functions (large tensor)";
+
+      blaze::DynamicTensor<double> tens( 3UL, 5UL, 301UL );
+      randomize( tens, -10.0, 10.0 );
+
+      const blaze::DynamicMatrix<size_t> rmax( blaze::argmax<blaze::rowwise>( tens ) );
+      const blaze::DynamicMatrix<size_t> rmin( blaze::argmin<blaze::rowwise>( tens ) );
+      const blaze::DynamicMatrix<size_t> cmax( blaze::argmax<blaze::columnwise>( tens ) );
+      const blaze::DynamicMatrix<size_t> pmin( blaze::argmin<blaze::pagewise>( tens ) );
+
+      for( size_t k=0UL; k<tens.pages(); ++k ) {
+         for( size_t i=0UL; i<tens.rows(); ++i ) {
+            for( size_t j=0UL; j<tens.columns(); ++j )
+            {
+               if( tens(k,i,j) > tens(k,i,rmax(k,i)) || tens(k,i,j) < tens(k,i,rmin(k,i)) ||
+                   tens(k,i,j) > tens(k,cmax(k,j),j) || tens(k,i,j) < tens(pmin(i,j),i,j) ) {
+                  std::ostringstream oss;
+                  oss << " Test: " << test_ << "\n"
+                      << " Error: Argmin/argmax computation failed\n"
+                      << " Details:\n"
+                      << "   Element (" << k << "," << i << "," << j << ") = " << tens(k,i,j) << "\n"
+                      << "   argmax<rowwise>(): " << rmax(k,i) << "\n"
+                      << "   argmin<rowwise>(): " << rmin(k,i) << "\n"
+                      << "   argmax<columnwise>(): " << cmax(k,j) << "\n"
+                      << "   argmin<pagewise>(): " << pmin(i,j) << "\n";
+                  throw std::runtime_error( oss.str() );
+               }
+            }
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c topk() function for dense tensors.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c topk() function for dense tensors. In case an error
+// is detected, a \a std::runtime_error exception is thrown.
+*/
+void GeneralTest::testTopK()
+{
+   //=====================================================================================
+   // Row-major tensor tests
+   //=====================================================================================
+
+   {
+      test_ = "topk() function";
+
+      blaze::DynamicTensor<int> tens{ { { 1, 5, 2, 9 }, { 7, 4, 7, 3 } },
+                                      { { 6, 0, 8, 2 }, { 1, 9, 2, 4 } } };
+
+      const blaze::DynamicTensor<size_t> rows( blaze::topk<blaze::rowwise>( tens, 2UL ) );
+      const blaze::DynamicTensor<size_t> pages( blaze::topk<blaze::pagewise>( tens, 1UL ) );
+
+      const blaze::DynamicTensor<size_t> rowsRef{ { { 3, 1 }, { 0, 2 } },
+                                                  { { 2, 0 }, { 1, 3 } } };
+      const blaze::DynamicTensor<size_t> pagesRef{ { { 1, 0, 1, 0 }, { 0, 1, 0, 1 } } };
+
+      if( rows != rowsRef || pages != pagesRef ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Top-k selection failed\n"
+             << " Details:\n"
+             << "   Row-wise result:\n" << rows << "\n"
+             << "   Expected row-wise result:\n" << rowsRef << "\n"
+             << "   Page-wise result:\n" << pages << "\n"
+             << "   Expected page-wise result:\n" << pagesRef << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "topk() function with values";
+
+      blaze::DynamicTensor<int> tens( 2UL, 31UL, 7UL );
+      randomize( tens, -20, 20 );
+
+      blaze::DynamicTensor<int> values;
+      blaze::DynamicTensor<size_t> indices;
+
+      blaze::topk<blaze::columnwise>( tens, 4UL, values, indices );
+
+      checkPages  ( values, 2UL );
+      checkRows   ( values, 4UL );
+      checkColumns( values, 7UL );
+
+      for( size_t k=0UL; k<tens.pages(); ++k ) {
+         for( size_t j=0UL; j<tens.columns(); ++j )
+         {
+            size_t greater( 0UL );
+            for( size_t i=0UL; i<tens.rows(); ++i ) {
+               if( tens(k,i,j) > values(k,3UL,j) ) ++greater;
+            }
+
+            for( size_t r=0UL; r<4UL; ++r )
+            {
+               if( tens(k,indices(k,r,j),j) != values(k,r,j) ||
+                   ( r > 0UL && values(k,r,j) > values(k,r-1UL,j) ) || greater > 3UL ) {
+                  std::ostringstream oss;
+                  oss << " Test: " << test_ << "\n"
+                      << " Error: Top-k selection failed\n"
+                      << " Details:\n"
+                      << "   Lane (" << k << ",:," << j << ")\n"
+                      << "   Values:\n" << values << "\n"
+                      << "   Indices:\n" << indices << "\n";
+                  throw std::runtime_error( oss.str() );
+               }
+            }
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Vectorizable ternary operation for the tests of the n-ary map() function.
+*/
+struct FusedUpdate
+{
+   template< typename T >
+   T operator()( const T& x, const T& y, const T& z ) const { return x + x + y + y + y - z; }
+
+   template< typename T >
+   T load( const T& x, const T& y, const T& z ) const { return x + x + y + y + y - z; }
+};
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the n-ary \c map(), \c select() and \c where() functions for dense tensors.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the n-ary \c map(), \c select() and \c where() functions
+// for dense tensors. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void GeneralTest::testNaryMap()
+{
+   //=====================================================================================
+   // Row-major tensor tests
+   //=====================================================================================
+
+   {
+      test_ = "map() function with three operands";
+
+      blaze::DynamicTensor<double> X( 3UL, 5UL, 19UL ), Y( 3UL, 5UL, 19UL ), Z( 3UL, 5UL, 19UL );
+      randomize( X );
+      randomize( Y );
+      randomize( Z );
+
+      blaze::DynamicTensor<double> ref( 3UL, 5UL, 19UL );
+      for( size_t k=0UL; k<ref.pages(); ++k ) {
+         for( size_t i=0UL; i<ref.rows(); ++i ) {
+            for( size_t j=0UL; j<ref.columns(); ++j ) {
+               ref(k,i,j) = FusedUpdate()( X(k,i,j), Y(k,i,j), Z(k,i,j) );
+            }
+         }
+      }
+
+      Y = map( X, Y, Z, FusedUpdate() );
+
+      if( Y != ref ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Ternary map operation failed\n"
+             << " Details:\n"
+             << "   Result:\n" << Y << "\n"
+             << "   Expected result:\n" << ref << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "map() function with four operands";
+
+      blaze::DynamicTensor<int> A( 2UL, 3UL, 7UL ), B( 2UL, 3UL, 7UL ), C( 2UL, 3UL, 7UL ), D( 2UL, 3UL, 7UL );
+      randomize( A, -10, 10 );
+      randomize( B, -10, 10 );
+      randomize( C, -10, 10 );
+      randomize( D, -10, 10 );
+
+      const blaze::DynamicTensor<int> res(
+         map( A + B, B, C, D, []( int a, int b, int c, int d ){ return a*b + c - d; } ) );
+
+      for( size_t k=0UL; k<A.pages(); ++k ) {
+         for( size_t i=0UL; i<A.rows(); ++i ) {
+            for( size_t j=0UL; j<A.columns(); ++j )
+            {
+               if( res(k,i,j) != ( A(k,i,j) + B(k,i,j) )*B(k,i,j) + C(k,i,j) - D(k,i,j) ) {
+                  std::ostringstream oss;
+                  oss << " Test: " << test_ << "\n"
+                      << " Error: Quaternary map operation failed\n"
+                      << " Details:\n"
+                      << "   Element (" << k << "," << i << "," << j << ") = " << res(k,i,j) << "\n";
+                  throw std::runtime_error( oss.str() );
+               }
+            }
+         }
+      }
+   }
+
+   {
+      test_ = "select() and where() functions";
+
+      blaze::DynamicTensor<int> A( 3UL, 4UL, 21UL ), B( 3UL, 4UL, 21UL );
+      randomize( A, -10, 10 );
+      randomize( B, -10, 10 );
+
+      blaze::DynamicTensor<bool> mask( 3UL, 4UL, 21UL );
+      for( size_t k=0UL; k<A.pages(); ++k ) {
+         for( size_t i=0UL; i<A.rows(); ++i ) {
+            for( size_t j=0UL; j<A.columns(); ++j ) {
+               mask(k,i,j) = ( A(k,i,j) > B(k,i,j) );
+            }
+         }
+      }
+
+      const blaze::DynamicTensor<int> upper( blaze::select( mask, A, B ) );
+      const blaze::DynamicTensor<int> lower( blaze::where( mask, B, A ) );
+
+      if( upper != blaze::max( A, B ) || lower != blaze::min( A, B ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Element-wise selection failed\n"
+             << " Details:\n"
+             << "   select() result:\n" << upper << "\n"
+             << "   where() result:\n" << lower << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "select() function with mismatching sizes";
+
+      blaze::DynamicTensor<bool> mask( 2UL, 3UL, 4UL, true );
+      blaze::DynamicTensor<int> A( 2UL, 3UL, 4UL, 1 ), B( 2UL, 3UL, 5UL, 2 );
+
+      try {
+         const blaze::DynamicTensor<int> res( blaze::select( mask, A, B ) );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Selection between tensors of different size succeeded\n"
+             << " Details:\n"
+             << "   Result:\n" << res << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the batched \c lu(), \c llh(), \c inv(), \c invert() and \c solve() functions.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the page-wise decomposition, inversion and solution
+// functions for dense tensors. The tests cover both small pages, which are processed by the
+// interleaved kernels, and larger pages, which are processed by LAPACK. In case an error is
+// detected, a \a std::runtime_error exception is thrown.
+*/
+void GeneralTest::testBatchedLinearAlgebra()
+{
+   //=====================================================================================
+   // Row-major tensor tests
+   //=====================================================================================
+
+   for( size_t n : { 3UL, 6UL } )
+   {
+      const size_t o( 7UL );
+
+      blaze::DynamicTensor<double> A( o, n, n );
+      randomize( A, -1.0, 1.0 );
+
+      blaze::DynamicMatrix<double> I( n, n, 0.0 );
+      for( size_t i=0UL; i<n; ++i ) {
+         I(i,i) = 1.0;
+      }
+
+      {
+         test_ = "lu() function";
+
+         blaze::DynamicTensor<double> L, U, P;
+         lu( A, L, U, P );
+
+         for( size_t k=0UL; k<o; ++k )
+         {
+            const blaze::DynamicMatrix<double> LUP(
+               pageslice( L, k ) * pageslice( U, k ) * pageslice( P, k ) );
+
+            if( !isLower( pageslice( L, k ) ) || !isUniUpper( pageslice( U, k ) ) ||
+                max( abs( LUP - pageslice( A, k ) ) ) > 1E-10 ) {
+               std::ostringstream oss;
+               oss << " Test: " << test_ << "\n"
+                   << " Error: Batched LU decomposition failed\n"
+                   << " Details:\n"
+                   << "   Page " << k << " of size " << n << "x" << n << "\n"
+                   << "   L:\n" << pageslice( L, k ) << "\n"
+                   << "   U:\n" << pageslice( U, k ) << "\n"
+                   << "   P:\n" << pageslice( P, k ) << "\n";
+               throw std::runtime_error( oss.str() );
+            }
+         }
+      }
+
+      {
+         test_ = "llh() function";
+
+         blaze::DynamicTensor<double> S( o, n, n );
+         for( size_t k=0UL; k<o; ++k ) {
+            pageslice( S, k ) = pageslice( A, k ) * trans( pageslice( A, k ) ) + I;
+         }
+
+         blaze::DynamicTensor<double> L;
+         llh( S, L );
+
+         for( size_t k=0UL; k<o; ++k )
+         {
+            if( !isLower( pageslice( L, k ) ) ||
+                max( abs( pageslice( L, k ) * trans( pageslice( L, k ) ) - pageslice( S, k ) ) ) > 1E-10 ) {
+               std::ostringstream oss;
+               oss << " Test: " << test_ << "\n"
+                   << " Error: Batched Cholesky decomposition failed\n"
+                   << " Details:\n"
+                   << "   Page " << k << " of size " << n << "x" << n << "\n"
+                   << "   L:\n" << pageslice( L, k ) << "\n";
+               throw std::runtime_error( oss.str() );
+            }
+         }
+      }
+
+      {
+         test_ = "inv() and invert() functions";
+
+         const blaze::DynamicTensor<double> B( inv( A ) );
+
+         blaze::DynamicTensor<double> C( A );
+         invert( C );
+
+         for( size_t k=0UL; k<o; ++k )
+         {
+            if( max( abs( pageslice( B, k ) * pageslice( A, k ) - I ) ) > 1E-8 ||
+                max( abs( pageslice( C, k ) - pageslice( B, k ) ) ) > 1E-8 ) {
+               std::ostringstream oss;
+               oss << " Test: " << test_ << "\n"
+                   << " Error: Batched inversion failed\n"
+                   << " Details:\n"
+                   << "   Page " << k << " of size " << n << "x" << n << "\n"
+                   << "   inv():\n" << pageslice( B, k ) << "\n"
+                   << "   invert():\n" << pageslice( C, k ) << "\n";
+               throw std::runtime_error( oss.str() );
+            }
+         }
+      }
+
+      {
+         test_ = "solve() function";
+
+         blaze::DynamicTensor<double> B( o, n, 2UL ), X;
+         randomize( B, -1.0, 1.0 );
+
+         solve( A, X, B );
+
+         for( size_t k=0UL; k<o; ++k )
+         {
+            if( max( abs( pageslice( A, k ) * pageslice( X, k ) - pageslice( B, k ) ) ) > 1E-8 ) {
+               std::ostringstream oss;
+               oss << " Test: " << test_ << "\n"
+                   << " Error: Batched solution of linear systems failed\n"
+                   << " Details:\n"
+                   << "   Page " << k << " of size " << n << "x" << n << "\n"
+                   << "   X:\n" << pageslice( X, k ) << "\n";
+               throw std::runtime_error( oss.str() );
+            }
+         }
+      }
+
+      {
+         test_ = "inv() and llh() functions with singular pages";
+
+         blaze::DynamicTensor<double> B( A );
+         pageslice( B, o-1UL ) = 0.0;
+
+         try {
+            const blaze::DynamicTensor<double> C( inv( B ) );
+
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Inversion of singular page succeeded\n"
+                << " Details:\n"
+                << "   Result:\n" << C << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+         catch( std::invalid_argument& ) {}
+
+         try {
+            blaze::DynamicTensor<double> L;
+            llh( B, L );
+
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Cholesky decomposition of singular page succeeded\n"
+                << " Details:\n"
+                << "   Result:\n" << L << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+         catch( std::invalid_argument& ) {}
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the fused \c layernorm(), \c batchnorm() and \c rmsnorm() functions.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the fused normalization functions for dense tensors. The
+// results are compared to a straightforward two-pass computation of the statistics. In case
+// an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void GeneralTest::testNormalization()
+{
+   //=====================================================================================
+   // Row-major tensor tests
+   //=====================================================================================
+
+   const double eps( 1E-5 );
+
+   blaze::DynamicTensor<double> A( 3UL, 5UL, 19UL );
+   randomize( A, -4.0, 4.0 );
+
+   {
+      test_ = "layernorm() function along the rows";
+
+      blaze::DynamicVector<double> gamma( 19UL ), beta( 19UL );
+      randomize( gamma );
+      randomize( beta );
+
+      blaze::DynamicMatrix<double> mean, rstd;
+      const blaze::DynamicTensor<double> B(
+         blaze::layernorm<blaze::rowwise>( A, gamma, beta, eps, mean, rstd ) );
+
+      for( size_t k=0UL; k<A.pages(); ++k ) {
+         for( size_t i=0UL; i<A.rows(); ++i )
+         {
+            double mu( 0.0 ), var( 0.0 );
+            for( size_t j=0UL; j<A.columns(); ++j ) mu += A(k,i,j);
+            mu /= A.columns();
+            for( size_t j=0UL; j<A.columns(); ++j ) var += ( A(k,i,j) - mu ) * ( A(k,i,j) - mu );
+            var /= A.columns();
+
+            const double r( 1.0 / std::sqrt( var + eps ) );
+
+            bool valid( isEqual( mean(k,i), mu ) && isEqual( rstd(k,i), r ) );
+            for( size_t j=0UL; j<A.columns(); ++j ) {
+               valid = valid && isEqual( B(k,i,j), ( A(k,i,j) - mu ) * r * gamma[j] + beta[j] );
+            }
+
+            if( !valid || mean.rows() != A.pages() || mean.columns() != A.rows() ) {
+               std::ostringstream oss;
+               oss << " Test: " << test_ << "\n"
+                   << " Error: Layer normalization failed\n"
+                   << " Details:\n"
+                   << "   Row (" << k << "," << i << ")\n"
+                   << "   Result:\n" << B << "\n"
+                   << "   Mean:\n" << mean << "\n";
+               throw std::runtime_error( oss.str() );
+            }
+         }
+      }
+   }
+
+   {
+      test_ = "layernorm() function along the pages";
+
+      blaze::DynamicVector<double> gamma( 3UL ), beta( 3UL );
+      randomize( gamma );
+      randomize( beta );
+
+      const blaze::DynamicTensor<double> B( blaze::layernorm<blaze::pagewise>( A, gamma, beta ) );
+
+      for( size_t i=0UL; i<A.rows(); ++i ) {
+         for( size_t j=0UL; j<A.columns(); ++j )
+         {
+            double mu( 0.0 ), var( 0.0 );
+            for( size_t k=0UL; k<A.pages(); ++k ) mu += A(k,i,j);
+            mu /= A.pages();
+            for( size_t k=0UL; k<A.pages(); ++k ) var += ( A(k,i,j) - mu ) * ( A(k,i,j) - mu );
+            var /= A.pages();
+
+            for( size_t k=0UL; k<A.pages(); ++k ) {
+               if( !isEqual( B(k,i,j), ( A(k,i,j) - mu ) / std::sqrt( var + eps ) * gamma[k] + beta[k] ) ) {
+                  std::ostringstream oss;
+                  oss << " Test: " << test_ << "\n"
+                      << " Error: Layer normalization failed\n"
+                      << " Details:\n"
+                      << "   Element (" << k << "," << i << "," << j << ") = " << B(k,i,j) << "\n";
+                  throw std::runtime_error( oss.str() );
+               }
+            }
+         }
+      }
+   }
+
+   {
+      test_ = "batchnorm() function with channels along the rows";
+
+      blaze::DynamicVector<double> gamma( 5UL ), beta( 5UL ), mean, rstd;
+      randomize( gamma );
+      randomize( beta );
+
+      const blaze::DynamicTensor<double> B(
+         blaze::batchnorm<blaze::columnwise>( A, gamma, beta, eps, mean, rstd ) );
+
+      for( size_t i=0UL; i<A.rows(); ++i )
+      {
+         double mu( 0.0 ), var( 0.0 );
+         for( size_t k=0UL; k<A.pages(); ++k )
+            for( size_t j=0UL; j<A.columns(); ++j ) mu += A(k,i,j);
+         mu /= A.pages() * A.columns();
+         for( size_t k=0UL; k<A.pages(); ++k )
+            for( size_t j=0UL; j<A.columns(); ++j ) var += ( A(k,i,j) - mu ) * ( A(k,i,j) - mu );
+         var /= A.pages() * A.columns();
+
+         const double r( 1.0 / std::sqrt( var + eps ) );
+
+         bool valid( mean.size() == 5UL && isEqual( mean[i], mu ) && isEqual( rstd[i], r ) );
+         for( size_t k=0UL; k<A.pages(); ++k ) {
+            for( size_t j=0UL; j<A.columns(); ++j ) {
+               valid = valid && isEqual( B(k,i,j), ( A(k,i,j) - mu ) * r * gamma[i] + beta[i] );
+            }
+         }
+
+         if( !valid ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Batch normalization failed\n"
+                << " Details:\n"
+                << "   Channel " << i << "\n"
+                << "   Result:\n" << B << "\n"
+                << "   Mean:\n" << mean << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+
+   {
+      test_ = "batchnorm() function with channels along the columns";
+
+      const blaze::DynamicTensor<double> B( blaze::batchnorm<blaze::rowwise>( A ) );
+
+      for( size_t j=0UL; j<A.columns(); ++j )
+      {
+         double mu( 0.0 ), var( 0.0 );
+         for( size_t k=0UL; k<A.pages(); ++k )
+            for( size_t i=0UL; i<A.rows(); ++i ) mu += A(k,i,j);
+         mu /= A.pages() * A.rows();
+         for( size_t k=0UL; k<A.pages(); ++k )
+            for( size_t i=0UL; i<A.rows(); ++i ) var += ( A(k,i,j) - mu ) * ( A(k,i,j) - mu );
+         var /= A.pages() * A.rows();
+
+         for( size_t k=0UL; k<A.pages(); ++k ) {
+            for( size_t i=0UL; i<A.rows(); ++i ) {
+               if( !isEqual( B(k,i,j), ( A(k,i,j) - mu ) / std::sqrt( var + eps ) ) ) {
+                  std::ostringstream oss;
+                  oss << " Test: " << test_ << "\n"
+                      << " Error: Batch normalization failed\n"
+                      << " Details:\n"
+                      << "   Element (" << k << "," << i << "," << j << ") = " << B(k,i,j) << "\n";
+                  throw std::runtime_error( oss.str() );
+               }
+            }
+         }
+      }
+   }
+
+   {
+      test_ = "rmsnorm() function along the rows of every page";
+
+      blaze::DynamicVector<double> gamma( 5UL );
+      randomize( gamma );
+
+      blaze::DynamicMatrix<double> rstd;
+      const blaze::DynamicTensor<double> B(
+         blaze::rmsnorm<blaze::columnwise>( A, gamma, eps, rstd ) );
+
+      for( size_t k=0UL; k<A.pages(); ++k ) {
+         for( size_t j=0UL; j<A.columns(); ++j )
+         {
+            double ms( 0.0 );
+            for( size_t i=0UL; i<A.rows(); ++i ) ms += A(k,i,j) * A(k,i,j);
+            ms /= A.rows();
+
+            const double r( 1.0 / std::sqrt( ms + eps ) );
+
+            bool valid( rstd.rows() == A.pages() && rstd.columns() == A.columns() && isEqual( rstd(k,j), r ) );
+            for( size_t i=0UL; i<A.rows(); ++i ) {
+               valid = valid && isEqual( B(k,i,j), A(k,i,j) * r * gamma[i] );
+            }
+
+            if( !valid ) {
+               std::ostringstream oss;
+               oss << " Test: " << test_ << "\n"
+                   << " Error: RMS normalization failed\n"
+                   << " Details:\n"
+                   << "   Column (" << k << "," << j << ")\n"
+                   << "   Result:\n" << B << "\n"
+                   << "   Reciprocal root mean squares:\n" << rstd << "\n";
+               throw std::runtime_error( oss.str() );
+            }
+         }
+      }
+   }
+
+   {
+      test_ = "layernorm() function with invalid scale vector";
+
+      blaze::DynamicVector<double> gamma( 4UL, 1.0 ), beta( 19UL, 0.0 );
+
+      try {
+         const blaze::DynamicTensor<double> B( blaze::layernorm<blaze::rowwise>( A, gamma, beta ) );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Layer normalization with invalid scale vector succeeded\n"
+             << " Details:\n"
+             << "   Result:\n" << B << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the serialization of dense tensors.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c serialize() and \c deserialize() functions for dense
+// tensors. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void GeneralTest::testSerialization()
+{
+   using blaze::unaligned;
+   using blaze::unpadded;
+
+   blaze::DynamicTensor<int> A( 3UL, 4UL, 13UL );
+   randomize( A, -100, 100 );
+
+   {
+      test_ = "Serialization of a padded dynamic tensor";
+
+      std::stringstream stream;
+      blaze::Archive<std::stringstream> archive( stream );
+
+      archive << A;
+
+      blaze::DynamicTensor<int> B( 1UL, 2UL, 3UL );
+      archive >> B;
+
+      if( !( A == B ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Deserialization failed\n"
+             << " Details:\n"
+             << "   Result:\n" << B << "\n"
+             << "   Expected result:\n" << A << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Deserialization into static and custom tensors";
+
+      std::stringstream stream;
+      blaze::Archive<std::stringstream> archive( stream );
+
+      archive << A << A;
+
+      blaze::StaticTensor<int,3UL,4UL,13UL> B;
+      std::unique_ptr<int[]> memory( new int[3UL*4UL*13UL] );
+      blaze::CustomTensor<int,unaligned,unpadded> C( memory.get(), 3UL, 4UL, 13UL );
+
+      archive >> B >> C;
+
+      if( !( A == B ) || !( A == C ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Deserialization failed\n"
+             << " Details:\n"
+             << "   Static tensor:\n" << B << "\n"
+             << "   Custom tensor:\n" << C << "\n"
+             << "   Expected result:\n" << A << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Deserialization with element type conversion";
+
+      std::stringstream stream;
+      blaze::Archive<std::stringstream> archive( stream );
+
+      archive << A;
+
+      blaze::DynamicTensor<double> B;
+      archive >> B;
+
+      if( B.pages() != A.pages() || B.rows() != A.rows() || B.columns() != A.columns() ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid tensor size\n"
+             << " Details:\n"
+             << "   Result: " << B.pages() << "x" << B.rows() << "x" << B.columns() << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      for( size_t k=0UL; k<A.pages(); ++k ) {
+         for( size_t i=0UL; i<A.rows(); ++i ) {
+            for( size_t j=0UL; j<A.columns(); ++j ) {
+               if( !isEqual( B(k,i,j), double( A(k,i,j) ) ) ) {
+                  std::ostringstream oss;
+                  oss << " Test: " << test_ << "\n"
+                      << " Error: Conversion failed\n"
+                      << " Details:\n"
+                      << "   Element (" << k << "," << i << "," << j << ") = " << B(k,i,j)
+                      << ", expected " << A(k,i,j) << "\n";
+                  throw std::runtime_error( oss.str() );
+               }
+            }
+         }
+      }
+   }
+
+   {
+      test_ = "Deserialization into a tensor of wrong size";
+
+      std::stringstream stream;
+      blaze::Archive<std::stringstream> archive( stream );
+
+      archive << A;
+
+      blaze::StaticTensor<int,2UL,2UL,2UL> B;
+      bool failed( false );
+
+      try {
+         archive >> B;
+      }
+      catch( std::invalid_argument& ) {
+         failed = true;
+      }
+
+      if( !failed ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Deserialization into a tensor of wrong size succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the MappedTensor class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of memory mapped tensor files. In case an error is detected,
+// a \a std::runtime_error exception is thrown.
+*/
+void GeneralTest::testMappedTensor()
+{
+   const std::string path( "blazetest_mappedtensor.tensor" );
+
+   blaze::DynamicTensor<double> A( 3UL, 4UL, 13UL );
+   randomize( A );
+
+   {
+      test_ = "Writing and mapping a tensor file";
+
+      blaze::writeMapped( path, A );
+
+      const blaze::MappedTensor<double> mapped( path );
+      mapped.advise( blaze::MapAdvice::sequential );
+
+      if( mapped.pages() != 3UL || mapped.rows() != 4UL || mapped.columns() != 13UL ||
+          mapped.spacing() < 13UL || !( mapped.tensor() == A ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Mapping failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mapped.tensor() << "\n"
+             << "   Expected result:\n" << A << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Copy-on-write and read-write mappings";
+
+      {
+         blaze::MappedTensor<double> mapped( path, blaze::MapMode::copyOnWrite );
+         mapped.tensor() *= 2.0;
+      }
+
+      {
+         blaze::MappedTensor<double> mapped( path, blaze::MapMode::readWrite );
+
+         if( !( mapped.tensor() == A ) ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Copy-on-write modification was written back\n"
+                << " Details:\n"
+                << "   Result:\n" << mapped.tensor() << "\n"
+                << "   Expected result:\n" << A << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+
+         mapped.tensor() += A;
+         mapped.flush();
+      }
+
+      const blaze::MappedTensor<double> mapped( path );
+      const blaze::DynamicTensor<double> B( 2.0 * A );
+
+      if( !( mapped.tensor() == B ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Read-write modification was not written back\n"
+             << " Details:\n"
+             << "   Result:\n" << mapped.tensor() << "\n"
+             << "   Expected result:\n" << B << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Mapping a tensor file with wrong element type";
+
+      bool failed( false );
+
+      try {
+         const blaze::MappedTensor<float> mapped( path );
+      }
+      catch( std::invalid_argument& ) {
+         failed = true;
+      }
+
+      if( !failed ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Mapping a tensor file with wrong element type succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   std::remove( path.c_str() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the NumPy .npy/.npz reader and writer.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of reading and writing tensors in the NumPy .npy and .npz
+// formats, including the zero-copy views on such files. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void GeneralTest::testNumPy()
+{
+   const std::string npyPath( "blazetest_numpy_tensor.npy" );
+   const std::string npzPath( "blazetest_numpy_tensor.npz" );
+
+   blaze::DynamicTensor<double> A( 3UL, 4UL, 13UL );
+   randomize( A );
+
+   blaze::DynamicTensor<int> C( 2UL, 5UL, 7UL );
+   for( size_t k=0UL; k<C.pages(); ++k )
+      for( size_t i=0UL; i<C.rows(); ++i )
+         for( size_t j=0UL; j<C.columns(); ++j )
+            C(k,i,j) = int( 100UL*k + 10UL*i + j ) - 50;
+
+   {
+      test_ = "Npy round trip of a padded tensor";
+
+      std::stringstream ss;
+      blaze::writeNpy( ss, A );
+
+      const std::string data( ss.str() );
+
+      if( data.compare( 0UL, 6UL, "\x93NUMPY" ) != 0 ||
+          data.find( "'shape': (3, 4, 13)" ) == std::string::npos ||
+          data.size() != blaze::npyDataSize( A ) ||
+          ( data.size() - 3UL*4UL*13UL*sizeof(double) ) % 64UL != 0UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid npy data\n"
+             << " Details:\n"
+             << "   Size: " << data.size() << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      blaze::DynamicTensor<double> B;
+      blaze::readNpy( ss, B );
+
+      if( !( B == A ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Round trip failed\n"
+             << " Details:\n"
+             << "   Result:\n" << B << "\n"
+             << "   Expected result:\n" << A << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Npy file with element type conversion";
+
+      blaze::writeNpy( npyPath, C );
+
+      blaze::DynamicTensor<double> B;
+      blaze::readNpy( npyPath, B );
+
+      const blaze::DynamicTensor<double> expected( C );
+
+      if( !( B == expected ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Conversion failed\n"
+             << " Details:\n"
+             << "   Result:\n" << B << "\n"
+             << "   Expected result:\n" << expected << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      std::unique_ptr<int[]> memory( new int[2UL*5UL*7UL] );
+      blaze::CustomTensor<int,blaze::unaligned,blaze::unpadded> D( memory.get(), 2UL, 5UL, 7UL );
+      blaze::readNpy( npyPath, D );
+
+      if( !( D == C ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Reading into a custom tensor failed\n"
+             << " Details:\n"
+             << "   Result:\n" << D << "\n"
+             << "   Expected result:\n" << C << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Npy file with wrong tensor size";
+
+      bool failed( false );
+
+      try {
+         blaze::StaticTensor<int,2UL,5UL,6UL> D;
+         blaze::readNpy( npyPath, D );
+      }
+      catch( std::invalid_argument& ) {
+         failed = true;
+      }
+
+      if( !failed ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Reading into a tensor of wrong size succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Npz archive with two entries";
+
+      {
+         blaze::NpzWriter npz( npzPath );
+         npz.write( "A", A );
+         npz.write( "C", C );
+         npz.close();
+      }
+
+      blaze::NpzReader npz( npzPath );
+
+      blaze::DynamicTensor<double> B;
+      blaze::DynamicTensor<int> D;
+      npz.read( "C", D );
+      npz.read( "A", B );
+
+      if( npz.names().size() != 2UL || !npz.contains( "A" ) || npz.contains( "B" ) ||
+          !( B == A ) || !( D == C ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Npz round trip failed\n"
+             << " Details:\n"
+             << "   Result:\n" << B << "\n" << D << "\n"
+             << "   Expected result:\n" << A << "\n" << C << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Zero-copy views on npy and npz data";
+
+      const blaze::NpyTensorView<int> view( npyPath );
+      const blaze::NpyTensorView<double> entry( npzPath, "A" );
+
+      const blaze::DynamicTensor<double> B( entry.tensor() );
+
+      if( !( view.tensor() == C ) || !( entry.tensor() == A ) || !( B == A ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Viewing failed\n"
+             << " Details:\n"
+             << "   Result:\n" << view.tensor() << "\n" << entry.tensor() << "\n"
+             << "   Expected result:\n" << C << "\n" << A << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Zero-copy view with wrong element type";
+
+      bool failed( false );
+
+      try {
+         const blaze::NpyTensorView<float> view( npzPath, "A" );
+      }
+      catch( std::invalid_argument& ) {
+         failed = true;
+      }
+
+      if( !failed ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Viewing data of wrong element type succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   std::remove( npyPath.c_str() );
+   std::remove( npzPath.c_str() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the ChunkedTensorReader class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the chunk-wise reading of tensor files. In case an error is
+// detected, a \a std::runtime_error exception is thrown.
+*/
+void GeneralTest::testChunkedTensorReader()
+{
+   const std::string path( "blazetest_chunkedtensor.tensor" );
+
+   blaze::DynamicTensor<float> A( 10UL, 5UL, 13UL );
+   randomize( A );
+
+   blaze::writeMapped( path, A );
+
+   for( size_t buffers=2UL; buffers<=5UL; ++buffers )
+   {
+      test_ = "Chunk-wise reading with " + std::to_string( buffers ) + " buffers";
+
+      blaze::ChunkedTensorReader<float> reader( path, 3UL, buffers );
+
+      size_t count( 0UL );
+
+      while( reader.next() )
+      {
+         const size_t k( reader.firstPage() );
+         const size_t o( reader.chunkPages() );
+
+         if( k != 3UL*count || o != std::min<size_t>( 3UL, 10UL - k ) ||
+             !( reader.chunk() == blaze::subtensor( A, k, 0UL, 0UL, o, 5UL, 13UL ) ) ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Invalid chunk\n"
+                << " Details:\n"
+                << "   First page: " << k << "\n"
+                << "   Result:\n" << reader.chunk() << "\n"
+                << "   Expected result:\n" << blaze::subtensor( A, k, 0UL, 0UL, o, 5UL, 13UL ) << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+
+         if( reader.requested() != std::min<size_t>( count + buffers, 4UL ) ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Following chunks are not read ahead\n"
+                << " Details:\n"
+                << "   Current chunk: " << count << "\n"
+                << "   Requested chunks: " << reader.requested() << "\n"
+                << "   Expected requested chunks: " << std::min<size_t>( count + buffers, 4UL ) << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+
+         ++count;
+      }
+
+      if( count != 4UL || reader.chunks() != 4UL || reader.next() ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid number of chunks\n"
+             << " Details:\n"
+             << "   Result: " << count << "\n"
+             << "   Expected result: 4\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Chunk-wise reading of a tensor file with wrong element type";
+
+      bool failed( false );
+
+      try {
+         blaze::ChunkedTensorReader<double> reader( path, 3UL );
+      }
+      catch( std::invalid_argument& ) {
+         failed = true;
+      }
+
+      if( !failed ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Reading a tensor file with wrong element type succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   std::remove( path.c_str() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the TensorArena and ArenaScope classes.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of routing the storage of dynamic tensors through a tensor
+// arena. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void GeneralTest::testTensorArena()
+{
+   blaze::DynamicTensor<double> A( 3UL, 4UL, 13UL );
+   blaze::DynamicTensor<double> B( 3UL, 4UL, 13UL );
+   randomize( A );
+   randomize( B );
+
+   const blaze::DynamicTensor<double> expected( A + B );
+
+   {
+      test_ = "Steady-state evaluation within an arena";
+
+      blaze::TensorArena arena;
+      size_t allocations( 0UL );
+
+      for( size_t step=0UL; step<4UL; ++step )
+      {
+         blaze::ArenaScope scope( arena );
+
+         blaze::DynamicTensor<double> C( A + B );
+         blaze::DynamicTensor<double> D( C );
+         D.resize( 2UL, 4UL, 13UL, true );
+
+         if( !( C == expected ) || !( D == blaze::subtensor( expected, 0UL, 0UL, 0UL, 2UL, 4UL, 13UL ) ) ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Evaluation within an arena failed\n"
+                << " Details:\n"
+                << "   Result:\n" << C << "\n"
+                << "   Expected result:\n" << expected << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+
+         if( step == 0UL ) {
+            allocations = arena.allocations();
+         }
+      }
+
+      if( allocations == 0UL || arena.allocations() != allocations || arena.cachedBytes() == 0UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Steady-state iterations performed heap allocations\n"
+             << " Details:\n"
+             << "   First iteration: " << allocations << "\n"
+             << "   All iterations : " << arena.allocations() << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      arena.release();
+
+      if( arena.cachedBytes() != 0UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Releasing the cached memory failed\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Tensors crossing the boundary of an arena scope";
+
+      blaze::TensorArena arena;
+      blaze::DynamicTensor<double> C( A );
+      blaze::DynamicTensor<double> D;
+
+      {
+         blaze::ArenaScope scope( arena );
+
+         blaze::DynamicTensor<double> E( B );
+         swap( C, E );   // Heap storage released within the scope
+         D = C + A;      // Arena storage used beyond the scope
+      }
+
+      if( !( C == B ) || !( D == expected ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Mixing heap and arena storage failed\n"
+             << " Details:\n"
+             << "   Result:\n" << D << "\n"
+             << "   Expected result:\n" << expected << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      {
+         blaze::DynamicTensor<double> E;
+         swap( C, E );  // Arena storage released outside of the scope
+      }
+
+      if( arena.cachedBytes() == 0UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Arena storage was not returned to the arena\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of appending and removing pages of a dynamic tensor.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the appendPage(), appendPages() and popPages() functions
+// of the DynamicTensor class template and of the CircularTensor class template. In case an
+// error is detected, a \a std::runtime_error exception is thrown.
+*/
+void GeneralTest::testAppendPages()
+{
+   blaze::DynamicTensor<double> A( 6UL, 4UL, 13UL );
+   randomize( A );
+
+   {
+      test_ = "Appending pages with amortized growth";
+
+      blaze::DynamicTensor<double> B;
+      size_t reallocations( 0UL );
+
+      for( size_t k=0UL; k<A.pages(); ++k ) {
+         const double* const before( B.data() );
+         B.appendPage( blaze::pageslice( A, k ) );
+         if( B.data() != before ) ++reallocations;
+      }
+
+      if( !( B == A ) || reallocations > 4UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Appending pages failed\n"
+             << " Details:\n"
+             << "   Reallocations: " << reallocations << "\n"
+             << "   Result:\n" << B << "\n"
+             << "   Expected result:\n" << A << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      const double* const before( B.data() );
+
+      B.popPages( 2UL );
+      B.appendPages( 2.0 * blaze::subtensor( A, 4UL, 0UL, 0UL, 2UL, 4UL, 13UL ) );
+      B.resize( 7UL, 4UL, 13UL, true );
+      B.resize( 6UL, 4UL, 13UL, true );
+
+      blaze::DynamicTensor<double> expected( A );
+      blaze::subtensor( expected, 4UL, 0UL, 0UL, 2UL, 4UL, 13UL ) *= 2.0;
+
+      if( !( B == expected ) || B.data() != before ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Changing the number of pages reallocated or failed\n"
+             << " Details:\n"
+             << "   Result:\n" << B << "\n"
+             << "   Expected result:\n" << expected << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      B.appendPage( blaze::pageslice( B, 0UL ) );
+
+      if( B.pages() != 7UL || !( blaze::pageslice( B, 6UL ) == blaze::pageslice( A, 0UL ) ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Appending an aliased page failed\n"
+             << " Details:\n"
+             << "   Result:\n" << B << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Appending a page of wrong size";
+
+      bool failed( false );
+
+      try {
+         blaze::DynamicTensor<double> B( A );
+         B.appendPage( blaze::DynamicMatrix<double>( 3UL, 13UL, 0.0 ) );
+      }
+      catch( std::invalid_argument& ) {
+         failed = true;
+      }
+
+      if( !failed ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Appending a page of wrong size succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Sliding window of pages";
+
+      blaze::CircularTensor<double> window( 4UL, 4UL, 13UL );
+
+      for( size_t k=0UL; k<A.pages(); ++k ) {
+         window.push( blaze::pageslice( A, k ) );
+      }
+
+      blaze::DynamicTensor<double> B;
+      window.copyTo( B );
+
+      const blaze::DynamicTensor<double> expected( blaze::subtensor( A, 2UL, 0UL, 0UL, 4UL, 4UL, 13UL ) );
+
+      if( !window.full() || window.pages() != 4UL || window.head() != 2UL || !( B == expected ) ||
+          !( window.page( 3UL ) == blaze::pageslice( A, 5UL ) ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Sliding window failed\n"
+             << " Details:\n"
+             << "   Result:\n" << B << "\n"
+             << "   Expected result:\n" << expected << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the NUMA placement policies.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of allocating dynamic tensors and arrays under the NUMA
+// placement policies. Since the placement of memory pages cannot be observed portably, the
+// test checks the results and the fallback behavior on single-node systems. In case an error
+// is detected, a \a std::runtime_error exception is thrown.
+*/
+void GeneralTest::testNumaPlacement()
+{
+   {
+      test_ = "NUMA topology and fallback";
+
+      const size_t nodes( blaze::numaNodes() );
+      std::vector<double> buffer( 1UL << 20 );
+
+      if( nodes == 0UL || ( nodes == 1UL && blaze::numaInterleave( buffer.data(), buffer.size()*sizeof( double ) ) ) ||
+          blaze::numaInterleave( buffer.data(), 1UL ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid NUMA fallback behavior\n"
+             << " Details:\n"
+             << "   Number of nodes: " << nodes << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "NUMA scopes";
+
+      {
+         blaze::NumaScope outer( blaze::numa_interleave );
+         {
+            blaze::NumaScope inner( blaze::numa_first_touch );
+
+            if( blaze::activeNumaPolicy() != blaze::numa_first_touch ) {
+               std::ostringstream oss;
+               oss << " Test: " << test_ << "\n"
+                   << " Error: Activating a NUMA policy failed\n";
+               throw std::runtime_error( oss.str() );
+            }
+         }
+
+         if( blaze::activeNumaPolicy() != blaze::numa_interleave ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Reactivating the previous NUMA policy failed\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      if( blaze::activeNumaPolicy() != blaze::numa_local ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Reactivating the default NUMA policy failed\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   const blaze::NumaPolicy policies[] = { blaze::numa_first_touch, blaze::numa_interleave };
+
+   for( blaze::NumaPolicy policy : policies )
+   {
+      test_ = ( policy == blaze::numa_first_touch ? "Parallel first-touch tensor and array allocation"
+                                                  : "Interleaved tensor and array allocation" );
+
+      blaze::DynamicTensor<double> A( 5UL, 37UL, 301UL );
+      blaze::DynamicTensor<double> B( 5UL, 37UL, 301UL );
+      randomize( A );
+      randomize( B );
+
+      blaze::NumaScope scope( policy );
+
+      blaze::DynamicTensor<double> C( 5UL, 37UL, 301UL );
+      C = A + B;
+
+      blaze::DynamicTensor<double> D( A );
+      D.resize( 9UL, 37UL, 301UL, true );
+
+      if( !( blaze::subtensor( D, 0UL, 0UL, 0UL, 5UL, 37UL, 301UL ) == A ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Growing the number of pages failed\n"
+             << " Details:\n"
+             << "   Result:\n" << D << "\n"
+             << "   Expected result:\n" << A << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      D.resize( 7UL, 33UL, 1001UL, false );
+
+      bool padded( true );
+      for( size_t k=0UL; k<D.pages(); ++k ) {
+         for( size_t i=0UL; i<D.rows(); ++i ) {
+            for( size_t j=D.columns(); j<D.spacing(); ++j ) {
+               padded = padded && D.data( i, k )[j] == 0.0;
+            }
+         }
+      }
+
+      blaze::DynamicArray<4UL, double> E( 3UL, 5UL, 37UL, 301UL );
+      E.resize( { 301UL, 37UL, 6UL, 3UL }, false );
+
+      if( !( C == blaze::DynamicTensor<double>( A + B ) ) || !padded || E.dimension<2>() != 6UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Allocation under a NUMA policy failed\n"
+             << " Details:\n"
+             << "   Result:\n" << C << "\n"
+             << "   Expected result:\n" << ( A + B ) << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the huge page backed storage of tensors.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of dynamic and custom tensors whose storage is allocated with
+// huge pages. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void GeneralTest::testHugePages()
+{
+   using blaze::aligned;
+   using blaze::padded;
+
+   const size_t o( 4UL ), m( 129UL ), n( 517UL );  // More than 2 MiB of storage
+
+   blaze::DynamicTensor<double> A( o, m, n );
+   randomize( A );
+
+   {
+      test_ = "Huge page backed dynamic tensor";
+
+      blaze::DynamicTensor<double> B, C;
+
+      {
+         blaze::HugePageScope scope;
+
+         B = A * 2.0;
+         C.resize( 2UL, 3UL, 5UL );  // Small storage is taken from the heap
+         C = 1.0;
+
+         B.resize( 2UL*o, m, n, true );
+         blaze::subtensor( B, o, 0UL, 0UL, o, m, n ) = A;
+      }
+
+      if( !( blaze::subtensor( B, 0UL, 0UL, 0UL, o, m, n ) == A * 2.0 ) ||
+          !( blaze::subtensor( B, o, 0UL, 0UL, o, m, n ) == A ) ||
+          !( C == blaze::DynamicTensor<double>( 2UL, 3UL, 5UL, 1.0 ) ) || !B.isAligned() ||
+          reinterpret_cast<size_t>( B.data() ) % 64UL != 0UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Huge page backed storage failed\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Huge page backed custom tensor";
+
+      const size_t nn( blaze::nextMultiple<size_t>( n, blaze::SIMDTrait<double>::size ) );
+
+      std::unique_ptr<double[],blaze::ArenaDeallocate> memory( blaze::hugePageAllocate<double>( o*m*nn ) );
+      blaze::CustomTensor<double,aligned,padded> B( memory.get(), o, m, n, nn );
+
+      B = A + A;
+
+#if defined(__linux__)
+      if( reinterpret_cast<size_t>( memory.get() ) % blaze::hugePageSize != 0UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Huge page backed storage is not aligned on a huge page boundary\n";
+         throw std::runtime_error( oss.str() );
+      }
+#endif
+
+      if( !( B == A * 2.0 ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Huge page backed custom tensor failed\n"
+             << " Details:\n"
+             << "   Result:\n" << B << "\n"
+             << "   Expected result:\n" << ( A * 2.0 ) << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Huge page scopes";
+
+      {
+         blaze::HugePageScope outer;
+         {
+            blaze::HugePageScope inner( false );
+
+            if( blaze::activeHugePages() ) {
+               std::ostringstream oss;
+               oss << " Test: " << test_ << "\n"
+                   << " Error: Disabling huge pages failed\n";
+               throw std::runtime_error( oss.str() );
+            }
+         }
+
+         if( !blaze::activeHugePages() ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Restoring the huge page setting failed\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      if( blaze::activeHugePages() ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Restoring the default huge page setting failed\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the half-width float16 and bfloat16 tensor element types.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the float16 and bfloat16 element types and of the SIMD
+// conversion between half-width and single precision tensors and arrays. In case an error is
+// detected, a \a std::runtime_error exception is thrown.
+*/
+void GeneralTest::testHalfPrecision()
+{
+   {
+      test_ = "Scalar float16 and bfloat16 conversions";
+
+      const blaze::float16  h1( 1.0F ), h2( 65504.0F ), h3( 1E6F ), h4( 5.9604645E-8F ), h5( 1.0F + 1.0F/2048.0F );
+      const blaze::bfloat16 b1( 1.0F ), b2( 3.0E38F ), b3( 1.0F + 1.0F/256.0F ), b4( 1.0F + 3.0F/256.0F );
+
+      if( h1.bits() != 0x3C00U || h2.bits() != 0x7BFFU || h3.bits() != 0x7C00U ||
+          h4.bits() != 0x0001U || h5.bits() != 0x3C00U ||
+          b1.bits() != 0x3F80U || b2.bits() != 0x7F62U ||
+          b3.bits() != 0x3F80U || b4.bits() != 0x3F82U ||
+          float( blaze::float16( -2.5F ) ) != -2.5F || !std::isnan( float( blaze::float16( std::nanf( "" ) ) ) ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Rounding to half precision failed\n"
+             << " Details:\n"
+             << "   float16 : " << h1 << " " << h2 << " " << h3 << " " << h4 << " " << h5 << "\n"
+             << "   bfloat16: " << b1 << " " << b2 << " " << b3 << " " << b4 << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   blaze::DynamicTensor<float> A( 3UL, 7UL, 37UL );
+   randomize( A, -100.0F, 100.0F );
+
+   {
+      test_ = "Conversion between float16 and single precision tensors";
+
+      blaze::DynamicTensor<blaze::float16> H;
+      blaze::DynamicTensor<float> B;
+
+      convert( H, A );
+      convert( B, H );
+
+      for( size_t k=0UL; k<A.pages(); ++k ) {
+         for( size_t i=0UL; i<A.rows(); ++i ) {
+            for( size_t j=0UL; j<A.columns(); ++j ) {
+               if( H(k,i,j).bits() != blaze::float16( A(k,i,j) ).bits() || B(k,i,j) != float( H(k,i,j) ) ||
+                   std::abs( B(k,i,j) - A(k,i,j) ) > std::abs( A(k,i,j) ) / 1024.0F ) {
+                  std::ostringstream oss;
+                  oss << " Test: " << test_ << "\n"
+                      << " Error: Conversion failed at (" << k << "," << i << "," << j << ")\n"
+                      << " Details:\n"
+                      << "   Result: " << B(k,i,j) << "\n"
+                      << "   Expected result: " << A(k,i,j) << "\n";
+                  throw std::runtime_error( oss.str() );
+               }
+            }
+         }
+      }
+   }
+
+   {
+      test_ = "Conversion between bfloat16 and single precision tensors";
+
+      std::unique_ptr<blaze::bfloat16[]> memory( new blaze::bfloat16[3UL*7UL*37UL] );
+      blaze::CustomTensor<blaze::bfloat16,blaze::unaligned,blaze::unpadded> H( memory.get(), 3UL, 7UL, 37UL );
+      blaze::DynamicTensor<float> B( 3UL, 7UL, 37UL );
+
+      convert( H, A );
+      convert( B, H );
+
+      for( size_t k=0UL; k<A.pages(); ++k ) {
+         for( size_t i=0UL; i<A.rows(); ++i ) {
+            for( size_t j=0UL; j<A.columns(); ++j ) {
+               if( H(k,i,j).bits() != blaze::bfloat16( A(k,i,j) ).bits() || B(k,i,j) != float( H(k,i,j) ) ) {
+                  std::ostringstream oss;
+                  oss << " Test: " << test_ << "\n"
+                      << " Error: Conversion failed at (" << k << "," << i << "," << j << ")\n"
+                      << " Details:\n"
+                      << "   Result: " << B(k,i,j) << "\n"
+                      << "   Expected result: " << A(k,i,j) << "\n";
+                  throw std::runtime_error( oss.str() );
+               }
+            }
+         }
+      }
+
+      blaze::DynamicTensor<float> C( 2UL, 2UL, 2UL );
+
+      try {
+         convert( H, C );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Conversion into a non-resizable tensor of different size succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+
+   {
+      test_ = "Conversion between half-width and single precision arrays";
+
+      blaze::DynamicArray<4UL, float> X( 2UL, 3UL, 5UL, 19UL );
+      randomize( X, -1.0F, 1.0F );
+
+      blaze::DynamicArray<4UL, blaze::bfloat16> H;
+      blaze::DynamicArray<4UL, float> Y;
+
+      convert( H, X );
+      convert( Y, H );
+
+      if( H.dimensions() != X.dimensions() || Y.dimensions() != X.dimensions() ||
+          Y(1UL,2UL,4UL,18UL) != float( blaze::bfloat16( X(1UL,2UL,4UL,18UL) ) ) ||
+          Y(0UL,0UL,0UL,0UL) != float( blaze::bfloat16( X(0UL,0UL,0UL,0UL) ) ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Array conversion failed\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the QuantizedTensor class template and the quantized page-wise product.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the int8 quantization and dequantization of tensors and of
+// the page-wise product of quantized tensors. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void GeneralTest::testQuantizedTensor()
+{
+   blaze::DynamicTensor<float> X( 3UL, 5UL, 70UL );
+   blaze::DynamicTensor<float> W( 1UL, 6UL, 70UL );
+   randomize( X, -2.0F, 4.0F );
+   randomize( W, -1.0F, 1.0F );
+
+   {
+      test_ = "Quantization and dequantization";
+
+      const blaze::QuantizedTensor<int8_t> qX( X );
+      const blaze::QuantizedTensor<int8_t> qW( blaze::quantize( W, blaze::quantizePerRow, true ) );
+      const blaze::DynamicTensor<float> dX( blaze::dequantize( qX ) );
+      const blaze::DynamicTensor<float> dW( blaze::dequantize( qW ) );
+
+      if( qX.scales().size() != 3UL || qW.scales().size() != 6UL ||
+          qW.zeroPoint( 0UL, 3UL ) != 0 || qX.granularity() != blaze::quantizePerPage ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid scales or zero points\n"
+             << " Details:\n"
+             << "   Number of scales: " << qX.scales().size() << " and " << qW.scales().size() << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      for( size_t k=0UL; k<X.pages(); ++k ) {
+         for( size_t i=0UL; i<X.rows(); ++i ) {
+            for( size_t j=0UL; j<X.columns(); ++j ) {
+               if( std::abs( dX(k,i,j) - X(k,i,j) ) > 0.5001F * qX.scale( k, i ) ) {
+                  std::ostringstream oss;
+                  oss << " Test: " << test_ << "\n"
+                      << " Error: Quantization error exceeds half a step at (" << k << "," << i << "," << j << ")\n"
+                      << " Details:\n"
+                      << "   Result: " << dX(k,i,j) << "\n"
+                      << "   Expected result: " << X(k,i,j) << "\n";
+                  throw std::runtime_error( oss.str() );
+               }
+            }
+         }
+      }
+
+      for( size_t i=0UL; i<W.rows(); ++i ) {
+         for( size_t j=0UL; j<W.columns(); ++j ) {
+            if( std::abs( dW(0UL,i,j) - W(0UL,i,j) ) > 0.5001F * qW.scale( 0UL, i ) ) {
+               std::ostringstream oss;
+               oss << " Test: " << test_ << "\n"
+                   << " Error: Symmetric quantization error exceeds half a step at (0," << i << "," << j << ")\n"
+                   << " Details:\n"
+                   << "   Result: " << dW(0UL,i,j) << "\n"
+                   << "   Expected result: " << W(0UL,i,j) << "\n";
+               throw std::runtime_error( oss.str() );
+            }
+         }
+      }
+
+      blaze::DynamicTensor<float> Z( 2UL, 3UL, 4UL, 0.0F );
+      const blaze::QuantizedTensor<int8_t> qZ( Z, blaze::quantizePerRow );
+
+      if( blaze::dequantize( qZ ) != Z ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Zero is not represented exactly\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Page-wise product of quantized tensors";
+
+      const blaze::QuantizedTensor<int8_t> qX( X, blaze::quantizePerRow );
+      const blaze::QuantizedTensor<int8_t> qW( W, blaze::quantizePerRow, true );
+      const blaze::QuantizedTensor<int8_t> qV( X );
+      const blaze::DynamicTensor<float> dX( blaze::dequantize( qX ) );
+      const blaze::DynamicTensor<float> dW( blaze::dequantize( qW ) );
+      const blaze::DynamicTensor<float> dV( blaze::dequantize( qV ) );
+
+      blaze::DynamicTensor<float> C;
+      blaze::DynamicTensor<double> D;
+      multTrans( C, qX, qW );  // Shared right-hand side page
+      multTrans( D, qX, qV );  // Page-wise right-hand side
+
+      if( C.pages() != 3UL || C.rows() != 5UL || C.columns() != 6UL ||
+          D.pages() != 3UL || D.rows() != 5UL || D.columns() != 5UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid result size\n"
+             << " Details:\n"
+             << "   Result:\n" << C << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      for( size_t k=0UL; k<X.pages(); ++k ) {
+         for( size_t i=0UL; i<X.rows(); ++i ) {
+            for( size_t j=0UL; j<C.columns(); ++j ) {
+               double refC( 0.0 ), refD( 0.0 );
+               for( size_t p=0UL; p<X.columns(); ++p ) {
+                  refC += double( dX(k,i,p) ) * dW(0UL,j,p);
+                  if( j < D.columns() ) refD += double( dX(k,i,p) ) * dV(k,j,p);
+               }
+               if( std::abs( C(k,i,j) - refC ) > 1E-4 * ( 1.0 + std::abs( refC ) ) ||
+                   ( j < D.columns() && std::abs( D(k,i,j) - refD ) > 1E-4 * ( 1.0 + std::abs( refD ) ) ) ) {
+                  std::ostringstream oss;
+                  oss << " Test: " << test_ << "\n"
+                      << " Error: Product failed at (" << k << "," << i << "," << j << ")\n"
+                      << " Details:\n"
+                      << "   Result: " << C(k,i,j) << "\n"
+                      << "   Expected result: " << refC << "\n";
+                  throw std::runtime_error( oss.str() );
+               }
+            }
+         }
+      }
+
+      try {
+         multTrans( C, qW, qX );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Product with mismatching number of pages succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the tensor threshold files.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of writing and reading the tunable tensor thresholds. In case
+// an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void GeneralTest::testRuntimeThresholds()
+{
+   test_ = "Writing and reading tensor thresholds";
+
+   const std::string path( "blazetest_thresholds.h" );
+
+   {
+      const blaze::TensorThresholds defaults( blaze::defaultTensorThresholds() );
+
+      if( defaults.smpDTensAssign != blaze::smpDTensAssignThreshold() ||
+          defaults.smpDTensDVecMult != blaze::smpDTensDVecMultThreshold() ||
+          defaults.smpDTensDMatSchur != blaze::smpDTensDMatSchurThreshold() ||
+          defaults.smpDArrAssign != blaze::smpDArrAssignThreshold() ||
+          defaults.dtensdvecmult != blaze::dtensDVecMultThreshold() ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Default thresholds differ from the active thresholds\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      std::ofstream file( path );
+      file << "// Tuned thresholds\n";
+      blaze::writeTensorThresholds( file, blaze::TensorThresholds{ 1000000UL, 1234UL, 56UL, 7890UL, 4321UL } );
+   }
+
+   blaze::TensorThresholds thresholds( blaze::defaultTensorThresholds() );
+
+   if( !blaze::readTensorThresholds( path, thresholds ) ||
+       thresholds.dtensdvecmult != 1000000UL || thresholds.smpDTensAssign != 1234UL ||
+       thresholds.smpDTensDVecMult != 56UL || thresholds.smpDTensDMatSchur != 7890UL ||
+       thresholds.smpDArrAssign != 4321UL ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Reading the thresholds failed\n"
+          << " Details:\n"
+          << "   Result: " << thresholds.dtensdvecmult << " " << thresholds.smpDTensAssign << " "
+          << thresholds.smpDTensDVecMult << " " << thresholds.smpDTensDMatSchur << " "
+          << thresholds.smpDArrAssign << "\n"
+          << "   Expected result: 1000000 1234 56 7890 4321\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   std::remove( path.c_str() );
+
+   if( blaze::readTensorThresholds( path, thresholds ) ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Reading a missing thresholds file succeeded\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the kernel tracing.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the kernel trace records and of the per-expression kernel
+// histogram. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void GeneralTest::testKernelTrace()
+{
+   test_ = "Kernel tracing";
+
+   blaze::resetKernelTraces();
+
+   blaze::DynamicTensor<int> tens( 2UL, 3UL, 4UL, 1 );
+
+#if BLAZE_USE_KERNEL_TRACING
+   {
+      blaze::KernelTrace trace( "test kernel", typeid( tens ), tens, 4UL );
+   }
+   {
+      blaze::KernelTrace trace( "test kernel", typeid( tens ), tens, 2UL );
+   }
+
+   const std::vector<blaze::KernelTraceRecord> records( blaze::kernelTraces() );
+
+   const auto rec( std::find_if( records.begin(), records.end(),
+                                 []( const blaze::KernelTraceRecord& r ) {
+                                    return r.kernel == "test kernel";
+                                 } ) );
+
+   if( records.size() != 1UL || rec == records.end() ||
+       rec->calls != 2UL || rec->elements != 48UL || rec->bytes != 48UL*sizeof(int) ||
+       rec->minElements != 24UL || rec->maxElements != 24UL || rec->threads != 4UL ||
+       rec->pages != 2UL || rec->rows != 3UL || rec->columns != 4UL ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Recording the kernel calls failed\n"
+          << " Details:\n"
+          << "   Number of records: " << records.size() << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   {
+      std::ostringstream oss;
+      blaze::dumpKernelTraces( oss );
+
+      if( oss.str().find( "test kernel" ) == std::string::npos ||
+          oss.str().find( "2x3x4" ) == std::string::npos ) {
+         std::ostringstream err;
+         err << " Test: " << test_ << "\n"
+             << " Error: Printing the kernel histogram failed\n"
+             << " Details:\n"
+             << "   Result:\n" << oss.str() << "\n";
+         throw std::runtime_error( err.str() );
+      }
+   }
+
+#endif
+
+   tens = tens + tens;
+
+#if !BLAZE_USE_KERNEL_TRACING
+   if( !blaze::kernelTraces().empty() ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Kernel calls recorded with deactivated kernel tracing\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   {
+      std::ostringstream oss;
+      blaze::dumpKernelTraces( oss );
+
+      if( oss.str().find( "deactivated" ) == std::string::npos ) {
+         std::ostringstream err;
+         err << " Test: " << test_ << "\n"
+             << " Error: Printing the kernel histogram failed\n"
+             << " Details:\n"
+             << "   Result:\n" << oss.str() << "\n";
+         throw std::runtime_error( err.str() );
+      }
+   }
+#endif
+
+   blaze::resetKernelTraces();
+
+   if( !blaze::kernelTraces().empty() ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Resetting the kernel traces failed\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the asynchronous tensor assignments.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the asynchronous assignment functions and of the chaining of
+// dependent assignments. In case an error is detected, a \a std::runtime_error exception is
+// thrown.
+*/
+void GeneralTest::testAsyncAssign()
+{
+   test_ = "Asynchronous tensor assignment";
+
+   {
+      blaze::DynamicTensor<int> A( 2UL, 3UL, 4UL, 1 );
+      blaze::DynamicTensor<int> B( 2UL, 3UL, 4UL, 2 );
+      blaze::DynamicTensor<int> C;
+      blaze::DynamicTensor<int> D( 2UL, 3UL, 4UL, 3 );
+
+      const blaze::AsyncFuture c( blaze::asyncAssign( C, A + B ) );
+      const blaze::AsyncFuture d( blaze::asyncSchurAssign( D, B ) );
+      const blaze::AsyncFuture e( blaze::asyncAddAssign( C, D, c, d ) );
+      const blaze::AsyncFuture f( blaze::asyncSubAssign( C, A, e ) );
+
+      f.get();
+
+      const blaze::DynamicTensor<int> expected( 2UL, 3UL, 4UL, 8 );
+
+      if( C != expected || D != ( B * 3 ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Chained asynchronous assignments failed\n"
+             << " Details:\n"
+             << "   Result:\n" << C << "\n"
+             << "   Expected result:\n" << expected << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      blaze::DynamicTensor<int> A( 2UL, 3UL, 4UL, 1 );
+      blaze::DynamicTensor<int> B( 1UL, 1UL, 1UL, 5 );
+
+      const blaze::AsyncFuture failed( blaze::asyncAddAssign( B, A ) );
+      const blaze::AsyncFuture skipped( blaze::asyncAssign( B, A, failed ) );
+
+      try {
+         skipped.get();
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Failed dependency not propagated\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+
+      if( B.pages() != 1UL || B.rows() != 1UL || B.columns() != 1UL || B(0,0,0) != 5 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Assignment performed despite failed dependency\n"
+             << " Details:\n"
+             << "   Result:\n" << B << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the fused multi-output assignment.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the fused assignment of several dense tensor expressions
+// and reductions via the assignAll() function. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void GeneralTest::testAssignAll()
+{
+   test_ = "Fused multi-output assignment";
+
+   blaze::DynamicTensor<double> A( 3UL, 4UL, 13UL );
+   blaze::DynamicTensor<double> B( 3UL, 4UL, 13UL );
+
+   for( size_t k=0UL; k<A.pages(); ++k ) {
+      for( size_t i=0UL; i<A.rows(); ++i ) {
+         for( size_t j=0UL; j<A.columns(); ++j ) {
+            A(k,i,j) = double( ( k*A.rows() + i )*A.columns() + j );
+            B(k,i,j) = double( j ) - 6.0;
+         }
+      }
+   }
+
+   {
+      blaze::DynamicTensor<double> C, D;
+      double s( 0.0 ), m( 0.0 );
+
+      blaze::assignAll( std::tie( C, D, s, m ), A + B, A % B,
+                        blaze::fusedSum( A + B ), blaze::fusedReduce( A, blaze::Max() ) );
+
+      const blaze::DynamicTensor<double> C2( A + B );
+      const blaze::DynamicTensor<double> D2( A % B );
+      const double s2( blaze::sum( A + B ) );
+      const double m2( blaze::max( A ) );
+
+      if( C != C2 || D != D2 || s != s2 || m != m2 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Fused assignment failed\n"
+             << " Details:\n"
+             << "   Result:   sum = " << s << ", max = " << m << "\n"
+             << "   Expected: sum = " << s2 << ", max = " << m2 << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      blaze::DynamicTensor<double> C;
+      blaze::DynamicTensor<double> A2( A );
+
+      const blaze::DynamicTensor<double> C2( A * 2.0 + B );
+
+      blaze::assignAll( std::tie( A2, C ), A2 * 2.0, A2 + B );
+
+      if( A2 != A * 2.0 || C != C2 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Fused assignment to an operand failed\n"
+             << " Details:\n"
+             << "   Result:\n" << C << "\n"
+             << "   Expected result:\n" << C2 << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   try {
+      blaze::DynamicTensor<double> C;
+      blaze::DynamicTensor<double> D( 1UL, 1UL, 1UL );
+      double s( 0.0 );
+
+      blaze::assignAll( std::tie( C, s ), A + B, blaze::fusedSum( D ) );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Fused assignment of differently sized tensors succeeded\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::invalid_argument& ) {}
+
+   {
+      blaze::DynamicTensor<double> C;
+      blaze::DynamicTensor<double> D( 3UL, 4UL, 13UL, 0.0 );
+      auto E = blaze::subtensor( D, 0UL, 0UL, 0UL, 1UL, 4UL, 13UL );
+
+      try {
+         blaze::assignAll( std::tie( C, E ), A + B, A * 2.0 );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Fused assignment to a non-resizable target succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+
+      if( C.pages() != 0UL || C.rows() != 0UL || C.columns() != 0UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Failed fused assignment resized a target\n"
+             << " Details:\n"
+             << "   Result: " << C.pages() << "x" << C.rows() << "x" << C.columns() << "\n"
+             << "   Expected result: 0x0x0\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the parallel and the axis-wise norms of dense tensors.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the norm functions for a tensor that is large enough to be
+// reduced in parallel and of the axis-wise l1Norm(), l2Norm() and maxNorm() functions. In case
+// an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void GeneralTest::testAxisNorms()
+{
+   test_ = "Parallel and axis-wise norms";
+
+   blaze::DynamicTensor<double> A( 6UL, 70UL, 301UL );
+
+   for( size_t k=0UL; k<A.pages(); ++k ) {
+      for( size_t i=0UL; i<A.rows(); ++i ) {
+         for( size_t j=0UL; j<A.columns(); ++j ) {
+            A(k,i,j) = double( ( k + 2UL*i + 3UL*j ) % 17UL ) - 8.0;
+         }
+      }
+   }
+
+   blaze::DynamicMatrix<double> R( A.pages(), A.rows(), 0.0 );
+   blaze::DynamicMatrix<double> C( A.pages(), A.columns(), 0.0 );
+   blaze::DynamicMatrix<double> P( A.rows(), A.columns(), 0.0 );
+   double sqr( 0.0 ), l1( 0.0 ), linf( 0.0 );
+
+   for( size_t k=0UL; k<A.pages(); ++k ) {
+      for( size_t i=0UL; i<A.rows(); ++i ) {
+         for( size_t j=0UL; j<A.columns(); ++j ) {
+            R(k,i) += A(k,i,j) * A(k,i,j);
+            C(k,j) += std::abs( A(k,i,j) );
+            P(i,j)  = blaze::max( P(i,j), std::abs( A(k,i,j) ) );
+            sqr    += A(k,i,j) * A(k,i,j);
+            l1     += std::abs( A(k,i,j) );
+            linf    = blaze::max( linf, std::abs( A(k,i,j) ) );
+         }
+      }
+   }
+
+   R = blaze::sqrt( R );
+
+   if( !blaze::equal( blaze::sqrNorm( A ), sqr ) ||
+       !blaze::equal( blaze::l2Norm( A ), std::sqrt( sqr ) ) ||
+       !blaze::equal( blaze::l1Norm( A ), l1 ) || blaze::maxNorm( A ) != linf ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Norm computation failed\n"
+          << " Details:\n"
+          << "   Result:   sqrNorm = " << blaze::sqrNorm( A ) << ", l1Norm = "
+          << blaze::l1Norm( A ) << ", maxNorm = " << blaze::maxNorm( A ) << "\n"
+          << "   Expected: sqrNorm = " << sqr << ", l1Norm = " << l1
+          << ", maxNorm = " << linf << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   {
+      const blaze::DynamicMatrix<double> R2( blaze::l2Norm<blaze::rowwise>( A ) );
+
+      if( R2 != R ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Rowwise l2Norm() failed\n"
+             << " Details:\n"
+             << "   Result:\n" << R2 << "\n"
+             << "   Expected result:\n" << R << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      const blaze::DynamicMatrix<double> C2( blaze::l1Norm<blaze::columnwise>( A ) );
+
+      if( C2 != C ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Columnwise l1Norm() failed\n"
+             << " Details:\n"
+             << "   Result:\n" << C2 << "\n"
+             << "   Expected result:\n" << C << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      const blaze::DynamicMatrix<double> P2( blaze::maxNorm<blaze::pagewise>( A ) );
+
+      if( P2 != P ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Pagewise maxNorm() failed\n"
+             << " Details:\n"
+             << "   Result:\n" << P2 << "\n"
+             << "   Expected result:\n" << P << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the accurate summation modes.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the Kahan-compensated, the pairwise and the widened summation
+// of a single precision tensor and of the corresponding norms. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void GeneralTest::testAccurateSum()
+{
+   test_ = "Accurate summation";
+
+   blaze::DynamicTensor<float> A( 4UL, 60UL, 1001UL );
+
+   double ref( 0.0 ), sqr( 0.0 );
+
+   for( size_t k=0UL; k<A.pages(); ++k ) {
+      for( size_t i=0UL; i<A.rows(); ++i ) {
+         for( size_t j=0UL; j<A.columns(); ++j ) {
+            A(k,i,j) = 0.1F + float( ( k + i + j ) % 7UL ) * 0.01F;
+            ref += double( A(k,i,j) );
+            sqr += double( A(k,i,j) ) * double( A(k,i,j) );
+         }
+      }
+   }
+
+   const double s1( blaze::sum( A, blaze::kahan ) );
+   const double s2( blaze::sum( A, blaze::pairwise ) );
+   const double s3( blaze::sum( A, blaze::widened<double> ) );
+
+   if( std::abs( s1 - ref ) > 1E-6 * ref || std::abs( s2 - ref ) > 1E-5 * ref ||
+       std::abs( s3 - ref ) > 1E-5 * ref ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Accurate summation failed\n"
+          << " Details:\n"
+          << "   Result:   kahan = " << s1 << ", pairwise = " << s2 << ", widened = " << s3 << "\n"
+          << "   Expected: " << ref << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   const double n1( blaze::sqrNorm( A, blaze::widened<double> ) );
+   const double n2( blaze::l2Norm( A, blaze::kahan ) );
+
+   if( std::abs( n1 - sqr ) > 1E-5 * sqr ||
+       std::abs( n2 - std::sqrt( sqr ) ) > 1E-6 * std::sqrt( sqr ) ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Accurate norm computation failed\n"
+          << " Details:\n"
+          << "   Result:   sqrNorm = " << n1 << ", l2Norm = " << n2 << "\n"
+          << "   Expected: sqrNorm = " << sqr << ", l2Norm = " << std::sqrt( sqr ) << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the counter-based random initialization of dense tensors.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c randomize() functions for dense tensors and subtensors.
+// The generated values are expected to depend on the seed only and to lie in the range of the
+// given distribution. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void GeneralTest::testParallelRandom()
+{
+   test_ = "Parallel random initialization";
+
+   {
+      blaze::DynamicTensor<double> A( 3UL, 70UL, 517UL );
+      blaze::DynamicTensor<double> B( 3UL, 70UL, 517UL );
+      blaze::DynamicTensor<double> C( 5UL, 72UL, 520UL, 0.0 );
+
+      const std::uniform_real_distribution<double> dist( -2.0, 3.0 );
+
+      blaze::randomize( A, dist, 42UL );
+      blaze::randomize( B, dist, 42UL );
+      blaze::randomize( blaze::subtensor( C, 1UL, 2UL, 3UL, 3UL, 70UL, 517UL ), dist, 42UL );
+
+      if( !( A == B ) || !( A == blaze::subtensor( C, 1UL, 2UL, 3UL, 3UL, 70UL, 517UL ) ) ||
+          C(0UL,0UL,0UL) != 0.0 || C(4UL,71UL,519UL) != 0.0 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Random initialization is not reproducible\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      if( blaze::min( A ) < -2.0 || blaze::max( A ) >= 3.0 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Random values out of range\n"
+             << " Details:\n"
+             << "   Result:   [" << blaze::min( A ) << "," << blaze::max( A ) << "]\n"
+             << "   Expected: [-2,3)\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      blaze::randomize( B, dist, 43UL );
+
+      if( A == B ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Different seeds produced identical values\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      blaze::DynamicTensor<float> A( 4UL, 50UL, 333UL );
+
+      blaze::randomize( A, std::normal_distribution<float>( 1.0F, 2.0F ), 7UL );
+
+      const size_t n( A.pages() * A.rows() * A.columns() );
+      const double mean( blaze::sum( A, blaze::widened<double> ) / double( n ) );
+
+      if( std::abs( mean - 1.0 ) > 0.05 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Normal distribution has wrong mean\n"
+             << " Details:\n"
+             << "   Result:   " << mean << "\n"
+             << "   Expected: 1\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      blaze::DynamicTensor<int> A( 2UL, 10UL, 100UL );
+
+      blaze::randomize( A, std::uniform_int_distribution<int>( -3, 3 ), 1UL );
+
+      if( blaze::min( A ) != -3 || blaze::max( A ) != 3 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Integer random values out of range\n"
+             << " Details:\n"
+             << "   Result:   [" << blaze::min( A ) << "," << blaze::max( A ) << "]\n"
+             << "   Expected: [-3,3]\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the early-exit comparison and element check kernels.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the equality comparison, the \c isUniform(), \c isZero(),
+// \c isnan(), \c isfinite() and \c allclose() functions for tensors that are large enough to be
+// checked in parallel. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void GeneralTest::testComparison()
+{
+   test_ = "Early-exit comparison";
+
+   {
+      blaze::DynamicTensor<double> A( 4UL, 50UL, 203UL );
+      blaze::randomize( A, std::uniform_real_distribution<double>( 1.0, 2.0 ), 3UL );
+
+      blaze::DynamicTensor<double> B( A );
+      B(3UL,49UL,202UL) *= 1.0 + 1E-12;
+
+      if( !( A == B ) || blaze::equal<blaze::strict>( A, B ) || !blaze::allclose( A, B ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Comparison of nearly identical tensors failed\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      B(2UL,25UL,100UL) *= 1.0 + 1E-4;
+
+      if( A == B || blaze::allclose( A, B ) || !blaze::allclose( A, B, 1E-3, 0.0 ) ||
+          !( A != B ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Comparison of different tensors failed\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      B(2UL,25UL,100UL) = std::numeric_limits<double>::quiet_NaN();
+
+      if( blaze::allclose( B, B ) || !blaze::isnan( B ) || blaze::isfinite( B ) ||
+          blaze::isnan( A ) || !blaze::isfinite( A ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Not-a-number check failed\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      B = A;
+      A(1UL,0UL,7UL) = B(1UL,0UL,7UL) = std::numeric_limits<double>::infinity();
+
+      if( !blaze::allclose( A, B ) || blaze::isnan( A ) || blaze::isfinite( A ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Infinity check failed\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      blaze::DynamicTensor<float> U( 3UL, 40UL, 301UL, 2.5F );
+      blaze::DynamicTensor<float> Z( 3UL, 40UL, 301UL, 0.0F );
+
+      if( !blaze::isUniform( U ) || !blaze::isZero( Z ) || blaze::isZero( U ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Uniform/zero check failed\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      U(1UL,39UL,300UL) = 3.0F;
+      Z(2UL,0UL,150UL) = 1.0F;
+
+      if( blaze::isUniform( U ) || blaze::isZero( Z ) || blaze::isZero<blaze::strict>( Z ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Non-uniform/non-zero check failed\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      const float  ulp( std::numeric_limits<float>::epsilon() );
+      const double atol( ulp * ( 1.0 - 1E-9 ) );
+
+      blaze::DynamicTensor<float> A( 2UL, 30UL, 64UL, 1.0F );
+      blaze::DynamicTensor<float> B( A );
+      B(1UL,17UL,5UL) += ulp;
+
+      if( blaze::allclose( A, B, 0.0, atol ) || !blaze::allclose( A, B, 0.0, double( ulp ) ) ||
+          blaze::allclose( B, A, 0.0, atol ) || !blaze::allclose( B, A, 0.0, double( ulp ) ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Closeness check at the tolerance boundary failed\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      blaze::DynamicArray<3UL, double> X( 4UL, 6UL, 51UL );
+      randomize( X, 1.0, 2.0 );
+
+      blaze::DynamicArray<3UL, double> Y( X );
+      Y(3UL,5UL,50UL) *= 1.0 + 1E-4;
+
+      blaze::DynamicArray<3UL, double> Z( blaze::init_from_value, 0.0, 4UL, 6UL, 51UL );
+
+      if( blaze::allclose( X, Y ) || !blaze::allclose( X, Y, 1E-3, 0.0 ) || X == Y ||
+          !blaze::isZero( Z ) || blaze::isZero( X ) || !blaze::isfinite( X ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Array comparison failed\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      blaze::DynamicTensor<unsigned int> A( 2UL, 30UL, 40UL, 5U );
+      blaze::DynamicTensor<unsigned int> B( 2UL, 30UL, 40UL, 5U );
+      A(1UL,29UL,39UL) = 3U;
+
+      if( blaze::allclose( A, B, 0.0, 1.0 ) || !blaze::allclose( A, B, 0.0, 2.0 ) ||
+          blaze::allclose( B, A, 0.0, 1.0 ) || !blaze::allclose( B, A, 0.0, 2.0 ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Closeness check of unsigned tensors failed\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      using cplx = blaze::complex<double>;
+
+      blaze::DynamicTensor<cplx> A( 2UL, 30UL, 40UL, cplx( 1.0, 2.0 ) );
+      blaze::DynamicTensor<cplx> B( A );
+      B(1UL,29UL,39UL) = cplx( 1.0, 2.0 + 1E-10 );
+
+      if( !blaze::allclose( A, B ) || !blaze::isfinite( A ) || blaze::allclose( A, B, 0.0, 1E-12 ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Closeness check of complex tensors failed\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      B(0UL,0UL,0UL) = cplx( 1.0, std::numeric_limits<double>::infinity() );
+
+      if( blaze::allclose( A, B ) || blaze::isfinite( B ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Infinity check of complex tensors failed\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
 } // namespace densetensor
 
 } // namespace mathtest